@@ -138,15 +138,29 @@ AssociateCreatedArtifactOutcome MigrationHubClient::AssociateCreatedArtifact(con
 
 AssociateCreatedArtifactOutcomeCallable MigrationHubClient::AssociateCreatedArtifactCallable(const AssociateCreatedArtifactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateCreatedArtifactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateCreatedArtifact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateCreatedArtifactOutcome > >(ALLOCATION_TAG);
+  AssociateCreatedArtifactAsync(request, [promise](const MigrationHubClient*, const AssociateCreatedArtifactRequest&, const AssociateCreatedArtifactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::AssociateCreatedArtifactAsync(const AssociateCreatedArtifactRequest& request, const AssociateCreatedArtifactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateCreatedArtifactAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateCreatedArtifactRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateCreatedArtifactOutcome(AssociateCreatedArtifactResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateCreatedArtifactOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::AssociateCreatedArtifactAsyncHelper(const AssociateCreatedArtifactRequest& request, const AssociateCreatedArtifactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,15 +187,29 @@ AssociateDiscoveredResourceOutcome MigrationHubClient::AssociateDiscoveredResour
 
 AssociateDiscoveredResourceOutcomeCallable MigrationHubClient::AssociateDiscoveredResourceCallable(const AssociateDiscoveredResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateDiscoveredResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateDiscoveredResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateDiscoveredResourceOutcome > >(ALLOCATION_TAG);
+  AssociateDiscoveredResourceAsync(request, [promise](const MigrationHubClient*, const AssociateDiscoveredResourceRequest&, const AssociateDiscoveredResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::AssociateDiscoveredResourceAsync(const AssociateDiscoveredResourceRequest& request, const AssociateDiscoveredResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateDiscoveredResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateDiscoveredResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateDiscoveredResourceOutcome(AssociateDiscoveredResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateDiscoveredResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::AssociateDiscoveredResourceAsyncHelper(const AssociateDiscoveredResourceRequest& request, const AssociateDiscoveredResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -208,15 +236,29 @@ CreateProgressUpdateStreamOutcome MigrationHubClient::CreateProgressUpdateStream
 
 CreateProgressUpdateStreamOutcomeCallable MigrationHubClient::CreateProgressUpdateStreamCallable(const CreateProgressUpdateStreamRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateProgressUpdateStreamOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateProgressUpdateStream(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateProgressUpdateStreamOutcome > >(ALLOCATION_TAG);
+  CreateProgressUpdateStreamAsync(request, [promise](const MigrationHubClient*, const CreateProgressUpdateStreamRequest&, const CreateProgressUpdateStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::CreateProgressUpdateStreamAsync(const CreateProgressUpdateStreamRequest& request, const CreateProgressUpdateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateProgressUpdateStreamAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateProgressUpdateStreamRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateProgressUpdateStreamOutcome(CreateProgressUpdateStreamResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateProgressUpdateStreamOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::CreateProgressUpdateStreamAsyncHelper(const CreateProgressUpdateStreamRequest& request, const CreateProgressUpdateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -243,15 +285,29 @@ DeleteProgressUpdateStreamOutcome MigrationHubClient::DeleteProgressUpdateStream
 
 DeleteProgressUpdateStreamOutcomeCallable MigrationHubClient::DeleteProgressUpdateStreamCallable(const DeleteProgressUpdateStreamRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteProgressUpdateStreamOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteProgressUpdateStream(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteProgressUpdateStreamOutcome > >(ALLOCATION_TAG);
+  DeleteProgressUpdateStreamAsync(request, [promise](const MigrationHubClient*, const DeleteProgressUpdateStreamRequest&, const DeleteProgressUpdateStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::DeleteProgressUpdateStreamAsync(const DeleteProgressUpdateStreamRequest& request, const DeleteProgressUpdateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteProgressUpdateStreamAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteProgressUpdateStreamRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteProgressUpdateStreamOutcome(DeleteProgressUpdateStreamResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteProgressUpdateStreamOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::DeleteProgressUpdateStreamAsyncHelper(const DeleteProgressUpdateStreamRequest& request, const DeleteProgressUpdateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -278,15 +334,29 @@ DescribeApplicationStateOutcome MigrationHubClient::DescribeApplicationState(con
 
 DescribeApplicationStateOutcomeCallable MigrationHubClient::DescribeApplicationStateCallable(const DescribeApplicationStateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeApplicationStateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeApplicationState(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeApplicationStateOutcome > >(ALLOCATION_TAG);
+  DescribeApplicationStateAsync(request, [promise](const MigrationHubClient*, const DescribeApplicationStateRequest&, const DescribeApplicationStateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::DescribeApplicationStateAsync(const DescribeApplicationStateRequest& request, const DescribeApplicationStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeApplicationStateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeApplicationStateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeApplicationStateOutcome(DescribeApplicationStateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeApplicationStateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::DescribeApplicationStateAsyncHelper(const DescribeApplicationStateRequest& request, const DescribeApplicationStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -313,15 +383,29 @@ DescribeMigrationTaskOutcome MigrationHubClient::DescribeMigrationTask(const Des
 
 DescribeMigrationTaskOutcomeCallable MigrationHubClient::DescribeMigrationTaskCallable(const DescribeMigrationTaskRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeMigrationTaskOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeMigrationTask(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeMigrationTaskOutcome > >(ALLOCATION_TAG);
+  DescribeMigrationTaskAsync(request, [promise](const MigrationHubClient*, const DescribeMigrationTaskRequest&, const DescribeMigrationTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::DescribeMigrationTaskAsync(const DescribeMigrationTaskRequest& request, const DescribeMigrationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeMigrationTaskAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeMigrationTaskRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeMigrationTaskOutcome(DescribeMigrationTaskResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeMigrationTaskOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::DescribeMigrationTaskAsyncHelper(const DescribeMigrationTaskRequest& request, const DescribeMigrationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -348,15 +432,29 @@ DisassociateCreatedArtifactOutcome MigrationHubClient::DisassociateCreatedArtifa
 
 DisassociateCreatedArtifactOutcomeCallable MigrationHubClient::DisassociateCreatedArtifactCallable(const DisassociateCreatedArtifactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateCreatedArtifactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateCreatedArtifact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateCreatedArtifactOutcome > >(ALLOCATION_TAG);
+  DisassociateCreatedArtifactAsync(request, [promise](const MigrationHubClient*, const DisassociateCreatedArtifactRequest&, const DisassociateCreatedArtifactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::DisassociateCreatedArtifactAsync(const DisassociateCreatedArtifactRequest& request, const DisassociateCreatedArtifactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateCreatedArtifactAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateCreatedArtifactRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateCreatedArtifactOutcome(DisassociateCreatedArtifactResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateCreatedArtifactOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::DisassociateCreatedArtifactAsyncHelper(const DisassociateCreatedArtifactRequest& request, const DisassociateCreatedArtifactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -383,15 +481,29 @@ DisassociateDiscoveredResourceOutcome MigrationHubClient::DisassociateDiscovered
 
 DisassociateDiscoveredResourceOutcomeCallable MigrationHubClient::DisassociateDiscoveredResourceCallable(const DisassociateDiscoveredResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateDiscoveredResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateDiscoveredResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateDiscoveredResourceOutcome > >(ALLOCATION_TAG);
+  DisassociateDiscoveredResourceAsync(request, [promise](const MigrationHubClient*, const DisassociateDiscoveredResourceRequest&, const DisassociateDiscoveredResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::DisassociateDiscoveredResourceAsync(const DisassociateDiscoveredResourceRequest& request, const DisassociateDiscoveredResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateDiscoveredResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateDiscoveredResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateDiscoveredResourceOutcome(DisassociateDiscoveredResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateDiscoveredResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::DisassociateDiscoveredResourceAsyncHelper(const DisassociateDiscoveredResourceRequest& request, const DisassociateDiscoveredResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -418,15 +530,29 @@ ImportMigrationTaskOutcome MigrationHubClient::ImportMigrationTask(const ImportM
 
 ImportMigrationTaskOutcomeCallable MigrationHubClient::ImportMigrationTaskCallable(const ImportMigrationTaskRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ImportMigrationTaskOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ImportMigrationTask(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ImportMigrationTaskOutcome > >(ALLOCATION_TAG);
+  ImportMigrationTaskAsync(request, [promise](const MigrationHubClient*, const ImportMigrationTaskRequest&, const ImportMigrationTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::ImportMigrationTaskAsync(const ImportMigrationTaskRequest& request, const ImportMigrationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ImportMigrationTaskAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ImportMigrationTaskRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ImportMigrationTaskOutcome(ImportMigrationTaskResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ImportMigrationTaskOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::ImportMigrationTaskAsyncHelper(const ImportMigrationTaskRequest& request, const ImportMigrationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -453,15 +579,29 @@ ListCreatedArtifactsOutcome MigrationHubClient::ListCreatedArtifacts(const ListC
 
 ListCreatedArtifactsOutcomeCallable MigrationHubClient::ListCreatedArtifactsCallable(const ListCreatedArtifactsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListCreatedArtifactsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCreatedArtifacts(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListCreatedArtifactsOutcome > >(ALLOCATION_TAG);
+  ListCreatedArtifactsAsync(request, [promise](const MigrationHubClient*, const ListCreatedArtifactsRequest&, const ListCreatedArtifactsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::ListCreatedArtifactsAsync(const ListCreatedArtifactsRequest& request, const ListCreatedArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListCreatedArtifactsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListCreatedArtifactsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCreatedArtifactsOutcome(ListCreatedArtifactsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCreatedArtifactsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::ListCreatedArtifactsAsyncHelper(const ListCreatedArtifactsRequest& request, const ListCreatedArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -488,15 +628,29 @@ ListDiscoveredResourcesOutcome MigrationHubClient::ListDiscoveredResources(const
 
 ListDiscoveredResourcesOutcomeCallable MigrationHubClient::ListDiscoveredResourcesCallable(const ListDiscoveredResourcesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDiscoveredResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDiscoveredResources(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListDiscoveredResourcesOutcome > >(ALLOCATION_TAG);
+  ListDiscoveredResourcesAsync(request, [promise](const MigrationHubClient*, const ListDiscoveredResourcesRequest&, const ListDiscoveredResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::ListDiscoveredResourcesAsync(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListDiscoveredResourcesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListDiscoveredResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDiscoveredResourcesOutcome(ListDiscoveredResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDiscoveredResourcesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::ListDiscoveredResourcesAsyncHelper(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -523,15 +677,29 @@ ListMigrationTasksOutcome MigrationHubClient::ListMigrationTasks(const ListMigra
 
 ListMigrationTasksOutcomeCallable MigrationHubClient::ListMigrationTasksCallable(const ListMigrationTasksRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListMigrationTasksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListMigrationTasks(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListMigrationTasksOutcome > >(ALLOCATION_TAG);
+  ListMigrationTasksAsync(request, [promise](const MigrationHubClient*, const ListMigrationTasksRequest&, const ListMigrationTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::ListMigrationTasksAsync(const ListMigrationTasksRequest& request, const ListMigrationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListMigrationTasksAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListMigrationTasksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListMigrationTasksOutcome(ListMigrationTasksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListMigrationTasksOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::ListMigrationTasksAsyncHelper(const ListMigrationTasksRequest& request, const ListMigrationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,15 +726,29 @@ ListProgressUpdateStreamsOutcome MigrationHubClient::ListProgressUpdateStreams(c
 
 ListProgressUpdateStreamsOutcomeCallable MigrationHubClient::ListProgressUpdateStreamsCallable(const ListProgressUpdateStreamsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListProgressUpdateStreamsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListProgressUpdateStreams(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListProgressUpdateStreamsOutcome > >(ALLOCATION_TAG);
+  ListProgressUpdateStreamsAsync(request, [promise](const MigrationHubClient*, const ListProgressUpdateStreamsRequest&, const ListProgressUpdateStreamsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::ListProgressUpdateStreamsAsync(const ListProgressUpdateStreamsRequest& request, const ListProgressUpdateStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListProgressUpdateStreamsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListProgressUpdateStreamsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListProgressUpdateStreamsOutcome(ListProgressUpdateStreamsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListProgressUpdateStreamsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::ListProgressUpdateStreamsAsyncHelper(const ListProgressUpdateStreamsRequest& request, const ListProgressUpdateStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -593,15 +775,29 @@ NotifyApplicationStateOutcome MigrationHubClient::NotifyApplicationState(const N
 
 NotifyApplicationStateOutcomeCallable MigrationHubClient::NotifyApplicationStateCallable(const NotifyApplicationStateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< NotifyApplicationStateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->NotifyApplicationState(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< NotifyApplicationStateOutcome > >(ALLOCATION_TAG);
+  NotifyApplicationStateAsync(request, [promise](const MigrationHubClient*, const NotifyApplicationStateRequest&, const NotifyApplicationStateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::NotifyApplicationStateAsync(const NotifyApplicationStateRequest& request, const NotifyApplicationStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->NotifyApplicationStateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<NotifyApplicationStateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, NotifyApplicationStateOutcome(NotifyApplicationStateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, NotifyApplicationStateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::NotifyApplicationStateAsyncHelper(const NotifyApplicationStateRequest& request, const NotifyApplicationStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -628,15 +824,29 @@ NotifyMigrationTaskStateOutcome MigrationHubClient::NotifyMigrationTaskState(con
 
 NotifyMigrationTaskStateOutcomeCallable MigrationHubClient::NotifyMigrationTaskStateCallable(const NotifyMigrationTaskStateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< NotifyMigrationTaskStateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->NotifyMigrationTaskState(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< NotifyMigrationTaskStateOutcome > >(ALLOCATION_TAG);
+  NotifyMigrationTaskStateAsync(request, [promise](const MigrationHubClient*, const NotifyMigrationTaskStateRequest&, const NotifyMigrationTaskStateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::NotifyMigrationTaskStateAsync(const NotifyMigrationTaskStateRequest& request, const NotifyMigrationTaskStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->NotifyMigrationTaskStateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<NotifyMigrationTaskStateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, NotifyMigrationTaskStateOutcome(NotifyMigrationTaskStateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, NotifyMigrationTaskStateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::NotifyMigrationTaskStateAsyncHelper(const NotifyMigrationTaskStateRequest& request, const NotifyMigrationTaskStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -663,15 +873,29 @@ PutResourceAttributesOutcome MigrationHubClient::PutResourceAttributes(const Put
 
 PutResourceAttributesOutcomeCallable MigrationHubClient::PutResourceAttributesCallable(const PutResourceAttributesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< PutResourceAttributesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutResourceAttributes(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< PutResourceAttributesOutcome > >(ALLOCATION_TAG);
+  PutResourceAttributesAsync(request, [promise](const MigrationHubClient*, const PutResourceAttributesRequest&, const PutResourceAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void MigrationHubClient::PutResourceAttributesAsync(const PutResourceAttributesRequest& request, const PutResourceAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutResourceAttributesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutResourceAttributesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutResourceAttributesOutcome(PutResourceAttributesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutResourceAttributesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void MigrationHubClient::PutResourceAttributesAsyncHelper(const PutResourceAttributesRequest& request, const PutResourceAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -142,15 +142,29 @@ CreateCertificateAuthorityOutcome ACMPCAClient::CreateCertificateAuthority(const
 
 CreateCertificateAuthorityOutcomeCallable ACMPCAClient::CreateCertificateAuthorityCallable(const CreateCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  CreateCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const CreateCertificateAuthorityRequest&, const CreateCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::CreateCertificateAuthorityAsync(const CreateCertificateAuthorityRequest& request, const CreateCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateCertificateAuthorityOutcome(CreateCertificateAuthorityResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::CreateCertificateAuthorityAsyncHelper(const CreateCertificateAuthorityRequest& request, const CreateCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -177,15 +191,29 @@ CreateCertificateAuthorityAuditReportOutcome ACMPCAClient::CreateCertificateAuth
 
 CreateCertificateAuthorityAuditReportOutcomeCallable ACMPCAClient::CreateCertificateAuthorityAuditReportCallable(const CreateCertificateAuthorityAuditReportRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateCertificateAuthorityAuditReportOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCertificateAuthorityAuditReport(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateCertificateAuthorityAuditReportOutcome > >(ALLOCATION_TAG);
+  CreateCertificateAuthorityAuditReportAsync(request, [promise](const ACMPCAClient*, const CreateCertificateAuthorityAuditReportRequest&, const CreateCertificateAuthorityAuditReportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::CreateCertificateAuthorityAuditReportAsync(const CreateCertificateAuthorityAuditReportRequest& request, const CreateCertificateAuthorityAuditReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateCertificateAuthorityAuditReportAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateCertificateAuthorityAuditReportRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateCertificateAuthorityAuditReportOutcome(CreateCertificateAuthorityAuditReportResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateCertificateAuthorityAuditReportOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::CreateCertificateAuthorityAuditReportAsyncHelper(const CreateCertificateAuthorityAuditReportRequest& request, const CreateCertificateAuthorityAuditReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -212,15 +240,29 @@ CreatePermissionOutcome ACMPCAClient::CreatePermission(const CreatePermissionReq
 
 CreatePermissionOutcomeCallable ACMPCAClient::CreatePermissionCallable(const CreatePermissionRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreatePermissionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreatePermission(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreatePermissionOutcome > >(ALLOCATION_TAG);
+  CreatePermissionAsync(request, [promise](const ACMPCAClient*, const CreatePermissionRequest&, const CreatePermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::CreatePermissionAsync(const CreatePermissionRequest& request, const CreatePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreatePermissionAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreatePermissionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreatePermissionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreatePermissionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::CreatePermissionAsyncHelper(const CreatePermissionRequest& request, const CreatePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -247,15 +289,29 @@ DeleteCertificateAuthorityOutcome ACMPCAClient::DeleteCertificateAuthority(const
 
 DeleteCertificateAuthorityOutcomeCallable ACMPCAClient::DeleteCertificateAuthorityCallable(const DeleteCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  DeleteCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const DeleteCertificateAuthorityRequest&, const DeleteCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::DeleteCertificateAuthorityAsync(const DeleteCertificateAuthorityRequest& request, const DeleteCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCertificateAuthorityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::DeleteCertificateAuthorityAsyncHelper(const DeleteCertificateAuthorityRequest& request, const DeleteCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -282,15 +338,29 @@ DeletePermissionOutcome ACMPCAClient::DeletePermission(const DeletePermissionReq
 
 DeletePermissionOutcomeCallable ACMPCAClient::DeletePermissionCallable(const DeletePermissionRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeletePermissionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePermission(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeletePermissionOutcome > >(ALLOCATION_TAG);
+  DeletePermissionAsync(request, [promise](const ACMPCAClient*, const DeletePermissionRequest&, const DeletePermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::DeletePermissionAsync(const DeletePermissionRequest& request, const DeletePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeletePermissionAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeletePermissionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeletePermissionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeletePermissionOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::DeletePermissionAsyncHelper(const DeletePermissionRequest& request, const DeletePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -317,15 +387,29 @@ DescribeCertificateAuthorityOutcome ACMPCAClient::DescribeCertificateAuthority(c
 
 DescribeCertificateAuthorityOutcomeCallable ACMPCAClient::DescribeCertificateAuthorityCallable(const DescribeCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  DescribeCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const DescribeCertificateAuthorityRequest&, const DescribeCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::DescribeCertificateAuthorityAsync(const DescribeCertificateAuthorityRequest& request, const DescribeCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeCertificateAuthorityOutcome(DescribeCertificateAuthorityResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::DescribeCertificateAuthorityAsyncHelper(const DescribeCertificateAuthorityRequest& request, const DescribeCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -352,15 +436,29 @@ DescribeCertificateAuthorityAuditReportOutcome ACMPCAClient::DescribeCertificate
 
 DescribeCertificateAuthorityAuditReportOutcomeCallable ACMPCAClient::DescribeCertificateAuthorityAuditReportCallable(const DescribeCertificateAuthorityAuditReportRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeCertificateAuthorityAuditReportOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeCertificateAuthorityAuditReport(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeCertificateAuthorityAuditReportOutcome > >(ALLOCATION_TAG);
+  DescribeCertificateAuthorityAuditReportAsync(request, [promise](const ACMPCAClient*, const DescribeCertificateAuthorityAuditReportRequest&, const DescribeCertificateAuthorityAuditReportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::DescribeCertificateAuthorityAuditReportAsync(const DescribeCertificateAuthorityAuditReportRequest& request, const DescribeCertificateAuthorityAuditReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificateAuthorityAuditReportAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeCertificateAuthorityAuditReportRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeCertificateAuthorityAuditReportOutcome(DescribeCertificateAuthorityAuditReportResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeCertificateAuthorityAuditReportOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::DescribeCertificateAuthorityAuditReportAsyncHelper(const DescribeCertificateAuthorityAuditReportRequest& request, const DescribeCertificateAuthorityAuditReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -387,15 +485,29 @@ GetCertificateOutcome ACMPCAClient::GetCertificate(const GetCertificateRequest&
 
 GetCertificateOutcomeCallable ACMPCAClient::GetCertificateCallable(const GetCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetCertificateOutcome > >(ALLOCATION_TAG);
+  GetCertificateAsync(request, [promise](const ACMPCAClient*, const GetCertificateRequest&, const GetCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::GetCertificateAsync(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(GetCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::GetCertificateAsyncHelper(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -422,15 +534,29 @@ GetCertificateAuthorityCertificateOutcome ACMPCAClient::GetCertificateAuthorityC
 
 GetCertificateAuthorityCertificateOutcomeCallable ACMPCAClient::GetCertificateAuthorityCertificateCallable(const GetCertificateAuthorityCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCertificateAuthorityCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCertificateAuthorityCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetCertificateAuthorityCertificateOutcome > >(ALLOCATION_TAG);
+  GetCertificateAuthorityCertificateAsync(request, [promise](const ACMPCAClient*, const GetCertificateAuthorityCertificateRequest&, const GetCertificateAuthorityCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::GetCertificateAuthorityCertificateAsync(const GetCertificateAuthorityCertificateRequest& request, const GetCertificateAuthorityCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetCertificateAuthorityCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetCertificateAuthorityCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCertificateAuthorityCertificateOutcome(GetCertificateAuthorityCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCertificateAuthorityCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::GetCertificateAuthorityCertificateAsyncHelper(const GetCertificateAuthorityCertificateRequest& request, const GetCertificateAuthorityCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -457,15 +583,29 @@ GetCertificateAuthorityCsrOutcome ACMPCAClient::GetCertificateAuthorityCsr(const
 
 GetCertificateAuthorityCsrOutcomeCallable ACMPCAClient::GetCertificateAuthorityCsrCallable(const GetCertificateAuthorityCsrRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCertificateAuthorityCsrOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCertificateAuthorityCsr(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetCertificateAuthorityCsrOutcome > >(ALLOCATION_TAG);
+  GetCertificateAuthorityCsrAsync(request, [promise](const ACMPCAClient*, const GetCertificateAuthorityCsrRequest&, const GetCertificateAuthorityCsrOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::GetCertificateAuthorityCsrAsync(const GetCertificateAuthorityCsrRequest& request, const GetCertificateAuthorityCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetCertificateAuthorityCsrAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetCertificateAuthorityCsrRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCertificateAuthorityCsrOutcome(GetCertificateAuthorityCsrResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCertificateAuthorityCsrOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::GetCertificateAuthorityCsrAsyncHelper(const GetCertificateAuthorityCsrRequest& request, const GetCertificateAuthorityCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -492,15 +632,29 @@ ImportCertificateAuthorityCertificateOutcome ACMPCAClient::ImportCertificateAuth
 
 ImportCertificateAuthorityCertificateOutcomeCallable ACMPCAClient::ImportCertificateAuthorityCertificateCallable(const ImportCertificateAuthorityCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ImportCertificateAuthorityCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ImportCertificateAuthorityCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ImportCertificateAuthorityCertificateOutcome > >(ALLOCATION_TAG);
+  ImportCertificateAuthorityCertificateAsync(request, [promise](const ACMPCAClient*, const ImportCertificateAuthorityCertificateRequest&, const ImportCertificateAuthorityCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::ImportCertificateAuthorityCertificateAsync(const ImportCertificateAuthorityCertificateRequest& request, const ImportCertificateAuthorityCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ImportCertificateAuthorityCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ImportCertificateAuthorityCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ImportCertificateAuthorityCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ImportCertificateAuthorityCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::ImportCertificateAuthorityCertificateAsyncHelper(const ImportCertificateAuthorityCertificateRequest& request, const ImportCertificateAuthorityCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,15 +681,29 @@ IssueCertificateOutcome ACMPCAClient::IssueCertificate(const IssueCertificateReq
 
 IssueCertificateOutcomeCallable ACMPCAClient::IssueCertificateCallable(const IssueCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< IssueCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->IssueCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< IssueCertificateOutcome > >(ALLOCATION_TAG);
+  IssueCertificateAsync(request, [promise](const ACMPCAClient*, const IssueCertificateRequest&, const IssueCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::IssueCertificateAsync(const IssueCertificateRequest& request, const IssueCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->IssueCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<IssueCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, IssueCertificateOutcome(IssueCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, IssueCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::IssueCertificateAsyncHelper(const IssueCertificateRequest& request, const IssueCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -562,15 +730,29 @@ ListCertificateAuthoritiesOutcome ACMPCAClient::ListCertificateAuthorities(const
 
 ListCertificateAuthoritiesOutcomeCallable ACMPCAClient::ListCertificateAuthoritiesCallable(const ListCertificateAuthoritiesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListCertificateAuthoritiesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCertificateAuthorities(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListCertificateAuthoritiesOutcome > >(ALLOCATION_TAG);
+  ListCertificateAuthoritiesAsync(request, [promise](const ACMPCAClient*, const ListCertificateAuthoritiesRequest&, const ListCertificateAuthoritiesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::ListCertificateAuthoritiesAsync(const ListCertificateAuthoritiesRequest& request, const ListCertificateAuthoritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListCertificateAuthoritiesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListCertificateAuthoritiesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCertificateAuthoritiesOutcome(ListCertificateAuthoritiesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCertificateAuthoritiesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::ListCertificateAuthoritiesAsyncHelper(const ListCertificateAuthoritiesRequest& request, const ListCertificateAuthoritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -597,15 +779,29 @@ ListPermissionsOutcome ACMPCAClient::ListPermissions(const ListPermissionsReques
 
 ListPermissionsOutcomeCallable ACMPCAClient::ListPermissionsCallable(const ListPermissionsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListPermissionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPermissions(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListPermissionsOutcome > >(ALLOCATION_TAG);
+  ListPermissionsAsync(request, [promise](const ACMPCAClient*, const ListPermissionsRequest&, const ListPermissionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::ListPermissionsAsync(const ListPermissionsRequest& request, const ListPermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListPermissionsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListPermissionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPermissionsOutcome(ListPermissionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPermissionsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::ListPermissionsAsyncHelper(const ListPermissionsRequest& request, const ListPermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -632,15 +828,29 @@ ListTagsOutcome ACMPCAClient::ListTags(const ListTagsRequest& request) const
 
 ListTagsOutcomeCallable ACMPCAClient::ListTagsCallable(const ListTagsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTags(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListTagsOutcome > >(ALLOCATION_TAG);
+  ListTagsAsync(request, [promise](const ACMPCAClient*, const ListTagsRequest&, const ListTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::ListTagsAsync(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsOutcome(ListTagsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::ListTagsAsyncHelper(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -667,15 +877,29 @@ RestoreCertificateAuthorityOutcome ACMPCAClient::RestoreCertificateAuthority(con
 
 RestoreCertificateAuthorityOutcomeCallable ACMPCAClient::RestoreCertificateAuthorityCallable(const RestoreCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RestoreCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RestoreCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RestoreCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  RestoreCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const RestoreCertificateAuthorityRequest&, const RestoreCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::RestoreCertificateAuthorityAsync(const RestoreCertificateAuthorityRequest& request, const RestoreCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RestoreCertificateAuthorityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RestoreCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::RestoreCertificateAuthorityAsyncHelper(const RestoreCertificateAuthorityRequest& request, const RestoreCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -702,15 +926,29 @@ RevokeCertificateOutcome ACMPCAClient::RevokeCertificate(const RevokeCertificate
 
 RevokeCertificateOutcomeCallable ACMPCAClient::RevokeCertificateCallable(const RevokeCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RevokeCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RevokeCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RevokeCertificateOutcome > >(ALLOCATION_TAG);
+  RevokeCertificateAsync(request, [promise](const ACMPCAClient*, const RevokeCertificateRequest&, const RevokeCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::RevokeCertificateAsync(const RevokeCertificateRequest& request, const RevokeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RevokeCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RevokeCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RevokeCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RevokeCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::RevokeCertificateAsyncHelper(const RevokeCertificateRequest& request, const RevokeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -737,15 +975,29 @@ TagCertificateAuthorityOutcome ACMPCAClient::TagCertificateAuthority(const TagCe
 
 TagCertificateAuthorityOutcomeCallable ACMPCAClient::TagCertificateAuthorityCallable(const TagCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TagCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TagCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< TagCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  TagCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const TagCertificateAuthorityRequest&, const TagCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::TagCertificateAuthorityAsync(const TagCertificateAuthorityRequest& request, const TagCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TagCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TagCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TagCertificateAuthorityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TagCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::TagCertificateAuthorityAsyncHelper(const TagCertificateAuthorityRequest& request, const TagCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -772,15 +1024,29 @@ UntagCertificateAuthorityOutcome ACMPCAClient::UntagCertificateAuthority(const U
 
 UntagCertificateAuthorityOutcomeCallable ACMPCAClient::UntagCertificateAuthorityCallable(const UntagCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UntagCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UntagCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UntagCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  UntagCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const UntagCertificateAuthorityRequest&, const UntagCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::UntagCertificateAuthorityAsync(const UntagCertificateAuthorityRequest& request, const UntagCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UntagCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UntagCertificateAuthorityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UntagCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::UntagCertificateAuthorityAsyncHelper(const UntagCertificateAuthorityRequest& request, const UntagCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -807,15 +1073,29 @@ UpdateCertificateAuthorityOutcome ACMPCAClient::UpdateCertificateAuthority(const
 
 UpdateCertificateAuthorityOutcomeCallable ACMPCAClient::UpdateCertificateAuthorityCallable(const UpdateCertificateAuthorityRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateCertificateAuthorityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCertificateAuthority(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateCertificateAuthorityOutcome > >(ALLOCATION_TAG);
+  UpdateCertificateAuthorityAsync(request, [promise](const ACMPCAClient*, const UpdateCertificateAuthorityRequest&, const UpdateCertificateAuthorityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMPCAClient::UpdateCertificateAuthorityAsync(const UpdateCertificateAuthorityRequest& request, const UpdateCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateCertificateAuthorityAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateCertificateAuthorityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateCertificateAuthorityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateCertificateAuthorityOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMPCAClient::UpdateCertificateAuthorityAsyncHelper(const UpdateCertificateAuthorityRequest& request, const UpdateCertificateAuthorityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -135,15 +135,29 @@ AddTagsToCertificateOutcome ACMClient::AddTagsToCertificate(const AddTagsToCerti
 
 AddTagsToCertificateOutcomeCallable ACMClient::AddTagsToCertificateCallable(const AddTagsToCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AddTagsToCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AddTagsToCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AddTagsToCertificateOutcome > >(ALLOCATION_TAG);
+  AddTagsToCertificateAsync(request, [promise](const ACMClient*, const AddTagsToCertificateRequest&, const AddTagsToCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::AddTagsToCertificateAsync(const AddTagsToCertificateRequest& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AddTagsToCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AddTagsToCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AddTagsToCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AddTagsToCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::AddTagsToCertificateAsyncHelper(const AddTagsToCertificateRequest& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -170,15 +184,29 @@ DeleteCertificateOutcome ACMClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteCertificateOutcome > >(ALLOCATION_TAG);
+  DeleteCertificateAsync(request, [promise](const ACMClient*, const DeleteCertificateRequest&, const DeleteCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -205,15 +233,29 @@ DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeCertificateOutcome > >(ALLOCATION_TAG);
+  DescribeCertificateAsync(request, [promise](const ACMClient*, const DescribeCertificateRequest&, const DescribeCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(DescribeCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -240,15 +282,29 @@ ExportCertificateOutcome ACMClient::ExportCertificate(const ExportCertificateReq
 
 ExportCertificateOutcomeCallable ACMClient::ExportCertificateCallable(const ExportCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ExportCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ExportCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ExportCertificateOutcome > >(ALLOCATION_TAG);
+  ExportCertificateAsync(request, [promise](const ACMClient*, const ExportCertificateRequest&, const ExportCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::ExportCertificateAsync(const ExportCertificateRequest& request, const ExportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ExportCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ExportCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ExportCertificateOutcome(ExportCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ExportCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::ExportCertificateAsyncHelper(const ExportCertificateRequest& request, const ExportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -275,15 +331,29 @@ GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& req
 
 GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(const GetCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetCertificateOutcome > >(ALLOCATION_TAG);
+  GetCertificateAsync(request, [promise](const ACMClient*, const GetCertificateRequest&, const GetCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::GetCertificateAsync(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(GetCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::GetCertificateAsyncHelper(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,15 +380,29 @@ ImportCertificateOutcome ACMClient::ImportCertificate(const ImportCertificateReq
 
 ImportCertificateOutcomeCallable ACMClient::ImportCertificateCallable(const ImportCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ImportCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ImportCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ImportCertificateOutcome > >(ALLOCATION_TAG);
+  ImportCertificateAsync(request, [promise](const ACMClient*, const ImportCertificateRequest&, const ImportCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::ImportCertificateAsync(const ImportCertificateRequest& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ImportCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ImportCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ImportCertificateOutcome(ImportCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ImportCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::ImportCertificateAsyncHelper(const ImportCertificateRequest& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -345,15 +429,29 @@ ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListCertificatesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCertificates(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListCertificatesOutcome > >(ALLOCATION_TAG);
+  ListCertificatesAsync(request, [promise](const ACMClient*, const ListCertificatesRequest&, const ListCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListCertificatesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListCertificatesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(ListCertificatesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,15 +478,29 @@ ListTagsForCertificateOutcome ACMClient::ListTagsForCertificate(const ListTagsFo
 
 ListTagsForCertificateOutcomeCallable ACMClient::ListTagsForCertificateCallable(const ListTagsForCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTagsForCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsForCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListTagsForCertificateOutcome > >(ALLOCATION_TAG);
+  ListTagsForCertificateAsync(request, [promise](const ACMClient*, const ListTagsForCertificateRequest&, const ListTagsForCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::ListTagsForCertificateAsync(const ListTagsForCertificateRequest& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsForCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsForCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsForCertificateOutcome(ListTagsForCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsForCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::ListTagsForCertificateAsyncHelper(const ListTagsForCertificateRequest& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,15 +527,29 @@ RemoveTagsFromCertificateOutcome ACMClient::RemoveTagsFromCertificate(const Remo
 
 RemoveTagsFromCertificateOutcomeCallable ACMClient::RemoveTagsFromCertificateCallable(const RemoveTagsFromCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RemoveTagsFromCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RemoveTagsFromCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RemoveTagsFromCertificateOutcome > >(ALLOCATION_TAG);
+  RemoveTagsFromCertificateAsync(request, [promise](const ACMClient*, const RemoveTagsFromCertificateRequest&, const RemoveTagsFromCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::RemoveTagsFromCertificateAsync(const RemoveTagsFromCertificateRequest& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RemoveTagsFromCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RemoveTagsFromCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RemoveTagsFromCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::RemoveTagsFromCertificateAsyncHelper(const RemoveTagsFromCertificateRequest& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -450,15 +576,29 @@ RenewCertificateOutcome ACMClient::RenewCertificate(const RenewCertificateReques
 
 RenewCertificateOutcomeCallable ACMClient::RenewCertificateCallable(const RenewCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RenewCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RenewCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RenewCertificateOutcome > >(ALLOCATION_TAG);
+  RenewCertificateAsync(request, [promise](const ACMClient*, const RenewCertificateRequest&, const RenewCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::RenewCertificateAsync(const RenewCertificateRequest& request, const RenewCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RenewCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RenewCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RenewCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RenewCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::RenewCertificateAsyncHelper(const RenewCertificateRequest& request, const RenewCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -485,15 +625,29 @@ RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificate
 
 RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(const RequestCertificateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RequestCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RequestCertificate(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RequestCertificateOutcome > >(ALLOCATION_TAG);
+  RequestCertificateAsync(request, [promise](const ACMClient*, const RequestCertificateRequest&, const RequestCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::RequestCertificateAsync(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RequestCertificateAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RequestCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RequestCertificateOutcome(RequestCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RequestCertificateOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::RequestCertificateAsyncHelper(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -520,15 +674,29 @@ ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValida
 
 ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(const ResendValidationEmailRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ResendValidationEmailOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ResendValidationEmail(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ResendValidationEmailOutcome > >(ALLOCATION_TAG);
+  ResendValidationEmailAsync(request, [promise](const ACMClient*, const ResendValidationEmailRequest&, const ResendValidationEmailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::ResendValidationEmailAsync(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ResendValidationEmailAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ResendValidationEmailRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ResendValidationEmailOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ResendValidationEmailOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::ResendValidationEmailAsyncHelper(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,15 +723,29 @@ UpdateCertificateOptionsOutcome ACMClient::UpdateCertificateOptions(const Update
 
 UpdateCertificateOptionsOutcomeCallable ACMClient::UpdateCertificateOptionsCallable(const UpdateCertificateOptionsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateCertificateOptionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCertificateOptions(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateCertificateOptionsOutcome > >(ALLOCATION_TAG);
+  UpdateCertificateOptionsAsync(request, [promise](const ACMClient*, const UpdateCertificateOptionsRequest&, const UpdateCertificateOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void ACMClient::UpdateCertificateOptionsAsync(const UpdateCertificateOptionsRequest& request, const UpdateCertificateOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateCertificateOptionsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateCertificateOptionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateCertificateOptionsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateCertificateOptionsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void ACMClient::UpdateCertificateOptionsAsyncHelper(const UpdateCertificateOptionsRequest& request, const UpdateCertificateOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
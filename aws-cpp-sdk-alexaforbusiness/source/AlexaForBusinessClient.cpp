@@ -209,15 +209,29 @@ ApproveSkillOutcome AlexaForBusinessClient::ApproveSkill(const ApproveSkillReque
 
 ApproveSkillOutcomeCallable AlexaForBusinessClient::ApproveSkillCallable(const ApproveSkillRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ApproveSkillOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ApproveSkill(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ApproveSkillOutcome > >(ALLOCATION_TAG);
+  ApproveSkillAsync(request, [promise](const AlexaForBusinessClient*, const ApproveSkillRequest&, const ApproveSkillOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ApproveSkillAsync(const ApproveSkillRequest& request, const ApproveSkillResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ApproveSkillAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ApproveSkillRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ApproveSkillOutcome(ApproveSkillResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ApproveSkillOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ApproveSkillAsyncHelper(const ApproveSkillRequest& request, const ApproveSkillResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -244,15 +258,29 @@ AssociateContactWithAddressBookOutcome AlexaForBusinessClient::AssociateContactW
 
 AssociateContactWithAddressBookOutcomeCallable AlexaForBusinessClient::AssociateContactWithAddressBookCallable(const AssociateContactWithAddressBookRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateContactWithAddressBookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateContactWithAddressBook(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateContactWithAddressBookOutcome > >(ALLOCATION_TAG);
+  AssociateContactWithAddressBookAsync(request, [promise](const AlexaForBusinessClient*, const AssociateContactWithAddressBookRequest&, const AssociateContactWithAddressBookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::AssociateContactWithAddressBookAsync(const AssociateContactWithAddressBookRequest& request, const AssociateContactWithAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateContactWithAddressBookAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateContactWithAddressBookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateContactWithAddressBookOutcome(AssociateContactWithAddressBookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateContactWithAddressBookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::AssociateContactWithAddressBookAsyncHelper(const AssociateContactWithAddressBookRequest& request, const AssociateContactWithAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,15 +307,29 @@ AssociateDeviceWithRoomOutcome AlexaForBusinessClient::AssociateDeviceWithRoom(c
 
 AssociateDeviceWithRoomOutcomeCallable AlexaForBusinessClient::AssociateDeviceWithRoomCallable(const AssociateDeviceWithRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateDeviceWithRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateDeviceWithRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateDeviceWithRoomOutcome > >(ALLOCATION_TAG);
+  AssociateDeviceWithRoomAsync(request, [promise](const AlexaForBusinessClient*, const AssociateDeviceWithRoomRequest&, const AssociateDeviceWithRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::AssociateDeviceWithRoomAsync(const AssociateDeviceWithRoomRequest& request, const AssociateDeviceWithRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateDeviceWithRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateDeviceWithRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateDeviceWithRoomOutcome(AssociateDeviceWithRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateDeviceWithRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::AssociateDeviceWithRoomAsyncHelper(const AssociateDeviceWithRoomRequest& request, const AssociateDeviceWithRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -314,15 +356,29 @@ AssociateSkillGroupWithRoomOutcome AlexaForBusinessClient::AssociateSkillGroupWi
 
 AssociateSkillGroupWithRoomOutcomeCallable AlexaForBusinessClient::AssociateSkillGroupWithRoomCallable(const AssociateSkillGroupWithRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateSkillGroupWithRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateSkillGroupWithRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateSkillGroupWithRoomOutcome > >(ALLOCATION_TAG);
+  AssociateSkillGroupWithRoomAsync(request, [promise](const AlexaForBusinessClient*, const AssociateSkillGroupWithRoomRequest&, const AssociateSkillGroupWithRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::AssociateSkillGroupWithRoomAsync(const AssociateSkillGroupWithRoomRequest& request, const AssociateSkillGroupWithRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateSkillGroupWithRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateSkillGroupWithRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateSkillGroupWithRoomOutcome(AssociateSkillGroupWithRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateSkillGroupWithRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::AssociateSkillGroupWithRoomAsyncHelper(const AssociateSkillGroupWithRoomRequest& request, const AssociateSkillGroupWithRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,15 +405,29 @@ AssociateSkillWithSkillGroupOutcome AlexaForBusinessClient::AssociateSkillWithSk
 
 AssociateSkillWithSkillGroupOutcomeCallable AlexaForBusinessClient::AssociateSkillWithSkillGroupCallable(const AssociateSkillWithSkillGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateSkillWithSkillGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateSkillWithSkillGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateSkillWithSkillGroupOutcome > >(ALLOCATION_TAG);
+  AssociateSkillWithSkillGroupAsync(request, [promise](const AlexaForBusinessClient*, const AssociateSkillWithSkillGroupRequest&, const AssociateSkillWithSkillGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::AssociateSkillWithSkillGroupAsync(const AssociateSkillWithSkillGroupRequest& request, const AssociateSkillWithSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateSkillWithSkillGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateSkillWithSkillGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateSkillWithSkillGroupOutcome(AssociateSkillWithSkillGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateSkillWithSkillGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::AssociateSkillWithSkillGroupAsyncHelper(const AssociateSkillWithSkillGroupRequest& request, const AssociateSkillWithSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -384,15 +454,29 @@ AssociateSkillWithUsersOutcome AlexaForBusinessClient::AssociateSkillWithUsers(c
 
 AssociateSkillWithUsersOutcomeCallable AlexaForBusinessClient::AssociateSkillWithUsersCallable(const AssociateSkillWithUsersRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateSkillWithUsersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateSkillWithUsers(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< AssociateSkillWithUsersOutcome > >(ALLOCATION_TAG);
+  AssociateSkillWithUsersAsync(request, [promise](const AlexaForBusinessClient*, const AssociateSkillWithUsersRequest&, const AssociateSkillWithUsersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::AssociateSkillWithUsersAsync(const AssociateSkillWithUsersRequest& request, const AssociateSkillWithUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->AssociateSkillWithUsersAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<AssociateSkillWithUsersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateSkillWithUsersOutcome(AssociateSkillWithUsersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateSkillWithUsersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::AssociateSkillWithUsersAsyncHelper(const AssociateSkillWithUsersRequest& request, const AssociateSkillWithUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -419,15 +503,29 @@ CreateAddressBookOutcome AlexaForBusinessClient::CreateAddressBook(const CreateA
 
 CreateAddressBookOutcomeCallable AlexaForBusinessClient::CreateAddressBookCallable(const CreateAddressBookRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateAddressBookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateAddressBook(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateAddressBookOutcome > >(ALLOCATION_TAG);
+  CreateAddressBookAsync(request, [promise](const AlexaForBusinessClient*, const CreateAddressBookRequest&, const CreateAddressBookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateAddressBookAsync(const CreateAddressBookRequest& request, const CreateAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateAddressBookAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateAddressBookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAddressBookOutcome(CreateAddressBookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAddressBookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateAddressBookAsyncHelper(const CreateAddressBookRequest& request, const CreateAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -454,15 +552,29 @@ CreateBusinessReportScheduleOutcome AlexaForBusinessClient::CreateBusinessReport
 
 CreateBusinessReportScheduleOutcomeCallable AlexaForBusinessClient::CreateBusinessReportScheduleCallable(const CreateBusinessReportScheduleRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateBusinessReportScheduleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBusinessReportSchedule(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateBusinessReportScheduleOutcome > >(ALLOCATION_TAG);
+  CreateBusinessReportScheduleAsync(request, [promise](const AlexaForBusinessClient*, const CreateBusinessReportScheduleRequest&, const CreateBusinessReportScheduleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateBusinessReportScheduleAsync(const CreateBusinessReportScheduleRequest& request, const CreateBusinessReportScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateBusinessReportScheduleAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateBusinessReportScheduleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateBusinessReportScheduleOutcome(CreateBusinessReportScheduleResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateBusinessReportScheduleOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateBusinessReportScheduleAsyncHelper(const CreateBusinessReportScheduleRequest& request, const CreateBusinessReportScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -489,15 +601,29 @@ CreateConferenceProviderOutcome AlexaForBusinessClient::CreateConferenceProvider
 
 CreateConferenceProviderOutcomeCallable AlexaForBusinessClient::CreateConferenceProviderCallable(const CreateConferenceProviderRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateConferenceProviderOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateConferenceProvider(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateConferenceProviderOutcome > >(ALLOCATION_TAG);
+  CreateConferenceProviderAsync(request, [promise](const AlexaForBusinessClient*, const CreateConferenceProviderRequest&, const CreateConferenceProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateConferenceProviderAsync(const CreateConferenceProviderRequest& request, const CreateConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateConferenceProviderAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateConferenceProviderRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateConferenceProviderOutcome(CreateConferenceProviderResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateConferenceProviderOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateConferenceProviderAsyncHelper(const CreateConferenceProviderRequest& request, const CreateConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -524,15 +650,29 @@ CreateContactOutcome AlexaForBusinessClient::CreateContact(const CreateContactRe
 
 CreateContactOutcomeCallable AlexaForBusinessClient::CreateContactCallable(const CreateContactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateContactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateContact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateContactOutcome > >(ALLOCATION_TAG);
+  CreateContactAsync(request, [promise](const AlexaForBusinessClient*, const CreateContactRequest&, const CreateContactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateContactAsync(const CreateContactRequest& request, const CreateContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateContactAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateContactRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateContactOutcome(CreateContactResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateContactOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateContactAsyncHelper(const CreateContactRequest& request, const CreateContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -559,15 +699,29 @@ CreateGatewayGroupOutcome AlexaForBusinessClient::CreateGatewayGroup(const Creat
 
 CreateGatewayGroupOutcomeCallable AlexaForBusinessClient::CreateGatewayGroupCallable(const CreateGatewayGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateGatewayGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateGatewayGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateGatewayGroupOutcome > >(ALLOCATION_TAG);
+  CreateGatewayGroupAsync(request, [promise](const AlexaForBusinessClient*, const CreateGatewayGroupRequest&, const CreateGatewayGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateGatewayGroupAsync(const CreateGatewayGroupRequest& request, const CreateGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateGatewayGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateGatewayGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateGatewayGroupOutcome(CreateGatewayGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateGatewayGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateGatewayGroupAsyncHelper(const CreateGatewayGroupRequest& request, const CreateGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -594,15 +748,29 @@ CreateProfileOutcome AlexaForBusinessClient::CreateProfile(const CreateProfileRe
 
 CreateProfileOutcomeCallable AlexaForBusinessClient::CreateProfileCallable(const CreateProfileRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateProfileOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateProfile(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateProfileOutcome > >(ALLOCATION_TAG);
+  CreateProfileAsync(request, [promise](const AlexaForBusinessClient*, const CreateProfileRequest&, const CreateProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateProfileAsync(const CreateProfileRequest& request, const CreateProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateProfileAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateProfileRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateProfileOutcome(CreateProfileResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateProfileOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateProfileAsyncHelper(const CreateProfileRequest& request, const CreateProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -629,15 +797,29 @@ CreateRoomOutcome AlexaForBusinessClient::CreateRoom(const CreateRoomRequest& re
 
 CreateRoomOutcomeCallable AlexaForBusinessClient::CreateRoomCallable(const CreateRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateRoomOutcome > >(ALLOCATION_TAG);
+  CreateRoomAsync(request, [promise](const AlexaForBusinessClient*, const CreateRoomRequest&, const CreateRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateRoomAsync(const CreateRoomRequest& request, const CreateRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateRoomOutcome(CreateRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateRoomAsyncHelper(const CreateRoomRequest& request, const CreateRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -664,15 +846,29 @@ CreateSkillGroupOutcome AlexaForBusinessClient::CreateSkillGroup(const CreateSki
 
 CreateSkillGroupOutcomeCallable AlexaForBusinessClient::CreateSkillGroupCallable(const CreateSkillGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateSkillGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateSkillGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateSkillGroupOutcome > >(ALLOCATION_TAG);
+  CreateSkillGroupAsync(request, [promise](const AlexaForBusinessClient*, const CreateSkillGroupRequest&, const CreateSkillGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateSkillGroupAsync(const CreateSkillGroupRequest& request, const CreateSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateSkillGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateSkillGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateSkillGroupOutcome(CreateSkillGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateSkillGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateSkillGroupAsyncHelper(const CreateSkillGroupRequest& request, const CreateSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -699,15 +895,29 @@ CreateUserOutcome AlexaForBusinessClient::CreateUser(const CreateUserRequest& re
 
 CreateUserOutcomeCallable AlexaForBusinessClient::CreateUserCallable(const CreateUserRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateUserOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateUser(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateUserOutcome > >(ALLOCATION_TAG);
+  CreateUserAsync(request, [promise](const AlexaForBusinessClient*, const CreateUserRequest&, const CreateUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::CreateUserAsync(const CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateUserAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateUserRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateUserOutcome(CreateUserResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateUserOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::CreateUserAsyncHelper(const CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -734,15 +944,29 @@ DeleteAddressBookOutcome AlexaForBusinessClient::DeleteAddressBook(const DeleteA
 
 DeleteAddressBookOutcomeCallable AlexaForBusinessClient::DeleteAddressBookCallable(const DeleteAddressBookRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteAddressBookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteAddressBook(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteAddressBookOutcome > >(ALLOCATION_TAG);
+  DeleteAddressBookAsync(request, [promise](const AlexaForBusinessClient*, const DeleteAddressBookRequest&, const DeleteAddressBookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteAddressBookAsync(const DeleteAddressBookRequest& request, const DeleteAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteAddressBookAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteAddressBookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAddressBookOutcome(DeleteAddressBookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAddressBookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteAddressBookAsyncHelper(const DeleteAddressBookRequest& request, const DeleteAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -769,15 +993,29 @@ DeleteBusinessReportScheduleOutcome AlexaForBusinessClient::DeleteBusinessReport
 
 DeleteBusinessReportScheduleOutcomeCallable AlexaForBusinessClient::DeleteBusinessReportScheduleCallable(const DeleteBusinessReportScheduleRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteBusinessReportScheduleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBusinessReportSchedule(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteBusinessReportScheduleOutcome > >(ALLOCATION_TAG);
+  DeleteBusinessReportScheduleAsync(request, [promise](const AlexaForBusinessClient*, const DeleteBusinessReportScheduleRequest&, const DeleteBusinessReportScheduleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteBusinessReportScheduleAsync(const DeleteBusinessReportScheduleRequest& request, const DeleteBusinessReportScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteBusinessReportScheduleAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBusinessReportScheduleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBusinessReportScheduleOutcome(DeleteBusinessReportScheduleResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBusinessReportScheduleOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteBusinessReportScheduleAsyncHelper(const DeleteBusinessReportScheduleRequest& request, const DeleteBusinessReportScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -804,15 +1042,29 @@ DeleteConferenceProviderOutcome AlexaForBusinessClient::DeleteConferenceProvider
 
 DeleteConferenceProviderOutcomeCallable AlexaForBusinessClient::DeleteConferenceProviderCallable(const DeleteConferenceProviderRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteConferenceProviderOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteConferenceProvider(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteConferenceProviderOutcome > >(ALLOCATION_TAG);
+  DeleteConferenceProviderAsync(request, [promise](const AlexaForBusinessClient*, const DeleteConferenceProviderRequest&, const DeleteConferenceProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteConferenceProviderAsync(const DeleteConferenceProviderRequest& request, const DeleteConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteConferenceProviderAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteConferenceProviderRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteConferenceProviderOutcome(DeleteConferenceProviderResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteConferenceProviderOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteConferenceProviderAsyncHelper(const DeleteConferenceProviderRequest& request, const DeleteConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -839,15 +1091,29 @@ DeleteContactOutcome AlexaForBusinessClient::DeleteContact(const DeleteContactRe
 
 DeleteContactOutcomeCallable AlexaForBusinessClient::DeleteContactCallable(const DeleteContactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteContactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteContact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteContactOutcome > >(ALLOCATION_TAG);
+  DeleteContactAsync(request, [promise](const AlexaForBusinessClient*, const DeleteContactRequest&, const DeleteContactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteContactAsync(const DeleteContactRequest& request, const DeleteContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteContactAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteContactRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteContactOutcome(DeleteContactResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteContactOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteContactAsyncHelper(const DeleteContactRequest& request, const DeleteContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -874,15 +1140,29 @@ DeleteDeviceOutcome AlexaForBusinessClient::DeleteDevice(const DeleteDeviceReque
 
 DeleteDeviceOutcomeCallable AlexaForBusinessClient::DeleteDeviceCallable(const DeleteDeviceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteDeviceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDevice(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteDeviceOutcome > >(ALLOCATION_TAG);
+  DeleteDeviceAsync(request, [promise](const AlexaForBusinessClient*, const DeleteDeviceRequest&, const DeleteDeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteDeviceAsync(const DeleteDeviceRequest& request, const DeleteDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteDeviceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteDeviceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDeviceOutcome(DeleteDeviceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDeviceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteDeviceAsyncHelper(const DeleteDeviceRequest& request, const DeleteDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -909,15 +1189,29 @@ DeleteDeviceUsageDataOutcome AlexaForBusinessClient::DeleteDeviceUsageData(const
 
 DeleteDeviceUsageDataOutcomeCallable AlexaForBusinessClient::DeleteDeviceUsageDataCallable(const DeleteDeviceUsageDataRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteDeviceUsageDataOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDeviceUsageData(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteDeviceUsageDataOutcome > >(ALLOCATION_TAG);
+  DeleteDeviceUsageDataAsync(request, [promise](const AlexaForBusinessClient*, const DeleteDeviceUsageDataRequest&, const DeleteDeviceUsageDataOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteDeviceUsageDataAsync(const DeleteDeviceUsageDataRequest& request, const DeleteDeviceUsageDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteDeviceUsageDataAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteDeviceUsageDataRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDeviceUsageDataOutcome(DeleteDeviceUsageDataResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDeviceUsageDataOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteDeviceUsageDataAsyncHelper(const DeleteDeviceUsageDataRequest& request, const DeleteDeviceUsageDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -944,15 +1238,29 @@ DeleteGatewayGroupOutcome AlexaForBusinessClient::DeleteGatewayGroup(const Delet
 
 DeleteGatewayGroupOutcomeCallable AlexaForBusinessClient::DeleteGatewayGroupCallable(const DeleteGatewayGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteGatewayGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteGatewayGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteGatewayGroupOutcome > >(ALLOCATION_TAG);
+  DeleteGatewayGroupAsync(request, [promise](const AlexaForBusinessClient*, const DeleteGatewayGroupRequest&, const DeleteGatewayGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteGatewayGroupAsync(const DeleteGatewayGroupRequest& request, const DeleteGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteGatewayGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteGatewayGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteGatewayGroupOutcome(DeleteGatewayGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteGatewayGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteGatewayGroupAsyncHelper(const DeleteGatewayGroupRequest& request, const DeleteGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -979,15 +1287,29 @@ DeleteProfileOutcome AlexaForBusinessClient::DeleteProfile(const DeleteProfileRe
 
 DeleteProfileOutcomeCallable AlexaForBusinessClient::DeleteProfileCallable(const DeleteProfileRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteProfileOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteProfile(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteProfileOutcome > >(ALLOCATION_TAG);
+  DeleteProfileAsync(request, [promise](const AlexaForBusinessClient*, const DeleteProfileRequest&, const DeleteProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteProfileAsync(const DeleteProfileRequest& request, const DeleteProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteProfileAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteProfileRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteProfileOutcome(DeleteProfileResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteProfileOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteProfileAsyncHelper(const DeleteProfileRequest& request, const DeleteProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1014,15 +1336,29 @@ DeleteRoomOutcome AlexaForBusinessClient::DeleteRoom(const DeleteRoomRequest& re
 
 DeleteRoomOutcomeCallable AlexaForBusinessClient::DeleteRoomCallable(const DeleteRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteRoomOutcome > >(ALLOCATION_TAG);
+  DeleteRoomAsync(request, [promise](const AlexaForBusinessClient*, const DeleteRoomRequest&, const DeleteRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteRoomAsync(const DeleteRoomRequest& request, const DeleteRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteRoomOutcome(DeleteRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteRoomAsyncHelper(const DeleteRoomRequest& request, const DeleteRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1049,15 +1385,29 @@ DeleteRoomSkillParameterOutcome AlexaForBusinessClient::DeleteRoomSkillParameter
 
 DeleteRoomSkillParameterOutcomeCallable AlexaForBusinessClient::DeleteRoomSkillParameterCallable(const DeleteRoomSkillParameterRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteRoomSkillParameterOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteRoomSkillParameter(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteRoomSkillParameterOutcome > >(ALLOCATION_TAG);
+  DeleteRoomSkillParameterAsync(request, [promise](const AlexaForBusinessClient*, const DeleteRoomSkillParameterRequest&, const DeleteRoomSkillParameterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteRoomSkillParameterAsync(const DeleteRoomSkillParameterRequest& request, const DeleteRoomSkillParameterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteRoomSkillParameterAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteRoomSkillParameterRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteRoomSkillParameterOutcome(DeleteRoomSkillParameterResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteRoomSkillParameterOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteRoomSkillParameterAsyncHelper(const DeleteRoomSkillParameterRequest& request, const DeleteRoomSkillParameterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1084,15 +1434,29 @@ DeleteSkillAuthorizationOutcome AlexaForBusinessClient::DeleteSkillAuthorization
 
 DeleteSkillAuthorizationOutcomeCallable AlexaForBusinessClient::DeleteSkillAuthorizationCallable(const DeleteSkillAuthorizationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteSkillAuthorizationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteSkillAuthorization(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteSkillAuthorizationOutcome > >(ALLOCATION_TAG);
+  DeleteSkillAuthorizationAsync(request, [promise](const AlexaForBusinessClient*, const DeleteSkillAuthorizationRequest&, const DeleteSkillAuthorizationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteSkillAuthorizationAsync(const DeleteSkillAuthorizationRequest& request, const DeleteSkillAuthorizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteSkillAuthorizationAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteSkillAuthorizationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteSkillAuthorizationOutcome(DeleteSkillAuthorizationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteSkillAuthorizationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteSkillAuthorizationAsyncHelper(const DeleteSkillAuthorizationRequest& request, const DeleteSkillAuthorizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1119,15 +1483,29 @@ DeleteSkillGroupOutcome AlexaForBusinessClient::DeleteSkillGroup(const DeleteSki
 
 DeleteSkillGroupOutcomeCallable AlexaForBusinessClient::DeleteSkillGroupCallable(const DeleteSkillGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteSkillGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteSkillGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteSkillGroupOutcome > >(ALLOCATION_TAG);
+  DeleteSkillGroupAsync(request, [promise](const AlexaForBusinessClient*, const DeleteSkillGroupRequest&, const DeleteSkillGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteSkillGroupAsync(const DeleteSkillGroupRequest& request, const DeleteSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteSkillGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteSkillGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteSkillGroupOutcome(DeleteSkillGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteSkillGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteSkillGroupAsyncHelper(const DeleteSkillGroupRequest& request, const DeleteSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1154,15 +1532,29 @@ DeleteUserOutcome AlexaForBusinessClient::DeleteUser(const DeleteUserRequest& re
 
 DeleteUserOutcomeCallable AlexaForBusinessClient::DeleteUserCallable(const DeleteUserRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteUserOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteUser(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteUserOutcome > >(ALLOCATION_TAG);
+  DeleteUserAsync(request, [promise](const AlexaForBusinessClient*, const DeleteUserRequest&, const DeleteUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DeleteUserAsync(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteUserAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteUserRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteUserOutcome(DeleteUserResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteUserOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DeleteUserAsyncHelper(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1189,15 +1581,29 @@ DisassociateContactFromAddressBookOutcome AlexaForBusinessClient::DisassociateCo
 
 DisassociateContactFromAddressBookOutcomeCallable AlexaForBusinessClient::DisassociateContactFromAddressBookCallable(const DisassociateContactFromAddressBookRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateContactFromAddressBookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateContactFromAddressBook(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateContactFromAddressBookOutcome > >(ALLOCATION_TAG);
+  DisassociateContactFromAddressBookAsync(request, [promise](const AlexaForBusinessClient*, const DisassociateContactFromAddressBookRequest&, const DisassociateContactFromAddressBookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DisassociateContactFromAddressBookAsync(const DisassociateContactFromAddressBookRequest& request, const DisassociateContactFromAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateContactFromAddressBookAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateContactFromAddressBookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateContactFromAddressBookOutcome(DisassociateContactFromAddressBookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateContactFromAddressBookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DisassociateContactFromAddressBookAsyncHelper(const DisassociateContactFromAddressBookRequest& request, const DisassociateContactFromAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1224,15 +1630,29 @@ DisassociateDeviceFromRoomOutcome AlexaForBusinessClient::DisassociateDeviceFrom
 
 DisassociateDeviceFromRoomOutcomeCallable AlexaForBusinessClient::DisassociateDeviceFromRoomCallable(const DisassociateDeviceFromRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateDeviceFromRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateDeviceFromRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateDeviceFromRoomOutcome > >(ALLOCATION_TAG);
+  DisassociateDeviceFromRoomAsync(request, [promise](const AlexaForBusinessClient*, const DisassociateDeviceFromRoomRequest&, const DisassociateDeviceFromRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DisassociateDeviceFromRoomAsync(const DisassociateDeviceFromRoomRequest& request, const DisassociateDeviceFromRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateDeviceFromRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateDeviceFromRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateDeviceFromRoomOutcome(DisassociateDeviceFromRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateDeviceFromRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DisassociateDeviceFromRoomAsyncHelper(const DisassociateDeviceFromRoomRequest& request, const DisassociateDeviceFromRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1259,15 +1679,29 @@ DisassociateSkillFromSkillGroupOutcome AlexaForBusinessClient::DisassociateSkill
 
 DisassociateSkillFromSkillGroupOutcomeCallable AlexaForBusinessClient::DisassociateSkillFromSkillGroupCallable(const DisassociateSkillFromSkillGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateSkillFromSkillGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateSkillFromSkillGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateSkillFromSkillGroupOutcome > >(ALLOCATION_TAG);
+  DisassociateSkillFromSkillGroupAsync(request, [promise](const AlexaForBusinessClient*, const DisassociateSkillFromSkillGroupRequest&, const DisassociateSkillFromSkillGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DisassociateSkillFromSkillGroupAsync(const DisassociateSkillFromSkillGroupRequest& request, const DisassociateSkillFromSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateSkillFromSkillGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateSkillFromSkillGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateSkillFromSkillGroupOutcome(DisassociateSkillFromSkillGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateSkillFromSkillGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DisassociateSkillFromSkillGroupAsyncHelper(const DisassociateSkillFromSkillGroupRequest& request, const DisassociateSkillFromSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1294,15 +1728,29 @@ DisassociateSkillFromUsersOutcome AlexaForBusinessClient::DisassociateSkillFromU
 
 DisassociateSkillFromUsersOutcomeCallable AlexaForBusinessClient::DisassociateSkillFromUsersCallable(const DisassociateSkillFromUsersRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateSkillFromUsersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateSkillFromUsers(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateSkillFromUsersOutcome > >(ALLOCATION_TAG);
+  DisassociateSkillFromUsersAsync(request, [promise](const AlexaForBusinessClient*, const DisassociateSkillFromUsersRequest&, const DisassociateSkillFromUsersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DisassociateSkillFromUsersAsync(const DisassociateSkillFromUsersRequest& request, const DisassociateSkillFromUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateSkillFromUsersAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateSkillFromUsersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateSkillFromUsersOutcome(DisassociateSkillFromUsersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateSkillFromUsersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DisassociateSkillFromUsersAsyncHelper(const DisassociateSkillFromUsersRequest& request, const DisassociateSkillFromUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1329,15 +1777,29 @@ DisassociateSkillGroupFromRoomOutcome AlexaForBusinessClient::DisassociateSkillG
 
 DisassociateSkillGroupFromRoomOutcomeCallable AlexaForBusinessClient::DisassociateSkillGroupFromRoomCallable(const DisassociateSkillGroupFromRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateSkillGroupFromRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateSkillGroupFromRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DisassociateSkillGroupFromRoomOutcome > >(ALLOCATION_TAG);
+  DisassociateSkillGroupFromRoomAsync(request, [promise](const AlexaForBusinessClient*, const DisassociateSkillGroupFromRoomRequest&, const DisassociateSkillGroupFromRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::DisassociateSkillGroupFromRoomAsync(const DisassociateSkillGroupFromRoomRequest& request, const DisassociateSkillGroupFromRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DisassociateSkillGroupFromRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DisassociateSkillGroupFromRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateSkillGroupFromRoomOutcome(DisassociateSkillGroupFromRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateSkillGroupFromRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::DisassociateSkillGroupFromRoomAsyncHelper(const DisassociateSkillGroupFromRoomRequest& request, const DisassociateSkillGroupFromRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1364,15 +1826,29 @@ ForgetSmartHomeAppliancesOutcome AlexaForBusinessClient::ForgetSmartHomeApplianc
 
 ForgetSmartHomeAppliancesOutcomeCallable AlexaForBusinessClient::ForgetSmartHomeAppliancesCallable(const ForgetSmartHomeAppliancesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ForgetSmartHomeAppliancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ForgetSmartHomeAppliances(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ForgetSmartHomeAppliancesOutcome > >(ALLOCATION_TAG);
+  ForgetSmartHomeAppliancesAsync(request, [promise](const AlexaForBusinessClient*, const ForgetSmartHomeAppliancesRequest&, const ForgetSmartHomeAppliancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ForgetSmartHomeAppliancesAsync(const ForgetSmartHomeAppliancesRequest& request, const ForgetSmartHomeAppliancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ForgetSmartHomeAppliancesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ForgetSmartHomeAppliancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ForgetSmartHomeAppliancesOutcome(ForgetSmartHomeAppliancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ForgetSmartHomeAppliancesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ForgetSmartHomeAppliancesAsyncHelper(const ForgetSmartHomeAppliancesRequest& request, const ForgetSmartHomeAppliancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1399,15 +1875,29 @@ GetAddressBookOutcome AlexaForBusinessClient::GetAddressBook(const GetAddressBoo
 
 GetAddressBookOutcomeCallable AlexaForBusinessClient::GetAddressBookCallable(const GetAddressBookRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetAddressBookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAddressBook(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetAddressBookOutcome > >(ALLOCATION_TAG);
+  GetAddressBookAsync(request, [promise](const AlexaForBusinessClient*, const GetAddressBookRequest&, const GetAddressBookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetAddressBookAsync(const GetAddressBookRequest& request, const GetAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetAddressBookAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetAddressBookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAddressBookOutcome(GetAddressBookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAddressBookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetAddressBookAsyncHelper(const GetAddressBookRequest& request, const GetAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1434,15 +1924,29 @@ GetConferencePreferenceOutcome AlexaForBusinessClient::GetConferencePreference(c
 
 GetConferencePreferenceOutcomeCallable AlexaForBusinessClient::GetConferencePreferenceCallable(const GetConferencePreferenceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetConferencePreferenceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetConferencePreference(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetConferencePreferenceOutcome > >(ALLOCATION_TAG);
+  GetConferencePreferenceAsync(request, [promise](const AlexaForBusinessClient*, const GetConferencePreferenceRequest&, const GetConferencePreferenceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetConferencePreferenceAsync(const GetConferencePreferenceRequest& request, const GetConferencePreferenceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetConferencePreferenceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetConferencePreferenceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetConferencePreferenceOutcome(GetConferencePreferenceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetConferencePreferenceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetConferencePreferenceAsyncHelper(const GetConferencePreferenceRequest& request, const GetConferencePreferenceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1469,15 +1973,29 @@ GetConferenceProviderOutcome AlexaForBusinessClient::GetConferenceProvider(const
 
 GetConferenceProviderOutcomeCallable AlexaForBusinessClient::GetConferenceProviderCallable(const GetConferenceProviderRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetConferenceProviderOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetConferenceProvider(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetConferenceProviderOutcome > >(ALLOCATION_TAG);
+  GetConferenceProviderAsync(request, [promise](const AlexaForBusinessClient*, const GetConferenceProviderRequest&, const GetConferenceProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetConferenceProviderAsync(const GetConferenceProviderRequest& request, const GetConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetConferenceProviderAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetConferenceProviderRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetConferenceProviderOutcome(GetConferenceProviderResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetConferenceProviderOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetConferenceProviderAsyncHelper(const GetConferenceProviderRequest& request, const GetConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1504,15 +2022,29 @@ GetContactOutcome AlexaForBusinessClient::GetContact(const GetContactRequest& re
 
 GetContactOutcomeCallable AlexaForBusinessClient::GetContactCallable(const GetContactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetContactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetContact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetContactOutcome > >(ALLOCATION_TAG);
+  GetContactAsync(request, [promise](const AlexaForBusinessClient*, const GetContactRequest&, const GetContactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetContactAsync(const GetContactRequest& request, const GetContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetContactAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetContactRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetContactOutcome(GetContactResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetContactOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetContactAsyncHelper(const GetContactRequest& request, const GetContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1539,15 +2071,29 @@ GetDeviceOutcome AlexaForBusinessClient::GetDevice(const GetDeviceRequest& reque
 
 GetDeviceOutcomeCallable AlexaForBusinessClient::GetDeviceCallable(const GetDeviceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetDeviceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDevice(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetDeviceOutcome > >(ALLOCATION_TAG);
+  GetDeviceAsync(request, [promise](const AlexaForBusinessClient*, const GetDeviceRequest&, const GetDeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetDeviceAsync(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetDeviceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetDeviceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDeviceOutcome(GetDeviceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDeviceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetDeviceAsyncHelper(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1574,15 +2120,29 @@ GetGatewayOutcome AlexaForBusinessClient::GetGateway(const GetGatewayRequest& re
 
 GetGatewayOutcomeCallable AlexaForBusinessClient::GetGatewayCallable(const GetGatewayRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetGatewayOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetGateway(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetGatewayOutcome > >(ALLOCATION_TAG);
+  GetGatewayAsync(request, [promise](const AlexaForBusinessClient*, const GetGatewayRequest&, const GetGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetGatewayAsync(const GetGatewayRequest& request, const GetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetGatewayAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetGatewayRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetGatewayOutcome(GetGatewayResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetGatewayOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetGatewayAsyncHelper(const GetGatewayRequest& request, const GetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1609,15 +2169,29 @@ GetGatewayGroupOutcome AlexaForBusinessClient::GetGatewayGroup(const GetGatewayG
 
 GetGatewayGroupOutcomeCallable AlexaForBusinessClient::GetGatewayGroupCallable(const GetGatewayGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetGatewayGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetGatewayGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetGatewayGroupOutcome > >(ALLOCATION_TAG);
+  GetGatewayGroupAsync(request, [promise](const AlexaForBusinessClient*, const GetGatewayGroupRequest&, const GetGatewayGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetGatewayGroupAsync(const GetGatewayGroupRequest& request, const GetGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetGatewayGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetGatewayGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetGatewayGroupOutcome(GetGatewayGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetGatewayGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetGatewayGroupAsyncHelper(const GetGatewayGroupRequest& request, const GetGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1644,15 +2218,29 @@ GetInvitationConfigurationOutcome AlexaForBusinessClient::GetInvitationConfigura
 
 GetInvitationConfigurationOutcomeCallable AlexaForBusinessClient::GetInvitationConfigurationCallable(const GetInvitationConfigurationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetInvitationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetInvitationConfiguration(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetInvitationConfigurationOutcome > >(ALLOCATION_TAG);
+  GetInvitationConfigurationAsync(request, [promise](const AlexaForBusinessClient*, const GetInvitationConfigurationRequest&, const GetInvitationConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetInvitationConfigurationAsync(const GetInvitationConfigurationRequest& request, const GetInvitationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetInvitationConfigurationAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetInvitationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetInvitationConfigurationOutcome(GetInvitationConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetInvitationConfigurationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetInvitationConfigurationAsyncHelper(const GetInvitationConfigurationRequest& request, const GetInvitationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1679,15 +2267,29 @@ GetProfileOutcome AlexaForBusinessClient::GetProfile(const GetProfileRequest& re
 
 GetProfileOutcomeCallable AlexaForBusinessClient::GetProfileCallable(const GetProfileRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetProfileOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetProfile(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetProfileOutcome > >(ALLOCATION_TAG);
+  GetProfileAsync(request, [promise](const AlexaForBusinessClient*, const GetProfileRequest&, const GetProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetProfileAsync(const GetProfileRequest& request, const GetProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetProfileAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetProfileRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetProfileOutcome(GetProfileResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetProfileOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetProfileAsyncHelper(const GetProfileRequest& request, const GetProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1714,15 +2316,29 @@ GetRoomOutcome AlexaForBusinessClient::GetRoom(const GetRoomRequest& request) co
 
 GetRoomOutcomeCallable AlexaForBusinessClient::GetRoomCallable(const GetRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetRoomOutcome > >(ALLOCATION_TAG);
+  GetRoomAsync(request, [promise](const AlexaForBusinessClient*, const GetRoomRequest&, const GetRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetRoomAsync(const GetRoomRequest& request, const GetRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetRoomOutcome(GetRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetRoomAsyncHelper(const GetRoomRequest& request, const GetRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1749,15 +2365,29 @@ GetRoomSkillParameterOutcome AlexaForBusinessClient::GetRoomSkillParameter(const
 
 GetRoomSkillParameterOutcomeCallable AlexaForBusinessClient::GetRoomSkillParameterCallable(const GetRoomSkillParameterRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetRoomSkillParameterOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetRoomSkillParameter(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetRoomSkillParameterOutcome > >(ALLOCATION_TAG);
+  GetRoomSkillParameterAsync(request, [promise](const AlexaForBusinessClient*, const GetRoomSkillParameterRequest&, const GetRoomSkillParameterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetRoomSkillParameterAsync(const GetRoomSkillParameterRequest& request, const GetRoomSkillParameterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetRoomSkillParameterAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetRoomSkillParameterRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetRoomSkillParameterOutcome(GetRoomSkillParameterResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetRoomSkillParameterOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetRoomSkillParameterAsyncHelper(const GetRoomSkillParameterRequest& request, const GetRoomSkillParameterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1784,15 +2414,29 @@ GetSkillGroupOutcome AlexaForBusinessClient::GetSkillGroup(const GetSkillGroupRe
 
 GetSkillGroupOutcomeCallable AlexaForBusinessClient::GetSkillGroupCallable(const GetSkillGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetSkillGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetSkillGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetSkillGroupOutcome > >(ALLOCATION_TAG);
+  GetSkillGroupAsync(request, [promise](const AlexaForBusinessClient*, const GetSkillGroupRequest&, const GetSkillGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::GetSkillGroupAsync(const GetSkillGroupRequest& request, const GetSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetSkillGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetSkillGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetSkillGroupOutcome(GetSkillGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetSkillGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::GetSkillGroupAsyncHelper(const GetSkillGroupRequest& request, const GetSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1819,15 +2463,29 @@ ListBusinessReportSchedulesOutcome AlexaForBusinessClient::ListBusinessReportSch
 
 ListBusinessReportSchedulesOutcomeCallable AlexaForBusinessClient::ListBusinessReportSchedulesCallable(const ListBusinessReportSchedulesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListBusinessReportSchedulesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListBusinessReportSchedules(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListBusinessReportSchedulesOutcome > >(ALLOCATION_TAG);
+  ListBusinessReportSchedulesAsync(request, [promise](const AlexaForBusinessClient*, const ListBusinessReportSchedulesRequest&, const ListBusinessReportSchedulesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListBusinessReportSchedulesAsync(const ListBusinessReportSchedulesRequest& request, const ListBusinessReportSchedulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListBusinessReportSchedulesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBusinessReportSchedulesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListBusinessReportSchedulesOutcome(ListBusinessReportSchedulesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListBusinessReportSchedulesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListBusinessReportSchedulesAsyncHelper(const ListBusinessReportSchedulesRequest& request, const ListBusinessReportSchedulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1854,15 +2512,29 @@ ListConferenceProvidersOutcome AlexaForBusinessClient::ListConferenceProviders(c
 
 ListConferenceProvidersOutcomeCallable AlexaForBusinessClient::ListConferenceProvidersCallable(const ListConferenceProvidersRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListConferenceProvidersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListConferenceProviders(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListConferenceProvidersOutcome > >(ALLOCATION_TAG);
+  ListConferenceProvidersAsync(request, [promise](const AlexaForBusinessClient*, const ListConferenceProvidersRequest&, const ListConferenceProvidersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListConferenceProvidersAsync(const ListConferenceProvidersRequest& request, const ListConferenceProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListConferenceProvidersAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListConferenceProvidersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListConferenceProvidersOutcome(ListConferenceProvidersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListConferenceProvidersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListConferenceProvidersAsyncHelper(const ListConferenceProvidersRequest& request, const ListConferenceProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1889,15 +2561,29 @@ ListDeviceEventsOutcome AlexaForBusinessClient::ListDeviceEvents(const ListDevic
 
 ListDeviceEventsOutcomeCallable AlexaForBusinessClient::ListDeviceEventsCallable(const ListDeviceEventsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDeviceEventsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDeviceEvents(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListDeviceEventsOutcome > >(ALLOCATION_TAG);
+  ListDeviceEventsAsync(request, [promise](const AlexaForBusinessClient*, const ListDeviceEventsRequest&, const ListDeviceEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListDeviceEventsAsync(const ListDeviceEventsRequest& request, const ListDeviceEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListDeviceEventsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListDeviceEventsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDeviceEventsOutcome(ListDeviceEventsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDeviceEventsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListDeviceEventsAsyncHelper(const ListDeviceEventsRequest& request, const ListDeviceEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1924,15 +2610,29 @@ ListGatewayGroupsOutcome AlexaForBusinessClient::ListGatewayGroups(const ListGat
 
 ListGatewayGroupsOutcomeCallable AlexaForBusinessClient::ListGatewayGroupsCallable(const ListGatewayGroupsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListGatewayGroupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListGatewayGroups(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListGatewayGroupsOutcome > >(ALLOCATION_TAG);
+  ListGatewayGroupsAsync(request, [promise](const AlexaForBusinessClient*, const ListGatewayGroupsRequest&, const ListGatewayGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListGatewayGroupsAsync(const ListGatewayGroupsRequest& request, const ListGatewayGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListGatewayGroupsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListGatewayGroupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListGatewayGroupsOutcome(ListGatewayGroupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListGatewayGroupsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListGatewayGroupsAsyncHelper(const ListGatewayGroupsRequest& request, const ListGatewayGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1959,15 +2659,29 @@ ListGatewaysOutcome AlexaForBusinessClient::ListGateways(const ListGatewaysReque
 
 ListGatewaysOutcomeCallable AlexaForBusinessClient::ListGatewaysCallable(const ListGatewaysRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListGatewaysOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListGateways(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListGatewaysOutcome > >(ALLOCATION_TAG);
+  ListGatewaysAsync(request, [promise](const AlexaForBusinessClient*, const ListGatewaysRequest&, const ListGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListGatewaysAsync(const ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListGatewaysAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListGatewaysRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListGatewaysOutcome(ListGatewaysResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListGatewaysOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListGatewaysAsyncHelper(const ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1994,15 +2708,29 @@ ListSkillsOutcome AlexaForBusinessClient::ListSkills(const ListSkillsRequest& re
 
 ListSkillsOutcomeCallable AlexaForBusinessClient::ListSkillsCallable(const ListSkillsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListSkillsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListSkills(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListSkillsOutcome > >(ALLOCATION_TAG);
+  ListSkillsAsync(request, [promise](const AlexaForBusinessClient*, const ListSkillsRequest&, const ListSkillsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListSkillsAsync(const ListSkillsRequest& request, const ListSkillsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListSkillsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListSkillsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListSkillsOutcome(ListSkillsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListSkillsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListSkillsAsyncHelper(const ListSkillsRequest& request, const ListSkillsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2029,15 +2757,29 @@ ListSkillsStoreCategoriesOutcome AlexaForBusinessClient::ListSkillsStoreCategori
 
 ListSkillsStoreCategoriesOutcomeCallable AlexaForBusinessClient::ListSkillsStoreCategoriesCallable(const ListSkillsStoreCategoriesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListSkillsStoreCategoriesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListSkillsStoreCategories(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListSkillsStoreCategoriesOutcome > >(ALLOCATION_TAG);
+  ListSkillsStoreCategoriesAsync(request, [promise](const AlexaForBusinessClient*, const ListSkillsStoreCategoriesRequest&, const ListSkillsStoreCategoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListSkillsStoreCategoriesAsync(const ListSkillsStoreCategoriesRequest& request, const ListSkillsStoreCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListSkillsStoreCategoriesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListSkillsStoreCategoriesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListSkillsStoreCategoriesOutcome(ListSkillsStoreCategoriesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListSkillsStoreCategoriesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListSkillsStoreCategoriesAsyncHelper(const ListSkillsStoreCategoriesRequest& request, const ListSkillsStoreCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2064,15 +2806,29 @@ ListSkillsStoreSkillsByCategoryOutcome AlexaForBusinessClient::ListSkillsStoreSk
 
 ListSkillsStoreSkillsByCategoryOutcomeCallable AlexaForBusinessClient::ListSkillsStoreSkillsByCategoryCallable(const ListSkillsStoreSkillsByCategoryRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListSkillsStoreSkillsByCategoryOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListSkillsStoreSkillsByCategory(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListSkillsStoreSkillsByCategoryOutcome > >(ALLOCATION_TAG);
+  ListSkillsStoreSkillsByCategoryAsync(request, [promise](const AlexaForBusinessClient*, const ListSkillsStoreSkillsByCategoryRequest&, const ListSkillsStoreSkillsByCategoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListSkillsStoreSkillsByCategoryAsync(const ListSkillsStoreSkillsByCategoryRequest& request, const ListSkillsStoreSkillsByCategoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListSkillsStoreSkillsByCategoryAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListSkillsStoreSkillsByCategoryRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListSkillsStoreSkillsByCategoryOutcome(ListSkillsStoreSkillsByCategoryResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListSkillsStoreSkillsByCategoryOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListSkillsStoreSkillsByCategoryAsyncHelper(const ListSkillsStoreSkillsByCategoryRequest& request, const ListSkillsStoreSkillsByCategoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2099,15 +2855,29 @@ ListSmartHomeAppliancesOutcome AlexaForBusinessClient::ListSmartHomeAppliances(c
 
 ListSmartHomeAppliancesOutcomeCallable AlexaForBusinessClient::ListSmartHomeAppliancesCallable(const ListSmartHomeAppliancesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListSmartHomeAppliancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListSmartHomeAppliances(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListSmartHomeAppliancesOutcome > >(ALLOCATION_TAG);
+  ListSmartHomeAppliancesAsync(request, [promise](const AlexaForBusinessClient*, const ListSmartHomeAppliancesRequest&, const ListSmartHomeAppliancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListSmartHomeAppliancesAsync(const ListSmartHomeAppliancesRequest& request, const ListSmartHomeAppliancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListSmartHomeAppliancesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListSmartHomeAppliancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListSmartHomeAppliancesOutcome(ListSmartHomeAppliancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListSmartHomeAppliancesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListSmartHomeAppliancesAsyncHelper(const ListSmartHomeAppliancesRequest& request, const ListSmartHomeAppliancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2134,15 +2904,29 @@ ListTagsOutcome AlexaForBusinessClient::ListTags(const ListTagsRequest& request)
 
 ListTagsOutcomeCallable AlexaForBusinessClient::ListTagsCallable(const ListTagsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTags(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListTagsOutcome > >(ALLOCATION_TAG);
+  ListTagsAsync(request, [promise](const AlexaForBusinessClient*, const ListTagsRequest&, const ListTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ListTagsAsync(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsOutcome(ListTagsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ListTagsAsyncHelper(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2169,15 +2953,29 @@ PutConferencePreferenceOutcome AlexaForBusinessClient::PutConferencePreference(c
 
 PutConferencePreferenceOutcomeCallable AlexaForBusinessClient::PutConferencePreferenceCallable(const PutConferencePreferenceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< PutConferencePreferenceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutConferencePreference(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< PutConferencePreferenceOutcome > >(ALLOCATION_TAG);
+  PutConferencePreferenceAsync(request, [promise](const AlexaForBusinessClient*, const PutConferencePreferenceRequest&, const PutConferencePreferenceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::PutConferencePreferenceAsync(const PutConferencePreferenceRequest& request, const PutConferencePreferenceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutConferencePreferenceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutConferencePreferenceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutConferencePreferenceOutcome(PutConferencePreferenceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutConferencePreferenceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::PutConferencePreferenceAsyncHelper(const PutConferencePreferenceRequest& request, const PutConferencePreferenceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2204,15 +3002,29 @@ PutInvitationConfigurationOutcome AlexaForBusinessClient::PutInvitationConfigura
 
 PutInvitationConfigurationOutcomeCallable AlexaForBusinessClient::PutInvitationConfigurationCallable(const PutInvitationConfigurationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< PutInvitationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutInvitationConfiguration(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< PutInvitationConfigurationOutcome > >(ALLOCATION_TAG);
+  PutInvitationConfigurationAsync(request, [promise](const AlexaForBusinessClient*, const PutInvitationConfigurationRequest&, const PutInvitationConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::PutInvitationConfigurationAsync(const PutInvitationConfigurationRequest& request, const PutInvitationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutInvitationConfigurationAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutInvitationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutInvitationConfigurationOutcome(PutInvitationConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutInvitationConfigurationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::PutInvitationConfigurationAsyncHelper(const PutInvitationConfigurationRequest& request, const PutInvitationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2239,15 +3051,29 @@ PutRoomSkillParameterOutcome AlexaForBusinessClient::PutRoomSkillParameter(const
 
 PutRoomSkillParameterOutcomeCallable AlexaForBusinessClient::PutRoomSkillParameterCallable(const PutRoomSkillParameterRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< PutRoomSkillParameterOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutRoomSkillParameter(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< PutRoomSkillParameterOutcome > >(ALLOCATION_TAG);
+  PutRoomSkillParameterAsync(request, [promise](const AlexaForBusinessClient*, const PutRoomSkillParameterRequest&, const PutRoomSkillParameterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::PutRoomSkillParameterAsync(const PutRoomSkillParameterRequest& request, const PutRoomSkillParameterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutRoomSkillParameterAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutRoomSkillParameterRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutRoomSkillParameterOutcome(PutRoomSkillParameterResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutRoomSkillParameterOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::PutRoomSkillParameterAsyncHelper(const PutRoomSkillParameterRequest& request, const PutRoomSkillParameterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2274,15 +3100,29 @@ PutSkillAuthorizationOutcome AlexaForBusinessClient::PutSkillAuthorization(const
 
 PutSkillAuthorizationOutcomeCallable AlexaForBusinessClient::PutSkillAuthorizationCallable(const PutSkillAuthorizationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< PutSkillAuthorizationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutSkillAuthorization(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< PutSkillAuthorizationOutcome > >(ALLOCATION_TAG);
+  PutSkillAuthorizationAsync(request, [promise](const AlexaForBusinessClient*, const PutSkillAuthorizationRequest&, const PutSkillAuthorizationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::PutSkillAuthorizationAsync(const PutSkillAuthorizationRequest& request, const PutSkillAuthorizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutSkillAuthorizationAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutSkillAuthorizationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutSkillAuthorizationOutcome(PutSkillAuthorizationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutSkillAuthorizationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::PutSkillAuthorizationAsyncHelper(const PutSkillAuthorizationRequest& request, const PutSkillAuthorizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2309,15 +3149,29 @@ RegisterAVSDeviceOutcome AlexaForBusinessClient::RegisterAVSDevice(const Registe
 
 RegisterAVSDeviceOutcomeCallable AlexaForBusinessClient::RegisterAVSDeviceCallable(const RegisterAVSDeviceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RegisterAVSDeviceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RegisterAVSDevice(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RegisterAVSDeviceOutcome > >(ALLOCATION_TAG);
+  RegisterAVSDeviceAsync(request, [promise](const AlexaForBusinessClient*, const RegisterAVSDeviceRequest&, const RegisterAVSDeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::RegisterAVSDeviceAsync(const RegisterAVSDeviceRequest& request, const RegisterAVSDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RegisterAVSDeviceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RegisterAVSDeviceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RegisterAVSDeviceOutcome(RegisterAVSDeviceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RegisterAVSDeviceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::RegisterAVSDeviceAsyncHelper(const RegisterAVSDeviceRequest& request, const RegisterAVSDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2344,15 +3198,29 @@ RejectSkillOutcome AlexaForBusinessClient::RejectSkill(const RejectSkillRequest&
 
 RejectSkillOutcomeCallable AlexaForBusinessClient::RejectSkillCallable(const RejectSkillRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RejectSkillOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RejectSkill(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RejectSkillOutcome > >(ALLOCATION_TAG);
+  RejectSkillAsync(request, [promise](const AlexaForBusinessClient*, const RejectSkillRequest&, const RejectSkillOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::RejectSkillAsync(const RejectSkillRequest& request, const RejectSkillResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RejectSkillAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RejectSkillRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RejectSkillOutcome(RejectSkillResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RejectSkillOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::RejectSkillAsyncHelper(const RejectSkillRequest& request, const RejectSkillResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2379,15 +3247,29 @@ ResolveRoomOutcome AlexaForBusinessClient::ResolveRoom(const ResolveRoomRequest&
 
 ResolveRoomOutcomeCallable AlexaForBusinessClient::ResolveRoomCallable(const ResolveRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ResolveRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ResolveRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ResolveRoomOutcome > >(ALLOCATION_TAG);
+  ResolveRoomAsync(request, [promise](const AlexaForBusinessClient*, const ResolveRoomRequest&, const ResolveRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::ResolveRoomAsync(const ResolveRoomRequest& request, const ResolveRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ResolveRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ResolveRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ResolveRoomOutcome(ResolveRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ResolveRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::ResolveRoomAsyncHelper(const ResolveRoomRequest& request, const ResolveRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2414,15 +3296,29 @@ RevokeInvitationOutcome AlexaForBusinessClient::RevokeInvitation(const RevokeInv
 
 RevokeInvitationOutcomeCallable AlexaForBusinessClient::RevokeInvitationCallable(const RevokeInvitationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RevokeInvitationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RevokeInvitation(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RevokeInvitationOutcome > >(ALLOCATION_TAG);
+  RevokeInvitationAsync(request, [promise](const AlexaForBusinessClient*, const RevokeInvitationRequest&, const RevokeInvitationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::RevokeInvitationAsync(const RevokeInvitationRequest& request, const RevokeInvitationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RevokeInvitationAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RevokeInvitationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RevokeInvitationOutcome(RevokeInvitationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RevokeInvitationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::RevokeInvitationAsyncHelper(const RevokeInvitationRequest& request, const RevokeInvitationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2449,15 +3345,29 @@ SearchAddressBooksOutcome AlexaForBusinessClient::SearchAddressBooks(const Searc
 
 SearchAddressBooksOutcomeCallable AlexaForBusinessClient::SearchAddressBooksCallable(const SearchAddressBooksRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchAddressBooksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchAddressBooks(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchAddressBooksOutcome > >(ALLOCATION_TAG);
+  SearchAddressBooksAsync(request, [promise](const AlexaForBusinessClient*, const SearchAddressBooksRequest&, const SearchAddressBooksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchAddressBooksAsync(const SearchAddressBooksRequest& request, const SearchAddressBooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchAddressBooksAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchAddressBooksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchAddressBooksOutcome(SearchAddressBooksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchAddressBooksOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchAddressBooksAsyncHelper(const SearchAddressBooksRequest& request, const SearchAddressBooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2484,15 +3394,29 @@ SearchContactsOutcome AlexaForBusinessClient::SearchContacts(const SearchContact
 
 SearchContactsOutcomeCallable AlexaForBusinessClient::SearchContactsCallable(const SearchContactsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchContactsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchContacts(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchContactsOutcome > >(ALLOCATION_TAG);
+  SearchContactsAsync(request, [promise](const AlexaForBusinessClient*, const SearchContactsRequest&, const SearchContactsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchContactsAsync(const SearchContactsRequest& request, const SearchContactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchContactsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchContactsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchContactsOutcome(SearchContactsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchContactsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchContactsAsyncHelper(const SearchContactsRequest& request, const SearchContactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2519,15 +3443,29 @@ SearchDevicesOutcome AlexaForBusinessClient::SearchDevices(const SearchDevicesRe
 
 SearchDevicesOutcomeCallable AlexaForBusinessClient::SearchDevicesCallable(const SearchDevicesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchDevicesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchDevices(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchDevicesOutcome > >(ALLOCATION_TAG);
+  SearchDevicesAsync(request, [promise](const AlexaForBusinessClient*, const SearchDevicesRequest&, const SearchDevicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchDevicesAsync(const SearchDevicesRequest& request, const SearchDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchDevicesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchDevicesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchDevicesOutcome(SearchDevicesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchDevicesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchDevicesAsyncHelper(const SearchDevicesRequest& request, const SearchDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2554,15 +3492,29 @@ SearchProfilesOutcome AlexaForBusinessClient::SearchProfiles(const SearchProfile
 
 SearchProfilesOutcomeCallable AlexaForBusinessClient::SearchProfilesCallable(const SearchProfilesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchProfilesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchProfiles(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchProfilesOutcome > >(ALLOCATION_TAG);
+  SearchProfilesAsync(request, [promise](const AlexaForBusinessClient*, const SearchProfilesRequest&, const SearchProfilesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchProfilesAsync(const SearchProfilesRequest& request, const SearchProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchProfilesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchProfilesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchProfilesOutcome(SearchProfilesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchProfilesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchProfilesAsyncHelper(const SearchProfilesRequest& request, const SearchProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2589,15 +3541,29 @@ SearchRoomsOutcome AlexaForBusinessClient::SearchRooms(const SearchRoomsRequest&
 
 SearchRoomsOutcomeCallable AlexaForBusinessClient::SearchRoomsCallable(const SearchRoomsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchRoomsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchRooms(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchRoomsOutcome > >(ALLOCATION_TAG);
+  SearchRoomsAsync(request, [promise](const AlexaForBusinessClient*, const SearchRoomsRequest&, const SearchRoomsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchRoomsAsync(const SearchRoomsRequest& request, const SearchRoomsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchRoomsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchRoomsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchRoomsOutcome(SearchRoomsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchRoomsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchRoomsAsyncHelper(const SearchRoomsRequest& request, const SearchRoomsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2624,15 +3590,29 @@ SearchSkillGroupsOutcome AlexaForBusinessClient::SearchSkillGroups(const SearchS
 
 SearchSkillGroupsOutcomeCallable AlexaForBusinessClient::SearchSkillGroupsCallable(const SearchSkillGroupsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchSkillGroupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchSkillGroups(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchSkillGroupsOutcome > >(ALLOCATION_TAG);
+  SearchSkillGroupsAsync(request, [promise](const AlexaForBusinessClient*, const SearchSkillGroupsRequest&, const SearchSkillGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchSkillGroupsAsync(const SearchSkillGroupsRequest& request, const SearchSkillGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchSkillGroupsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchSkillGroupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchSkillGroupsOutcome(SearchSkillGroupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchSkillGroupsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchSkillGroupsAsyncHelper(const SearchSkillGroupsRequest& request, const SearchSkillGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2659,15 +3639,29 @@ SearchUsersOutcome AlexaForBusinessClient::SearchUsers(const SearchUsersRequest&
 
 SearchUsersOutcomeCallable AlexaForBusinessClient::SearchUsersCallable(const SearchUsersRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SearchUsersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SearchUsers(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SearchUsersOutcome > >(ALLOCATION_TAG);
+  SearchUsersAsync(request, [promise](const AlexaForBusinessClient*, const SearchUsersRequest&, const SearchUsersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SearchUsersAsync(const SearchUsersRequest& request, const SearchUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SearchUsersAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SearchUsersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchUsersOutcome(SearchUsersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchUsersOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SearchUsersAsyncHelper(const SearchUsersRequest& request, const SearchUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2694,15 +3688,29 @@ SendAnnouncementOutcome AlexaForBusinessClient::SendAnnouncement(const SendAnnou
 
 SendAnnouncementOutcomeCallable AlexaForBusinessClient::SendAnnouncementCallable(const SendAnnouncementRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SendAnnouncementOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SendAnnouncement(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SendAnnouncementOutcome > >(ALLOCATION_TAG);
+  SendAnnouncementAsync(request, [promise](const AlexaForBusinessClient*, const SendAnnouncementRequest&, const SendAnnouncementOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SendAnnouncementAsync(const SendAnnouncementRequest& request, const SendAnnouncementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SendAnnouncementAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SendAnnouncementRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SendAnnouncementOutcome(SendAnnouncementResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SendAnnouncementOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SendAnnouncementAsyncHelper(const SendAnnouncementRequest& request, const SendAnnouncementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2729,15 +3737,29 @@ SendInvitationOutcome AlexaForBusinessClient::SendInvitation(const SendInvitatio
 
 SendInvitationOutcomeCallable AlexaForBusinessClient::SendInvitationCallable(const SendInvitationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< SendInvitationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SendInvitation(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< SendInvitationOutcome > >(ALLOCATION_TAG);
+  SendInvitationAsync(request, [promise](const AlexaForBusinessClient*, const SendInvitationRequest&, const SendInvitationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::SendInvitationAsync(const SendInvitationRequest& request, const SendInvitationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->SendInvitationAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<SendInvitationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SendInvitationOutcome(SendInvitationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SendInvitationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::SendInvitationAsyncHelper(const SendInvitationRequest& request, const SendInvitationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2764,15 +3786,29 @@ StartDeviceSyncOutcome AlexaForBusinessClient::StartDeviceSync(const StartDevice
 
 StartDeviceSyncOutcomeCallable AlexaForBusinessClient::StartDeviceSyncCallable(const StartDeviceSyncRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< StartDeviceSyncOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->StartDeviceSync(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< StartDeviceSyncOutcome > >(ALLOCATION_TAG);
+  StartDeviceSyncAsync(request, [promise](const AlexaForBusinessClient*, const StartDeviceSyncRequest&, const StartDeviceSyncOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::StartDeviceSyncAsync(const StartDeviceSyncRequest& request, const StartDeviceSyncResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->StartDeviceSyncAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<StartDeviceSyncRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, StartDeviceSyncOutcome(StartDeviceSyncResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, StartDeviceSyncOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::StartDeviceSyncAsyncHelper(const StartDeviceSyncRequest& request, const StartDeviceSyncResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2799,15 +3835,29 @@ StartSmartHomeApplianceDiscoveryOutcome AlexaForBusinessClient::StartSmartHomeAp
 
 StartSmartHomeApplianceDiscoveryOutcomeCallable AlexaForBusinessClient::StartSmartHomeApplianceDiscoveryCallable(const StartSmartHomeApplianceDiscoveryRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< StartSmartHomeApplianceDiscoveryOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->StartSmartHomeApplianceDiscovery(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< StartSmartHomeApplianceDiscoveryOutcome > >(ALLOCATION_TAG);
+  StartSmartHomeApplianceDiscoveryAsync(request, [promise](const AlexaForBusinessClient*, const StartSmartHomeApplianceDiscoveryRequest&, const StartSmartHomeApplianceDiscoveryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::StartSmartHomeApplianceDiscoveryAsync(const StartSmartHomeApplianceDiscoveryRequest& request, const StartSmartHomeApplianceDiscoveryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->StartSmartHomeApplianceDiscoveryAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<StartSmartHomeApplianceDiscoveryRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, StartSmartHomeApplianceDiscoveryOutcome(StartSmartHomeApplianceDiscoveryResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, StartSmartHomeApplianceDiscoveryOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::StartSmartHomeApplianceDiscoveryAsyncHelper(const StartSmartHomeApplianceDiscoveryRequest& request, const StartSmartHomeApplianceDiscoveryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2834,15 +3884,29 @@ TagResourceOutcome AlexaForBusinessClient::TagResource(const TagResourceRequest&
 
 TagResourceOutcomeCallable AlexaForBusinessClient::TagResourceCallable(const TagResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TagResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TagResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< TagResourceOutcome > >(ALLOCATION_TAG);
+  TagResourceAsync(request, [promise](const AlexaForBusinessClient*, const TagResourceRequest&, const TagResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::TagResourceAsync(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TagResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TagResourceOutcome(TagResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TagResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::TagResourceAsyncHelper(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2869,15 +3933,29 @@ UntagResourceOutcome AlexaForBusinessClient::UntagResource(const UntagResourceRe
 
 UntagResourceOutcomeCallable AlexaForBusinessClient::UntagResourceCallable(const UntagResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UntagResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UntagResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UntagResourceOutcome > >(ALLOCATION_TAG);
+  UntagResourceAsync(request, [promise](const AlexaForBusinessClient*, const UntagResourceRequest&, const UntagResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UntagResourceAsync(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UntagResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UntagResourceOutcome(UntagResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UntagResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UntagResourceAsyncHelper(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2904,15 +3982,29 @@ UpdateAddressBookOutcome AlexaForBusinessClient::UpdateAddressBook(const UpdateA
 
 UpdateAddressBookOutcomeCallable AlexaForBusinessClient::UpdateAddressBookCallable(const UpdateAddressBookRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateAddressBookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAddressBook(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateAddressBookOutcome > >(ALLOCATION_TAG);
+  UpdateAddressBookAsync(request, [promise](const AlexaForBusinessClient*, const UpdateAddressBookRequest&, const UpdateAddressBookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateAddressBookAsync(const UpdateAddressBookRequest& request, const UpdateAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateAddressBookAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateAddressBookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAddressBookOutcome(UpdateAddressBookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAddressBookOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateAddressBookAsyncHelper(const UpdateAddressBookRequest& request, const UpdateAddressBookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2939,15 +4031,29 @@ UpdateBusinessReportScheduleOutcome AlexaForBusinessClient::UpdateBusinessReport
 
 UpdateBusinessReportScheduleOutcomeCallable AlexaForBusinessClient::UpdateBusinessReportScheduleCallable(const UpdateBusinessReportScheduleRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateBusinessReportScheduleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateBusinessReportSchedule(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateBusinessReportScheduleOutcome > >(ALLOCATION_TAG);
+  UpdateBusinessReportScheduleAsync(request, [promise](const AlexaForBusinessClient*, const UpdateBusinessReportScheduleRequest&, const UpdateBusinessReportScheduleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateBusinessReportScheduleAsync(const UpdateBusinessReportScheduleRequest& request, const UpdateBusinessReportScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateBusinessReportScheduleAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateBusinessReportScheduleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateBusinessReportScheduleOutcome(UpdateBusinessReportScheduleResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateBusinessReportScheduleOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateBusinessReportScheduleAsyncHelper(const UpdateBusinessReportScheduleRequest& request, const UpdateBusinessReportScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2974,15 +4080,29 @@ UpdateConferenceProviderOutcome AlexaForBusinessClient::UpdateConferenceProvider
 
 UpdateConferenceProviderOutcomeCallable AlexaForBusinessClient::UpdateConferenceProviderCallable(const UpdateConferenceProviderRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateConferenceProviderOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateConferenceProvider(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateConferenceProviderOutcome > >(ALLOCATION_TAG);
+  UpdateConferenceProviderAsync(request, [promise](const AlexaForBusinessClient*, const UpdateConferenceProviderRequest&, const UpdateConferenceProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateConferenceProviderAsync(const UpdateConferenceProviderRequest& request, const UpdateConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateConferenceProviderAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateConferenceProviderRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateConferenceProviderOutcome(UpdateConferenceProviderResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateConferenceProviderOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateConferenceProviderAsyncHelper(const UpdateConferenceProviderRequest& request, const UpdateConferenceProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3009,15 +4129,29 @@ UpdateContactOutcome AlexaForBusinessClient::UpdateContact(const UpdateContactRe
 
 UpdateContactOutcomeCallable AlexaForBusinessClient::UpdateContactCallable(const UpdateContactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateContactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateContact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateContactOutcome > >(ALLOCATION_TAG);
+  UpdateContactAsync(request, [promise](const AlexaForBusinessClient*, const UpdateContactRequest&, const UpdateContactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateContactAsync(const UpdateContactRequest& request, const UpdateContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateContactAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateContactRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateContactOutcome(UpdateContactResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateContactOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateContactAsyncHelper(const UpdateContactRequest& request, const UpdateContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3044,15 +4178,29 @@ UpdateDeviceOutcome AlexaForBusinessClient::UpdateDevice(const UpdateDeviceReque
 
 UpdateDeviceOutcomeCallable AlexaForBusinessClient::UpdateDeviceCallable(const UpdateDeviceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateDeviceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDevice(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateDeviceOutcome > >(ALLOCATION_TAG);
+  UpdateDeviceAsync(request, [promise](const AlexaForBusinessClient*, const UpdateDeviceRequest&, const UpdateDeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateDeviceAsync(const UpdateDeviceRequest& request, const UpdateDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateDeviceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateDeviceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDeviceOutcome(UpdateDeviceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDeviceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateDeviceAsyncHelper(const UpdateDeviceRequest& request, const UpdateDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3079,15 +4227,29 @@ UpdateGatewayOutcome AlexaForBusinessClient::UpdateGateway(const UpdateGatewayRe
 
 UpdateGatewayOutcomeCallable AlexaForBusinessClient::UpdateGatewayCallable(const UpdateGatewayRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateGatewayOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateGateway(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateGatewayOutcome > >(ALLOCATION_TAG);
+  UpdateGatewayAsync(request, [promise](const AlexaForBusinessClient*, const UpdateGatewayRequest&, const UpdateGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateGatewayAsync(const UpdateGatewayRequest& request, const UpdateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGatewayAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGatewayRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateGatewayOutcome(UpdateGatewayResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateGatewayOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateGatewayAsyncHelper(const UpdateGatewayRequest& request, const UpdateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3114,15 +4276,29 @@ UpdateGatewayGroupOutcome AlexaForBusinessClient::UpdateGatewayGroup(const Updat
 
 UpdateGatewayGroupOutcomeCallable AlexaForBusinessClient::UpdateGatewayGroupCallable(const UpdateGatewayGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateGatewayGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateGatewayGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateGatewayGroupOutcome > >(ALLOCATION_TAG);
+  UpdateGatewayGroupAsync(request, [promise](const AlexaForBusinessClient*, const UpdateGatewayGroupRequest&, const UpdateGatewayGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateGatewayGroupAsync(const UpdateGatewayGroupRequest& request, const UpdateGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGatewayGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGatewayGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateGatewayGroupOutcome(UpdateGatewayGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateGatewayGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateGatewayGroupAsyncHelper(const UpdateGatewayGroupRequest& request, const UpdateGatewayGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3149,15 +4325,29 @@ UpdateProfileOutcome AlexaForBusinessClient::UpdateProfile(const UpdateProfileRe
 
 UpdateProfileOutcomeCallable AlexaForBusinessClient::UpdateProfileCallable(const UpdateProfileRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateProfileOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateProfile(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateProfileOutcome > >(ALLOCATION_TAG);
+  UpdateProfileAsync(request, [promise](const AlexaForBusinessClient*, const UpdateProfileRequest&, const UpdateProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateProfileAsync(const UpdateProfileRequest& request, const UpdateProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateProfileAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateProfileRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateProfileOutcome(UpdateProfileResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateProfileOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateProfileAsyncHelper(const UpdateProfileRequest& request, const UpdateProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3184,15 +4374,29 @@ UpdateRoomOutcome AlexaForBusinessClient::UpdateRoom(const UpdateRoomRequest& re
 
 UpdateRoomOutcomeCallable AlexaForBusinessClient::UpdateRoomCallable(const UpdateRoomRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateRoomOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateRoom(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateRoomOutcome > >(ALLOCATION_TAG);
+  UpdateRoomAsync(request, [promise](const AlexaForBusinessClient*, const UpdateRoomRequest&, const UpdateRoomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateRoomAsync(const UpdateRoomRequest& request, const UpdateRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateRoomAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateRoomRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateRoomOutcome(UpdateRoomResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateRoomOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateRoomAsyncHelper(const UpdateRoomRequest& request, const UpdateRoomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3219,15 +4423,29 @@ UpdateSkillGroupOutcome AlexaForBusinessClient::UpdateSkillGroup(const UpdateSki
 
 UpdateSkillGroupOutcomeCallable AlexaForBusinessClient::UpdateSkillGroupCallable(const UpdateSkillGroupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateSkillGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateSkillGroup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateSkillGroupOutcome > >(ALLOCATION_TAG);
+  UpdateSkillGroupAsync(request, [promise](const AlexaForBusinessClient*, const UpdateSkillGroupRequest&, const UpdateSkillGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AlexaForBusinessClient::UpdateSkillGroupAsync(const UpdateSkillGroupRequest& request, const UpdateSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateSkillGroupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateSkillGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateSkillGroupOutcome(UpdateSkillGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateSkillGroupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AlexaForBusinessClient::UpdateSkillGroupAsyncHelper(const UpdateSkillGroupRequest& request, const UpdateSkillGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -142,15 +142,29 @@ CreateAppOutcome AmplifyClient::CreateApp(const CreateAppRequest& request) const
 
 CreateAppOutcomeCallable AmplifyClient::CreateAppCallable(const CreateAppRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateAppOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateApp(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateAppOutcome > >(ALLOCATION_TAG);
+  CreateAppAsync(request, [promise](const AmplifyClient*, const CreateAppRequest&, const CreateAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::CreateAppAsync(const CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateAppAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateAppRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAppOutcome(CreateAppResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAppOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::CreateAppAsyncHelper(const CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -184,15 +198,36 @@ CreateBranchOutcome AmplifyClient::CreateBranch(const CreateBranchRequest& reque
 
 CreateBranchOutcomeCallable AmplifyClient::CreateBranchCallable(const CreateBranchRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateBranchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBranch(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateBranchOutcome > >(ALLOCATION_TAG);
+  CreateBranchAsync(request, [promise](const AmplifyClient*, const CreateBranchRequest&, const CreateBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::CreateBranchAsync(const CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateBranchAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateBranchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateBranchOutcome(CreateBranchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateBranchOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::CreateBranchAsyncHelper(const CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -226,15 +261,36 @@ CreateDomainAssociationOutcome AmplifyClient::CreateDomainAssociation(const Crea
 
 CreateDomainAssociationOutcomeCallable AmplifyClient::CreateDomainAssociationCallable(const CreateDomainAssociationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateDomainAssociationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDomainAssociation(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateDomainAssociationOutcome > >(ALLOCATION_TAG);
+  CreateDomainAssociationAsync(request, [promise](const AmplifyClient*, const CreateDomainAssociationRequest&, const CreateDomainAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::CreateDomainAssociationAsync(const CreateDomainAssociationRequest& request, const CreateDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateDomainAssociationAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/domains";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateDomainAssociationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDomainAssociationOutcome(CreateDomainAssociationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDomainAssociationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::CreateDomainAssociationAsyncHelper(const CreateDomainAssociationRequest& request, const CreateDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -267,15 +323,35 @@ DeleteAppOutcome AmplifyClient::DeleteApp(const DeleteAppRequest& request) const
 
 DeleteAppOutcomeCallable AmplifyClient::DeleteAppCallable(const DeleteAppRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteAppOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteApp(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteAppOutcome > >(ALLOCATION_TAG);
+  DeleteAppAsync(request, [promise](const AmplifyClient*, const DeleteAppRequest&, const DeleteAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::DeleteAppAsync(const DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteAppAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteAppAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteAppRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAppOutcome(DeleteAppResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAppOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::DeleteAppAsyncHelper(const DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -315,15 +391,42 @@ DeleteBranchOutcome AmplifyClient::DeleteBranch(const DeleteBranchRequest& reque
 
 DeleteBranchOutcomeCallable AmplifyClient::DeleteBranchCallable(const DeleteBranchRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteBranchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBranch(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteBranchOutcome > >(ALLOCATION_TAG);
+  DeleteBranchAsync(request, [promise](const AmplifyClient*, const DeleteBranchRequest&, const DeleteBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::DeleteBranchAsync(const DeleteBranchRequest& request, const DeleteBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteBranchAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBranchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBranchOutcome(DeleteBranchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBranchOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::DeleteBranchAsyncHelper(const DeleteBranchRequest& request, const DeleteBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -363,15 +466,42 @@ DeleteDomainAssociationOutcome AmplifyClient::DeleteDomainAssociation(const Dele
 
 DeleteDomainAssociationOutcomeCallable AmplifyClient::DeleteDomainAssociationCallable(const DeleteDomainAssociationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteDomainAssociationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDomainAssociation(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteDomainAssociationOutcome > >(ALLOCATION_TAG);
+  DeleteDomainAssociationAsync(request, [promise](const AmplifyClient*, const DeleteDomainAssociationRequest&, const DeleteDomainAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::DeleteDomainAssociationAsync(const DeleteDomainAssociationRequest& request, const DeleteDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteDomainAssociationAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.DomainNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/domains/";
+  ss << request.GetDomainName();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteDomainAssociationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDomainAssociationOutcome(DeleteDomainAssociationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDomainAssociationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::DeleteDomainAssociationAsyncHelper(const DeleteDomainAssociationRequest& request, const DeleteDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -418,15 +548,49 @@ DeleteJobOutcome AmplifyClient::DeleteJob(const DeleteJobRequest& request) const
 
 DeleteJobOutcomeCallable AmplifyClient::DeleteJobCallable(const DeleteJobRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteJobOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteJob(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteJobOutcome > >(ALLOCATION_TAG);
+  DeleteJobAsync(request, [promise](const AmplifyClient*, const DeleteJobRequest&, const DeleteJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::DeleteJobAsync(const DeleteJobRequest& request, const DeleteJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteJobAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.JobIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  ss << "/jobs/";
+  ss << request.GetJobId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteJobRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteJobOutcome(DeleteJobResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteJobOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::DeleteJobAsyncHelper(const DeleteJobRequest& request, const DeleteJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -459,15 +623,35 @@ GetAppOutcome AmplifyClient::GetApp(const GetAppRequest& request) const
 
 GetAppOutcomeCallable AmplifyClient::GetAppCallable(const GetAppRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetAppOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetApp(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetAppOutcome > >(ALLOCATION_TAG);
+  GetAppAsync(request, [promise](const AmplifyClient*, const GetAppRequest&, const GetAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::GetAppAsync(const GetAppRequest& request, const GetAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetAppAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetAppAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetAppRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAppOutcome(GetAppResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAppOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::GetAppAsyncHelper(const GetAppRequest& request, const GetAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -507,15 +691,42 @@ GetBranchOutcome AmplifyClient::GetBranch(const GetBranchRequest& request) const
 
 GetBranchOutcomeCallable AmplifyClient::GetBranchCallable(const GetBranchRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetBranchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBranch(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetBranchOutcome > >(ALLOCATION_TAG);
+  GetBranchAsync(request, [promise](const AmplifyClient*, const GetBranchRequest&, const GetBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::GetBranchAsync(const GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetBranchAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetBranchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBranchOutcome(GetBranchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBranchOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::GetBranchAsyncHelper(const GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,15 +766,42 @@ GetDomainAssociationOutcome AmplifyClient::GetDomainAssociation(const GetDomainA
 
 GetDomainAssociationOutcomeCallable AmplifyClient::GetDomainAssociationCallable(const GetDomainAssociationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetDomainAssociationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDomainAssociation(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetDomainAssociationOutcome > >(ALLOCATION_TAG);
+  GetDomainAssociationAsync(request, [promise](const AmplifyClient*, const GetDomainAssociationRequest&, const GetDomainAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::GetDomainAssociationAsync(const GetDomainAssociationRequest& request, const GetDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetDomainAssociationAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.DomainNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/domains/";
+  ss << request.GetDomainName();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetDomainAssociationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDomainAssociationOutcome(GetDomainAssociationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDomainAssociationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::GetDomainAssociationAsyncHelper(const GetDomainAssociationRequest& request, const GetDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -610,15 +848,49 @@ GetJobOutcome AmplifyClient::GetJob(const GetJobRequest& request) const
 
 GetJobOutcomeCallable AmplifyClient::GetJobCallable(const GetJobRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetJobOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetJob(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetJobOutcome > >(ALLOCATION_TAG);
+  GetJobAsync(request, [promise](const AmplifyClient*, const GetJobRequest&, const GetJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::GetJobAsync(const GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetJobAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.JobIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  ss << "/jobs/";
+  ss << request.GetJobId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetJobRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetJobOutcome(GetJobResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetJobOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::GetJobAsyncHelper(const GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -645,15 +917,29 @@ ListAppsOutcome AmplifyClient::ListApps(const ListAppsRequest& request) const
 
 ListAppsOutcomeCallable AmplifyClient::ListAppsCallable(const ListAppsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListAppsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListApps(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListAppsOutcome > >(ALLOCATION_TAG);
+  ListAppsAsync(request, [promise](const AmplifyClient*, const ListAppsRequest&, const ListAppsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::ListAppsAsync(const ListAppsRequest& request, const ListAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListAppsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListAppsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListAppsOutcome(ListAppsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListAppsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::ListAppsAsyncHelper(const ListAppsRequest& request, const ListAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -687,15 +973,36 @@ ListBranchesOutcome AmplifyClient::ListBranches(const ListBranchesRequest& reque
 
 ListBranchesOutcomeCallable AmplifyClient::ListBranchesCallable(const ListBranchesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListBranchesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListBranches(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListBranchesOutcome > >(ALLOCATION_TAG);
+  ListBranchesAsync(request, [promise](const AmplifyClient*, const ListBranchesRequest&, const ListBranchesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::ListBranchesAsync(const ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListBranchesAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListBranchesAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBranchesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListBranchesOutcome(ListBranchesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListBranchesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::ListBranchesAsyncHelper(const ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -729,15 +1036,36 @@ ListDomainAssociationsOutcome AmplifyClient::ListDomainAssociations(const ListDo
 
 ListDomainAssociationsOutcomeCallable AmplifyClient::ListDomainAssociationsCallable(const ListDomainAssociationsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDomainAssociationsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDomainAssociations(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListDomainAssociationsOutcome > >(ALLOCATION_TAG);
+  ListDomainAssociationsAsync(request, [promise](const AmplifyClient*, const ListDomainAssociationsRequest&, const ListDomainAssociationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::ListDomainAssociationsAsync(const ListDomainAssociationsRequest& request, const ListDomainAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListDomainAssociationsAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListDomainAssociationsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/domains";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListDomainAssociationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDomainAssociationsOutcome(ListDomainAssociationsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDomainAssociationsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::ListDomainAssociationsAsyncHelper(const ListDomainAssociationsRequest& request, const ListDomainAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -778,15 +1106,43 @@ ListJobsOutcome AmplifyClient::ListJobs(const ListJobsRequest& request) const
 
 ListJobsOutcomeCallable AmplifyClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListJobsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListJobs(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListJobsOutcome > >(ALLOCATION_TAG);
+  ListJobsAsync(request, [promise](const AmplifyClient*, const ListJobsRequest&, const ListJobsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  ss << "/jobs";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListJobsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListJobsOutcome(ListJobsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListJobsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -827,15 +1183,43 @@ StartJobOutcome AmplifyClient::StartJob(const StartJobRequest& request) const
 
 StartJobOutcomeCallable AmplifyClient::StartJobCallable(const StartJobRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< StartJobOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->StartJob(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< StartJobOutcome > >(ALLOCATION_TAG);
+  StartJobAsync(request, [promise](const AmplifyClient*, const StartJobRequest&, const StartJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::StartJobAsync(const StartJobRequest& request, const StartJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->StartJobAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->StartJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->StartJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  ss << "/jobs";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<StartJobRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, StartJobOutcome(StartJobResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, StartJobOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::StartJobAsyncHelper(const StartJobRequest& request, const StartJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -883,15 +1267,50 @@ StopJobOutcome AmplifyClient::StopJob(const StopJobRequest& request) const
 
 StopJobOutcomeCallable AmplifyClient::StopJobCallable(const StopJobRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< StopJobOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->StopJob(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< StopJobOutcome > >(ALLOCATION_TAG);
+  StopJobAsync(request, [promise](const AmplifyClient*, const StopJobRequest&, const StopJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::StopJobAsync(const StopJobRequest& request, const StopJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->StopJobAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->StopJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->StopJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.JobIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->StopJobAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  ss << "/jobs/";
+  ss << request.GetJobId();
+  ss << "/stop";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<StopJobRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, StopJobOutcome(StopJobResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, StopJobOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::StopJobAsyncHelper(const StopJobRequest& request, const StopJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -924,15 +1343,35 @@ UpdateAppOutcome AmplifyClient::UpdateApp(const UpdateAppRequest& request) const
 
 UpdateAppOutcomeCallable AmplifyClient::UpdateAppCallable(const UpdateAppRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateAppOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateApp(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateAppOutcome > >(ALLOCATION_TAG);
+  UpdateAppAsync(request, [promise](const AmplifyClient*, const UpdateAppRequest&, const UpdateAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::UpdateAppAsync(const UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateAppAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateAppAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateAppRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAppOutcome(UpdateAppResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAppOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::UpdateAppAsyncHelper(const UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -972,15 +1411,42 @@ UpdateBranchOutcome AmplifyClient::UpdateBranch(const UpdateBranchRequest& reque
 
 UpdateBranchOutcomeCallable AmplifyClient::UpdateBranchCallable(const UpdateBranchRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateBranchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateBranch(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateBranchOutcome > >(ALLOCATION_TAG);
+  UpdateBranchAsync(request, [promise](const AmplifyClient*, const UpdateBranchRequest&, const UpdateBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::UpdateBranchAsync(const UpdateBranchRequest& request, const UpdateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateBranchAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.BranchNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateBranchAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/branches/";
+  ss << request.GetBranchName();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateBranchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateBranchOutcome(UpdateBranchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateBranchOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::UpdateBranchAsyncHelper(const UpdateBranchRequest& request, const UpdateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1020,15 +1486,42 @@ UpdateDomainAssociationOutcome AmplifyClient::UpdateDomainAssociation(const Upda
 
 UpdateDomainAssociationOutcomeCallable AmplifyClient::UpdateDomainAssociationCallable(const UpdateDomainAssociationRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateDomainAssociationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDomainAssociation(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateDomainAssociationOutcome > >(ALLOCATION_TAG);
+  UpdateDomainAssociationAsync(request, [promise](const AmplifyClient*, const UpdateDomainAssociationRequest&, const UpdateDomainAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void AmplifyClient::UpdateDomainAssociationAsync(const UpdateDomainAssociationRequest& request, const UpdateDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainAssociationAsyncHelper( request, handler, context ); } );
+  if (!request.AppIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.DomainNameHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainAssociationAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/apps/";
+  ss << request.GetAppId();
+  ss << "/domains/";
+  ss << request.GetDomainName();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateDomainAssociationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDomainAssociationOutcome(UpdateDomainAssociationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDomainAssociationOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void AmplifyClient::UpdateDomainAssociationAsyncHelper(const UpdateDomainAssociationRequest& request, const UpdateDomainAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
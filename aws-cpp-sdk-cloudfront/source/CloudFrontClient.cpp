@@ -168,15 +168,29 @@ CreateCloudFrontOriginAccessIdentity2018_11_05Outcome CloudFrontClient::CreateCl
 
 CreateCloudFrontOriginAccessIdentity2018_11_05OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_11_05Callable(const CreateCloudFrontOriginAccessIdentity2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateCloudFrontOriginAccessIdentity2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCloudFrontOriginAccessIdentity2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateCloudFrontOriginAccessIdentity2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateCloudFrontOriginAccessIdentity2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateCloudFrontOriginAccessIdentity2018_11_05Request&, const CreateCloudFrontOriginAccessIdentity2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_11_05Async(const CreateCloudFrontOriginAccessIdentity2018_11_05Request& request, const CreateCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/origin-access-identity/cloudfront";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateCloudFrontOriginAccessIdentity2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateCloudFrontOriginAccessIdentity2018_11_05Outcome(CreateCloudFrontOriginAccessIdentity2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateCloudFrontOriginAccessIdentity2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_11_05AsyncHelper(const CreateCloudFrontOriginAccessIdentity2018_11_05Request& request, const CreateCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -203,15 +217,29 @@ CreateDistribution2018_11_05Outcome CloudFrontClient::CreateDistribution2018_11_
 
 CreateDistribution2018_11_05OutcomeCallable CloudFrontClient::CreateDistribution2018_11_05Callable(const CreateDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateDistribution2018_11_05Request&, const CreateDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateDistribution2018_11_05Async(const CreateDistribution2018_11_05Request& request, const CreateDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDistribution2018_11_05Outcome(CreateDistribution2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateDistribution2018_11_05AsyncHelper(const CreateDistribution2018_11_05Request& request, const CreateDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -240,15 +268,31 @@ CreateDistributionWithTags2018_11_05Outcome CloudFrontClient::CreateDistribution
 
 CreateDistributionWithTags2018_11_05OutcomeCallable CloudFrontClient::CreateDistributionWithTags2018_11_05Callable(const CreateDistributionWithTags2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateDistributionWithTags2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDistributionWithTags2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateDistributionWithTags2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateDistributionWithTags2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateDistributionWithTags2018_11_05Request&, const CreateDistributionWithTags2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateDistributionWithTags2018_11_05Async(const CreateDistributionWithTags2018_11_05Request& request, const CreateDistributionWithTags2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateDistributionWithTags2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution";
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?WithTags");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateDistributionWithTags2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDistributionWithTags2018_11_05Outcome(CreateDistributionWithTags2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDistributionWithTags2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateDistributionWithTags2018_11_05AsyncHelper(const CreateDistributionWithTags2018_11_05Request& request, const CreateDistributionWithTags2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -275,15 +319,29 @@ CreateFieldLevelEncryptionConfig2018_11_05Outcome CloudFrontClient::CreateFieldL
 
 CreateFieldLevelEncryptionConfig2018_11_05OutcomeCallable CloudFrontClient::CreateFieldLevelEncryptionConfig2018_11_05Callable(const CreateFieldLevelEncryptionConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateFieldLevelEncryptionConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateFieldLevelEncryptionConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateFieldLevelEncryptionConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateFieldLevelEncryptionConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateFieldLevelEncryptionConfig2018_11_05Request&, const CreateFieldLevelEncryptionConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateFieldLevelEncryptionConfig2018_11_05Async(const CreateFieldLevelEncryptionConfig2018_11_05Request& request, const CreateFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateFieldLevelEncryptionConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateFieldLevelEncryptionConfig2018_11_05Outcome(CreateFieldLevelEncryptionConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateFieldLevelEncryptionConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateFieldLevelEncryptionConfig2018_11_05AsyncHelper(const CreateFieldLevelEncryptionConfig2018_11_05Request& request, const CreateFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,15 +368,29 @@ CreateFieldLevelEncryptionProfile2018_11_05Outcome CloudFrontClient::CreateField
 
 CreateFieldLevelEncryptionProfile2018_11_05OutcomeCallable CloudFrontClient::CreateFieldLevelEncryptionProfile2018_11_05Callable(const CreateFieldLevelEncryptionProfile2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateFieldLevelEncryptionProfile2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateFieldLevelEncryptionProfile2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateFieldLevelEncryptionProfile2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateFieldLevelEncryptionProfile2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateFieldLevelEncryptionProfile2018_11_05Request&, const CreateFieldLevelEncryptionProfile2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateFieldLevelEncryptionProfile2018_11_05Async(const CreateFieldLevelEncryptionProfile2018_11_05Request& request, const CreateFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption-profile";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateFieldLevelEncryptionProfile2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateFieldLevelEncryptionProfile2018_11_05Outcome(CreateFieldLevelEncryptionProfile2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateFieldLevelEncryptionProfile2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateFieldLevelEncryptionProfile2018_11_05AsyncHelper(const CreateFieldLevelEncryptionProfile2018_11_05Request& request, const CreateFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -352,15 +424,36 @@ CreateInvalidation2018_11_05Outcome CloudFrontClient::CreateInvalidation2018_11_
 
 CreateInvalidation2018_11_05OutcomeCallable CloudFrontClient::CreateInvalidation2018_11_05Callable(const CreateInvalidation2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateInvalidation2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateInvalidation2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateInvalidation2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateInvalidation2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateInvalidation2018_11_05Request&, const CreateInvalidation2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateInvalidation2018_11_05Async(const CreateInvalidation2018_11_05Request& request, const CreateInvalidation2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateInvalidation2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.DistributionIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateInvalidation2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateInvalidation2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateInvalidation2018_11_05Outcome(CreateInvalidation2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateInvalidation2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateInvalidation2018_11_05AsyncHelper(const CreateInvalidation2018_11_05Request& request, const CreateInvalidation2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -387,15 +480,29 @@ CreatePublicKey2018_11_05Outcome CloudFrontClient::CreatePublicKey2018_11_05(con
 
 CreatePublicKey2018_11_05OutcomeCallable CloudFrontClient::CreatePublicKey2018_11_05Callable(const CreatePublicKey2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreatePublicKey2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreatePublicKey2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreatePublicKey2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreatePublicKey2018_11_05Async(request, [promise](const CloudFrontClient*, const CreatePublicKey2018_11_05Request&, const CreatePublicKey2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreatePublicKey2018_11_05Async(const CreatePublicKey2018_11_05Request& request, const CreatePublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreatePublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/public-key";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreatePublicKey2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreatePublicKey2018_11_05Outcome(CreatePublicKey2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreatePublicKey2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreatePublicKey2018_11_05AsyncHelper(const CreatePublicKey2018_11_05Request& request, const CreatePublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -422,15 +529,29 @@ CreateStreamingDistribution2018_11_05Outcome CloudFrontClient::CreateStreamingDi
 
 CreateStreamingDistribution2018_11_05OutcomeCallable CloudFrontClient::CreateStreamingDistribution2018_11_05Callable(const CreateStreamingDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateStreamingDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStreamingDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateStreamingDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateStreamingDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateStreamingDistribution2018_11_05Request&, const CreateStreamingDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateStreamingDistribution2018_11_05Async(const CreateStreamingDistribution2018_11_05Request& request, const CreateStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateStreamingDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStreamingDistribution2018_11_05Outcome(CreateStreamingDistribution2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStreamingDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateStreamingDistribution2018_11_05AsyncHelper(const CreateStreamingDistribution2018_11_05Request& request, const CreateStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -459,15 +580,31 @@ CreateStreamingDistributionWithTags2018_11_05Outcome CloudFrontClient::CreateStr
 
 CreateStreamingDistributionWithTags2018_11_05OutcomeCallable CloudFrontClient::CreateStreamingDistributionWithTags2018_11_05Callable(const CreateStreamingDistributionWithTags2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateStreamingDistributionWithTags2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStreamingDistributionWithTags2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateStreamingDistributionWithTags2018_11_05Outcome > >(ALLOCATION_TAG);
+  CreateStreamingDistributionWithTags2018_11_05Async(request, [promise](const CloudFrontClient*, const CreateStreamingDistributionWithTags2018_11_05Request&, const CreateStreamingDistributionWithTags2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::CreateStreamingDistributionWithTags2018_11_05Async(const CreateStreamingDistributionWithTags2018_11_05Request& request, const CreateStreamingDistributionWithTags2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateStreamingDistributionWithTags2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution";
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?WithTags");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateStreamingDistributionWithTags2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStreamingDistributionWithTags2018_11_05Outcome(CreateStreamingDistributionWithTags2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStreamingDistributionWithTags2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::CreateStreamingDistributionWithTags2018_11_05AsyncHelper(const CreateStreamingDistributionWithTags2018_11_05Request& request, const CreateStreamingDistributionWithTags2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -500,15 +637,35 @@ DeleteCloudFrontOriginAccessIdentity2018_11_05Outcome CloudFrontClient::DeleteCl
 
 DeleteCloudFrontOriginAccessIdentity2018_11_05OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2018_11_05Callable(const DeleteCloudFrontOriginAccessIdentity2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteCloudFrontOriginAccessIdentity2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteCloudFrontOriginAccessIdentity2018_11_05Outcome > >(ALLOCATION_TAG);
+  DeleteCloudFrontOriginAccessIdentity2018_11_05Async(request, [promise](const CloudFrontClient*, const DeleteCloudFrontOriginAccessIdentity2018_11_05Request&, const DeleteCloudFrontOriginAccessIdentity2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2018_11_05Async(const DeleteCloudFrontOriginAccessIdentity2018_11_05Request& request, const DeleteCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteCloudFrontOriginAccessIdentity2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCloudFrontOriginAccessIdentity2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCloudFrontOriginAccessIdentity2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2018_11_05AsyncHelper(const DeleteCloudFrontOriginAccessIdentity2018_11_05Request& request, const DeleteCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -541,15 +698,35 @@ DeleteDistribution2018_11_05Outcome CloudFrontClient::DeleteDistribution2018_11_
 
 DeleteDistribution2018_11_05OutcomeCallable CloudFrontClient::DeleteDistribution2018_11_05Callable(const DeleteDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  DeleteDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const DeleteDistribution2018_11_05Request&, const DeleteDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::DeleteDistribution2018_11_05Async(const DeleteDistribution2018_11_05Request& request, const DeleteDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDistribution2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 void CloudFrontClient::DeleteDistribution2018_11_05AsyncHelper(const DeleteDistribution2018_11_05Request& request, const DeleteDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -582,15 +759,35 @@ DeleteFieldLevelEncryptionConfig2018_11_05Outcome CloudFrontClient::DeleteFieldL
 
 DeleteFieldLevelEncryptionConfig2018_11_05OutcomeCallable CloudFrontClient::DeleteFieldLevelEncryptionConfig2018_11_05Callable(const DeleteFieldLevelEncryptionConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteFieldLevelEncryptionConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteFieldLevelEncryptionConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteFieldLevelEncryptionConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  DeleteFieldLevelEncryptionConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const DeleteFieldLevelEncryptionConfig2018_11_05Request&, const DeleteFieldLevelEncryptionConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::DeleteFieldLevelEncryptionConfig2018_11_05Async(const DeleteFieldLevelEncryptionConfig2018_11_05Request& request, const DeleteFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteFieldLevelEncryptionConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteFieldLevelEncryptionConfig2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteFieldLevelEncryptionConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 void CloudFrontClient::DeleteFieldLevelEncryptionConfig2018_11_05AsyncHelper(const DeleteFieldLevelEncryptionConfig2018_11_05Request& request, const DeleteFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -623,15 +820,35 @@ DeleteFieldLevelEncryptionProfile2018_11_05Outcome CloudFrontClient::DeleteField
 
 DeleteFieldLevelEncryptionProfile2018_11_05OutcomeCallable CloudFrontClient::DeleteFieldLevelEncryptionProfile2018_11_05Callable(const DeleteFieldLevelEncryptionProfile2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteFieldLevelEncryptionProfile2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteFieldLevelEncryptionProfile2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteFieldLevelEncryptionProfile2018_11_05Outcome > >(ALLOCATION_TAG);
+  DeleteFieldLevelEncryptionProfile2018_11_05Async(request, [promise](const CloudFrontClient*, const DeleteFieldLevelEncryptionProfile2018_11_05Request&, const DeleteFieldLevelEncryptionProfile2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::DeleteFieldLevelEncryptionProfile2018_11_05Async(const DeleteFieldLevelEncryptionProfile2018_11_05Request& request, const DeleteFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption-profile/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteFieldLevelEncryptionProfile2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteFieldLevelEncryptionProfile2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteFieldLevelEncryptionProfile2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 void CloudFrontClient::DeleteFieldLevelEncryptionProfile2018_11_05AsyncHelper(const DeleteFieldLevelEncryptionProfile2018_11_05Request& request, const DeleteFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -664,15 +881,35 @@ DeletePublicKey2018_11_05Outcome CloudFrontClient::DeletePublicKey2018_11_05(con
 
 DeletePublicKey2018_11_05OutcomeCallable CloudFrontClient::DeletePublicKey2018_11_05Callable(const DeletePublicKey2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeletePublicKey2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePublicKey2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeletePublicKey2018_11_05Outcome > >(ALLOCATION_TAG);
+  DeletePublicKey2018_11_05Async(request, [promise](const CloudFrontClient*, const DeletePublicKey2018_11_05Request&, const DeletePublicKey2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::DeletePublicKey2018_11_05Async(const DeletePublicKey2018_11_05Request& request, const DeletePublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeletePublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeletePublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/public-key/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeletePublicKey2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeletePublicKey2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeletePublicKey2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 void CloudFrontClient::DeletePublicKey2018_11_05AsyncHelper(const DeletePublicKey2018_11_05Request& request, const DeletePublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -705,15 +942,35 @@ DeleteStreamingDistribution2018_11_05Outcome CloudFrontClient::DeleteStreamingDi
 
 DeleteStreamingDistribution2018_11_05OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2018_11_05Callable(const DeleteStreamingDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteStreamingDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStreamingDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteStreamingDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  DeleteStreamingDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const DeleteStreamingDistribution2018_11_05Request&, const DeleteStreamingDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2018_11_05Async(const DeleteStreamingDistribution2018_11_05Request& request, const DeleteStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteStreamingDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStreamingDistribution2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStreamingDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_DELETE);
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2018_11_05AsyncHelper(const DeleteStreamingDistribution2018_11_05Request& request, const DeleteStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -746,15 +1003,35 @@ GetCloudFrontOriginAccessIdentity2018_11_05Outcome CloudFrontClient::GetCloudFro
 
 GetCloudFrontOriginAccessIdentity2018_11_05OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2018_11_05Callable(const GetCloudFrontOriginAccessIdentity2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentity2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentity2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetCloudFrontOriginAccessIdentity2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetCloudFrontOriginAccessIdentity2018_11_05Async(request, [promise](const CloudFrontClient*, const GetCloudFrontOriginAccessIdentity2018_11_05Request&, const GetCloudFrontOriginAccessIdentity2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2018_11_05Async(const GetCloudFrontOriginAccessIdentity2018_11_05Request& request, const GetCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetCloudFrontOriginAccessIdentity2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentity2018_11_05Outcome(GetCloudFrontOriginAccessIdentity2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentity2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2018_11_05AsyncHelper(const GetCloudFrontOriginAccessIdentity2018_11_05Request& request, const GetCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -788,15 +1065,36 @@ GetCloudFrontOriginAccessIdentityConfig2018_11_05Outcome CloudFrontClient::GetCl
 
 GetCloudFrontOriginAccessIdentityConfig2018_11_05OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2018_11_05Callable(const GetCloudFrontOriginAccessIdentityConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentityConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetCloudFrontOriginAccessIdentityConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetCloudFrontOriginAccessIdentityConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const GetCloudFrontOriginAccessIdentityConfig2018_11_05Request&, const GetCloudFrontOriginAccessIdentityConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2018_11_05Async(const GetCloudFrontOriginAccessIdentityConfig2018_11_05Request& request, const GetCloudFrontOriginAccessIdentityConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetCloudFrontOriginAccessIdentityConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetCloudFrontOriginAccessIdentityConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetCloudFrontOriginAccessIdentityConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentityConfig2018_11_05Outcome(GetCloudFrontOriginAccessIdentityConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentityConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2018_11_05AsyncHelper(const GetCloudFrontOriginAccessIdentityConfig2018_11_05Request& request, const GetCloudFrontOriginAccessIdentityConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -829,15 +1127,35 @@ GetDistribution2018_11_05Outcome CloudFrontClient::GetDistribution2018_11_05(con
 
 GetDistribution2018_11_05OutcomeCallable CloudFrontClient::GetDistribution2018_11_05Callable(const GetDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const GetDistribution2018_11_05Request&, const GetDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetDistribution2018_11_05Async(const GetDistribution2018_11_05Request& request, const GetDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDistribution2018_11_05Outcome(GetDistribution2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetDistribution2018_11_05AsyncHelper(const GetDistribution2018_11_05Request& request, const GetDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -871,15 +1189,36 @@ GetDistributionConfig2018_11_05Outcome CloudFrontClient::GetDistributionConfig20
 
 GetDistributionConfig2018_11_05OutcomeCallable CloudFrontClient::GetDistributionConfig2018_11_05Callable(const GetDistributionConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetDistributionConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistributionConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetDistributionConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetDistributionConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const GetDistributionConfig2018_11_05Request&, const GetDistributionConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetDistributionConfig2018_11_05Async(const GetDistributionConfig2018_11_05Request& request, const GetDistributionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetDistributionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetDistributionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetDistributionConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDistributionConfig2018_11_05Outcome(GetDistributionConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDistributionConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetDistributionConfig2018_11_05AsyncHelper(const GetDistributionConfig2018_11_05Request& request, const GetDistributionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -912,15 +1251,35 @@ GetFieldLevelEncryption2018_11_05Outcome CloudFrontClient::GetFieldLevelEncrypti
 
 GetFieldLevelEncryption2018_11_05OutcomeCallable CloudFrontClient::GetFieldLevelEncryption2018_11_05Callable(const GetFieldLevelEncryption2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryption2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryption2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetFieldLevelEncryption2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetFieldLevelEncryption2018_11_05Async(request, [promise](const CloudFrontClient*, const GetFieldLevelEncryption2018_11_05Request&, const GetFieldLevelEncryption2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetFieldLevelEncryption2018_11_05Async(const GetFieldLevelEncryption2018_11_05Request& request, const GetFieldLevelEncryption2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryption2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryption2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetFieldLevelEncryption2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryption2018_11_05Outcome(GetFieldLevelEncryption2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryption2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetFieldLevelEncryption2018_11_05AsyncHelper(const GetFieldLevelEncryption2018_11_05Request& request, const GetFieldLevelEncryption2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -954,15 +1313,36 @@ GetFieldLevelEncryptionConfig2018_11_05Outcome CloudFrontClient::GetFieldLevelEn
 
 GetFieldLevelEncryptionConfig2018_11_05OutcomeCallable CloudFrontClient::GetFieldLevelEncryptionConfig2018_11_05Callable(const GetFieldLevelEncryptionConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryptionConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryptionConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetFieldLevelEncryptionConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetFieldLevelEncryptionConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const GetFieldLevelEncryptionConfig2018_11_05Request&, const GetFieldLevelEncryptionConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionConfig2018_11_05Async(const GetFieldLevelEncryptionConfig2018_11_05Request& request, const GetFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetFieldLevelEncryptionConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryptionConfig2018_11_05Outcome(GetFieldLevelEncryptionConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryptionConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionConfig2018_11_05AsyncHelper(const GetFieldLevelEncryptionConfig2018_11_05Request& request, const GetFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -995,15 +1375,35 @@ GetFieldLevelEncryptionProfile2018_11_05Outcome CloudFrontClient::GetFieldLevelE
 
 GetFieldLevelEncryptionProfile2018_11_05OutcomeCallable CloudFrontClient::GetFieldLevelEncryptionProfile2018_11_05Callable(const GetFieldLevelEncryptionProfile2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryptionProfile2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryptionProfile2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetFieldLevelEncryptionProfile2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetFieldLevelEncryptionProfile2018_11_05Async(request, [promise](const CloudFrontClient*, const GetFieldLevelEncryptionProfile2018_11_05Request&, const GetFieldLevelEncryptionProfile2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionProfile2018_11_05Async(const GetFieldLevelEncryptionProfile2018_11_05Request& request, const GetFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption-profile/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetFieldLevelEncryptionProfile2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryptionProfile2018_11_05Outcome(GetFieldLevelEncryptionProfile2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryptionProfile2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionProfile2018_11_05AsyncHelper(const GetFieldLevelEncryptionProfile2018_11_05Request& request, const GetFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1037,15 +1437,36 @@ GetFieldLevelEncryptionProfileConfig2018_11_05Outcome CloudFrontClient::GetField
 
 GetFieldLevelEncryptionProfileConfig2018_11_05OutcomeCallable CloudFrontClient::GetFieldLevelEncryptionProfileConfig2018_11_05Callable(const GetFieldLevelEncryptionProfileConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryptionProfileConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryptionProfileConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetFieldLevelEncryptionProfileConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetFieldLevelEncryptionProfileConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const GetFieldLevelEncryptionProfileConfig2018_11_05Request&, const GetFieldLevelEncryptionProfileConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionProfileConfig2018_11_05Async(const GetFieldLevelEncryptionProfileConfig2018_11_05Request& request, const GetFieldLevelEncryptionProfileConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryptionProfileConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetFieldLevelEncryptionProfileConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption-profile/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetFieldLevelEncryptionProfileConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryptionProfileConfig2018_11_05Outcome(GetFieldLevelEncryptionProfileConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetFieldLevelEncryptionProfileConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionProfileConfig2018_11_05AsyncHelper(const GetFieldLevelEncryptionProfileConfig2018_11_05Request& request, const GetFieldLevelEncryptionProfileConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1085,15 +1506,42 @@ GetInvalidation2018_11_05Outcome CloudFrontClient::GetInvalidation2018_11_05(con
 
 GetInvalidation2018_11_05OutcomeCallable CloudFrontClient::GetInvalidation2018_11_05Callable(const GetInvalidation2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetInvalidation2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetInvalidation2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetInvalidation2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetInvalidation2018_11_05Async(request, [promise](const CloudFrontClient*, const GetInvalidation2018_11_05Request&, const GetInvalidation2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetInvalidation2018_11_05Async(const GetInvalidation2018_11_05Request& request, const GetInvalidation2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetInvalidation2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.DistributionIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetInvalidation2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetInvalidation2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetInvalidation2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetInvalidation2018_11_05Outcome(GetInvalidation2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetInvalidation2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetInvalidation2018_11_05AsyncHelper(const GetInvalidation2018_11_05Request& request, const GetInvalidation2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1126,15 +1574,35 @@ GetPublicKey2018_11_05Outcome CloudFrontClient::GetPublicKey2018_11_05(const Get
 
 GetPublicKey2018_11_05OutcomeCallable CloudFrontClient::GetPublicKey2018_11_05Callable(const GetPublicKey2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetPublicKey2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPublicKey2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetPublicKey2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetPublicKey2018_11_05Async(request, [promise](const CloudFrontClient*, const GetPublicKey2018_11_05Request&, const GetPublicKey2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetPublicKey2018_11_05Async(const GetPublicKey2018_11_05Request& request, const GetPublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetPublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetPublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/public-key/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetPublicKey2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetPublicKey2018_11_05Outcome(GetPublicKey2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetPublicKey2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetPublicKey2018_11_05AsyncHelper(const GetPublicKey2018_11_05Request& request, const GetPublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1168,15 +1636,36 @@ GetPublicKeyConfig2018_11_05Outcome CloudFrontClient::GetPublicKeyConfig2018_11_
 
 GetPublicKeyConfig2018_11_05OutcomeCallable CloudFrontClient::GetPublicKeyConfig2018_11_05Callable(const GetPublicKeyConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetPublicKeyConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPublicKeyConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetPublicKeyConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetPublicKeyConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const GetPublicKeyConfig2018_11_05Request&, const GetPublicKeyConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetPublicKeyConfig2018_11_05Async(const GetPublicKeyConfig2018_11_05Request& request, const GetPublicKeyConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetPublicKeyConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetPublicKeyConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/public-key/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetPublicKeyConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetPublicKeyConfig2018_11_05Outcome(GetPublicKeyConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetPublicKeyConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetPublicKeyConfig2018_11_05AsyncHelper(const GetPublicKeyConfig2018_11_05Request& request, const GetPublicKeyConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1209,15 +1698,35 @@ GetStreamingDistribution2018_11_05Outcome CloudFrontClient::GetStreamingDistribu
 
 GetStreamingDistribution2018_11_05OutcomeCallable CloudFrontClient::GetStreamingDistribution2018_11_05Callable(const GetStreamingDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetStreamingDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetStreamingDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const GetStreamingDistribution2018_11_05Request&, const GetStreamingDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetStreamingDistribution2018_11_05Async(const GetStreamingDistribution2018_11_05Request& request, const GetStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution/";
+  ss << request.GetId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetStreamingDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStreamingDistribution2018_11_05Outcome(GetStreamingDistribution2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStreamingDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetStreamingDistribution2018_11_05AsyncHelper(const GetStreamingDistribution2018_11_05Request& request, const GetStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1251,15 +1760,36 @@ GetStreamingDistributionConfig2018_11_05Outcome CloudFrontClient::GetStreamingDi
 
 GetStreamingDistributionConfig2018_11_05OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2018_11_05Callable(const GetStreamingDistributionConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistributionConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistributionConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< GetStreamingDistributionConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  GetStreamingDistributionConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const GetStreamingDistributionConfig2018_11_05Request&, const GetStreamingDistributionConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2018_11_05Async(const GetStreamingDistributionConfig2018_11_05Request& request, const GetStreamingDistributionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetStreamingDistributionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetStreamingDistributionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetStreamingDistributionConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStreamingDistributionConfig2018_11_05Outcome(GetStreamingDistributionConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStreamingDistributionConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2018_11_05AsyncHelper(const GetStreamingDistributionConfig2018_11_05Request& request, const GetStreamingDistributionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1286,15 +1816,29 @@ ListCloudFrontOriginAccessIdentities2018_11_05Outcome CloudFrontClient::ListClou
 
 ListCloudFrontOriginAccessIdentities2018_11_05OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_11_05Callable(const ListCloudFrontOriginAccessIdentities2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListCloudFrontOriginAccessIdentities2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCloudFrontOriginAccessIdentities2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListCloudFrontOriginAccessIdentities2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListCloudFrontOriginAccessIdentities2018_11_05Async(request, [promise](const CloudFrontClient*, const ListCloudFrontOriginAccessIdentities2018_11_05Request&, const ListCloudFrontOriginAccessIdentities2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_11_05Async(const ListCloudFrontOriginAccessIdentities2018_11_05Request& request, const ListCloudFrontOriginAccessIdentities2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListCloudFrontOriginAccessIdentities2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/origin-access-identity/cloudfront";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListCloudFrontOriginAccessIdentities2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCloudFrontOriginAccessIdentities2018_11_05Outcome(ListCloudFrontOriginAccessIdentities2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCloudFrontOriginAccessIdentities2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_11_05AsyncHelper(const ListCloudFrontOriginAccessIdentities2018_11_05Request& request, const ListCloudFrontOriginAccessIdentities2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1321,15 +1865,29 @@ ListDistributions2018_11_05Outcome CloudFrontClient::ListDistributions2018_11_05
 
 ListDistributions2018_11_05OutcomeCallable CloudFrontClient::ListDistributions2018_11_05Callable(const ListDistributions2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDistributions2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributions2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListDistributions2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListDistributions2018_11_05Async(request, [promise](const CloudFrontClient*, const ListDistributions2018_11_05Request&, const ListDistributions2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListDistributions2018_11_05Async(const ListDistributions2018_11_05Request& request, const ListDistributions2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListDistributions2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListDistributions2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDistributions2018_11_05Outcome(ListDistributions2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDistributions2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListDistributions2018_11_05AsyncHelper(const ListDistributions2018_11_05Request& request, const ListDistributions2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1362,15 +1920,35 @@ ListDistributionsByWebACLId2018_11_05Outcome CloudFrontClient::ListDistributions
 
 ListDistributionsByWebACLId2018_11_05OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2018_11_05Callable(const ListDistributionsByWebACLId2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDistributionsByWebACLId2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributionsByWebACLId2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListDistributionsByWebACLId2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListDistributionsByWebACLId2018_11_05Async(request, [promise](const CloudFrontClient*, const ListDistributionsByWebACLId2018_11_05Request&, const ListDistributionsByWebACLId2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2018_11_05Async(const ListDistributionsByWebACLId2018_11_05Request& request, const ListDistributionsByWebACLId2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListDistributionsByWebACLId2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.WebACLIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListDistributionsByWebACLId2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distributionsByWebACLId/";
+  ss << request.GetWebACLId();
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListDistributionsByWebACLId2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDistributionsByWebACLId2018_11_05Outcome(ListDistributionsByWebACLId2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDistributionsByWebACLId2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2018_11_05AsyncHelper(const ListDistributionsByWebACLId2018_11_05Request& request, const ListDistributionsByWebACLId2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1397,15 +1975,29 @@ ListFieldLevelEncryptionConfigs2018_11_05Outcome CloudFrontClient::ListFieldLeve
 
 ListFieldLevelEncryptionConfigs2018_11_05OutcomeCallable CloudFrontClient::ListFieldLevelEncryptionConfigs2018_11_05Callable(const ListFieldLevelEncryptionConfigs2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListFieldLevelEncryptionConfigs2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListFieldLevelEncryptionConfigs2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListFieldLevelEncryptionConfigs2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListFieldLevelEncryptionConfigs2018_11_05Async(request, [promise](const CloudFrontClient*, const ListFieldLevelEncryptionConfigs2018_11_05Request&, const ListFieldLevelEncryptionConfigs2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListFieldLevelEncryptionConfigs2018_11_05Async(const ListFieldLevelEncryptionConfigs2018_11_05Request& request, const ListFieldLevelEncryptionConfigs2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListFieldLevelEncryptionConfigs2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListFieldLevelEncryptionConfigs2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListFieldLevelEncryptionConfigs2018_11_05Outcome(ListFieldLevelEncryptionConfigs2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListFieldLevelEncryptionConfigs2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListFieldLevelEncryptionConfigs2018_11_05AsyncHelper(const ListFieldLevelEncryptionConfigs2018_11_05Request& request, const ListFieldLevelEncryptionConfigs2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1432,15 +2024,29 @@ ListFieldLevelEncryptionProfiles2018_11_05Outcome CloudFrontClient::ListFieldLev
 
 ListFieldLevelEncryptionProfiles2018_11_05OutcomeCallable CloudFrontClient::ListFieldLevelEncryptionProfiles2018_11_05Callable(const ListFieldLevelEncryptionProfiles2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListFieldLevelEncryptionProfiles2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListFieldLevelEncryptionProfiles2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListFieldLevelEncryptionProfiles2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListFieldLevelEncryptionProfiles2018_11_05Async(request, [promise](const CloudFrontClient*, const ListFieldLevelEncryptionProfiles2018_11_05Request&, const ListFieldLevelEncryptionProfiles2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListFieldLevelEncryptionProfiles2018_11_05Async(const ListFieldLevelEncryptionProfiles2018_11_05Request& request, const ListFieldLevelEncryptionProfiles2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListFieldLevelEncryptionProfiles2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption-profile";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListFieldLevelEncryptionProfiles2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListFieldLevelEncryptionProfiles2018_11_05Outcome(ListFieldLevelEncryptionProfiles2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListFieldLevelEncryptionProfiles2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListFieldLevelEncryptionProfiles2018_11_05AsyncHelper(const ListFieldLevelEncryptionProfiles2018_11_05Request& request, const ListFieldLevelEncryptionProfiles2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1474,15 +2080,36 @@ ListInvalidations2018_11_05Outcome CloudFrontClient::ListInvalidations2018_11_05
 
 ListInvalidations2018_11_05OutcomeCallable CloudFrontClient::ListInvalidations2018_11_05Callable(const ListInvalidations2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListInvalidations2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListInvalidations2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListInvalidations2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListInvalidations2018_11_05Async(request, [promise](const CloudFrontClient*, const ListInvalidations2018_11_05Request&, const ListInvalidations2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListInvalidations2018_11_05Async(const ListInvalidations2018_11_05Request& request, const ListInvalidations2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListInvalidations2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.DistributionIdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListInvalidations2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListInvalidations2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListInvalidations2018_11_05Outcome(ListInvalidations2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListInvalidations2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListInvalidations2018_11_05AsyncHelper(const ListInvalidations2018_11_05Request& request, const ListInvalidations2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1509,15 +2136,29 @@ ListPublicKeys2018_11_05Outcome CloudFrontClient::ListPublicKeys2018_11_05(const
 
 ListPublicKeys2018_11_05OutcomeCallable CloudFrontClient::ListPublicKeys2018_11_05Callable(const ListPublicKeys2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListPublicKeys2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPublicKeys2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListPublicKeys2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListPublicKeys2018_11_05Async(request, [promise](const CloudFrontClient*, const ListPublicKeys2018_11_05Request&, const ListPublicKeys2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListPublicKeys2018_11_05Async(const ListPublicKeys2018_11_05Request& request, const ListPublicKeys2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListPublicKeys2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/public-key";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListPublicKeys2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPublicKeys2018_11_05Outcome(ListPublicKeys2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPublicKeys2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListPublicKeys2018_11_05AsyncHelper(const ListPublicKeys2018_11_05Request& request, const ListPublicKeys2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1544,15 +2185,29 @@ ListStreamingDistributions2018_11_05Outcome CloudFrontClient::ListStreamingDistr
 
 ListStreamingDistributions2018_11_05OutcomeCallable CloudFrontClient::ListStreamingDistributions2018_11_05Callable(const ListStreamingDistributions2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListStreamingDistributions2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStreamingDistributions2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListStreamingDistributions2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListStreamingDistributions2018_11_05Async(request, [promise](const CloudFrontClient*, const ListStreamingDistributions2018_11_05Request&, const ListStreamingDistributions2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListStreamingDistributions2018_11_05Async(const ListStreamingDistributions2018_11_05Request& request, const ListStreamingDistributions2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListStreamingDistributions2018_11_05AsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListStreamingDistributions2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStreamingDistributions2018_11_05Outcome(ListStreamingDistributions2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStreamingDistributions2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListStreamingDistributions2018_11_05AsyncHelper(const ListStreamingDistributions2018_11_05Request& request, const ListStreamingDistributions2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1584,15 +2239,34 @@ ListTagsForResource2018_11_05Outcome CloudFrontClient::ListTagsForResource2018_1
 
 ListTagsForResource2018_11_05OutcomeCallable CloudFrontClient::ListTagsForResource2018_11_05Callable(const ListTagsForResource2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTagsForResource2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsForResource2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListTagsForResource2018_11_05Outcome > >(ALLOCATION_TAG);
+  ListTagsForResource2018_11_05Async(request, [promise](const CloudFrontClient*, const ListTagsForResource2018_11_05Request&, const ListTagsForResource2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::ListTagsForResource2018_11_05Async(const ListTagsForResource2018_11_05Request& request, const ListTagsForResource2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResource2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.ResourceHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResource2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/tagging";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsForResource2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsForResource2018_11_05Outcome(ListTagsForResource2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsForResource2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_GET);
 }
 
 void CloudFrontClient::ListTagsForResource2018_11_05AsyncHelper(const ListTagsForResource2018_11_05Request& request, const ListTagsForResource2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1626,15 +2300,36 @@ TagResource2018_11_05Outcome CloudFrontClient::TagResource2018_11_05(const TagRe
 
 TagResource2018_11_05OutcomeCallable CloudFrontClient::TagResource2018_11_05Callable(const TagResource2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TagResource2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->TagResource2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< TagResource2018_11_05Outcome > >(ALLOCATION_TAG);
+  TagResource2018_11_05Async(request, [promise](const CloudFrontClient*, const TagResource2018_11_05Request&, const TagResource2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::TagResource2018_11_05Async(const TagResource2018_11_05Request& request, const TagResource2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TagResource2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.ResourceHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TagResource2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/tagging";
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?Operation=Tag");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<TagResource2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TagResource2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TagResource2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::TagResource2018_11_05AsyncHelper(const TagResource2018_11_05Request& request, const TagResource2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1668,15 +2363,36 @@ UntagResource2018_11_05Outcome CloudFrontClient::UntagResource2018_11_05(const U
 
 UntagResource2018_11_05OutcomeCallable CloudFrontClient::UntagResource2018_11_05Callable(const UntagResource2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UntagResource2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UntagResource2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UntagResource2018_11_05Outcome > >(ALLOCATION_TAG);
+  UntagResource2018_11_05Async(request, [promise](const CloudFrontClient*, const UntagResource2018_11_05Request&, const UntagResource2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UntagResource2018_11_05Async(const UntagResource2018_11_05Request& request, const UntagResource2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UntagResource2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.ResourceHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UntagResource2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/tagging";
+  uri.SetPath(uri.GetPath() + ss.str());
+  ss.str("?Operation=Untag");
+  uri.SetQueryString(ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagResource2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UntagResource2018_11_05Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UntagResource2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST);
 }
 
 void CloudFrontClient::UntagResource2018_11_05AsyncHelper(const UntagResource2018_11_05Request& request, const UntagResource2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1710,15 +2426,36 @@ UpdateCloudFrontOriginAccessIdentity2018_11_05Outcome CloudFrontClient::UpdateCl
 
 UpdateCloudFrontOriginAccessIdentity2018_11_05OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2018_11_05Callable(const UpdateCloudFrontOriginAccessIdentity2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateCloudFrontOriginAccessIdentity2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateCloudFrontOriginAccessIdentity2018_11_05Outcome > >(ALLOCATION_TAG);
+  UpdateCloudFrontOriginAccessIdentity2018_11_05Async(request, [promise](const CloudFrontClient*, const UpdateCloudFrontOriginAccessIdentity2018_11_05Request&, const UpdateCloudFrontOriginAccessIdentity2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2018_11_05Async(const UpdateCloudFrontOriginAccessIdentity2018_11_05Request& request, const UpdateCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateCloudFrontOriginAccessIdentity2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateCloudFrontOriginAccessIdentity2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateCloudFrontOriginAccessIdentity2018_11_05Outcome(UpdateCloudFrontOriginAccessIdentity2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateCloudFrontOriginAccessIdentity2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2018_11_05AsyncHelper(const UpdateCloudFrontOriginAccessIdentity2018_11_05Request& request, const UpdateCloudFrontOriginAccessIdentity2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1752,15 +2489,36 @@ UpdateDistribution2018_11_05Outcome CloudFrontClient::UpdateDistribution2018_11_
 
 UpdateDistribution2018_11_05OutcomeCallable CloudFrontClient::UpdateDistribution2018_11_05Callable(const UpdateDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  UpdateDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const UpdateDistribution2018_11_05Request&, const UpdateDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UpdateDistribution2018_11_05Async(const UpdateDistribution2018_11_05Request& request, const UpdateDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDistribution2018_11_05Outcome(UpdateDistribution2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 void CloudFrontClient::UpdateDistribution2018_11_05AsyncHelper(const UpdateDistribution2018_11_05Request& request, const UpdateDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1794,15 +2552,36 @@ UpdateFieldLevelEncryptionConfig2018_11_05Outcome CloudFrontClient::UpdateFieldL
 
 UpdateFieldLevelEncryptionConfig2018_11_05OutcomeCallable CloudFrontClient::UpdateFieldLevelEncryptionConfig2018_11_05Callable(const UpdateFieldLevelEncryptionConfig2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateFieldLevelEncryptionConfig2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateFieldLevelEncryptionConfig2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateFieldLevelEncryptionConfig2018_11_05Outcome > >(ALLOCATION_TAG);
+  UpdateFieldLevelEncryptionConfig2018_11_05Async(request, [promise](const CloudFrontClient*, const UpdateFieldLevelEncryptionConfig2018_11_05Request&, const UpdateFieldLevelEncryptionConfig2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UpdateFieldLevelEncryptionConfig2018_11_05Async(const UpdateFieldLevelEncryptionConfig2018_11_05Request& request, const UpdateFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateFieldLevelEncryptionConfig2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateFieldLevelEncryptionConfig2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateFieldLevelEncryptionConfig2018_11_05Outcome(UpdateFieldLevelEncryptionConfig2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateFieldLevelEncryptionConfig2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 void CloudFrontClient::UpdateFieldLevelEncryptionConfig2018_11_05AsyncHelper(const UpdateFieldLevelEncryptionConfig2018_11_05Request& request, const UpdateFieldLevelEncryptionConfig2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1836,15 +2615,36 @@ UpdateFieldLevelEncryptionProfile2018_11_05Outcome CloudFrontClient::UpdateField
 
 UpdateFieldLevelEncryptionProfile2018_11_05OutcomeCallable CloudFrontClient::UpdateFieldLevelEncryptionProfile2018_11_05Callable(const UpdateFieldLevelEncryptionProfile2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateFieldLevelEncryptionProfile2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateFieldLevelEncryptionProfile2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateFieldLevelEncryptionProfile2018_11_05Outcome > >(ALLOCATION_TAG);
+  UpdateFieldLevelEncryptionProfile2018_11_05Async(request, [promise](const CloudFrontClient*, const UpdateFieldLevelEncryptionProfile2018_11_05Request&, const UpdateFieldLevelEncryptionProfile2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UpdateFieldLevelEncryptionProfile2018_11_05Async(const UpdateFieldLevelEncryptionProfile2018_11_05Request& request, const UpdateFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateFieldLevelEncryptionProfile2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/field-level-encryption-profile/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateFieldLevelEncryptionProfile2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateFieldLevelEncryptionProfile2018_11_05Outcome(UpdateFieldLevelEncryptionProfile2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateFieldLevelEncryptionProfile2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 void CloudFrontClient::UpdateFieldLevelEncryptionProfile2018_11_05AsyncHelper(const UpdateFieldLevelEncryptionProfile2018_11_05Request& request, const UpdateFieldLevelEncryptionProfile2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1878,15 +2678,36 @@ UpdatePublicKey2018_11_05Outcome CloudFrontClient::UpdatePublicKey2018_11_05(con
 
 UpdatePublicKey2018_11_05OutcomeCallable CloudFrontClient::UpdatePublicKey2018_11_05Callable(const UpdatePublicKey2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdatePublicKey2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdatePublicKey2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdatePublicKey2018_11_05Outcome > >(ALLOCATION_TAG);
+  UpdatePublicKey2018_11_05Async(request, [promise](const CloudFrontClient*, const UpdatePublicKey2018_11_05Request&, const UpdatePublicKey2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UpdatePublicKey2018_11_05Async(const UpdatePublicKey2018_11_05Request& request, const UpdatePublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdatePublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdatePublicKey2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/public-key/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdatePublicKey2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdatePublicKey2018_11_05Outcome(UpdatePublicKey2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdatePublicKey2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 void CloudFrontClient::UpdatePublicKey2018_11_05AsyncHelper(const UpdatePublicKey2018_11_05Request& request, const UpdatePublicKey2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1920,15 +2741,36 @@ UpdateStreamingDistribution2018_11_05Outcome CloudFrontClient::UpdateStreamingDi
 
 UpdateStreamingDistribution2018_11_05OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2018_11_05Callable(const UpdateStreamingDistribution2018_11_05Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateStreamingDistribution2018_11_05Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStreamingDistribution2018_11_05(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateStreamingDistribution2018_11_05Outcome > >(ALLOCATION_TAG);
+  UpdateStreamingDistribution2018_11_05Async(request, [promise](const CloudFrontClient*, const UpdateStreamingDistribution2018_11_05Request&, const UpdateStreamingDistribution2018_11_05Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2018_11_05Async(const UpdateStreamingDistribution2018_11_05Request& request, const UpdateStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+  if (!request.IdHasBeenSet())
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateStreamingDistribution2018_11_05AsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/2018-11-05/streaming-distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateStreamingDistribution2018_11_05Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const XmlOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStreamingDistribution2018_11_05Outcome(UpdateStreamingDistribution2018_11_05Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStreamingDistribution2018_11_05Outcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_PUT);
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2018_11_05AsyncHelper(const UpdateStreamingDistribution2018_11_05Request& request, const UpdateStreamingDistribution2018_11_05ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
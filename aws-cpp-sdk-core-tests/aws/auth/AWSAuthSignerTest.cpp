@@ -24,6 +24,7 @@
 #include <aws/core/platform/Platform.h>
 #include <aws/core/utils/StringUtils.h>
 #include <fstream>
+#include <thread>
 
 using namespace Aws::Client;
 using namespace Aws::Utils;
@@ -50,6 +51,19 @@ private:
     DateTime m_signingTimeStamp;
 };
 
+//Credentials provider whose credentials can be swapped between requests, used to check that signing keys are cached per credential set.
+class SwitchableCredentialsProvider : public Aws::Auth::AWSCredentialsProvider
+{
+public:
+    SwitchableCredentialsProvider(const Aws::Auth::AWSCredentials& credentials) : m_credentials(credentials) {}
+
+    void SetCredentials(const Aws::Auth::AWSCredentials& credentials) { m_credentials = credentials; }
+    Aws::Auth::AWSCredentials GetAWSCredentials() override { return m_credentials; }
+
+private:
+    Aws::Auth::AWSCredentials m_credentials;
+};
+
 static DateTime ParseTestFileDateTime(const char* dateStr)
 {
     Aws::StringStream ss;
@@ -300,6 +314,112 @@ TEST(AWSAuthV4SignerTest, HeadersWithEmptyValues)
     ASSERT_STREQ(UNSIGNED_PAYLOAD, request.GetHeaderValue("x-amz-content-sha256").c_str());
 }
 
+static Aws::String SignWithFreshSigner(const Aws::Auth::AWSCredentials& credentials, const DateTime& timestamp)
+{
+    auto credProvider = Aws::MakeShared<SwitchableCredentialsProvider>(ALLOC_TAG, credentials);
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    signer.SetSigningTimestamp(timestamp);
+    Standard::StandardHttpRequest request("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+    EXPECT_TRUE(signer.SignRequest(request));
+    return request.GetHeaderValue(Aws::Http::AWS_AUTHORIZATION_HEADER);
+}
+
+TEST(AWSAuthV4SignerTest, SigningKeysCachedPerCredentialsAndDay)
+{
+    Aws::Auth::AWSCredentials first("AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    Aws::Auth::AWSCredentials second("AKIDEXAMPLE2", "anotherSecretKeyThatIsNotTheSameAsTheFirst");
+    DateTime days[] = { DateTime("2015-08-30T12:36:00Z", DateFormat::ISO_8601), DateTime("2015-08-31T12:36:00Z", DateFormat::ISO_8601) };
+
+    auto credProvider = Aws::MakeShared<SwitchableCredentialsProvider>(ALLOC_TAG, first);
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+
+    //alternate credential sets and days so every lookup after the first round is served from the cache.
+    for (int round = 0; round < 3; ++round)
+    {
+        for (const auto& day : days)
+        {
+            for (const auto* credentials : { &first, &second })
+            {
+                credProvider->SetCredentials(*credentials);
+                signer.SetSigningTimestamp(day);
+                Standard::StandardHttpRequest request("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+                ASSERT_TRUE(signer.SignRequest(request));
+                ASSERT_EQ(SignWithFreshSigner(*credentials, day), request.GetHeaderValue(Aws::Http::AWS_AUTHORIZATION_HEADER));
+            }
+        }
+    }
+}
+
+TEST(AWSAuthV4SignerTest, SigningKeysEvictedWhenCycling)
+{
+    //more regions than the signer caches keys for, so every presign evicts a key and retires a snapshot.
+    const char* regions[] = { "us-east-1", "us-east-2", "us-west-1", "us-west-2", "eu-west-1", "eu-west-2",
+        "eu-central-1", "ap-northeast-1", "ap-southeast-1", "ap-southeast-2", "sa-east-1", "ca-central-1" };
+    DateTime timestamp("2015-08-30T12:36:00Z", DateFormat::ISO_8601);
+
+    auto credProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    signer.SetSigningTimestamp(timestamp);
+    TestableAuthv4Signer referenceSigner(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    referenceSigner.SetSigningTimestamp(timestamp);
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (const char* region : regions)
+        {
+            Standard::StandardHttpRequest request("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+            ASSERT_TRUE(signer.PresignRequest(request, region, "service", 60));
+            Standard::StandardHttpRequest expected("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+            ASSERT_TRUE(referenceSigner.PresignRequest(expected, region, "service", 60));
+            ASSERT_EQ(expected.GetURIString(), request.GetURIString());
+        }
+    }
+}
+
+TEST(AWSAuthV4SignerTest, ConcurrentSigningWithSharedSigner)
+{
+    const size_t threadCount = 4;
+    const size_t requestsPerThread = 50;
+    const char* regions[threadCount] = { "us-east-1", "us-west-2", "eu-west-1", "ap-northeast-1" };
+    DateTime timestamp("2015-08-30T12:36:00Z", DateFormat::ISO_8601);
+
+    auto credProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    TestableAuthv4Signer signer(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    signer.SetSigningTimestamp(timestamp);
+
+    //threads rotate through the regions so they keep publishing and reading key snapshots concurrently.
+    Aws::Vector<Aws::String> urls(threadCount * requestsPerThread);
+    Aws::Vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (size_t i = 0; i < requestsPerThread; ++i)
+            {
+                Standard::StandardHttpRequest request("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+                signer.PresignRequest(request, regions[(t + i) % threadCount], "service", 60);
+                urls[t * requestsPerThread + i] = request.GetURIString();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    TestableAuthv4Signer referenceSigner(credProvider, "service", "us-east-1", AWSAuthV4Signer::PayloadSigningPolicy::Never, false);
+    referenceSigner.SetSigningTimestamp(timestamp);
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        for (size_t i = 0; i < requestsPerThread; ++i)
+        {
+            Standard::StandardHttpRequest request("https://test.com/query?key=val", Aws::Http::HttpMethod::HTTP_GET);
+            ASSERT_TRUE(referenceSigner.PresignRequest(request, regions[(t + i) % threadCount], "service", 60));
+            ASSERT_EQ(request.GetURIString(), urls[t * requestsPerThread + i]);
+        }
+    }
+}
+
 TEST(AWSAuthV4SignerTest, PayloadSigningPolicyNever)
 {
     // Test without payload(empty body)
@@ -0,0 +1,301 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+/*
+ * Compares AWSAuthV4Signer::SignRequest against the StringStream based implementation it replaced. The comparison test checks both
+ * produce the same Authorization header; the benchmark is disabled by default, run it with
+ *   --gtest_also_run_disabled_tests --gtest_filter=AWSAuthV4SignerBenchmarkTest.*
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/logging/AWSLogging.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace Aws::Client;
+using namespace Aws::Utils;
+using namespace Aws::Http;
+
+static const char ALLOC_TAG[] = "AWSAuthV4SignerBenchmarkTest";
+static const char ACCESS_KEY_ID[] = "AKIDEXAMPLE";
+static const char SECRET_KEY[] = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+static const char REGION[] = "us-east-1";
+static const char SERVICE_NAME[] = "dynamodb";
+static const size_t BENCHMARK_ITERATIONS = 20000;
+
+namespace
+{
+    /**
+     * The SignRequest implementation from before canonicalization moved to a single per thread buffer. The signing key is cached per
+     * date, as the signer did, so the benchmark measures only the per request work.
+     */
+    class LegacyV4Signer
+    {
+    public:
+        LegacyV4Signer(bool urlEscapePath) : m_urlEscapePath(urlEscapePath) {}
+
+        Aws::String Sign(HttpRequest& request, const Aws::String& dateHeaderValue, const Aws::String& payloadHash)
+        {
+            Aws::StringStream headersStream;
+            Aws::StringStream signedHeadersStream;
+
+            for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
+            {
+                if (ShouldSignHeader(header.first))
+                {
+                    headersStream << header.first.c_str() << ":" << header.second.c_str() << "\n";
+                    signedHeadersStream << header.first.c_str() << ";";
+                }
+            }
+
+            Aws::String canonicalHeadersString = headersStream.str();
+            Aws::String signedHeadersValue = signedHeadersStream.str();
+            if (!signedHeadersValue.empty())
+            {
+                signedHeadersValue.pop_back();
+            }
+
+            Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
+            canonicalRequestString.append(canonicalHeadersString);
+            canonicalRequestString.append("\n");
+            canonicalRequestString.append(signedHeadersValue);
+            canonicalRequestString.append("\n");
+            canonicalRequestString.append(payloadHash);
+
+            Aws::String cannonicalRequestHash = HashingUtils::HexEncode(m_hash.Calculate(canonicalRequestString).GetResult());
+            Aws::String simpleDate = dateHeaderValue.substr(0, 8);
+
+            Aws::StringStream stringToSignStream;
+            stringToSignStream << "AWS4-HMAC-SHA256" << "\n" << dateHeaderValue << "\n" << simpleDate << "/" << REGION << "/"
+                << SERVICE_NAME << "/" << "aws4_request" << "\n" << cannonicalRequestHash;
+            Aws::String stringToSign = stringToSignStream.str();
+
+            const ByteBuffer& key = GetSigningKey(simpleDate);
+            auto finalSignature = HashingUtils::HexEncode(m_HMAC.Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), key).GetResult());
+
+            Aws::StringStream ss;
+            ss << "AWS4-HMAC-SHA256" << " " << "Credential" << "=" << ACCESS_KEY_ID << "/" << simpleDate
+                << "/" << REGION << "/" << SERVICE_NAME << "/" << "aws4_request" << ", " << "SignedHeaders" << "="
+                << signedHeadersValue << ", " << "Signature" << "=" << finalSignature;
+            return ss.str();
+        }
+
+    private:
+        static bool ShouldSignHeader(const Aws::String& header)
+        {
+            Aws::String lowerHeader = StringUtils::ToLower(header.c_str());
+            return lowerHeader != "user-agent" && lowerHeader != "x-amzn-trace-id";
+        }
+
+        Aws::String CanonicalizeRequestSigningString(HttpRequest& request)
+        {
+            request.CanonicalizeRequest();
+            Aws::StringStream signingStringStream;
+            signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
+
+            URI uriCpy = request.GetUri();
+            if (m_urlEscapePath)
+            {
+                auto rfc3986EncodedPath = URI::URLEncodePathRFC3986(uriCpy.GetPath());
+                uriCpy.SetPath(rfc3986EncodedPath);
+                signingStringStream << "\n" << uriCpy.GetURLEncodedPath() << "\n";
+            }
+            else
+            {
+                uriCpy.SetPath(uriCpy.GetURLEncodedPath());
+                signingStringStream << "\n" << uriCpy.GetPath() << "\n";
+            }
+
+            if (request.GetQueryString().find('=') != std::string::npos)
+            {
+                signingStringStream << request.GetQueryString().substr(1) << "\n";
+            }
+            else if (request.GetQueryString().size() > 1)
+            {
+                signingStringStream << request.GetQueryString().substr(1) << "=" << "\n";
+            }
+            else
+            {
+                signingStringStream << "\n";
+            }
+
+            return signingStringStream.str();
+        }
+
+        static HeaderValueCollection CanonicalizeHeaders(HeaderValueCollection&& headers)
+        {
+            HeaderValueCollection canonicalHeaders;
+            for (const auto& header : headers)
+            {
+                auto trimmedHeaderName = StringUtils::Trim(header.first.c_str());
+                auto trimmedHeaderValue = StringUtils::Trim(header.second.c_str());
+
+                auto headerMultiLine = StringUtils::SplitOnLine(trimmedHeaderValue);
+                Aws::String headerValue = headerMultiLine.size() == 0 ? "" : headerMultiLine[0];
+
+                if (headerMultiLine.size() > 1)
+                {
+                    for (size_t i = 1; i < headerMultiLine.size(); ++i)
+                    {
+                        headerValue += ",";
+                        headerValue += StringUtils::Trim(headerMultiLine[i].c_str());
+                    }
+                }
+
+                Aws::String::iterator new_end =
+                    std::unique(headerValue.begin(), headerValue.end(),
+                        [=](char lhs, char rhs) { return (lhs == rhs) && (lhs == ' '); }
+                );
+                headerValue.erase(new_end, headerValue.end());
+
+                canonicalHeaders[trimmedHeaderName] = headerValue;
+            }
+
+            return canonicalHeaders;
+        }
+
+        const ByteBuffer& GetSigningKey(const Aws::String& simpleDate)
+        {
+            if (simpleDate != m_keyDate)
+            {
+                Aws::String signingKey("AWS4");
+                signingKey.append(SECRET_KEY);
+                auto kDate = m_HMAC.Calculate(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
+                        ByteBuffer((unsigned char*)signingKey.c_str(), signingKey.length())).GetResult();
+                auto kRegion = m_HMAC.Calculate(ByteBuffer((unsigned char*)REGION, strlen(REGION)), kDate).GetResult();
+                auto kService = m_HMAC.Calculate(ByteBuffer((unsigned char*)SERVICE_NAME, strlen(SERVICE_NAME)), kRegion).GetResult();
+                m_key = m_HMAC.Calculate(ByteBuffer((unsigned char*)"aws4_request", strlen("aws4_request")), kService).GetResult();
+                m_keyDate = simpleDate;
+            }
+            return m_key;
+        }
+
+        bool m_urlEscapePath;
+        Crypto::Sha256 m_hash;
+        Crypto::Sha256HMAC m_HMAC;
+        Aws::String m_keyDate;
+        ByteBuffer m_key;
+    };
+}
+
+static std::shared_ptr<Standard::StandardHttpRequest> MakeItemRequest(const char* uri)
+{
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOC_TAG, uri, HttpMethod::HTTP_POST);
+    request->SetHeaderValue("content-type", "application/x-amz-json-1.0");
+    request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+    request->SetHeaderValue("user-agent", "aws-sdk-cpp/benchmark");
+    request->SetHeaderValue("x-amzn-trace-id", "Root=1-5759e988-bd862e3fe1be46a994272793");
+    request->SetHeaderValue("content-length", "62");
+    return request;
+}
+
+static std::shared_ptr<Standard::StandardHttpRequest> MakeOddHeadersRequest(const char* uri)
+{
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOC_TAG, uri, HttpMethod::HTTP_GET);
+    request->SetHeaderValue("My-Header1", "value1\n  value2 \r\n\n value3");
+    request->SetHeaderValue("my-header2", "  a   b    c  ");
+    request->SetHeaderValue("my-header3", " \t\n ");
+    request->SetHeaderValue("my-header4", "");
+    request->SetHeaderValue("x-amz-meta-list", "one,  two,\n\n  three  ");
+    return request;
+}
+
+static void AssertSameAuthorization(const std::function<std::shared_ptr<Standard::StandardHttpRequest>()>& makeRequest, bool urlEscapePath)
+{
+    auto credentialsProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, SERVICE_NAME, REGION, AWSAuthV4Signer::PayloadSigningPolicy::Never, urlEscapePath);
+    LegacyV4Signer legacySigner(urlEscapePath);
+
+    auto request = makeRequest();
+    ASSERT_TRUE(signer.SignRequest(*request));
+
+    auto legacyRequest = makeRequest();
+    legacyRequest->SetHeaderValue("x-amz-content-sha256", request->GetHeaderValue("x-amz-content-sha256"));
+    legacyRequest->SetHeaderValue("x-amz-date", request->GetHeaderValue("x-amz-date"));
+    Aws::String legacyAuthorization = legacySigner.Sign(*legacyRequest, request->GetHeaderValue("x-amz-date"), request->GetHeaderValue("x-amz-content-sha256"));
+
+    ASSERT_STREQ(legacyAuthorization.c_str(), request->GetAwsAuthorization().c_str());
+}
+
+TEST(AWSAuthV4SignerBenchmarkTest, TestMatchesLegacySigner)
+{
+    AssertSameAuthorization([] { return MakeItemRequest("https://dynamodb.us-east-1.amazonaws.com/"); }, true);
+    AssertSameAuthorization([] { return MakeItemRequest("https://dynamodb.us-east-1.amazonaws.com/"); }, false);
+    AssertSameAuthorization([] { return MakeOddHeadersRequest("https://test.com/path/with space/and%2Fslash?b=2&a=1&c"); }, true);
+    AssertSameAuthorization([] { return MakeOddHeadersRequest("https://test.com/path/with space/and%2Fslash?b=2&a=1&c"); }, false);
+    AssertSameAuthorization([] { return MakeOddHeadersRequest("https://test.com/?key"); }, true);
+    AssertSameAuthorization([]
+    {
+        auto request = MakeOddHeadersRequest("https://test.com/");
+        request->SetHeaderValue("   ", " ");
+        return request;
+    }, true);
+    // canonical headers longer than the signer hashes at a time.
+    AssertSameAuthorization([]
+    {
+        auto request = MakeItemRequest("https://dynamodb.us-east-1.amazonaws.com/");
+        for (char suffix = 'a'; suffix <= 'e'; ++suffix)
+        {
+            request->SetHeaderValue(Aws::String("x-amz-meta-large-") + suffix, Aws::String(3000, suffix));
+        }
+        return request;
+    }, true);
+}
+
+TEST(AWSAuthV4SignerBenchmarkTest, DISABLED_BenchmarkSignRequest)
+{
+    auto credentialsProvider = Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOC_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, SERVICE_NAME, REGION, AWSAuthV4Signer::PayloadSigningPolicy::Never, true);
+    LegacyV4Signer legacySigner(true);
+
+    auto request = MakeItemRequest("https://dynamodb.us-east-1.amazonaws.com/");
+    ASSERT_TRUE(signer.SignRequest(*request));
+    Aws::String dateHeaderValue = request->GetHeaderValue("x-amz-date");
+    Aws::String payloadHash = request->GetHeaderValue("x-amz-content-sha256");
+
+    // the test runner logs at trace level, which would dwarf the signing work being measured.
+    Aws::Utils::Logging::PushLogger(nullptr);
+    auto legacyStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < BENCHMARK_ITERATIONS; ++i)
+    {
+        legacySigner.Sign(*request, dateHeaderValue, payloadHash);
+    }
+    auto legacyElapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - legacyStart);
+
+    bool allSigned = true;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < BENCHMARK_ITERATIONS; ++i)
+    {
+        allSigned = signer.SignRequest(*request) && allSigned;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    Aws::Utils::Logging::PopLogger();
+
+    ASSERT_TRUE(allSigned);
+
+    std::cout << "legacy SignRequest:  " << legacyElapsed.count() / BENCHMARK_ITERATIONS << " ns/request" << std::endl;
+    std::cout << "current SignRequest: " << elapsed.count() / BENCHMARK_ITERATIONS << " ns/request" << std::endl;
+}
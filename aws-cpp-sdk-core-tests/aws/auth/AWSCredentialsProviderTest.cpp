@@ -299,6 +299,65 @@ TEST_F(EnvironmentModifyingTest, TestProvidersNumberInCredentialsProvidersChain)
     ASSERT_EQ(2u, providersChainWith2Providers.GetProviders().size());
 }
 
+class CountingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    CountingCredentialsProvider() : m_calls(0) {}
+
+    AWSCredentials GetAWSCredentials() override
+    {
+        ++m_calls;
+        return m_credentials;
+    }
+
+    AWSCredentials m_credentials;
+    int m_calls;
+};
+
+class TestCredentialsProviderChain : public AWSCredentialsProviderChain
+{
+public:
+    using AWSCredentialsProviderChain::AddProvider;
+};
+
+TEST(AWSCredentialsProviderChainTest, TestChainSticksToActiveProvider)
+{
+    auto first = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag);
+    auto second = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag);
+    auto third = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag);
+    second->m_credentials = AWSCredentials("secondKey", "secondSecret");
+    third->m_credentials = AWSCredentials("thirdKey", "thirdSecret");
+
+    TestCredentialsProviderChain chain;
+    chain.AddProvider(first);
+    chain.AddProvider(second);
+    chain.AddProvider(third);
+    ASSERT_EQ(-1, chain.GetActiveProviderIndex());
+
+    ASSERT_EQ("secondKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(1, chain.GetActiveProviderIndex());
+    ASSERT_EQ("secondKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("secondKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(1, first->m_calls);
+    ASSERT_EQ(3, second->m_calls);
+    ASSERT_EQ(0, third->m_calls);
+    ASSERT_EQ(1u, chain.GetChainWalks());
+    ASSERT_EQ(2u, chain.GetActiveProviderHits());
+
+    // Once the active provider fails the chain is walked from the start again.
+    second->m_credentials = AWSCredentials("", "");
+    ASSERT_EQ("thirdKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(2, chain.GetActiveProviderIndex());
+    ASSERT_EQ(2, first->m_calls);
+    ASSERT_EQ(2u, chain.GetChainWalks());
+
+    third->m_credentials = AWSCredentials("", "");
+    ASSERT_TRUE(chain.GetAWSCredentials().IsEmpty());
+    ASSERT_EQ(-1, chain.GetActiveProviderIndex());
+    ASSERT_EQ(3u, chain.GetChainWalks());
+    ASSERT_EQ(2u, chain.GetActiveProviderHits());
+}
+
 
 TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientReturnsGoodData)
 {
@@ -0,0 +1,117 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/RefreshAheadCredentials.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+namespace
+{
+    /**
+     * Hands out credentials with the access key "1", "2"... each valid for lifetime, counting the loads.
+     */
+    struct CountingLoader
+    {
+        CountingLoader(std::chrono::milliseconds lifetime, std::chrono::milliseconds loadTime = std::chrono::milliseconds(0)) :
+            lifetime(lifetime), loadTime(loadTime), loads(0)
+        {
+        }
+
+        RefreshAheadCredentials::LoadFunction Function()
+        {
+            return [this](AWSCredentials& credentials, DateTime& expiration)
+            {
+                std::this_thread::sleep_for(loadTime);
+                int load = ++loads;
+                credentials = AWSCredentials(Aws::Utils::StringUtils::to_string(load), "secret");
+                expiration = DateTime::Now() + lifetime;
+            };
+        }
+
+        std::chrono::milliseconds lifetime;
+        std::chrono::milliseconds loadTime;
+        std::atomic<int> loads;
+    };
+}
+
+TEST(RefreshAheadCredentialsTest, TestConcurrentFirstLoadsAreCoalesced)
+{
+    CountingLoader loader(std::chrono::minutes(60), std::chrono::milliseconds(50));
+    RefreshAheadCredentials credentials(loader.Function());
+
+    std::atomic<int> loaded(0);
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            if (credentials.GetCredentials().GetAWSAccessKeyId() == "1")
+            {
+                ++loaded;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(8, loaded.load());
+    ASSERT_EQ(1, loader.loads.load());
+    ASSERT_EQ("1", credentials.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(1, loader.loads.load());
+}
+
+TEST(RefreshAheadCredentialsTest, TestCredentialsAreRefreshedInTheBackgroundBeforeTheyExpire)
+{
+    // refreshed at a random point between 500ms and 250ms before they expire
+    CountingLoader loader(std::chrono::seconds(2));
+    RefreshAheadCredentials credentials(loader.Function());
+    ASSERT_EQ("1", credentials.GetCredentials().GetAWSAccessKeyId());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1800));
+    loader.loadTime = std::chrono::milliseconds(300);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ("1", credentials.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(200));
+
+    Aws::String accessKey;
+    for (int i = 0; i < 200 && accessKey != "2"; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        accessKey = credentials.GetCredentials().GetAWSAccessKeyId();
+    }
+    ASSERT_EQ("2", accessKey);
+    ASSERT_EQ(2, loader.loads.load());
+}
+
+TEST(RefreshAheadCredentialsTest, TestExpiredCredentialsAreLoadedByTheCaller)
+{
+    // too short lived to be refreshed ahead
+    CountingLoader loader(std::chrono::milliseconds(100));
+    RefreshAheadCredentials credentials(loader.Function());
+    ASSERT_EQ("1", credentials.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("1", credentials.GetCredentials().GetAWSAccessKeyId());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    ASSERT_EQ("2", credentials.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(2, loader.loads.load());
+}
@@ -28,7 +28,11 @@
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/platform/Environment.h>
+#include <aws/core/client/RetryTokenBucket.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <fstream>
+#include <future>
+#include <thread>
 
 using Aws::Utils::DateTime;
 using Aws::Utils::DateFormat;
@@ -222,6 +226,212 @@ TEST_F(AWSClientTestSuite, TestClockChangesAfterSkewHasBeenSet)
     ASSERT_EQ(1, client->GetRequestAttemptedRetries());
 }
 
+TEST_F(AWSClientTestSuite, TestAsyncRequestWithBlockingHttpClient)
+{
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<bool> outcomePromise;
+    client->MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome.IsSuccess()); });
+
+    ASSERT_TRUE(outcomePromise.get_future().get());
+    ASSERT_EQ(0, client->GetRequestAttemptedRetries());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncRequestWithNonBlockingHttpClientRetries)
+{
+    mockHttpClient->SetSupportsAsyncRequests(true);
+    // a null response is a retryable network error for the mock client.
+    mockHttpClient->AddResponseToReturn(nullptr);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<bool> outcomePromise;
+    client->MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome.IsSuccess()); });
+
+    ASSERT_TRUE(outcomePromise.get_future().get());
+    ASSERT_EQ(1, client->GetRequestAttemptedRetries());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestAsyncRequestWithNonBlockingHttpClientFails)
+{
+    mockHttpClient->SetSupportsAsyncRequests(true);
+    QueueMockResponse(HttpResponseCode::BAD_REQUEST, HeaderValueCollection());
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<HttpResponseCode> outcomePromise;
+    client->MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome)
+    {
+        outcomePromise.set_value(outcome.IsSuccess() ? HttpResponseCode::OK : outcome.GetError().GetResponseCode());
+    });
+
+    ASSERT_EQ(HttpResponseCode::BAD_REQUEST, outcomePromise.get_future().get());
+    ASSERT_EQ(0, client->GetRequestAttemptedRetries());
+}
+
+class FixedDelayRetryStrategy : public CountedRetryStrategy
+{
+public:
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>&, long) const override { return 300; }
+};
+
+TEST_F(AWSClientTestSuite, TestAsyncRetryBackOffDoesNotHoldExecutorThread)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<FixedDelayRetryStrategy>(ALLOCATION_TAG);
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    config.executor = executor;
+    MockAWSClient singleThreadedClient(config);
+
+    mockHttpClient->AddResponseToReturn(nullptr);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<bool> outcomePromise;
+    singleThreadedClient.MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome.IsSuccess()); });
+
+    //the only executor thread is free again while the retry waits out its back-off.
+    std::promise<size_t> requestsMadeBeforeRetry;
+    executor->Submit([&]() { requestsMadeBeforeRetry.set_value(mockHttpClient->GetAllRequestsMade().size()); });
+    ASSERT_EQ(1u, requestsMadeBeforeRetry.get_future().get());
+
+    ASSERT_TRUE(outcomePromise.get_future().get());
+    ASSERT_EQ(1, singleThreadedClient.GetRequestAttemptedRetries());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+class LongDelayRetryStrategy : public CountedRetryStrategy
+{
+public:
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>&, long) const override { return 60000; }
+};
+
+TEST_F(AWSClientTestSuite, TestPendingAsyncRetryCompletesWhenClientIsDestroyed)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<LongDelayRetryStrategy>(ALLOCATION_TAG);
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    config.executor = executor;
+    auto shortLivedClient = Aws::MakeShared<MockAWSClient>(ALLOCATION_TAG, config);
+
+    mockHttpClient->AddResponseToReturn(nullptr);
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<bool> outcomePromise;
+    shortLivedClient->MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome.IsSuccess()); });
+
+    //wait for the first attempt to fail, its retry then waits a minute on the timer wheel.
+    std::promise<void> firstAttemptDone;
+    executor->Submit([&]() { firstAttemptDone.set_value(); });
+    firstAttemptDone.get_future().get();
+
+    //the retry is not resubmitted to the executor, the handler gets the failed outcome of the first attempt.
+    shortLivedClient = nullptr;
+    auto outcomeFuture = outcomePromise.get_future();
+    ASSERT_EQ(std::future_status::ready, outcomeFuture.wait_for(std::chrono::seconds(0)));
+    ASSERT_FALSE(outcomeFuture.get());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestQueuedAsyncResponseCompletesWhenClientIsDestroyed)
+{
+    mockHttpClient->SetSupportsAsyncRequests(true);
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    config.executor = executor;
+    auto shortLivedClient = Aws::MakeShared<MockAWSClient>(ALLOCATION_TAG, config);
+
+    //hold the only executor thread, so the response is still queued on the executor when the client goes away.
+    std::promise<void> releaseExecutor;
+    auto executorReleased = releaseExecutor.get_future().share();
+    executor->Submit([executorReleased]() { executorReleased.wait(); });
+
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<bool> outcomePromise;
+    shortLivedClient->MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome.IsSuccess()); });
+    shortLivedClient = nullptr;
+    releaseExecutor.set_value();
+
+    ASSERT_FALSE(outcomePromise.get_future().get());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestQueuedAsyncRetryCompletesWhenClientIsDestroyed)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<FixedDelayRetryStrategy>(ALLOCATION_TAG);
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 1);
+    config.executor = executor;
+    auto shortLivedClient = Aws::MakeShared<MockAWSClient>(ALLOCATION_TAG, config);
+
+    mockHttpClient->AddResponseToReturn(nullptr);
+    auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(ALLOCATION_TAG);
+    std::promise<bool> outcomePromise;
+    shortLivedClient->MakeRequestAsync(request, [&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome.IsSuccess()); });
+
+    std::promise<void> firstAttemptDone;
+    executor->Submit([&]() { firstAttemptDone.set_value(); });
+    firstAttemptDone.get_future().get();
+
+    //hold the only executor thread past the back-off, so the timer wheel has queued the retry behind it when the client goes away.
+    std::promise<void> releaseExecutor;
+    auto executorReleased = releaseExecutor.get_future().share();
+    executor->Submit([executorReleased]() { executorReleased.wait(); });
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    shortLivedClient = nullptr;
+    releaseExecutor.set_value();
+
+    //the queued retry is turned away, the handler gets the failed outcome of the first attempt.
+    ASSERT_FALSE(outcomePromise.get_future().get());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST_F(AWSClientTestSuite, TestRetryBudgetStopsRetries)
+{
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    // enough for a single retry after a connection failure.
+    config.retryTokenBucketCapacity = RetryTokenBucket::TIMEOUT_RETRY_COST;
+    MockAWSClient budgetedClient(config);
+
+    AmazonWebServiceRequestMock request;
+    for (int i = 0; i < 3; ++i)
+    {
+        mockHttpClient->AddResponseToReturn(nullptr);
+    }
+    auto outcome = budgetedClient.MakeRequest(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+
+    mockHttpClient->Reset();
+    mockHttpClient->AddResponseToReturn(nullptr);
+    outcome = budgetedClient.MakeRequest(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+}
+
+TEST(RetryTokenBucketTest, TestRetriesTakeTokensAndSuccessesReturnThem)
+{
+    RetryTokenBucket bucket(12);
+    unsigned acquired = 0;
+    ASSERT_TRUE(bucket.AcquireForRetry(AWSError<CoreErrors>(CoreErrors::THROTTLING, true), acquired));
+    ASSERT_EQ(RetryTokenBucket::RETRY_COST, acquired);
+    ASSERT_FALSE(bucket.AcquireForRetry(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, true), acquired));
+    ASSERT_EQ(0u, acquired);
+    ASSERT_EQ(7u, bucket.GetAvailableTokens());
+
+    bucket.ReleaseOnSuccess(RetryTokenBucket::RETRY_COST);
+    ASSERT_EQ(12u, bucket.GetAvailableTokens());
+    //never exceeds the capacity.
+    bucket.ReleaseOnSuccess(0);
+    ASSERT_EQ(12u, bucket.GetAvailableTokens());
+
+    RetryTokenBucket disabled(0);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(disabled.AcquireForRetry(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true), acquired));
+    }
+}
+
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
 {
     HeaderValueCollection headerValues;
@@ -316,6 +526,27 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
     ASSERT_EQ(contentLengthExpected.str(), finalHeaders[Http::CONTENT_LENGTH_HEADER]);  
 }
 
+TEST(AWSClientTest, TestBuildHttpRequestComputesMd5AndSha256InOnePass)
+{
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    amazonWebServiceRequest.SetComputeContentMd5(true);
+
+    std::shared_ptr<Aws::StringStream> ss = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *ss << "test";
+    amazonWebServiceRequest.SetBody(ss);
+
+    URI uri("http://www.uri.com");
+    std::shared_ptr<Standard::StandardHttpRequest> httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_PUT);
+    httpRequest->SetComputeContentSha256(true);
+
+    AccessViolatingAWSClient awsClient;
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+
+    ASSERT_EQ(Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5(*ss)), httpRequest->GetHeaderValue(Http::CONTENT_MD5_HEADER));
+    ASSERT_EQ(Utils::HashingUtils::HexEncode(Utils::HashingUtils::CalculateSHA256(*ss)), httpRequest->GetContentSha256());
+    ASSERT_EQ(0, ss->tellg());
+}
+
 TEST(AWSClientTest, TestHostHeaderWithNonStandardHttpPort)
 {
     Standard::StandardHttpRequest r1("http://example.amazonaws.com:8080", HttpMethod::HTTP_GET);
@@ -0,0 +1,216 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/EndpointDiscoveryCache.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <future>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    const char* ALLOCATION_TAG = "EndpointDiscoveryCacheTest";
+
+    /**
+     * Discovers address, counting the calls.
+     */
+    struct CountingDiscovery
+    {
+        CountingDiscovery(const char* address, std::chrono::milliseconds cachePeriod) :
+            address(address), cachePeriod(cachePeriod), calls(0), succeed(true)
+        {
+        }
+
+        EndpointDiscoveryCache::DiscoverEndpointFunction Function()
+        {
+            return [this](Aws::String& discoveredAddress, std::chrono::milliseconds& discoveredCachePeriod)
+            {
+                ++calls;
+                discoveredAddress = address;
+                discoveredCachePeriod = cachePeriod;
+                return succeed.load();
+            };
+        }
+
+        Aws::String address;
+        std::chrono::milliseconds cachePeriod;
+        std::atomic<int> calls;
+        std::atomic<bool> succeed;
+    };
+}
+
+TEST(EndpointDiscoveryCacheTest, TestEndpointIsDiscoveredOnce)
+{
+    EndpointDiscoveryCache cache;
+    CountingDiscovery discovery("https://a.example.com", std::chrono::minutes(10));
+
+    Aws::String endpoint;
+    ASSERT_TRUE(cache.GetEndpoint("Shared", discovery.Function(), endpoint));
+    ASSERT_STREQ("https://a.example.com", endpoint.c_str());
+    endpoint.clear();
+    ASSERT_TRUE(cache.GetEndpoint("Shared", discovery.Function(), endpoint));
+    ASSERT_STREQ("https://a.example.com", endpoint.c_str());
+    ASSERT_EQ(1, discovery.calls.load());
+
+    CountingDiscovery other("https://b.example.com", std::chrono::minutes(10));
+    ASSERT_TRUE(cache.GetEndpoint("Query.TableName:t.", other.Function(), endpoint));
+    ASSERT_STREQ("https://b.example.com", endpoint.c_str());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestConcurrentLookupsShareOneDiscovery)
+{
+    EndpointDiscoveryCache cache;
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    std::atomic<int> calls(0);
+    auto discover = [&](Aws::String& address, std::chrono::milliseconds& cachePeriod)
+    {
+        ++calls;
+        released.wait();
+        address = "https://a.example.com";
+        cachePeriod = std::chrono::minutes(10);
+        return true;
+    };
+
+    std::atomic<int> found(0);
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            Aws::String endpoint;
+            if (cache.GetEndpoint("Shared", discover, endpoint) && endpoint == "https://a.example.com")
+            {
+                ++found;
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    release.set_value();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(1, calls.load());
+    ASSERT_EQ(8, found.load());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestFailedDiscoveryIsRetriedByTheNextLookup)
+{
+    EndpointDiscoveryCache cache;
+    CountingDiscovery discovery("https://a.example.com", std::chrono::minutes(10));
+    discovery.succeed = false;
+
+    Aws::String endpoint;
+    ASSERT_FALSE(cache.GetEndpoint("Shared", discovery.Function(), endpoint));
+    ASSERT_TRUE(endpoint.empty());
+
+    discovery.succeed = true;
+    ASSERT_TRUE(cache.GetEndpoint("Shared", discovery.Function(), endpoint));
+    ASSERT_STREQ("https://a.example.com", endpoint.c_str());
+    ASSERT_EQ(2, discovery.calls.load());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestEndpointIsRefreshedInTheBackgroundBeforeItExpires)
+{
+    // refreshed once less than half of its 400ms cache period is left, the window is larger than that.
+    EndpointDiscoveryCache cache(1000, std::chrono::milliseconds(300));
+    cache.SetExecutor(Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1));
+    CountingDiscovery first("https://a.example.com", std::chrono::milliseconds(400));
+
+    Aws::String endpoint;
+    ASSERT_TRUE(cache.GetEndpoint("Shared", first.Function(), endpoint));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(cache.GetEndpoint("Shared", first.Function(), endpoint));
+    ASSERT_EQ(1, first.calls.load());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::promise<void> refreshed;
+    auto refresh = [&](Aws::String& address, std::chrono::milliseconds& cachePeriod)
+    {
+        address = "https://b.example.com";
+        cachePeriod = std::chrono::minutes(10);
+        refreshed.set_value();
+        return true;
+    };
+    ASSERT_TRUE(cache.GetEndpoint("Shared", refresh, endpoint));
+    ASSERT_STREQ("https://a.example.com", endpoint.c_str());
+
+    ASSERT_EQ(std::future_status::ready, refreshed.get_future().wait_for(std::chrono::seconds(10)));
+    for (int i = 0; i < 100 && endpoint != "https://b.example.com"; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        ASSERT_TRUE(cache.GetEndpoint("Shared", first.Function(), endpoint));
+    }
+    ASSERT_STREQ("https://b.example.com", endpoint.c_str());
+    ASSERT_EQ(1, first.calls.load());
+    cache.StopRefreshing();
+}
+
+TEST(EndpointDiscoveryCacheTest, TestExpiredEndpointIsUsedWhileItIsRediscovered)
+{
+    EndpointDiscoveryCache cache;
+    CountingDiscovery first("https://a.example.com", std::chrono::milliseconds(20));
+
+    Aws::String endpoint;
+    ASSERT_TRUE(cache.GetEndpoint("Shared", first.Function(), endpoint));
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    std::promise<void> started;
+    std::promise<void> release;
+    auto rediscover = [&](Aws::String& address, std::chrono::milliseconds& cachePeriod)
+    {
+        started.set_value();
+        release.get_future().wait();
+        address = "https://b.example.com";
+        cachePeriod = std::chrono::minutes(10);
+        return true;
+    };
+    std::thread rediscovering([&]()
+    {
+        Aws::String rediscovered;
+        cache.GetEndpoint("Shared", rediscover, rediscovered);
+    });
+    started.get_future().wait();
+
+    ASSERT_TRUE(cache.GetEndpoint("Shared", first.Function(), endpoint));
+    ASSERT_STREQ("https://a.example.com", endpoint.c_str());
+    ASSERT_EQ(1, first.calls.load());
+
+    release.set_value();
+    rediscovering.join();
+    ASSERT_TRUE(cache.GetEndpoint("Shared", first.Function(), endpoint));
+    ASSERT_STREQ("https://b.example.com", endpoint.c_str());
+}
+
+TEST(EndpointDiscoveryCacheTest, TestNoRefreshesAfterStopRefreshing)
+{
+    EndpointDiscoveryCache cache(1000, std::chrono::minutes(1));
+    cache.SetExecutor(Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1));
+    CountingDiscovery discovery("https://a.example.com", std::chrono::seconds(30));
+
+    Aws::String endpoint;
+    ASSERT_TRUE(cache.GetEndpoint("Shared", discovery.Function(), endpoint));
+    cache.StopRefreshing();
+    ASSERT_TRUE(cache.GetEndpoint("Shared", discovery.Function(), endpoint));
+    ASSERT_STREQ("https://a.example.com", endpoint.c_str());
+    ASSERT_EQ(1, discovery.calls.load());
+}
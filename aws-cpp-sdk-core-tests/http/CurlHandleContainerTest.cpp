@@ -0,0 +1,190 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#if ENABLE_CURL_CLIENT
+#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/http/curl/CurlShareHandle.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/testing/mocks/http/LoopbackHttpServer.h>
+#include <thread>
+
+using namespace Aws::Http;
+
+static const char S3_ENDPOINT[] = "https://s3.us-east-1.amazonaws.com:443";
+static const char DDB_ENDPOINT[] = "https://dynamodb.us-east-1.amazonaws.com:443";
+
+TEST(CurlHandleContainerTest, TestEndpointKey)
+{
+    ASSERT_EQ(S3_ENDPOINT, CurlHandleContainer::GetEndpointKey("https", "s3.us-east-1.amazonaws.com", 443));
+}
+
+TEST(CurlHandleContainerTest, TestHandlesStayWithTheirEndpoint)
+{
+    CurlHandleContainer container(4);
+
+    CURL* s3Handle = container.AcquireCurlHandle(S3_ENDPOINT);
+    ASSERT_NE(nullptr, s3Handle);
+    container.ReleaseCurlHandle(s3Handle, S3_ENDPOINT);
+
+    // the pool can still grow, so the idle s3 handle is not handed to another endpoint.
+    CURL* ddbHandle = container.AcquireCurlHandle(DDB_ENDPOINT);
+    ASSERT_NE(nullptr, ddbHandle);
+    ASSERT_NE(s3Handle, ddbHandle);
+    container.ReleaseCurlHandle(ddbHandle, DDB_ENDPOINT);
+
+    ASSERT_EQ(s3Handle, container.AcquireCurlHandle(S3_ENDPOINT));
+    ASSERT_EQ(ddbHandle, container.AcquireCurlHandle(DDB_ENDPOINT));
+
+    auto stats = container.GetPoolStats();
+    ASSERT_EQ(4u, stats.maxPoolSize);
+    ASSERT_EQ(2u, stats.poolSize);
+    ASSERT_EQ(0u, stats.idleHandles);
+    ASSERT_EQ(4u, stats.acquisitions);
+    ASSERT_EQ(2u, stats.endpointHits);
+
+    container.ReleaseCurlHandle(s3Handle, S3_ENDPOINT);
+    container.ReleaseCurlHandle(ddbHandle, DDB_ENDPOINT);
+    stats = container.GetPoolStats();
+    ASSERT_EQ(2u, stats.idleHandles);
+    ASSERT_EQ(2u, stats.idleEndpoints);
+}
+
+TEST(CurlHandleContainerTest, TestFullPoolHandsOutHandlesOfOtherEndpoints)
+{
+    CurlHandleContainer container(2);
+    CURL* first = container.TryAcquireCurlHandle(S3_ENDPOINT);
+    CURL* second = container.TryAcquireCurlHandle(S3_ENDPOINT);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_EQ(nullptr, container.TryAcquireCurlHandle(DDB_ENDPOINT));
+
+    container.ReleaseCurlHandle(first, S3_ENDPOINT);
+    ASSERT_EQ(first, container.TryAcquireCurlHandle(DDB_ENDPOINT));
+    ASSERT_EQ(0u, container.GetPoolStats().endpointHits);
+
+    container.ReleaseCurlHandle(first, DDB_ENDPOINT);
+    container.ReleaseCurlHandle(second);
+}
+
+TEST(CurlHandleContainerTest, TestAcquireBlocksUntilRelease)
+{
+    CurlHandleContainer container(1);
+    CURL* handle = container.AcquireCurlHandle(S3_ENDPOINT);
+    ASSERT_NE(nullptr, handle);
+
+    CURL* acquiredByOtherThread = nullptr;
+    std::thread waiter([&]()
+    {
+        acquiredByOtherThread = container.AcquireCurlHandle(S3_ENDPOINT);
+    });
+
+    while (container.GetPoolStats().waits == 0)
+    {
+        std::this_thread::yield();
+    }
+    container.ReleaseCurlHandle(handle, S3_ENDPOINT);
+    waiter.join();
+
+    ASSERT_EQ(handle, acquiredByOtherThread);
+    ASSERT_EQ(1u, container.GetPoolStats().endpointHits);
+    container.ReleaseCurlHandle(acquiredByOtherThread, S3_ENDPOINT);
+}
+
+TEST(CurlHandleContainerTest, TestFailedWarmUpReturnsHandlesToPool)
+{
+    Aws::Client::ClientConfiguration config;
+    config.maxConnections = 4;
+    config.warmUpEndpoints.push_back("http://some.unknown1234xxx.test.aws");
+    config.warmUpConnectionsPerEndpoint = 2;
+    CurlHttpClient client(config);
+
+    auto stats = client.GetConnectionPoolStats();
+    ASSERT_EQ(2u, stats.poolSize);
+    ASSERT_EQ(2u, stats.idleHandles);
+    // the lookups failed, so the handles are not advertised as connected.
+    ASSERT_EQ(0u, stats.idleEndpoints);
+}
+
+#ifndef _WIN32
+TEST(CurlHandleContainerTest, TestWarmedUpConnectionIsReused)
+{
+    LoopbackHttpServer server;
+    ASSERT_NE(0, server.GetPort());
+
+    Aws::Client::ClientConfiguration config;
+    config.maxConnections = 4;
+    config.warmUpEndpoints.push_back(server.GetEndpoint());
+    config.warmUpConnectionsPerEndpoint = 1;
+    {
+        CurlHttpClient client(config);
+        ASSERT_EQ(1, server.GetConnectionCount());
+        ASSERT_EQ(1, server.GetRequestCount());
+        ASSERT_EQ(1u, client.GetConnectionPoolStats().idleEndpoints);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            auto request = Aws::MakeShared<Standard::StandardHttpRequest>("CurlHandleContainerTest", server.GetEndpoint() + "/object",
+                    HttpMethod::HTTP_GET);
+            request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            auto response = client.MakeRequest(request);
+            ASSERT_NE(nullptr, response);
+            ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+        }
+
+        // every request went over the connection opened by the warm up.
+        ASSERT_EQ(4, server.GetRequestCount());
+        ASSERT_EQ(1, server.GetConnectionCount());
+    }
+}
+#endif
+
+TEST(CurlHandleContainerTest, TestProcessShareHandleIsSharedUntilReleased)
+{
+    auto shareHandle = CurlShareHandle::GetProcessShareHandle();
+    ASSERT_NE(nullptr, shareHandle);
+    ASSERT_NE(nullptr, shareHandle->GetHandle());
+    ASSERT_EQ(shareHandle, CurlShareHandle::GetProcessShareHandle());
+
+    CurlShareHandle::ReleaseProcessShareHandle();
+    auto newShareHandle = CurlShareHandle::GetProcessShareHandle();
+    ASSERT_NE(shareHandle, newShareHandle);
+    CurlShareHandle::ReleaseProcessShareHandle();
+}
+
+TEST(CurlHandleContainerTest, TestClientsWithSharedCachesOutliveProcessShareHandle)
+{
+    Aws::Client::ClientConfiguration config;
+    config.shareCurlCaches = true;
+    config.connectTimeoutMs = 1000;
+    auto firstClient = Aws::MakeShared<CurlHttpClient>("CurlHandleContainerTest", config);
+    CurlHttpClient secondClient(config);
+
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>("CurlHandleContainerTest", "http://some.unknown1234xxx.test.aws",
+            HttpMethod::HTTP_GET);
+    request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    ASSERT_EQ(nullptr, firstClient->MakeRequest(request));
+
+    //the handles of both clients keep using the share after the process wide reference is gone.
+    CurlShareHandle::ReleaseProcessShareHandle();
+    firstClient = nullptr;
+    ASSERT_EQ(nullptr, secondClient.MakeRequest(request));
+}
+#endif
@@ -19,6 +19,7 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/client/ClientConfiguration.h>
+#include <future>
 
 using namespace Aws::Http;
 #ifndef NO_HTTP_CLIENT
@@ -30,4 +31,35 @@ TEST(HttpClientTest, TestNullResponse)
 	auto response = httpClient->MakeRequest(request);
 	ASSERT_EQ(nullptr, response);
 }
+
+TEST(HttpClientTest, TestNullResponseAsync)
+{
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    config.httpEventLoopThreads = 2;
+    auto httpClient = CreateHttpClient(config);
+
+    const int requestCount = 4;
+    std::promise<int> nullResponsesPromise;
+    std::atomic<int> completed(0);
+    std::atomic<int> nullResponses(0);
+    for (int i = 0; i < requestCount; ++i)
+    {
+        auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+                HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        httpClient->MakeRequestAsync(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+        {
+            if (!response)
+            {
+                ++nullResponses;
+            }
+            if (++completed == requestCount)
+            {
+                nullResponsesPromise.set_value(nullResponses.load());
+            }
+        });
+    }
+
+    ASSERT_EQ(requestCount, nullResponsesPromise.get_future().get());
+}
 #endif
@@ -0,0 +1,167 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/ResponseSink.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#if ENABLE_CURL_CLIENT
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/testing/mocks/http/LoopbackHttpServer.h>
+#endif
+
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#endif
+
+using namespace Aws::Http;
+
+static const unsigned char BODY[] = "0123456789abcdefghij";
+static const size_t BODY_LENGTH = sizeof(BODY) - 1;
+
+TEST(ResponseSinkTest, TestCallerBufferRejectsBodyThatDoesNotFit)
+{
+    unsigned char buffer[BODY_LENGTH];
+    BufferResponseSink sink(buffer, sizeof(buffer));
+
+    ASSERT_FALSE(sink.BeginBody(BODY_LENGTH + 1));
+    ASSERT_TRUE(sink.BeginBody(BODY_LENGTH));
+    ASSERT_TRUE(sink.Write(BODY, 8));
+    ASSERT_TRUE(sink.Write(BODY + 8, BODY_LENGTH - 8));
+    ASSERT_EQ(BODY_LENGTH, sink.GetBytesWritten());
+    ASSERT_EQ(0, std::memcmp(BODY, sink.GetData(), BODY_LENGTH));
+    ASSERT_EQ(buffer, sink.GetData());
+    ASSERT_FALSE(sink.Write(BODY, 1));
+
+    //a retried attempt starts over.
+    ASSERT_TRUE(sink.BeginBody(-1));
+    ASSERT_EQ(0u, sink.GetBytesWritten());
+}
+
+TEST(ResponseSinkTest, TestOwnedBufferGrowsWithoutContentLength)
+{
+    BufferResponseSink sink;
+    ASSERT_TRUE(sink.BeginBody(-1));
+    for (size_t i = 0; i < BODY_LENGTH; ++i)
+    {
+        ASSERT_TRUE(sink.Write(BODY + i, 1));
+    }
+    ASSERT_EQ(BODY_LENGTH, sink.GetBytesWritten());
+    ASSERT_EQ(0, std::memcmp(BODY, sink.GetData(), BODY_LENGTH));
+}
+
+TEST(ResponseSinkTest, TestScatterFillsSegmentsInOrder)
+{
+    unsigned char first[3];
+    unsigned char second[10];
+    unsigned char third[BODY_LENGTH - 13];
+    Aws::Vector<ResponseSinkSegment> segments;
+    segments.push_back({ first, sizeof(first) });
+    segments.push_back({ second, sizeof(second) });
+    segments.push_back({ third, sizeof(third) });
+    ScatterResponseSink sink(segments);
+
+    ASSERT_FALSE(sink.BeginBody(BODY_LENGTH + 1));
+    ASSERT_TRUE(sink.BeginBody(BODY_LENGTH));
+    ASSERT_TRUE(sink.Write(BODY, 5));
+    ASSERT_TRUE(sink.Write(BODY + 5, BODY_LENGTH - 5));
+    ASSERT_FALSE(sink.Write(BODY, 1));
+    ASSERT_EQ(BODY_LENGTH, sink.GetBytesWritten());
+
+    ASSERT_EQ(0, std::memcmp(BODY, first, sizeof(first)));
+    ASSERT_EQ(0, std::memcmp(BODY + 3, second, sizeof(second)));
+    ASSERT_EQ(0, std::memcmp(BODY + 13, third, sizeof(third)));
+}
+
+#if !defined(_WIN32)
+TEST(ResponseSinkTest, TestFileSinkWritesAtOffset)
+{
+    char path[] = "/tmp/ResponseSinkTestXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_NE(-1, fd);
+
+    FileResponseSink sink(fd, 4);
+    ASSERT_TRUE(sink.BeginBody(BODY_LENGTH));
+    ASSERT_TRUE(sink.Write(BODY, 10));
+    ASSERT_TRUE(sink.Write(BODY + 10, BODY_LENGTH - 10));
+    ASSERT_EQ(BODY_LENGTH, sink.GetBytesWritten());
+
+    char contents[BODY_LENGTH + 4];
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(contents)), pread(fd, contents, sizeof(contents), 0));
+    ASSERT_EQ(0, std::memcmp(BODY, contents + 4, BODY_LENGTH));
+
+    close(fd);
+    unlink(path);
+}
+#endif
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+static std::string RespondByPath(const std::string& requestLine)
+{
+    if (requestLine.find(" /body ") != std::string::npos)
+    {
+        return "HTTP/1.1 200 OK\r\nContent-Length: 20\r\n\r\n0123456789abcdefghij";
+    }
+    if (requestLine.find(" /missing ") != std::string::npos)
+    {
+        return "HTTP/1.1 404 Not Found\r\nContent-Length: 7\r\n\r\nmissing";
+    }
+    return LoopbackHttpServer::RespondEmptyOk(requestLine);
+}
+
+static std::shared_ptr<HttpResponse> GetIntoSink(CurlHttpClient& client, const Aws::String& url, const std::shared_ptr<ResponseSink>& sink)
+{
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>("ResponseSinkTest", url, HttpMethod::HTTP_GET);
+    request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetResponseSink(sink);
+    return client.MakeRequest(request);
+}
+
+TEST(ResponseSinkTest, TestCurlClientRoutesSuccessfulBodiesToSink)
+{
+    LoopbackHttpServer server(RespondByPath);
+    ASSERT_NE(0, server.GetPort());
+    CurlHttpClient client{Aws::Client::ClientConfiguration()};
+    auto sink = Aws::MakeShared<BufferResponseSink>("ResponseSinkTest");
+
+    auto response = GetIntoSink(client, server.GetEndpoint() + "/body", sink);
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    ASSERT_EQ(BODY_LENGTH, sink->GetBytesWritten());
+    ASSERT_EQ(0, std::memcmp(BODY, sink->GetData(), BODY_LENGTH));
+    ASSERT_EQ(Aws::IOStream::traits_type::eof(), response->GetResponseBody().peek());
+
+    //an empty body still starts the sink over, nothing of the previous body is left in it.
+    response = GetIntoSink(client, server.GetEndpoint() + "/empty", sink);
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    ASSERT_EQ(0u, sink->GetBytesWritten());
+
+    //error bodies go to the response stream to be parsed.
+    response = GetIntoSink(client, server.GetEndpoint() + "/missing", sink);
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::NOT_FOUND, response->GetResponseCode());
+    ASSERT_EQ(0u, sink->GetBytesWritten());
+    Aws::String errorBody((Aws::IStreamBufIterator(response->GetResponseBody())), Aws::IStreamBufIterator());
+    ASSERT_STREQ("missing", errorBody.c_str());
+}
+#endif
@@ -15,6 +15,7 @@
 
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
 #include <aws/external/gtest.h>
 #include <fstream>
@@ -151,6 +152,8 @@ TEST_F(DirectoryTreeTest, TestManualDirectoryTraversal)
     ASSERT_EQ(Aws::FileSystem::FileType::File, entry.fileType);
     ASSERT_STREQ(file2.c_str(), entry.path.c_str());
     ASSERT_EQ(static_cast<int64_t>(file2Size), entry.fileSize);
+    ASSERT_GT(entry.lastModified.Millis(), DateTime::CurrentTimeMillis() - 60000);
+    ASSERT_LE(entry.lastModified.Millis(), DateTime::CurrentTimeMillis());
     ASSERT_TRUE(entry.operator bool());
 
     entry = nextDir->Next();
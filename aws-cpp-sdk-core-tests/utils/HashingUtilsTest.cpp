@@ -321,3 +321,21 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     TestMD5FromStream( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "V+30oivjyVWsSdouIQe2eg==" );
 }
 
+
+static void TestCRCFromStringAndStream(const char* value, const char* expectedCrc32Hex, const char* expectedCrc32cHex)
+{
+    ASSERT_STREQ(expectedCrc32Hex, HashingUtils::HexEncode(HashingUtils::CalculateCRC32(value)).c_str());
+    ASSERT_STREQ(expectedCrc32cHex, HashingUtils::HexEncode(HashingUtils::CalculateCRC32C(value)).c_str());
+
+    Aws::StringStream stream;
+    stream.str(value);
+    ASSERT_STREQ(expectedCrc32Hex, HashingUtils::HexEncode(HashingUtils::CalculateCRC32(stream)).c_str());
+    ASSERT_STREQ(expectedCrc32cHex, HashingUtils::HexEncode(HashingUtils::CalculateCRC32C(stream)).c_str());
+}
+
+TEST(HashingUtilsTest, TestCRC32AndCRC32C)
+{
+    TestCRCFromStringAndStream("", "00000000", "00000000");
+    TestCRCFromStringAndStream("123456789", "cbf43926", "e3069283");
+    TestCRCFromStringAndStream("The quick brown fox jumps over the lazy dog", "414fa339", "22620404");
+}
@@ -0,0 +1,141 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/crypto/MultiDigestHasher.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char ALLOCATION_TAG[] = "MultiDigestHasherTest";
+
+static Aws::String MakeTestPayload(size_t length)
+{
+    Aws::String payload;
+    payload.reserve(length);
+    unsigned state = 12345;
+    for (size_t i = 0; i < length; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        payload.push_back(static_cast<char>(state >> 16));
+    }
+    return payload;
+}
+
+static void VerifyAllDigests(MultiDigestHasher& hasher, const Aws::String& payload)
+{
+    hasher.AddDigest(DigestAlgorithm::SHA256);
+    hasher.AddDigest(DigestAlgorithm::MD5);
+    hasher.AddDigest(DigestAlgorithm::CRC32);
+    hasher.AddDigest(DigestAlgorithm::CRC32C);
+
+    Aws::StringStream stream;
+    stream.str(payload);
+    stream.seekg(17);
+    ASSERT_TRUE(hasher.Calculate(stream));
+    ASSERT_EQ(17, stream.tellg());
+
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), hasher.GetDigest(DigestAlgorithm::SHA256));
+    ASSERT_EQ(HashingUtils::CalculateMD5(payload), hasher.GetDigest(DigestAlgorithm::MD5));
+    ASSERT_EQ(HashingUtils::CalculateCRC32(payload), hasher.GetDigest(DigestAlgorithm::CRC32));
+    ASSERT_EQ(HashingUtils::CalculateCRC32C(payload), hasher.GetDigest(DigestAlgorithm::CRC32C));
+
+    //a second pass starts from fresh digests.
+    ASSERT_TRUE(hasher.Calculate(stream));
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), hasher.GetDigest(DigestAlgorithm::SHA256));
+}
+
+TEST(MultiDigestHasherTest, TestSerialDigestsMatchIndividualDigests)
+{
+    MultiDigestHasher hasher;
+    VerifyAllDigests(hasher, MakeTestPayload(3 * MultiDigestHasher::SERIAL_CHUNK_SIZE + 5));
+}
+
+TEST(MultiDigestHasherTest, TestParallelDigestsMatchIndividualDigests)
+{
+    auto executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 2);
+    MultiDigestHasher hasher(executor);
+    VerifyAllDigests(hasher, MakeTestPayload(2 * MultiDigestHasher::PARALLEL_CHUNK_SIZE + 7));
+}
+
+TEST(MultiDigestHasherTest, TestEmptyStreamAndUnrequestedDigest)
+{
+    MultiDigestHasher hasher;
+    hasher.AddDigest(DigestAlgorithm::MD5);
+    hasher.AddDigest(DigestAlgorithm::MD5);
+    ASSERT_TRUE(hasher.HasDigest(DigestAlgorithm::MD5));
+    ASSERT_FALSE(hasher.HasDigest(DigestAlgorithm::SHA256));
+
+    Aws::StringStream stream;
+    ASSERT_TRUE(hasher.Calculate(stream));
+    ASSERT_STREQ("1B2M2Y8AsgTpgAmY7PhCfg==", HashingUtils::Base64Encode(hasher.GetDigest(DigestAlgorithm::MD5)).c_str());
+    ASSERT_EQ(0u, hasher.GetDigest(DigestAlgorithm::SHA256).GetLength());
+}
+
+TEST(MultiDigestHasherTest, TestIncrementalUpdateMatchesCalculate)
+{
+    Aws::String payload = MakeTestPayload(10000);
+    unsigned char* data = reinterpret_cast<unsigned char*>(&payload[0]);
+
+    Sha256 sha256;
+    MD5 md5;
+    CRC32C crc32c;
+    for (size_t offset = 0; offset < payload.size(); offset += 999)
+    {
+        size_t length = (std::min)(static_cast<size_t>(999), payload.size() - offset);
+        sha256.Update(data + offset, length);
+        md5.Update(data + offset, length);
+        crc32c.Update(data + offset, length);
+    }
+
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), sha256.GetHash().GetResult());
+    ASSERT_EQ(HashingUtils::CalculateMD5(payload), md5.GetHash().GetResult());
+    ASSERT_EQ(HashingUtils::CalculateCRC32C(payload), crc32c.GetHash().GetResult());
+
+    //GetHash() resets the running digest.
+    ASSERT_EQ(HashingUtils::CalculateSHA256(""), sha256.GetHash().GetResult());
+}
+
+//A Hash written before Update()/GetHash() existed, it only implements Calculate().
+class CalculateOnlyHash : public Hash
+{
+public:
+    HashResult Calculate(const Aws::String& str) override { return m_impl.Calculate(str); }
+    HashResult Calculate(Aws::IStream& stream) override { return m_impl.Calculate(stream); }
+
+private:
+    Sha256 m_impl;
+};
+
+TEST(MultiDigestHasherTest, TestDefaultIncrementalUpdateBuffersInput)
+{
+    Aws::String payload = MakeTestPayload(5000);
+    unsigned char* data = reinterpret_cast<unsigned char*>(&payload[0]);
+
+    CalculateOnlyHash hash;
+    ASSERT_EQ(HashingUtils::CalculateSHA256(""), hash.GetHash().GetResult());
+
+    hash.Update(data, 1234);
+    hash.Update(data + 1234, payload.size() - 1234);
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), hash.GetHash().GetResult());
+    ASSERT_EQ(HashingUtils::CalculateSHA256(""), hash.GetHash().GetResult());
+}
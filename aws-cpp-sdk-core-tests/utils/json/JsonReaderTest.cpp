@@ -0,0 +1,224 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils;
+
+namespace
+{
+    struct Item
+    {
+        Item() : m_count(0), m_size(0), m_ratio(0.0), m_enabled(false), m_countHasBeenSet(false) {}
+
+        bool ReadJson(JsonReader& reader)
+        {
+            return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+            {
+                if (name == "Name")
+                {
+                    return ReadJsonValue(reader, m_name);
+                }
+                if (name == "Count")
+                {
+                    m_countHasBeenSet = true;
+                    return ReadJsonValue(reader, m_count);
+                }
+                if (name == "Size")
+                {
+                    return ReadJsonValue(reader, m_size);
+                }
+                if (name == "Ratio")
+                {
+                    return ReadJsonValue(reader, m_ratio);
+                }
+                if (name == "Enabled")
+                {
+                    return ReadJsonValue(reader, m_enabled);
+                }
+                if (name == "Data")
+                {
+                    return ReadJsonValue(reader, m_data);
+                }
+                if (name == "Tags")
+                {
+                    return ReadJsonValue(reader, m_tags);
+                }
+                if (name == "Children")
+                {
+                    return ReadJsonValue(reader, m_children);
+                }
+                return reader.SkipValue();
+            });
+        }
+
+        Aws::String m_name;
+        int m_count;
+        long long m_size;
+        double m_ratio;
+        bool m_enabled;
+        ByteBuffer m_data;
+        Aws::Map<Aws::String, Aws::Vector<Aws::String>> m_tags;
+        Aws::Vector<std::shared_ptr<Item>> m_children;
+        bool m_countHasBeenSet;
+    };
+}
+
+TEST(JsonReaderTest, TestTokens)
+{
+    Aws::StringStream ss(" {\"a\" : [1, -2.5e3, true, false, null, \"x\"], \"b\": {}, \"c\": []} ");
+    JsonReader reader(ss);
+
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_STREQ("a", reader.GetName().c_str());
+    ASSERT_EQ(JsonToken::BEGIN_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_EQ(1, reader.GetInt64());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Peek());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_DOUBLE_EQ(-2500.0, reader.GetDouble());
+    ASSERT_EQ(-2500, reader.GetInt64());
+    ASSERT_EQ(JsonToken::BOOLEAN, reader.Next());
+    ASSERT_TRUE(reader.GetBool());
+    ASSERT_EQ(JsonToken::BOOLEAN, reader.Next());
+    ASSERT_FALSE(reader.GetBool());
+    ASSERT_EQ(JsonToken::NULL_VALUE, reader.Next());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_STREQ("x", reader.GetValue().c_str());
+    ASSERT_EQ(JsonToken::END_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::BEGIN_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::NAME, reader.Next());
+    ASSERT_EQ(JsonToken::BEGIN_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::END_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::END_OBJECT, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, TestStringEscapes)
+{
+    Aws::StringStream ss("[\"a\\\"b\\\\c\\/d\\n\\t\", \"\\u00e9\\u20ac\\ud83d\\ude00\"]");
+    JsonReader reader(ss);
+
+    ASSERT_EQ(JsonToken::BEGIN_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_STREQ("a\"b\\c/d\n\t", reader.GetValue().c_str());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_STREQ("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", reader.TakeValue().c_str());
+    ASSERT_EQ(JsonToken::END_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+}
+
+TEST(JsonReaderTest, TestValuesSpanningReadBuffers)
+{
+    // longer than the read buffer, with escapes straddling its boundaries.
+    Aws::String expected;
+    Aws::String json = "[\"";
+    for (size_t i = 0; i < 50000; ++i)
+    {
+        if (i % 997 == 0)
+        {
+            json += "\\u00e9";
+            expected += "\xC3\xA9";
+        }
+        else
+        {
+            char c = static_cast<char>('a' + i % 26);
+            json += c;
+            expected += c;
+        }
+    }
+    json += "\", 12345678901234]";
+
+    Aws::StringStream ss(json);
+    JsonReader reader(ss);
+    ASSERT_EQ(JsonToken::BEGIN_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::STRING, reader.Next());
+    ASSERT_EQ(expected, reader.GetValue());
+    ASSERT_EQ(JsonToken::NUMBER, reader.Next());
+    ASSERT_EQ(12345678901234LL, reader.GetInt64());
+    ASSERT_EQ(JsonToken::END_ARRAY, reader.Next());
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+}
+
+TEST(JsonReaderTest, TestMalformedDocuments)
+{
+    const char* documents[] = { "", "{", "{\"a\" 1}", "{\"a\":1,}", "[1 2]", "[1}", "tru", "\"abc", "[\"\\x\"]", "{} {}", "-" };
+    for (const char* document : documents)
+    {
+        Aws::StringStream ss(document);
+        JsonReader reader(ss);
+        JsonToken token;
+        do
+        {
+            token = reader.Next();
+        } while (token != JsonToken::PARSE_ERROR && token != JsonToken::END_DOCUMENT);
+
+        ASSERT_EQ(JsonToken::PARSE_ERROR, token) << document;
+        ASSERT_FALSE(reader.WasParseSuccessful());
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+        ASSERT_EQ(JsonToken::PARSE_ERROR, reader.Next());
+    }
+}
+
+TEST(JsonReaderTest, TestReadJsonValuePopulatesModel)
+{
+    Aws::StringStream ss(
+        "{\"Name\":\"root\",\"Count\":3,\"Size\":9007199254740993,\"Ratio\":0.5,\"Enabled\":true,\"Data\":\"aGVsbG8=\","
+        "\"Unknown\":{\"Nested\":[1,{\"x\":[]}]},"
+        "\"Tags\":{\"k1\":[\"a\",\"b\"],\"k2\":[]},"
+        "\"Children\":[{\"Name\":\"child\",\"Count\":\"not a number\"},null]}");
+    JsonReader reader(ss);
+
+    Item item;
+    ASSERT_TRUE(ReadJsonValue(reader, item));
+    ASSERT_EQ(JsonToken::END_DOCUMENT, reader.Next());
+
+    ASSERT_STREQ("root", item.m_name.c_str());
+    ASSERT_EQ(3, item.m_count);
+    ASSERT_TRUE(item.m_countHasBeenSet);
+    ASSERT_EQ(9007199254740993LL, item.m_size);
+    ASSERT_DOUBLE_EQ(0.5, item.m_ratio);
+    ASSERT_TRUE(item.m_enabled);
+    ASSERT_EQ(Aws::String("hello"), Aws::String(reinterpret_cast<const char*>(item.m_data.GetUnderlyingData()), item.m_data.GetLength()));
+    ASSERT_EQ(2u, item.m_tags.size());
+    ASSERT_EQ(2u, item.m_tags["k1"].size());
+    ASSERT_STREQ("b", item.m_tags["k1"][1].c_str());
+    ASSERT_TRUE(item.m_tags["k2"].empty());
+
+    ASSERT_EQ(2u, item.m_children.size());
+    ASSERT_STREQ("child", item.m_children[0]->m_name.c_str());
+    // a value of the wrong type is skipped.
+    ASSERT_EQ(0, item.m_children[0]->m_count);
+    ASSERT_EQ(nullptr, item.m_children[1]);
+}
+
+TEST(JsonReaderTest, TestReadJsonValueStopsOnParseError)
+{
+    Aws::StringStream ss("{\"Name\":\"root\",\"Tags\":{\"k1\":[\"a\" \"b\"]}}");
+    JsonReader reader(ss);
+
+    Item item;
+    ASSERT_FALSE(ReadJsonValue(reader, item));
+    ASSERT_FALSE(reader.WasParseSuccessful());
+    ASSERT_STREQ("root", item.m_name.c_str());
+}
@@ -0,0 +1,141 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonWriter.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+
+#include <limits>
+
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils;
+
+namespace
+{
+    struct Item
+    {
+        Item() : m_count(0), m_countHasBeenSet(false) {}
+
+        void WriteJson(JsonWriter& writer) const
+        {
+            writer.WriteStartObject();
+            writer.WriteName("Name");
+            WriteJsonValue(writer, m_name);
+            if (m_countHasBeenSet)
+            {
+                writer.WriteName("Count");
+                WriteJsonValue(writer, m_count);
+            }
+            writer.WriteName("Tags");
+            WriteJsonValue(writer, m_tags);
+            writer.WriteName("Children");
+            WriteJsonValue(writer, m_children);
+            writer.WriteEndObject();
+        }
+
+        Aws::String m_name;
+        int m_count;
+        bool m_countHasBeenSet;
+        Aws::Map<Aws::String, Aws::Vector<Aws::String>> m_tags;
+        Aws::Vector<std::shared_ptr<Item>> m_children;
+    };
+}
+
+TEST(JsonWriterTest, TestTokens)
+{
+    JsonWriter writer;
+    writer.WriteStartObject();
+    writer.WriteName("a");
+    writer.WriteStartArray();
+    writer.WriteInt64(1);
+    writer.WriteInt64(std::numeric_limits<long long>::min());
+    writer.WriteDouble(-2.5);
+    writer.WriteDouble(3.0);
+    writer.WriteDouble(0.1);
+    writer.WriteDouble(std::numeric_limits<double>::quiet_NaN());
+    writer.WriteBool(true);
+    writer.WriteBool(false);
+    writer.WriteNull();
+    writer.WriteString("x");
+    writer.WriteEndArray();
+    writer.WriteName("b");
+    writer.WriteStartObject();
+    writer.WriteEndObject();
+    writer.WriteName("c");
+    writer.WriteStartArray();
+    writer.WriteEndArray();
+    writer.WriteEndObject();
+
+    ASSERT_EQ(Aws::String("{\"a\":[1,-9223372036854775808,-2.5,3,0.1,null,true,false,null,\"x\"],\"b\":{},\"c\":[]}"), writer.GetOutput());
+    ASSERT_EQ(writer.GetOutput().size(), writer.GetLength());
+}
+
+TEST(JsonWriterTest, TestEscaping)
+{
+    JsonWriter writer;
+    writer.WriteStartObject();
+    writer.WriteName("quote\"name");
+    writer.WriteString(Aws::String("a\"b\\c/d\n\t\x01\xC3\xA9", 12));
+    writer.WriteEndObject();
+
+    ASSERT_EQ(Aws::String("{\"quote\\\"name\":\"a\\\"b\\\\c/d\\n\\t\\u0001\xC3\xA9\"}"), writer.GetOutput());
+
+    JsonValue parsed(writer.GetOutput());
+    ASSERT_TRUE(parsed.WasParseSuccessful());
+    ASSERT_EQ(Aws::String("a\"b\\c/d\n\t\x01\xC3\xA9", 12), parsed.View().GetString("quote\"name"));
+}
+
+TEST(JsonWriterTest, TestWriteJsonValueMatchesDocumentModel)
+{
+    Item item;
+    item.m_name = "root";
+    item.m_count = 3;
+    item.m_countHasBeenSet = true;
+    item.m_tags["k1"] = { "a", "b" };
+    item.m_tags["k2"] = {};
+    item.m_children.push_back(Aws::MakeShared<Item>("JsonWriterTest"));
+    item.m_children.back()->m_name = "child";
+    item.m_children.push_back(nullptr);
+
+    JsonWriter writer;
+    WriteJsonValue(writer, item);
+
+    JsonValue expected("{\"Name\":\"root\",\"Count\":3,\"Tags\":{\"k1\":[\"a\",\"b\"],\"k2\":[]},"
+        "\"Children\":[{\"Name\":\"child\",\"Tags\":{},\"Children\":[]},null]}");
+    JsonValue written(writer.GetOutput());
+    ASSERT_TRUE(written.WasParseSuccessful());
+    ASSERT_EQ(expected, written);
+}
+
+TEST(JsonWriterTest, TestNestedWritersDoNotShareBuffers)
+{
+    {
+        JsonWriter outer;
+        outer.WriteStartArray();
+        {
+            JsonWriter inner;
+            inner.WriteString("inner");
+            ASSERT_EQ(Aws::String("\"inner\""), inner.GetOutput());
+        }
+        outer.WriteString("outer");
+        outer.WriteEndArray();
+        ASSERT_EQ(Aws::String("[\"outer\"]"), outer.GetOutput());
+    }
+
+    // the thread's buffer is handed out again once released, starting empty.
+    JsonWriter next;
+    ASSERT_EQ(0u, next.GetLength());
+}
@@ -0,0 +1,176 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/stream/FileRangeStreamBuf.h>
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <fstream>
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "FileRangeStreamBufTest";
+static const char fileContents[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+class FileRangeStreamBufTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_tempFile = Aws::MakeUnique<TempFile>(ALLOCATION_TAG, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        *m_tempFile << fileContents;
+        m_tempFile->close();
+        m_file = Aws::MakeShared<ReadOnlyFile>(ALLOCATION_TAG, m_tempFile->GetFileName());
+        ASSERT_TRUE(m_file->IsOpen());
+    }
+
+    void TearDown() override
+    {
+        m_file = nullptr;
+        m_tempFile = nullptr;
+    }
+
+    Aws::UniquePtr<TempFile> m_tempFile;
+    std::shared_ptr<const ReadOnlyFile> m_file;
+};
+
+TEST_F(FileRangeStreamBufTest, TestReadOnlySeesItsRange)
+{
+    FileRangeStreamBuf streamBuf(m_file, 10, 6);
+    Aws::IOStream ioStream(&streamBuf);
+
+    char readBuf[16] = {};
+    ioStream.read(readBuf, sizeof(readBuf));
+    ASSERT_EQ(6, ioStream.gcount());
+    ASSERT_STREQ("abcdef", readBuf);
+    ASSERT_TRUE(ioStream.eof());
+}
+
+TEST_F(FileRangeStreamBufTest, TestSeekAndCharacterReads)
+{
+    FileRangeStreamBuf streamBuf(m_file, 10, 26);
+    Aws::IOStream ioStream(&streamBuf);
+
+    ioStream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(26, static_cast<int>(ioStream.tellg()));
+
+    ioStream.seekg(3, std::ios_base::beg);
+    ASSERT_EQ('d', ioStream.get());
+    ASSERT_EQ('e', ioStream.peek());
+    ioStream.seekg(2, std::ios_base::cur);
+    ASSERT_EQ(6, static_cast<int>(ioStream.tellg()));
+
+    char readBuf[4] = {};
+    ioStream.read(readBuf, 3);
+    ASSERT_STREQ("ghi", readBuf);
+
+    ioStream.seekg(-2, std::ios_base::end);
+    Aws::String rest((Aws::IStreamBufIterator(ioStream)), Aws::IStreamBufIterator());
+    ASSERT_STREQ("yz", rest.c_str());
+
+    ioStream.clear();
+    ioStream.seekg(27, std::ios_base::beg);
+    ASSERT_TRUE(ioStream.fail());
+}
+
+TEST_F(FileRangeStreamBufTest, TestRangesReadConcurrently)
+{
+    Aws::String ranges[6];
+    Aws::Vector<std::thread> readers;
+    for (size_t i = 0; i < 6; ++i)
+    {
+        readers.emplace_back([this, i, &ranges]()
+        {
+            for (int pass = 0; pass < 100; ++pass)
+            {
+                FileRangeStreamBuf streamBuf(m_file, i * 6, 6);
+                Aws::IOStream ioStream(&streamBuf);
+                ranges[i] = Aws::String((Aws::IStreamBufIterator(ioStream)), Aws::IStreamBufIterator());
+            }
+        });
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    for (size_t i = 0; i < 6; ++i)
+    {
+        ASSERT_EQ(Aws::String(fileContents + i * 6, 6), ranges[i]);
+    }
+}
+
+TEST(ReadOnlyFileTest, TestMissingFile)
+{
+    ReadOnlyFile file("FileRangeStreamBufTestMissingFile");
+    ASSERT_FALSE(file.IsOpen());
+}
+
+TEST_F(FileRangeStreamBufTest, TestRangesWrittenConcurrently)
+{
+    {
+        auto file = Aws::MakeShared<WritableFile>(ALLOCATION_TAG, m_tempFile->GetFileName());
+        ASSERT_TRUE(file->IsOpen());
+        ASSERT_TRUE(file->Allocate(40));
+
+        Aws::Vector<std::thread> writers;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            writers.emplace_back([&file, i]()
+            {
+                FileRangeWriteStreamBuf streamBuf(file, i * 10, 10);
+                Aws::IOStream ioStream(&streamBuf);
+                ioStream << static_cast<char>('A' + i) << "12345678";
+                ioStream.put(static_cast<char>('a' + i));
+            });
+        }
+        for (auto& writer : writers)
+        {
+            writer.join();
+        }
+        ASSERT_TRUE(file->Sync());
+    }
+
+    std::ifstream written(m_tempFile->GetFileName().c_str(), std::ios_base::binary);
+    Aws::String contents((std::istreambuf_iterator<char>(written)), std::istreambuf_iterator<char>());
+    ASSERT_STREQ("A12345678aB12345678bC12345678cD12345678d", contents.c_str());
+}
+
+TEST_F(FileRangeStreamBufTest, TestWriteSeekAndRangeLimit)
+{
+    auto file = Aws::MakeShared<WritableFile>(ALLOCATION_TAG, m_tempFile->GetFileName());
+    ASSERT_TRUE(file->IsOpen());
+
+    FileRangeWriteStreamBuf streamBuf(file, 4, 4);
+    Aws::IOStream ioStream(&streamBuf);
+    ioStream.seekp(2, std::ios_base::beg);
+    ioStream << "XY";
+    ASSERT_TRUE(ioStream.good());
+    ioStream.seekp(0, std::ios_base::beg);
+    ioStream << "WZ";
+    ioStream.seekp(0, std::ios_base::end);
+    ioStream << "!";
+    ASSERT_TRUE(ioStream.bad());
+
+    char readBuf[16] = {};
+    FileRangeStreamBuf readStreamBuf(m_file, 0, 12);
+    Aws::IOStream readStream(&readStreamBuf);
+    readStream.read(readBuf, 12);
+    ASSERT_STREQ("0123WZXY89ab", readBuf);
+}
@@ -0,0 +1,79 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/ExecutorTask.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "AsyncTaskStorageTest";
+
+namespace
+{
+    // Stands in for a generated request with a handful of members.
+    struct Request
+    {
+        Aws::String m_fields[12];
+        Aws::Map<Aws::String, Aws::String> m_attributes;
+    };
+
+    class Client;
+    typedef std::function<void(const Client*, const Request&, int, const std::shared_ptr<const AsyncCallerContext>&)> Handler;
+}
+
+TEST(AsyncTaskStorageTest, TestCompletionCallbackIsStoredInline)
+{
+    // Same shape as the completion callback of an asynchronous operation: client pointer, shared request, handler and context.
+    std::atomic<int> calls(0);
+    const Client* client = nullptr;
+    std::shared_ptr<const Request> request = Aws::MakeShared<Request>(ALLOCATION_TAG);
+    Handler handler = [&calls](const Client*, const Request&, int outcome, const std::shared_ptr<const AsyncCallerContext>&) { calls += outcome; };
+    std::shared_ptr<const AsyncCallerContext> context;
+    auto callback = [client, request, handler, context]() { handler(client, *request, 1, context); };
+
+    ASSERT_TRUE(ExecutorTask::IsStoredInline<decltype(callback)>());
+    ExecutorTask task(std::move(callback));
+    task();
+    ASSERT_EQ(1, calls.load());
+}
+
+TEST(AsyncTaskStorageTest, TestClosureCopyingTheRequestFallsBackToHeap)
+{
+    std::atomic<int> calls(0);
+    const Client* client = nullptr;
+    Request request;
+    request.m_fields[0] = "value";
+    Handler handler = [&calls](const Client*, const Request& handled, int outcome, const std::shared_ptr<const AsyncCallerContext>&)
+    {
+        ASSERT_STREQ("value", handled.m_fields[0].c_str());
+        calls += outcome;
+    };
+    std::shared_ptr<const AsyncCallerContext> context;
+    auto closure = [client, request, handler, context]() { handler(client, request, 1, context); };
+
+    ASSERT_FALSE(ExecutorTask::IsStoredInline<decltype(closure)>());
+    ExecutorTask task(std::move(closure));
+    ExecutorTask moved(std::move(task));
+    moved();
+    ASSERT_EQ(1, calls.load());
+}
@@ -0,0 +1,140 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/ExecutorTask.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <atomic>
+
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "ExecutorTaskTest";
+
+namespace
+{
+    // Move-only callable which counts how many live copies exist, so we can tell whether moves leak or double destroy.
+    class CountingTask
+    {
+    public:
+        CountingTask(std::atomic<int>& live, std::atomic<int>& calls) : m_live(&live), m_calls(&calls), m_value(Aws::MakeUnique<int>(ALLOCATION_TAG, 42))
+        {
+            ++*m_live;
+        }
+
+        CountingTask(CountingTask&& other) : m_live(other.m_live), m_calls(other.m_calls), m_value(std::move(other.m_value))
+        {
+            ++*m_live;
+        }
+
+        ~CountingTask()
+        {
+            --*m_live;
+        }
+
+        void operator()()
+        {
+            if (m_value && *m_value == 42)
+            {
+                ++*m_calls;
+            }
+        }
+
+    private:
+        std::atomic<int>* m_live;
+        std::atomic<int>* m_calls;
+        Aws::UniquePtr<int> m_value;
+    };
+
+    struct LargeTask
+    {
+        char m_padding[ExecutorTask::INLINE_STORAGE_SIZE * 2];
+        std::atomic<int>* m_calls;
+
+        void operator()() { ++*m_calls; }
+    };
+}
+
+TEST(ExecutorTaskTest, TestEmptyTask)
+{
+    ExecutorTask task;
+    ASSERT_FALSE(static_cast<bool>(task));
+}
+
+TEST(ExecutorTaskTest, TestInlineMoveOnlyCallable)
+{
+    std::atomic<int> live(0);
+    std::atomic<int> calls(0);
+    {
+        ExecutorTask task(CountingTask(live, calls));
+        ASSERT_TRUE(static_cast<bool>(task));
+        ASSERT_EQ(1, live.load());
+
+        ExecutorTask moved(std::move(task));
+        ASSERT_FALSE(static_cast<bool>(task));
+        ASSERT_TRUE(static_cast<bool>(moved));
+        ASSERT_EQ(1, live.load());
+
+        moved();
+        ASSERT_EQ(1, calls.load());
+
+        ExecutorTask assigned;
+        assigned = std::move(moved);
+        ASSERT_FALSE(static_cast<bool>(moved));
+        assigned();
+        ASSERT_EQ(2, calls.load());
+    }
+    ASSERT_EQ(0, live.load());
+}
+
+TEST(ExecutorTaskTest, TestLargeCallableFallsBackToHeap)
+{
+    std::atomic<int> calls(0);
+    LargeTask large;
+    large.m_calls = &calls;
+
+    ExecutorTask task(large);
+    ExecutorTask moved(std::move(task));
+    ASSERT_FALSE(static_cast<bool>(task));
+    moved();
+    ASSERT_EQ(1, calls.load());
+
+    moved.Reset();
+    ASSERT_FALSE(static_cast<bool>(moved));
+}
+
+TEST(ExecutorTaskTest, TestPooledExecutorRunsTasksAndArguments)
+{
+    std::atomic<int> live(0);
+    std::atomic<int> calls(0);
+    std::atomic<int> sum(0);
+    Semaphore done(0, 3);
+    {
+        PooledThreadExecutor exec(2);
+        ASSERT_TRUE(exec.Submit([&] { ++calls; done.Release(); }));
+        ASSERT_TRUE(exec.Submit([&](int a, int b) { sum += a + b; done.Release(); }, 3, 4));
+
+        CountingTask counting(live, calls);
+        ASSERT_TRUE(exec.Submit([&done](CountingTask& inner) { inner(); done.Release(); }, std::move(counting)));
+
+        done.WaitOne();
+        done.WaitOne();
+        done.WaitOne();
+    }
+    ASSERT_EQ(2, calls.load());
+    ASSERT_EQ(7, sum.load());
+    ASSERT_EQ(0, live.load());
+}
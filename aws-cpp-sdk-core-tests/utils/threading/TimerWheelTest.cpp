@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/TimerWheel.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <future>
+
+using namespace Aws::Utils::Threading;
+
+TEST(TimerWheelTest, TestTimersFireInOrderAfterTheirDelay)
+{
+    // a small wheel, so the later timers wrap around it several times.
+    TimerWheel wheel(std::chrono::milliseconds(5), 4);
+    std::mutex lock;
+    Aws::Vector<int> fired;
+    std::promise<void> allFired;
+
+    auto start = std::chrono::steady_clock::now();
+    const int delays[] = { 120, 10, 60, 35 };
+    for (int delay : delays)
+    {
+        wheel.Schedule(std::chrono::milliseconds(delay), [&, delay]()
+        {
+            ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(delay));
+            std::lock_guard<std::mutex> locker(lock);
+            fired.push_back(delay);
+            if (fired.size() == 4)
+            {
+                allFired.set_value();
+            }
+        });
+    }
+    ASSERT_EQ(4u, wheel.GetPendingTimers());
+
+    allFired.get_future().wait();
+    ASSERT_EQ(0u, wheel.GetPendingTimers());
+    ASSERT_EQ(10, fired[0]);
+    ASSERT_EQ(35, fired[1]);
+    ASSERT_EQ(60, fired[2]);
+    ASSERT_EQ(120, fired[3]);
+}
+
+TEST(TimerWheelTest, TestTimerScheduledAfterIdlePeriod)
+{
+    TimerWheel wheel(std::chrono::milliseconds(1));
+    std::promise<void> first;
+    wheel.Schedule(std::chrono::milliseconds(0), [&]() { first.set_value(); });
+    first.get_future().wait();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::promise<void> second;
+    wheel.Schedule(std::chrono::milliseconds(2), [&]() { second.set_value(); });
+    ASSERT_EQ(std::future_status::ready, second.get_future().wait_for(std::chrono::seconds(5)));
+}
+
+TEST(TimerWheelTest, TestPendingTimersAreCancelledOnDestruction)
+{
+    std::atomic<int> fired(0);
+    std::atomic<int> cancelled(0);
+    {
+        TimerWheel wheel;
+        wheel.Schedule(std::chrono::milliseconds(60000), [&]() { ++fired; });
+        wheel.Schedule(std::chrono::milliseconds(120000), [&]() { ++fired; }, [&]()
+        {
+            ++cancelled;
+            //scheduling while the wheel shuts down cancels the new timer right away.
+            wheel.Schedule(std::chrono::milliseconds(60000), [&]() { ++fired; }, [&]() { ++cancelled; });
+        });
+    }
+    ASSERT_EQ(0, fired.load());
+    ASSERT_EQ(2, cancelled.load());
+}
@@ -0,0 +1,101 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/WorkStealingThreadExecutor.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+TEST(WorkStealingThreadExecutor, RunsAllSubmittedTasks)
+{
+    const int taskCount = 10000;
+    std::atomic<int> completed(0);
+    Semaphore done(0, 1);
+    WorkStealingThreadExecutor exec(4, 64);
+    for (int i = 0; i < taskCount; ++i)
+    {
+        ASSERT_TRUE(exec.Submit([&] { if (++completed == taskCount) done.Release(); }));
+    }
+    done.WaitOne();
+    ASSERT_EQ(taskCount, completed.load());
+}
+
+TEST(WorkStealingThreadExecutor, TasksSubmittedFromWorkersAreStolen)
+{
+    const int fanOut = 1000;
+    std::atomic<int> completed(0);
+    Semaphore done(0, 1);
+    WorkStealingThreadExecutor exec(4, 16);
+    exec.Submit([&]
+    {
+        for (int i = 0; i < fanOut; ++i)
+        {
+            exec.Submit([&] { if (++completed == fanOut) done.Release(); });
+        }
+    });
+    done.WaitOne();
+    ASSERT_EQ(fanOut, completed.load());
+}
+
+TEST(WorkStealingThreadExecutor, RejectsWhenFull)
+{
+    Semaphore blocker(0, 1);
+    Semaphore started(0, 1);
+    WorkStealingThreadExecutor exec(1, 2, OverflowPolicy::REJECT_IMMEDIATELY);
+    ASSERT_TRUE(exec.Submit([&] { started.Release(); blocker.WaitOne(); }));
+    started.WaitOne();
+    ASSERT_TRUE(exec.Submit([] {}));
+    ASSERT_TRUE(exec.Submit([] {}));
+    ASSERT_FALSE(exec.Submit([] {}));
+    blocker.Release();
+}
+
+TEST(WorkStealingThreadExecutor, BlocksSubmitterWhenFull)
+{
+    const int taskCount = 100;
+    std::atomic<int> completed(0);
+    Semaphore done(0, 1);
+    WorkStealingThreadExecutor exec(2, 2, OverflowPolicy::QUEUE_TASKS_EVENLY_ACCROSS_THREADS, true /*pinThreadsToProcessors*/);
+    for (int i = 0; i < taskCount; ++i)
+    {
+        ASSERT_TRUE(exec.Submit([&] { if (++completed == taskCount) done.Release(); }));
+    }
+    done.WaitOne();
+    ASSERT_EQ(taskCount, completed.load());
+}
+
+TEST(WorkStealingThreadExecutor, DestroysTasksLeftInWorkerDeques)
+{
+    auto token = std::make_shared<int>(0);
+    Semaphore queued(0, 1);
+    {
+        WorkStealingThreadExecutor exec(2, 16);
+        exec.Submit([&]
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                exec.Submit([token] { std::this_thread::sleep_for(std::chrono::microseconds(10)); });
+            }
+            queued.Release();
+        });
+        queued.WaitOne();
+    }
+    ASSERT_EQ(1, token.use_count());
+}
@@ -0,0 +1,222 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Xml;
+using namespace Aws::Utils;
+
+namespace
+{
+    enum class Color
+    {
+        NOT_SET,
+        RED,
+        BLUE
+    };
+
+    Color GetColorForName(const Aws::String& name)
+    {
+        return name == "red" ? Color::RED : name == "blue" ? Color::BLUE : Color::NOT_SET;
+    }
+
+    struct Item
+    {
+        Item() : m_size(0), m_ratio(0.0), m_enabled(false), m_color(Color::NOT_SET), m_sizeHasBeenSet(false) {}
+
+        bool ReadXml(XmlReader& reader)
+        {
+            return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+            {
+                if (name == "Name")
+                {
+                    return ReadXmlValue(reader, m_name);
+                }
+                if (name == "Size")
+                {
+                    m_sizeHasBeenSet = true;
+                    return ReadXmlValue(reader, m_size);
+                }
+                if (name == "Ratio")
+                {
+                    return ReadXmlValue(reader, m_ratio);
+                }
+                if (name == "Enabled")
+                {
+                    return ReadXmlValue(reader, m_enabled);
+                }
+                if (name == "Color")
+                {
+                    return ReadXmlValue(reader, m_color, GetColorForName);
+                }
+                if (name == "Data")
+                {
+                    return ReadXmlValue(reader, m_data);
+                }
+                if (name == "Modified")
+                {
+                    return ReadXmlValue(reader, m_modified);
+                }
+                if (name == "tagSet")
+                {
+                    return ReadXmlList(reader, "item", m_tags);
+                }
+                if (name == "Child")
+                {
+                    m_children.emplace_back();
+                    return ReadXmlValue(reader, m_children.back());
+                }
+                return reader.SkipElement();
+            });
+        }
+
+        Aws::String m_name;
+        long long m_size;
+        double m_ratio;
+        bool m_enabled;
+        Color m_color;
+        ByteBuffer m_data;
+        DateTime m_modified;
+        Aws::Vector<Aws::String> m_tags;
+        Aws::Vector<Item> m_children;
+        bool m_sizeHasBeenSet;
+    };
+}
+
+TEST(XmlReaderTest, TestTokens)
+{
+    Aws::StringStream ss("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<!-- c -->"
+        "<Root xmlns=\"http://example.com/doc/\" a='1'><A>x</A><B/><C >y<!-- z --><D/>w</C></Root>\n");
+    XmlReader reader(ss);
+
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "Root");
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "A");
+    ASSERT_EQ(XmlToken::TEXT, reader.Next());
+    ASSERT_EQ(Aws::String("x"), reader.GetText().ToString());
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "A");
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "B");
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "B");
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "C");
+
+    XmlStringView text;
+    ASSERT_TRUE(reader.ReadText(text));
+    ASSERT_EQ(Aws::String("yw"), text.ToString());
+
+    ASSERT_EQ(XmlToken::END_ELEMENT, reader.Next());
+    ASSERT_TRUE(reader.GetName() == "Root");
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestTextDecoding)
+{
+    Aws::StringStream ss("<a><b>1 &lt; 2 &amp;&amp; &quot;x&apos; &gt; &#233;&#x20AC;&#x1F600; &unknown; &amp</b>"
+        "<c><![CDATA[<raw> &amp;]]> and &amp; more</c><d>line\r\nbreak\rhere</d></a>");
+    XmlReader reader(ss);
+
+    Aws::String b, c, d;
+    ASSERT_TRUE(reader.ReadDocument([&](XmlReader& reader, const XmlStringView& name) -> bool
+    {
+        return ReadXmlValue(reader, name == "b" ? b : name == "c" ? c : d);
+    }));
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+
+    ASSERT_EQ(Aws::String("1 < 2 && \"x' > \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 &unknown; &amp"), b);
+    ASSERT_EQ(Aws::String("<raw> &amp; and & more"), c);
+    ASSERT_EQ(Aws::String("line\nbreak\nhere"), d);
+}
+
+TEST(XmlReaderTest, TestMalformedDocuments)
+{
+    const char* documents[] = { "", "   ", "text", "<a>", "<a></b>", "<a><b></a></b>", "<a></a><b></b>", "<a x></a>",
+        "<a x=1></a>", "<a x=\"1></a>", "<a/ >", "<a><!-- </a>", "<a><![CDATA[x</a>", "<>", "<a></a>trailing" };
+    for (const char* document : documents)
+    {
+        Aws::StringStream ss(document);
+        XmlReader reader(ss);
+        XmlToken token;
+        do
+        {
+            token = reader.Next();
+        } while (token != XmlToken::PARSE_ERROR && token != XmlToken::END_DOCUMENT);
+
+        ASSERT_EQ(XmlToken::PARSE_ERROR, token) << document;
+        ASSERT_FALSE(reader.WasParseSuccessful());
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+        ASSERT_EQ(XmlToken::PARSE_ERROR, reader.Next());
+    }
+}
+
+TEST(XmlReaderTest, TestReadXmlValuePopulatesModel)
+{
+    Aws::StringStream ss(
+        "<ItemResponse xmlns=\"http://example.com/doc/\">\n"
+        "  <Name> root </Name>\n"
+        "  <Size>9007199254740993</Size>\n"
+        "  <Ratio>0.5</Ratio>\n"
+        "  <Enabled>true</Enabled>\n"
+        "  <Color>blue</Color>\n"
+        "  <Data>aGVsbG8=</Data>\n"
+        "  <Modified>2019-03-04T05:06:07.000Z</Modified>\n"
+        "  <Unknown><Nested a=\"b\"><Deeper/></Nested></Unknown>\n"
+        "  <tagSet><item>a</item><other>skipped</other><item>b</item></tagSet>\n"
+        "  <Child><Name>first</Name></Child>\n"
+        "  <Child><Name>second</Name><Child><Name>grandchild</Name></Child></Child>\n"
+        "</ItemResponse>");
+    XmlReader reader(ss);
+
+    Item item;
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_TRUE(ReadXmlValue(reader, item));
+    ASSERT_EQ(XmlToken::END_DOCUMENT, reader.Next());
+
+    ASSERT_STREQ("root", item.m_name.c_str());
+    ASSERT_TRUE(item.m_sizeHasBeenSet);
+    ASSERT_EQ(9007199254740993LL, item.m_size);
+    ASSERT_DOUBLE_EQ(0.5, item.m_ratio);
+    ASSERT_TRUE(item.m_enabled);
+    ASSERT_EQ(Color::BLUE, item.m_color);
+    ASSERT_EQ(Aws::String("hello"), Aws::String(reinterpret_cast<const char*>(item.m_data.GetUnderlyingData()), item.m_data.GetLength()));
+    ASSERT_EQ(DateTime("2019-03-04T05:06:07.000Z", DateFormat::ISO_8601), item.m_modified);
+    ASSERT_EQ(2u, item.m_tags.size());
+    ASSERT_STREQ("b", item.m_tags[1].c_str());
+    ASSERT_EQ(2u, item.m_children.size());
+    ASSERT_STREQ("first", item.m_children[0].m_name.c_str());
+    ASSERT_FALSE(item.m_children[0].m_sizeHasBeenSet);
+    ASSERT_EQ(1u, item.m_children[1].m_children.size());
+    ASSERT_STREQ("grandchild", item.m_children[1].m_children[0].m_name.c_str());
+}
+
+TEST(XmlReaderTest, TestReadXmlValueStopsOnParseError)
+{
+    Aws::StringStream ss("<Item><Name>root</Name><tagSet><item>a</item></tagSet><Child><Name>x</Child></Item>");
+    XmlReader reader(ss);
+
+    Item item;
+    ASSERT_EQ(XmlToken::START_ELEMENT, reader.Next());
+    ASSERT_FALSE(ReadXmlValue(reader, item));
+    ASSERT_FALSE(reader.WasParseSuccessful());
+    ASSERT_STREQ("root", item.m_name.c_str());
+    ASSERT_EQ(1u, item.m_tags.size());
+}
@@ -21,6 +21,7 @@
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/ResponseSink.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/auth/AWSAuthSigner.h>
@@ -83,6 +84,15 @@ namespace Aws
          * Set the response stream factory.
          */
         void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = factory; }
+        /**
+         * Retrieves the sink the body of a successful response is written into, if any.
+         */
+        const std::shared_ptr<Aws::Http::ResponseSink>& GetResponseSink() const { return m_responseSink; }
+        /**
+         * Set a sink, e.g. a pre-sized buffer or a file descriptor, the http client writes the body of a successful response
+         * into directly instead of the stream created by the response stream factory, which then stays empty.
+         */
+        void SetResponseSink(const std::shared_ptr<Aws::Http::ResponseSink>& sink) { m_responseSink = sink; }
         /**
          * Register closure for data recieved event.
          */
@@ -147,6 +157,7 @@ namespace Aws
 
     private:
         Aws::IOStreamFactory m_responseStreamFactory;
+        std::shared_ptr<Aws::Http::ResponseSink> m_responseSink;
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
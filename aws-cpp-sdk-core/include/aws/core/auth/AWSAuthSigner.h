@@ -20,6 +20,7 @@
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/threading/ReaderWriterLock.h>
@@ -29,6 +30,7 @@
 #include <memory>
 #include <atomic>
 #include <chrono>
+#include <mutex>
 
 namespace Aws
 {
@@ -81,6 +83,12 @@ namespace Aws
              */
             virtual bool SignRequest(Aws::Http::HttpRequest& request, bool signBody) const { AWS_UNREFERENCED_PARAM(signBody); return SignRequest(request); }
 
+            /**
+             * Returns true if SignRequest(request, signBody) will read the content body to hash it.
+             * The default implementation returns false.
+             */
+            virtual bool SignsPayload(const Aws::Http::HttpRequest& request, bool signBody) const { AWS_UNREFERENCED_PARAM(request); AWS_UNREFERENCED_PARAM(signBody); return false; }
+
             /**
              * Signs a single event message in an event stream.
              * The input message buffer is copied and signed. The message's input buffer will be deallocated and a new
@@ -195,6 +203,11 @@ namespace Aws
             */
             bool SignRequest(Aws::Http::HttpRequest& request, bool signBody) const override;
 
+            /**
+            * Returns true if the payload will be hashed, based on the payload signing policy, signBody and the request scheme.
+            */
+            bool SignsPayload(const Aws::Http::HttpRequest& request, bool signBody) const override;
+
             /**
             * Takes a request and signs the URI based on the HttpMethod, URI and other info from the request.
             * the region the signer was initialized with will be used for the signature.
@@ -241,10 +254,17 @@ namespace Aws
             Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate,
                     const Aws::String& canonicalRequestHash, const Aws::String& region,
                     const Aws::String& serviceName) const;
-            Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const;
+            std::shared_ptr<const Aws::Utils::ByteBuffer> ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const;
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey,
                     const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
+            /**
+             * Returns the derived signing key for (secretKey, simpleDate, region, serviceName), computing and caching it on first use.
+             * The returned key keeps the snapshot it was found in alive, so it may be held for as long as the caller needs it.
+             */
+            std::shared_ptr<const Aws::Utils::ByteBuffer> GetSigningKey(const Aws::String& secretKey,
+                    const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
 
+            struct SigningKeySnapshot;
 
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
             const Aws::String m_serviceName;
@@ -254,13 +274,13 @@ namespace Aws
 
             Aws::Set<Aws::String> m_unsignedHeaders;
 
-            //these next four fields are ONLY for caching purposes and do not change
+            //these next two fields are ONLY for caching purposes and do not change
             //the logical state of the signer. They are marked mutable so the
             //interface can remain const.
-            mutable Aws::Utils::ByteBuffer m_partialSignature;
-            mutable Aws::String m_currentDateStr;
-            mutable Aws::String m_currentSecretKey;
-            mutable Utils::Threading::ReaderWriterLock m_partialSignatureLock;
+            //Signing threads only ever atomically load m_signingKeys; a new snapshot is published (under m_signingKeysWriteLock) when a
+            //(credentials, day, region, service) combination is first seen. A replaced snapshot is freed once the last key taken from it is.
+            mutable std::shared_ptr<const SigningKeySnapshot> m_signingKeys;
+            mutable std::mutex m_signingKeysWriteLock;
             PayloadSigningPolicy m_payloadSigningPolicy;
             bool m_urlEscapePath;
         };
@@ -24,6 +24,7 @@
 #include <aws/core/utils/threading/ReaderWriterLock.h>
 #include <aws/core/internal/AWSHttpResourceClient.h>
 #include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/auth/RefreshAheadCredentials.h>
 #include <aws/core/config/AWSProfileConfigLoader.h>
 #include <memory>
 
@@ -205,6 +206,7 @@ namespace Aws
 
             /**
             * Retrieves the credentials if found, otherwise returns empty credential set.
+            * They are refreshed in the background before they expire, see RefreshAheadCredentials.
             */
             AWSCredentials GetAWSCredentials() override;
 
@@ -212,10 +214,12 @@ namespace Aws
             void Reload() override;
 
         private:
-            void RefreshIfExpired();
+            void LoadCredentials(AWSCredentials& credentials, Aws::Utils::DateTime& expiration);
 
             std::shared_ptr<Aws::Config::AWSProfileConfigLoader> m_ec2MetadataConfigLoader;
             long m_loadFrequencyMs;
+            // last, so a background refresh is done before the members it uses are destroyed
+            RefreshAheadCredentials m_refreshAheadCredentials;
         };
 
         /**
@@ -251,20 +255,22 @@ namespace Aws
                     long refreshRateMs = REFRESH_THRESHOLD);
             /**
             * Retrieves the credentials if found, otherwise returns empty credential set.
+            * They are refreshed in the background before they expire, see RefreshAheadCredentials.
             */
             AWSCredentials GetAWSCredentials() override;
 
         protected:
             void Reload() override;
         private:
-            bool ExpiresSoon() const;
-            void RefreshIfExpired();
+            void LoadCredentials(AWSCredentials& credentials, Aws::Utils::DateTime& expiration);
 
         private:
             std::shared_ptr<Aws::Internal::ECSCredentialsClient> m_ecsCredentialsClient;
             long m_loadFrequencyMs;
             Aws::Utils::DateTime m_expirationDate;
             Aws::Auth::AWSCredentials m_credentials;
+            // last, so a background refresh is done before the members it uses are destroyed
+            RefreshAheadCredentials m_refreshAheadCredentials;
         };
 
         /**
@@ -296,19 +302,22 @@ namespace Aws
 
             /**
              * Retrieves the credentials if found, otherwise returns empty credential set.
+             * They are refreshed in the background before they expire, see RefreshAheadCredentials.
              */
             AWSCredentials GetAWSCredentials() override;
 
         protected:
             void Reload() override;
         private:
-            void RefreshIfExpired();
+            void LoadCredentials(AWSCredentials& credentials, Aws::Utils::DateTime& expiration);
 
         private:
             Aws::String m_profileToUse;
             Aws::Config::AWSConfigFileProfileConfigLoader m_configFileLoader;
             Aws::Auth::AWSCredentials m_credentials;
             Aws::Utils::DateTime m_expire;
+            // last, so a background refresh is done before the members it uses are destroyed
+            RefreshAheadCredentials m_refreshAheadCredentials;
         };
 
     } // namespace Auth
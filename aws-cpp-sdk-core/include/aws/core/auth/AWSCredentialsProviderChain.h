@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <atomic>
 #include <memory>
 
 namespace Aws
@@ -27,6 +28,10 @@ namespace Aws
         /**
          * Abstract class for providing chains of credentials providers. When a credentials provider in the chain returns empty credentials,
          * We go on to the next provider until we have either exhausted the installed providers in the chain or something returns non-empty credentials.
+         *
+         * The provider that last returned credentials becomes the active provider, and later calls go straight to it instead of
+         * walking the chain. The chain is walked again from the start once the active provider returns empty credentials, and
+         * every REFRESH_THRESHOLD ms so that a provider earlier in the chain which has since become available takes over.
          */
         class AWS_CORE_API AWSCredentialsProviderChain : public AWSCredentialsProvider
         {
@@ -44,11 +49,26 @@ namespace Aws
              */
             const Aws::Vector<std::shared_ptr<AWSCredentialsProvider>>& GetProviders() { return m_providerChain; }
 
+            /**
+             * Index in GetProviders() of the active provider, or -1 if the last walk of the chain found no credentials.
+             */
+            int GetActiveProviderIndex() const { return m_activeProvider.load(std::memory_order_relaxed); }
+
+            /**
+             * Number of calls to GetAWSCredentials() answered by the active provider without walking the chain.
+             */
+            unsigned long long GetActiveProviderHits() const { return m_activeProviderHits.load(std::memory_order_relaxed); }
+
+            /**
+             * Number of calls to GetAWSCredentials() that walked the chain from the start.
+             */
+            unsigned long long GetChainWalks() const { return m_chainWalks.load(std::memory_order_relaxed); }
+
         protected:
             /**
              * This class is only allowed to be initialized by subclasses.
              */
-            AWSCredentialsProviderChain() = default;
+            AWSCredentialsProviderChain() : m_activeProvider(-1), m_activeProviderSelectedMs(0), m_activeProviderHits(0), m_chainWalks(0) {}
 
             /**
              * Adds a provider to the back of the chain.
@@ -56,8 +76,12 @@ namespace Aws
             void AddProvider(const std::shared_ptr<AWSCredentialsProvider>& provider) { m_providerChain.push_back(provider); }
 
 
-        private:            
+        private:
             Aws::Vector<std::shared_ptr<AWSCredentialsProvider> > m_providerChain;
+            std::atomic<int> m_activeProvider;
+            std::atomic<long long> m_activeProviderSelectedMs;
+            std::atomic<unsigned long long> m_activeProviderHits;
+            std::atomic<unsigned long long> m_chainWalks;
         };
 
         /**
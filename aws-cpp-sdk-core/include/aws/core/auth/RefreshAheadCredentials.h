@@ -0,0 +1,82 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/utils/DateTime.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        /**
+         * Credentials of a provider that loads them from a slow source, such as a metadata service or a process, kept as
+         * an immutable snapshot that GetCredentials() reads without taking a lock.
+         *
+         * The credentials are loaded again on a background thread ahead of their expiration, at a random point in the
+         * last quarter of their lifetime (at most the last five minutes), so neither the request that happens to cross
+         * the expiration nor every host of a fleet at once pays for the refresh. Callers only wait for the first load,
+         * and for a load after the credentials expired because refreshing them ahead failed.
+         */
+        class AWS_CORE_API RefreshAheadCredentials
+        {
+        public:
+            /**
+             * Loads the credentials, setting them and the time they have to be loaded again by. Loads never overlap.
+             */
+            typedef std::function<void(AWSCredentials& credentials, Aws::Utils::DateTime& expiration)> LoadFunction;
+
+            explicit RefreshAheadCredentials(LoadFunction&& load);
+
+            /**
+             * Waits for a running background refresh. Owners whose load function calls into them have to destroy this
+             * before anything that function uses.
+             */
+            ~RefreshAheadCredentials();
+
+            RefreshAheadCredentials(const RefreshAheadCredentials&) = delete;
+            RefreshAheadCredentials& operator=(const RefreshAheadCredentials&) = delete;
+
+            AWSCredentials GetCredentials();
+
+        private:
+            struct Snapshot
+            {
+                AWSCredentials credentials;
+                Aws::Utils::DateTime expiration;
+                Aws::Utils::DateTime refreshAt;
+            };
+
+            // the following require m_loadLock to be locked
+            void Load();
+            void StartRefresh();
+
+            LoadFunction m_load;
+            // published with std::atomic_store, read with std::atomic_load
+            std::shared_ptr<const Snapshot> m_snapshot;
+            std::mutex m_loadLock;
+            bool m_refreshing;
+            std::thread m_refreshThread;
+            std::default_random_engine m_random;
+        };
+    } // namespace Auth
+} // namespace Aws
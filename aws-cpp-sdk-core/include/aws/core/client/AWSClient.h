@@ -20,10 +20,12 @@
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/NoResult.h>
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 struct aws_array_list;
 
@@ -37,11 +39,13 @@ namespace Aws
         namespace Xml
         {
             class XmlDocument;
+            class XmlReader;
         } // namespace Xml
 
         namespace Json
         {
             class JsonValue;
+            class JsonReader;
         } // namespace Json
 
         namespace RateLimits
@@ -53,6 +57,12 @@ namespace Aws
         {
             class MD5;
         } // namespace Crypto
+
+        namespace Threading
+        {
+            class Executor;
+            class TimerWheel;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -85,9 +95,11 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class RetryTokenBucket;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(const HttpResponseOutcome&)> HttpResponseOutcomeReceivedHandler;
 
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
@@ -113,7 +125,10 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSClient() { };
+            /**
+             * Waits for the async requests running in the client, see StopAsyncRequests().
+             */
+            virtual ~AWSClient();
 
             /**
              * Generates a signed Uri using the injected signer. for the supplied uri and http method. expirationInSecodns defaults
@@ -180,6 +195,18 @@ namespace Aws
                     const char* signerName,
                     const char* requestName = nullptr) const;
 
+            /**
+             * Asynchronous version of AttemptExhaustively. If the http client supports async requests, each attempt is handed off to it
+             * and no thread is held while the request is in flight; response handling runs on the configured executor. Otherwise each
+             * attempt runs on the executor. No thread waits out the retry back-off either, the next attempt is scheduled on the
+             * client's timer wheel. handler is called with the final outcome.
+             */
+            void AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    Http::HttpMethod httpMethod,
+                    const char* signerName,
+                    const HttpResponseOutcomeReceivedHandler& handler) const;
+
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it accross the wire
              * then reports the http response.
@@ -254,7 +281,29 @@ namespace Aws
              * Performs the HTTP request via the HTTP client while enforcing rate limiters
              */
             std::shared_ptr<Aws::Http::HttpResponse> MakeHttpRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
+
+            /**
+             * Waits for the async requests that are running in the client, e.g. marshalling a response, and makes the others complete without
+             * touching it: they are handed the outcome of their last attempt, or an error if they had none. Subclasses overriding functions
+             * the async requests call have to call it first thing in their destructor. Calling it more than once is fine.
+             */
+            void StopAsyncRequests();
         private:
+            struct AsyncAttempt;
+            struct AsyncRequestTracker;
+
+            /**
+             * Runs step of an async request in the client if it is still there, and calls the request's handler once the step has
+             * finished the request. The steps below return true if they finished the request, false if they handed it on.
+             */
+            static void RunAsyncStep(const std::shared_ptr<AsyncRequestTracker>& tracker, const std::shared_ptr<AsyncAttempt>& attempt,
+                    const std::function<bool()>& step);
+            bool FinishAsyncAttempt(const std::shared_ptr<AsyncAttempt>& attempt, HttpResponseOutcome&& outcome) const;
+            bool SendAsyncAttempt(const std::shared_ptr<AsyncAttempt>& attempt) const;
+            bool OnAsyncAttemptCompleted(const std::shared_ptr<AsyncAttempt>& attempt, HttpResponseOutcome&& outcome) const;
+            bool RetryAsyncAttempt(const std::shared_ptr<AsyncAttempt>& attempt) const;
+            HttpResponseOutcome BuildResponseOutcome(const std::shared_ptr<Http::HttpRequest>& httpRequest,
+                    const std::shared_ptr<Http::HttpResponse>& httpResponse) const;
             /**
              * Try to adjust signer's clock
              * return true if signer's clock is adjusted, false otherwise.
@@ -277,9 +326,19 @@ namespace Aws
             Aws::String m_userAgent;
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
             bool m_enableClockSkewAdjustment;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+            std::shared_ptr<RetryTokenBucket> m_retryTokenBucket;
+            // shared with the callbacks of async requests, which find out through it whether the client is still there.
+            std::shared_ptr<AsyncRequestTracker> m_asyncRequests;
+            // declared last so it is destroyed first. Retries still waiting on it are not resubmitted then: each request is
+            // completed with the outcome of its last attempt.
+            std::shared_ptr<Aws::Utils::Threading::TimerWheel> m_retryScheduler;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef std::function<void(const JsonOutcome&)> JsonOutcomeReceivedHandler;
+        typedef Utils::Outcome<NoResult, AWSError<CoreErrors>> JsonReaderOutcome;
+        typedef std::function<bool(Utils::Json::JsonReader&)> JsonPayloadReader;
         AWS_CORE_API Aws::String GetAuthorizationHeader(const Aws::Http::HttpRequest& httpRequest);
 
         /**
@@ -305,7 +364,7 @@ namespace Aws
                     const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSJsonClient() = default;
+            virtual ~AWSJsonClient();
 
         protected:
             /**
@@ -335,10 +394,38 @@ namespace Aws
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = nullptr) const;
 
+            /**
+             * Same as MakeRequest, but instead of building a Json document the response body is handed to readPayload,
+             * which parses it straight from the response stream with a JsonReader. Returns a json parser error if
+             * readPayload fails or the body has anything after the document. readPayload isn't called for an empty body.
+             *
+             * method defaults to POST
+             */
+            JsonReaderOutcome MakeRequestWithJsonReader(const Aws::Http::URI& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                const JsonPayloadReader& readPayload,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER) const;
+
+            /**
+             * Asynchronous version of MakeRequest. Calls AttemptExhaustivelyAsync, then marshalls the json response
+             * on the executor and hands it to handler.
+             *
+             * method defaults to POST
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const JsonOutcomeReceivedHandler& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER) const;
+
             JsonOutcome MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
+        typedef std::function<void(const XmlOutcome&)> XmlOutcomeReceivedHandler;
+        typedef Utils::Outcome<NoResult, AWSError<CoreErrors>> XmlReaderOutcome;
+        typedef std::function<bool(Utils::Xml::XmlReader&)> XmlPayloadReader;
 
         /**
         *  AWSClient that handles marshalling xml response bodies. You would inherit from this class
@@ -358,7 +445,7 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSXMLClient() = default;
+            virtual ~AWSXMLClient();
 
         protected:
             /**
@@ -389,6 +476,31 @@ namespace Aws
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requesetName = nullptr) const;
 
+            /**
+             * Same as MakeRequest, but instead of building an xml document the response body is handed to readPayload,
+             * which parses it in a single pass with an XmlReader. Returns an xml parse error if readPayload fails or the
+             * body has anything after the document. readPayload isn't called for an empty body.
+             *
+             * method defaults to POST
+             */
+            XmlReaderOutcome MakeRequestWithXmlReader(const Aws::Http::URI& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                const XmlPayloadReader& readPayload,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER) const;
+
+            /**
+             * Asynchronous version of MakeRequest. Calls AttemptExhaustivelyAsync, then parses the xml response
+             * on the executor and hands it to handler.
+             *
+             * method defaults to POST
+             */
+            void MakeRequestAsync(const Aws::Http::URI& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                const XmlOutcomeReceivedHandler& handler,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* signerName = Aws::Auth::SIGV4_SIGNER) const;
+
             /**
             * This is used for event stream response.
             */
@@ -404,6 +516,9 @@ namespace Aws
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
                 const char* signerName = Aws::Auth::SIGV4_SIGNER,
                 const char* requestName = nullptr) const;
+
+        private:
+            static XmlOutcome ParseXmlOutcome(const HttpResponseOutcome& httpOutcome);
         };
 
     } // namespace Client
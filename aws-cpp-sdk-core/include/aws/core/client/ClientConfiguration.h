@@ -19,6 +19,7 @@
 #include <aws/core/http/Scheme.h>
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/http/HttpTypes.h>
 #include <memory>
 
@@ -105,6 +106,12 @@ namespace Aws
              * Strategy to use in case of failed requests. Default is DefaultRetryStrategy (e.g. exponential backoff)
              */
             std::shared_ptr<RetryStrategy> retryStrategy;
+            /**
+             * Size of the client's retry budget. Each retry takes 5 tokens (10 after a timeout or connection failure) and each
+             * successful request puts tokens back; when the budget is used up, failed requests are no longer retried.
+             * 0 disables the budget. Default 500.
+             */
+            unsigned retryTokenBucketCapacity;
             /**
              * Override the http endpoint used to talk to a service.
              */
@@ -156,6 +163,7 @@ namespace Aws
             Aws::String proxySSLKeyPassword;
             /**
             * Threading Executor implementation. Default uses std::thread::detach()
+            * For high request rates use a bounded pool such as PooledThreadExecutor or WorkStealingThreadExecutor.
             */
             std::shared_ptr<Aws::Utils::Threading::Executor> executor;
             /**
@@ -187,6 +195,28 @@ namespace Aws
              * Override the http implementation the default factory returns.
              */
             Aws::Http::TransferLibType httpLibOverride;
+            /**
+             * Number of event loop threads used by the curl multi http client (TransferLibType::CURL_MULTI_CLIENT)
+             * to multiplex in flight requests. Each thread drives its own curl multi handle. Default 1.
+             */
+            unsigned httpEventLoopThreads;
+            /**
+             * Only works for Curl http client.
+             * Endpoints (e.g. "https://s3.us-east-1.amazonaws.com") the http client opens connections to when it is created,
+             * so that the first requests don't pay for DNS lookup, TCP connect and TLS handshake. Empty by default.
+             */
+            Aws::Vector<Aws::String> warmUpEndpoints;
+            /**
+             * Number of connections opened to each of warmUpEndpoints, bounded by maxConnections. Default 1.
+             */
+            unsigned warmUpConnectionsPerEndpoint;
+            /**
+             * Only works for Curl http client.
+             * Share the DNS cache, TLS session IDs and (libcurl 7.57.0 or newer) open connections with every other http client
+             * created with this flag set, instead of each client keeping its own. Recommended when many clients are created
+             * for the same hosts, e.g. one per region or tenant. Default false.
+             */
+            bool shareCurlCaches;
             /**
              * If set to true the http stack will follow 300 redirect codes.
              */
@@ -0,0 +1,116 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Threading
+{
+class Executor;
+} // namespace Threading
+} // namespace Utils
+
+namespace Client
+{
+
+/**
+ * Endpoints a client discovered through its endpoint discovery operation, by endpoint key.
+ *
+ * Concurrent lookups of a key that has no endpoint yet are coalesced: one of them discovers it and the others wait for
+ * that result. When an endpoint gets close to the end of its cache period, the lookup that notices submits a refresh to
+ * the executor and every lookup keeps returning the current endpoint meanwhile. An endpoint that expired anyway is
+ * rediscovered by the lookup that finds it, while other lookups keep using the expired one until that completes.
+ *
+ * Clients whose discovery functions call back into them must call StopRefreshing() before they are destroyed.
+ */
+class AWS_CORE_API EndpointDiscoveryCache
+{
+public:
+    /**
+     * Discovers an endpoint, setting its address and how long it may be used. Returns false if discovery failed.
+     */
+    typedef std::function<bool(Aws::String& address, std::chrono::milliseconds& cachePeriod)> DiscoverEndpointFunction;
+
+    /**
+     * maxSize bounds the number of endpoint keys kept. Endpoints are refreshed once less than refreshWindow, or half of
+     * their cache period, is left.
+     */
+    explicit EndpointDiscoveryCache(size_t maxSize = 1000, std::chrono::milliseconds refreshWindow = std::chrono::minutes(1));
+    ~EndpointDiscoveryCache();
+
+    EndpointDiscoveryCache(const EndpointDiscoveryCache&) = delete;
+    EndpointDiscoveryCache& operator=(const EndpointDiscoveryCache&) = delete;
+
+    /**
+     * Executor that refreshes endpoints in the background. Without one, endpoints are only rediscovered once they expired.
+     */
+    void SetExecutor(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor);
+
+    /**
+     * Sets endpoint to the endpoint for key, calling discover, with the signature of DiscoverEndpointFunction, if it has
+     * to be discovered or refreshed. discover is only copied in that case. Returns false if there is no endpoint because
+     * discovery failed.
+     */
+    template<typename DiscoverFunction>
+    bool GetEndpoint(const Aws::String& key, DiscoverFunction&& discover, Aws::String& endpoint)
+    {
+        LookupResult result = Lookup(key, endpoint);
+        switch (result)
+        {
+            case LookupResult::FOUND:
+                return true;
+            case LookupResult::NOT_FOUND:
+                return false;
+            default:
+                return Discover(key, result, DiscoverEndpointFunction(std::forward<DiscoverFunction>(discover)), endpoint);
+        }
+    }
+
+    /**
+     * Waits for the background refreshes that are running and drops the ones that haven't started yet. No refresh is
+     * submitted afterwards.
+     */
+    void StopRefreshing();
+
+private:
+    enum class LookupResult
+    {
+        FOUND,
+        NOT_FOUND,
+        // endpoint is set, but the caller has to submit a refresh
+        REFRESH,
+        // the caller has to discover the endpoint
+        DISCOVER
+    };
+
+    LookupResult Lookup(const Aws::String& key, Aws::String& endpoint);
+    bool Discover(const Aws::String& key, LookupResult result, DiscoverEndpointFunction&& discover, Aws::String& endpoint);
+
+    struct State;
+    std::shared_ptr<State> m_state;
+};
+
+} // namespace Client
+} // namespace Aws
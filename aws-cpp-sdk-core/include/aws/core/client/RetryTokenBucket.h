@@ -0,0 +1,68 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <atomic>
+
+namespace Aws
+{
+namespace Client
+{
+
+enum class CoreErrors;
+template<typename ERROR_TYPE>
+class AWSError;
+
+/**
+ * Retry budget shared by all requests of a client. Every retry takes tokens, more for timeouts and connection failures,
+ * and successful requests put tokens back. Once the bucket is empty requests fail with their last error instead of being
+ * retried, so an outage or a throttling event does not multiply the load on the service while the retries keep failing.
+ *
+ * A capacity of 0 disables the budget.
+ */
+class AWS_CORE_API RetryTokenBucket
+{
+public:
+    static const unsigned RETRY_COST = 5;
+    static const unsigned TIMEOUT_RETRY_COST = 10;
+    // refilled by a request that succeeds without having been retried
+    static const unsigned NO_RETRY_INCREMENT = 1;
+
+    explicit RetryTokenBucket(unsigned capacity = 500);
+
+    /**
+     * Takes the tokens for retrying after error. Returns false if there are not enough left, the request must not be retried then.
+     * acquiredTokens is set to the number of tokens taken.
+     */
+    bool AcquireForRetry(const AWSError<CoreErrors>& error, unsigned& acquiredTokens);
+
+    /**
+     * Puts tokens back after a request succeeded. acquiredTokens is what the last AcquireForRetry() of that request took,
+     * 0 if it was not retried.
+     */
+    void ReleaseOnSuccess(unsigned acquiredTokens);
+
+    unsigned GetCapacity() const { return m_capacity; }
+    unsigned GetAvailableTokens() const { return m_availableTokens.load(std::memory_order_relaxed); }
+
+private:
+    unsigned m_capacity;
+    std::atomic<unsigned> m_availableTokens;
+};
+
+} // namespace Client
+} // namespace Aws
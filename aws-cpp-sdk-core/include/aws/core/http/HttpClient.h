@@ -19,6 +19,7 @@
 #include <aws/core/utils/UnreferencedParam.h>
 
 #include <memory>
+#include <functional>
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
@@ -38,6 +39,11 @@ namespace Aws
         class HttpRequest;
         class HttpResponse;
 
+        /**
+         * Invoked once an asynchronous request has completed. response is nullptr if the request failed at the transport level.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)> HttpResponseReceivedHandler;
+
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
           */
@@ -69,6 +75,22 @@ namespace Aws
                 return nullptr;
             }
 
+            /**
+             * Takes an http request, makes it, and invokes handler with the newly allocated HttpResponse once it has been received.
+             * Default implementation makes the request synchronously on the calling thread, then invokes handler.
+             * Clients which return true from SupportsAsyncRequests() return immediately and invoke handler from their own I/O threads,
+             * so handler must not block.
+             */
+            virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                const HttpResponseReceivedHandler& handler,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
+            /**
+             * Returns true if MakeRequestAsync() multiplexes requests without tying up the calling thread for the round trip.
+             */
+            virtual bool SupportsAsyncRequests() const { return false; }
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
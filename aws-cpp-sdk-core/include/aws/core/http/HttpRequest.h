@@ -53,6 +53,7 @@ namespace Aws
 
         class HttpRequest;
         class HttpResponse;
+        class ResponseSink;
 
         /**
          * closure type for recieving notifications that data has been recieved.
@@ -77,7 +78,7 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
+                m_uri(uri), m_method(method), m_computeContentSha256(false)
             {}
 
             virtual ~HttpRequest() {}
@@ -86,6 +87,11 @@ namespace Aws
              * Get All headers for this request.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Get all headers for this request without copying them, or nullptr if the implementation doesn't keep them in a
+             * HeaderValueCollection, in which case use GetHeaders(). The pointer is only valid until the headers are next changed.
+             */
+            virtual const HeaderValueCollection* PeekHeaders() const { return nullptr; }
             /**
              * Get the value for a Header based on its name. (in default StandardHttpRequest implementation, an empty string will be returned if headerName dosen't exist)
              */
@@ -486,6 +492,31 @@ namespace Aws
             */
             inline void SetSigningRegion(const Aws::String& region) { m_signingRegion = region; }
 
+            /**
+             * Whether the signer will hash the content body, so anything else reading the body (e.g. to compute Content-MD5)
+             * should compute the SHA256 in the same pass and store it with SetContentSha256().
+             */
+            inline bool ShouldComputeContentSha256() const { return m_computeContentSha256; }
+            inline void SetComputeContentSha256(bool value) { m_computeContentSha256 = value; }
+
+            /**
+             * Gets the hex encoded SHA256 of the content body if it has already been computed, otherwise an empty string.
+             */
+            inline const Aws::String& GetContentSha256() const { return m_contentSha256; }
+            /**
+             * Sets the hex encoded SHA256 of the content body. Signers use it instead of reading the body again.
+             */
+            inline void SetContentSha256(const Aws::String& value) { m_contentSha256 = value; }
+
+            /**
+             * Gets the sink the body of a successful response is written into, or nullptr if it goes to the response stream.
+             */
+            inline const std::shared_ptr<ResponseSink>& GetResponseSink() const { return m_responseSink; }
+            /**
+             * Sets the sink the body of a successful response is written into instead of the response stream.
+             */
+            inline void SetResponseSink(const std::shared_ptr<ResponseSink>& sink) { m_responseSink = sink; }
+
             /**
              * Add a request metric
              * @param key, HttpClientMetricsKey defined in HttpClientMetrics.cpp
@@ -521,6 +552,9 @@ namespace Aws
             Aws::String m_signingRegion;
             Aws::String m_signingAccessKey;
             Aws::String m_resolvedRemoteHost;
+            bool m_computeContentSha256;
+            Aws::String m_contentSha256;
+            std::shared_ptr<ResponseSink> m_responseSink;
             HttpClientMetricsCollection m_httpRequestMetrics;
         };
 
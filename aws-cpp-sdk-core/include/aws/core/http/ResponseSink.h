@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Destination for the body of a successful (2xx) response that the http client writes into directly, instead of
+         * going through the response stream. Bodies of error responses still go to the response stream so they can be parsed.
+         *
+         * Only the curl http client delivers into sinks, other clients write the body to the response stream.
+         */
+        class AWS_CORE_API ResponseSink
+        {
+        public:
+            virtual ~ResponseSink() {}
+
+            /**
+             * Called once the headers of the response of every attempt are in, before its body and also if it has none, so a retried
+             * request starts over.
+             * contentLength is the value of the Content-Length header, or -1 if the response didn't have one.
+             * Returning false aborts the request.
+             */
+            virtual bool BeginBody(int64_t contentLength) = 0;
+
+            /**
+             * Writes the next length bytes of the body. Returning false aborts the request.
+             */
+            virtual bool Write(const unsigned char* data, size_t length) = 0;
+
+            /**
+             * Number of body bytes written since the last BeginBody().
+             */
+            virtual uint64_t GetBytesWritten() const = 0;
+        };
+
+        /**
+         * Writes the body into memory. Either into a buffer owned by the caller, in which case a body that doesn't fit
+         * aborts the request, or into a buffer owned by the sink, pre-sized from Content-Length.
+         */
+        class AWS_CORE_API BufferResponseSink : public ResponseSink
+        {
+        public:
+            /**
+             * The sink allocates the buffer.
+             */
+            BufferResponseSink();
+            /**
+             * The body is written to buffer, which must stay valid until the request has completed.
+             */
+            BufferResponseSink(unsigned char* buffer, size_t capacity);
+
+            bool BeginBody(int64_t contentLength) override;
+            bool Write(const unsigned char* data, size_t length) override;
+            uint64_t GetBytesWritten() const override { return m_length; }
+
+            /**
+             * Returns the start of the body.
+             */
+            const unsigned char* GetData() const { return m_buffer ? m_buffer : m_ownedBuffer.data(); }
+
+        private:
+            unsigned char* m_buffer;
+            size_t m_capacity;
+            size_t m_length;
+            Aws::Vector<unsigned char> m_ownedBuffer;
+        };
+
+        /**
+         * One contiguous piece of a ScatterResponseSink.
+         */
+        struct ResponseSinkSegment
+        {
+            unsigned char* data;
+            size_t length;
+        };
+
+        /**
+         * Writes the body across a list of caller owned buffers, filling them in order. A body larger than all of them
+         * together aborts the request.
+         */
+        class AWS_CORE_API ScatterResponseSink : public ResponseSink
+        {
+        public:
+            explicit ScatterResponseSink(const Aws::Vector<ResponseSinkSegment>& segments);
+
+            bool BeginBody(int64_t contentLength) override;
+            bool Write(const unsigned char* data, size_t length) override;
+            uint64_t GetBytesWritten() const override { return m_bytesWritten; }
+
+        private:
+            Aws::Vector<ResponseSinkSegment> m_segments;
+            uint64_t m_capacity;
+            size_t m_currentSegment;
+            size_t m_segmentOffset;
+            uint64_t m_bytesWritten;
+        };
+
+#if !defined(_WIN32)
+        /**
+         * Writes the body to an open file descriptor with pwrite, starting at offset. The descriptor's file position is not
+         * used, so several requests can write different ranges of the same file concurrently. The descriptor is not closed.
+         */
+        class AWS_CORE_API FileResponseSink : public ResponseSink
+        {
+        public:
+            FileResponseSink(int fileDescriptor, int64_t offset);
+
+            bool BeginBody(int64_t contentLength) override;
+            bool Write(const unsigned char* data, size_t length) override;
+            uint64_t GetBytesWritten() const override { return m_bytesWritten; }
+
+        private:
+            int m_fileDescriptor;
+            int64_t m_offset;
+            uint64_t m_bytesWritten;
+        };
+#endif
+
+    } // namespace Http
+} // namespace Aws
@@ -15,8 +15,13 @@
 
 #pragma once
 
-#include <aws/core/utils/ResourceManager.h>
+#include <aws/core/http/curl/CurlShareHandle.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 #include <curl/curl.h>
 
@@ -28,29 +33,74 @@ namespace Http
 /**
   * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
   * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
-  * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
-  * needed up to the maximum amount of connections.
+  * initialized handle is preferable (especially for synchronous clients). Handles are created on demand
+  * up to the maximum amount of connections.
+  *
+  * Idle handles are kept per endpoint (scheme://host:port) their last transfer went to, since an easy handle keeps
+  * that connection open. Acquiring for an endpoint prefers a handle with a live connection to it, then a handle with
+  * no connection, then a new handle, and only then takes one that last talked to another endpoint.
   */
 class CurlHandleContainer
 {
 public:
+    /**
+      * Pool occupancy and connection affinity counters.
+      */
+    struct PoolStats
+    {
+        unsigned maxPoolSize;
+        // handles created so far
+        unsigned poolSize;
+        unsigned idleHandles;
+        // endpoints that currently have at least one idle handle
+        unsigned idleEndpoints;
+        uint64_t acquisitions;
+        // acquisitions served by a handle whose last transfer went to the requested endpoint
+        uint64_t endpointHits;
+        // acquisitions that had to block for a handle to be released
+        uint64_t waits;
+    };
+
     /**
       * Initializes an empty stack of CURL handles. If you are only making synchronous calls via your http client
       * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
+      * If shareHandle is set, every handle of the pool is attached to it.
       */
     CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000,
-                        bool tcpKeepAlive = true, unsigned long tcpKeepAliveIntervalMs = 30000, unsigned long lowSpeedLimit = 1);
+                        bool tcpKeepAlive = true, unsigned long tcpKeepAliveIntervalMs = 30000, unsigned long lowSpeedLimit = 1,
+                        const std::shared_ptr<CurlShareHandle>& shareHandle = nullptr);
     ~CurlHandleContainer();
 
     /**
-      * Blocks until a curl handle from the pool is available for use.
+      * Blocks until a curl handle from the pool is available for use, preferring one connected to endpoint.
       */
-    CURL* AcquireCurlHandle();
+    CURL* AcquireCurlHandle(const Aws::String& endpoint = "");
+    /**
+      * Returns a curl handle from the pool if one is available (growing the pool if it is not at max size yet),
+      * otherwise returns nullptr immediately. Used by event loop driven clients which must never block.
+      */
+    CURL* TryAcquireCurlHandle(const Aws::String& endpoint = "");
     /**
       * Returns a handle to the pool for reuse. It is imperative that this is called
-      * after you are finished with the handle.
+      * after you are finished with the handle. endpoint is where the handle's last transfer went, or empty
+      * if it is not known to hold a usable connection.
+      */
+    void ReleaseCurlHandle(CURL* handle, const Aws::String& endpoint = "");
+
+    /**
+      * Returns a snapshot of the pool counters.
+      */
+    PoolStats GetPoolStats() const;
+
+    /**
+      * Returns whether the handles of the pool keep their connections in a shared connection cache rather than each in its own.
+      */
+    bool IsSharingConnections() const { return m_shareHandle && m_shareHandle->IsSharingConnections(); }
+
+    /**
+      * Builds the key idle handles are grouped by.
       */
-    void ReleaseCurlHandle(CURL* handle);
+    static Aws::String GetEndpointKey(const Aws::String& scheme, const Aws::String& authority, uint16_t port);
 
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
@@ -58,18 +108,29 @@ private:
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
-    bool CheckAndGrowPool();
+    CURL* AcquireCurlHandle(const Aws::String& endpoint, bool waitForHandle);
+    CURL* TakeIdleHandleLocked(const Aws::String& endpoint);
+    CURL* CreateCurlHandle();
     void SetDefaultOptionsOnHandle(CURL* handle);
 
-    Aws::Utils::ExclusiveOwnershipResourceManager<CURL*> m_handleContainer;
+    // idle handles keyed by the endpoint of their last transfer, "" holds handles without a known connection.
+    Aws::Map<Aws::String, Aws::Vector<CURL*>> m_idleHandles;
     unsigned m_maxPoolSize;
     unsigned long m_requestTimeout;
     unsigned long m_connectTimeout;
     bool m_enableTcpKeepAlive;
     unsigned long m_tcpKeepAliveIntervalMs;
     unsigned long m_lowSpeedLimit;
+    // released only after every handle of the pool has been cleaned up.
+    std::shared_ptr<CurlShareHandle> m_shareHandle;
     unsigned m_poolSize;
-    std::mutex m_containerLock;
+    unsigned m_idleCount;
+    uint64_t m_acquisitions;
+    uint64_t m_endpointHits;
+    uint64_t m_waits;
+    bool m_shutdown;
+    mutable std::mutex m_containerLock;
+    std::condition_variable m_handleReleased;
 };
 
 } // namespace Http
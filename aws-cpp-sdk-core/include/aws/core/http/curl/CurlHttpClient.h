@@ -22,6 +22,7 @@
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <atomic>
+#include <chrono>
 
 namespace Aws
 {
@@ -53,6 +54,59 @@ public:
     static void InitGlobalState();
     static void CleanupGlobalState();
 
+    /**
+     * Opens up to connectionCount connections (DNS lookup, TCP connect and TLS handshake) to endpoint, e.g.
+     * "https://dynamodb.us-east-1.amazonaws.com", in parallel and keeps them in the connection pool for later requests.
+     * Blocks until every connection has been established or has failed.
+     * The connections are kept in the connection cache of the pool's share handle, so this does nothing for a client created with
+     * neither ClientConfiguration::warmUpEndpoints nor ClientConfiguration::shareCurlCaches set, or with libcurl older than 7.57.0.
+     */
+    void WarmUpConnections(const Aws::String& endpoint, unsigned connectionCount) const;
+
+    /**
+     * Returns occupancy and connection reuse counters of the connection pool.
+     */
+    CurlHandleContainer::PoolStats GetConnectionPoolStats() const;
+
+protected:
+    /**
+     * Per request state shared by the curl callbacks: header list, read/write callback contexts, response and the easy handle in use.
+     * Defined in CurlHttpClient.cpp.
+     */
+    struct CurlRequestContext;
+
+    /**
+     * Acquires an easy handle and configures it for request. If waitForHandle is false and the pool is exhausted, returns nullptr
+     * without side effects. The returned context must be passed to CompleteRequest() once the transfer has finished.
+     * With deferRateLimitDelays, the rate limiters never put the calling thread or the curl callbacks to sleep: the transfer must not be
+     * started before GetStartDelay() has passed, and its callbacks pause it while a limiter is in debt, see ResumeRateLimitedTransfer().
+     */
+    CurlRequestContext* PrepareRequest(HttpRequest& request, const std::shared_ptr<Standard::StandardHttpResponse>& response,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter, bool waitForHandle, bool deferRateLimitDelays = false) const;
+
+    /**
+     * Returns the easy handle configured by PrepareRequest().
+     */
+    static CURL* GetCurlHandle(const CurlRequestContext* context);
+
+    /**
+     * How long a transfer prepared with deferRateLimitDelays has to wait for the write limiter before it is started.
+     */
+    static std::chrono::milliseconds GetStartDelay(const CurlRequestContext* context);
+
+    /**
+     * Unpauses the directions of a transfer prepared with deferRateLimitDelays whose rate limiter is out of debt. Returns how long until the
+     * transfer needs to be looked at again, zero if it isn't paused anymore.
+     */
+    static std::chrono::milliseconds ResumeRateLimitedTransfer(CurlRequestContext* context);
+
+    /**
+     * Fills in the response from the finished transfer, records metrics, releases the handle back to the pool and frees context.
+     * Returns the response, or nullptr if the transfer failed.
+     */
+    std::shared_ptr<Standard::StandardHttpResponse> CompleteRequest(CurlRequestContext* context, CURLcode curlResponseCode) const;
+
 private:
     mutable CurlHandleContainer m_curlHandleContainer;
     bool m_isUsingProxy;
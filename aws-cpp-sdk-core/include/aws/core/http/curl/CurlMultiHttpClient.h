@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+ * Curl implementation of an http client which multiplexes asynchronous requests over a small, fixed number of event loop threads.
+ * Each event loop thread owns a curl multi handle and drives all the transfers assigned to it, so requests in flight do not each
+ * tie up a thread for the full round trip. Easy handles are still taken from the connection pool, bounded by maxConnections;
+ * requests beyond that are queued until a handle is released.
+ *
+ * MakeRequestAsync() returns immediately and invokes the handler on an event loop thread, so the handler must be short and must not block.
+ * Synchronous MakeRequest() calls are performed on the calling thread exactly as CurlHttpClient does.
+ * The rate limiters never block an event loop: a transfer waits for them unstarted, or paused, while the loop goes on with the others.
+ *
+ * Do not destroy this client from within a response handler.
+ */
+class AWS_CORE_API CurlMultiHttpClient: public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    /**
+     * Creates the client and starts clientConfig.httpEventLoopThreads event loop threads (at least one).
+     */
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    /**
+     * Stops the event loops. Requests still in flight or queued are completed with a nullptr response.
+     */
+    virtual ~CurlMultiHttpClient();
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+        const HttpResponseReceivedHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+private:
+    CurlMultiHttpClient(const CurlMultiHttpClient&) = delete;
+    CurlMultiHttpClient& operator=(const CurlMultiHttpClient&) = delete;
+
+    struct EventLoop;
+    struct PendingRequest;
+
+    void RunEventLoop(EventLoop* eventLoop);
+    void AdmitPendingRequests(EventLoop* eventLoop) const;
+    void StartTransfer(EventLoop* eventLoop, PendingRequest* pendingRequest) const;
+    /**
+     * Starts the transfers whose write limiter allows it and resumes the ones paused for their rate limiters. Returns the time until the
+     * next of the others is due, zero if there are none.
+     */
+    std::chrono::milliseconds ServiceRateLimitedTransfers(EventLoop* eventLoop) const;
+    void CompleteTransfer(EventLoop* eventLoop, PendingRequest* pendingRequest, CURLcode curlResponseCode) const;
+    void WakeUpEventLoops() const;
+
+    Aws::Vector<EventLoop*> m_eventLoops;
+    mutable std::atomic<size_t> m_nextEventLoop;
+};
+
+} // namespace Http
+} // namespace Aws
+
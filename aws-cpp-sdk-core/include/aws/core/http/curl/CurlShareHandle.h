@@ -0,0 +1,73 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <curl/curl.h>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+  * Owns a curl share handle through which easy handles of different http clients share their DNS cache, TLS session IDs
+  * and (with libcurl 7.57.0 or newer) their connection cache. Processes creating many short lived clients then pay for a
+  * DNS lookup and a full TLS handshake once per host instead of once per client.
+  *
+  * Every easy handle using the share must be cleaned up before the share handle is destroyed, so containers hold on to it
+  * through a shared_ptr.
+  */
+class CurlShareHandle
+{
+public:
+    CurlShareHandle();
+    ~CurlShareHandle();
+
+    CURLSH* GetHandle() const { return m_shareHandle; }
+
+    /**
+      * Returns whether connections, not only DNS entries and TLS sessions, are shared.
+      */
+    bool IsSharingConnections() const { return m_sharingConnections; }
+
+    /**
+      * Returns the share handle used by every client with ClientConfiguration::shareCurlCaches set, creating it on first use.
+      */
+    static std::shared_ptr<CurlShareHandle> GetProcessShareHandle();
+
+    /**
+      * Drops the process wide reference. Called when the http static state is cleaned up, clients still alive keep the share
+      * handle until they are destroyed, and later clients get a new one.
+      */
+    static void ReleaseProcessShareHandle();
+
+private:
+    CurlShareHandle(const CurlShareHandle&) = delete;
+    const CurlShareHandle& operator = (const CurlShareHandle&) = delete;
+
+    static void LockShareData(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData);
+    static void UnlockShareData(CURL* handle, curl_lock_data data, void* userData);
+
+    CURLSH* m_shareHandle;
+    bool m_sharingConnections;
+    // one lock per kind of shared data, so a DNS lookup does not wait for a TLS session being stored.
+    std::mutex m_dataLocks[CURL_LOCK_DATA_LAST];
+};
+
+} // namespace Http
+} // namespace Aws
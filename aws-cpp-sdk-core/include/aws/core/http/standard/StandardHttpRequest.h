@@ -42,6 +42,10 @@ namespace Aws
                  * Get All headers for this request.
                  */
                 virtual HeaderValueCollection GetHeaders() const override;
+                /**
+                 * Get all headers for this request without copying them.
+                 */
+                virtual const HeaderValueCollection* PeekHeaders() const override { return &headerMap; }
                 /**
                  * Get the value for a Header based on its name.
                  * This function doesn't check the existence of headerName.
@@ -18,6 +18,7 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/DateTime.h>
 #include <functional>
 
 namespace Aws
@@ -120,6 +121,10 @@ namespace FileSystem
         Aws::String relativePath;
         FileType fileType;
         int64_t fileSize;
+        /**
+         * Time of the entry's last modification, to the second.
+         */
+        Aws::Utils::DateTime lastModified;
     };
 
     /**
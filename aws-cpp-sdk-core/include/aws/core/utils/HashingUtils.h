@@ -87,6 +87,26 @@ namespace Aws
             */
             static ByteBuffer CalculateMD5(Aws::IOStream& stream);
 
+            /**
+            * Calculates a CRC32 checksum (4 bytes, big-endian)
+            */
+            static ByteBuffer CalculateCRC32(const Aws::String& str);
+
+            /**
+            * Calculates a CRC32 checksum on a stream (the entire stream is read)
+            */
+            static ByteBuffer CalculateCRC32(Aws::IOStream& stream);
+
+            /**
+            * Calculates a CRC32C checksum (4 bytes, big-endian)
+            */
+            static ByteBuffer CalculateCRC32C(const Aws::String& str);
+
+            /**
+            * Calculates a CRC32C checksum on a stream (the entire stream is read)
+            */
+            static ByteBuffer CalculateCRC32C(Aws::IOStream& stream);
+
             static int HashString(const char* strToHash);
 
         };
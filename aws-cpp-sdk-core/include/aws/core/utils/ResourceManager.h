@@ -60,6 +60,27 @@ namespace Aws
                 return resource;
             }
 
+            /**
+             * Non-blocking version of Acquire(). If a resource is available, it is handed out with exclusive ownership
+             * and true is returned. Otherwise resource is left untouched and false is returned.
+             *
+             * @param resource receives the acquired resource on success
+             * @return true if a resource was acquired
+             */
+            bool TryAcquire(RESOURCE_TYPE& resource)
+            {
+                std::lock_guard<std::mutex> locker(m_queueLock);
+                if (m_shutdown.load() || m_resources.size() == 0)
+                {
+                    return false;
+                }
+
+                resource = m_resources.back();
+                m_resources.pop_back();
+
+                return true;
+            }
+
             /**
              * Returns whether or not resources are currently available for acquisition
              *
@@ -0,0 +1,102 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/Outcome.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * CRC32 (ISO-HDLC polynomial, as used by zlib and x-amz-checksum-crc32) checksum.
+             * The digest is the 4 byte big-endian checksum.
+             */
+            class AWS_CORE_API CRC32 : public Hash
+            {
+            public:
+                CRC32();
+                virtual ~CRC32() = default;
+
+                /**
+                * Calculates a CRC32 checksum
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates a CRC32 checksum on a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                /**
+                * Feeds data into a running CRC32 checksum
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Returns the CRC32 checksum of all data passed to Update() and resets it
+                */
+                virtual HashResult GetHash() override;
+
+            private:
+
+                uint32_t m_runningCrc;
+            };
+
+            /**
+             * CRC32C (Castagnoli polynomial, as used by x-amz-checksum-crc32c) checksum. Uses the SSE4.2 / ARMv8 crc32c
+             * instructions when the build targets them. The digest is the 4 byte big-endian checksum.
+             */
+            class AWS_CORE_API CRC32C : public Hash
+            {
+            public:
+                CRC32C();
+                virtual ~CRC32C() = default;
+
+                /**
+                * Calculates a CRC32C checksum
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates a CRC32C checksum on a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                /**
+                * Feeds data into a running CRC32C checksum
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Returns the CRC32C checksum of all data passed to Update() and resets it
+                */
+                virtual HashResult GetHash() override;
+
+            private:
+
+                uint32_t m_runningCrc;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
+
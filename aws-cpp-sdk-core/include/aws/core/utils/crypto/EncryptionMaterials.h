@@ -30,7 +30,9 @@ namespace Aws
             enum class CryptoErrors
             {
                 ENCRYPT_CONTENT_ENCRYPTION_KEY_FAILED,
-                DECRYPT_CONTENT_ENCRYPTION_KEY_FAILED
+                DECRYPT_CONTENT_ENCRYPTION_KEY_FAILED,
+                ENCRYPT_CONTENT_FAILED,
+                DECRYPT_CONTENT_FAILED
             };
 
             typedef Outcome<Aws::NoResult, Aws::Client::AWSError<CryptoErrors>> CryptoOutcome;
@@ -46,8 +46,24 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) = 0;
 
+                /**
+                * Feeds bufferSize bytes from buffer into a running Hash digest. Call GetHash() once all data has been fed to
+                * retrieve the digest; this lets callers hash data produced in pieces without first concatenating it.
+                * The default implementation buffers the data and hashes it in GetHash(); implementations override this
+                * to digest incrementally.
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize);
+
+                /**
+                * Returns the digest of all data fed through Update() since the last call, and resets the running digest.
+                */
+                virtual HashResult GetHash();
+
                 // when hashing streams, this is the size of our internal buffer we read the stream into
                 static const uint32_t INTERNAL_HASH_STREAM_BUFFER_SIZE = 8192;
+
+            private:
+                Aws::String m_pendingData;
             };
 
             /**
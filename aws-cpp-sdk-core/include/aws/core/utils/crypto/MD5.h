@@ -65,6 +65,16 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                * Feeds data into a running MD5 digest
+                */
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Returns the MD5 digest of all data passed to Update() and resets it
+                */
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr<Hash> m_hashImpl;
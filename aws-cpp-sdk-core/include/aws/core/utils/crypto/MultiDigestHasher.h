@@ -0,0 +1,109 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        }
+
+        namespace Crypto
+        {
+            enum class DigestAlgorithm
+            {
+                SHA256,
+                MD5,
+                CRC32,
+                CRC32C
+            };
+
+            /**
+             * Computes several digests of the same data while reading it only once, e.g. the SHA256 payload hash for signing
+             * together with the Content-MD5 of a request body.
+             *
+             * SHA256 and MD5 are inherently sequential, so a single digest cannot be split across threads. When an executor
+             * is supplied, the digests of each chunk are instead computed side by side on the executor's threads while the
+             * next chunk is read from the stream. The calling thread also picks up digest work, so this never deadlocks on a
+             * busy or bounded executor.
+             *
+             * Instances are not thread safe.
+             */
+            class AWS_CORE_API MultiDigestHasher
+            {
+            public:
+                MultiDigestHasher();
+
+                /**
+                 * Digests of a stream are computed in parallel on executor.
+                 */
+                explicit MultiDigestHasher(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor);
+
+                /**
+                 * Adds a digest to compute. Adding an algorithm twice has no effect.
+                 */
+                void AddDigest(DigestAlgorithm algorithm);
+
+                /**
+                 * Whether the digest was requested via AddDigest().
+                 */
+                bool HasDigest(DigestAlgorithm algorithm) const;
+
+                /**
+                 * Reads the entire stream once, feeding every requested digest, then restores the stream position.
+                 * Returns false if any of the digests could not be computed.
+                 */
+                bool Calculate(Aws::IStream& stream);
+
+                /**
+                 * Returns the digest computed by the last Calculate(), or an empty buffer if it was not requested or failed.
+                 */
+                const ByteBuffer& GetDigest(DigestAlgorithm algorithm) const;
+
+                // size of the chunks read from the stream when digests are computed on the calling thread only
+                static const uint32_t SERIAL_CHUNK_SIZE = 64 * 1024;
+                // size of the chunks read from the stream when digests are computed in parallel
+                static const uint32_t PARALLEL_CHUNK_SIZE = 1024 * 1024;
+
+            private:
+                struct Digest
+                {
+                    DigestAlgorithm m_algorithm;
+                    std::shared_ptr<Hash> m_hash;
+                    ByteBuffer m_result;
+                };
+
+                void CalculateSerially(Aws::IStream& stream);
+                void CalculateInParallel(Aws::IStream& stream);
+
+                Aws::Vector<Digest> m_digests;
+                std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
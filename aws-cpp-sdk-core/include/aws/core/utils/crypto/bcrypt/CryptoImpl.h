@@ -78,6 +78,14 @@ namespace Aws
                  * Calculates a Hash on the stream without loading the entire stream into memory at once.
                  */
                 HashResult Calculate(Aws::IStream& stream);
+                /**
+                 * Feeds data into a running hash, which is created on first use.
+                 */
+                void Update(unsigned char* buffer, size_t bufferSize);
+                /**
+                 * Finishes the running hash started by Update() and returns its digest.
+                 */
+                HashResult GetHash();
 
             private:
 
@@ -94,6 +102,11 @@ namespace Aws
                 DWORD m_hashObjectLength;
                 PBYTE m_hashObject;
 
+                // the running hash used by Update()/GetHash(); its hash object is owned by bcrypt so it
+                // does not collide with m_hashObject used by the one shot Calculate() calls.
+                BCRYPT_HASH_HANDLE m_runningHashHandle;
+                bool m_runningHashFailed;
+
                 //I'm 99% sure the algorithm handle for windows is not thread safe, but I can't 
                 //prove or disprove that theory. Therefore, we have to lock to be safe.
                 std::mutex m_algorithmMutex;
@@ -120,6 +133,10 @@ namespace Aws
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
             private:
                 BCryptHashImpl m_impl;
             };
@@ -145,6 +162,10 @@ namespace Aws
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
             private:
                 BCryptHashImpl m_impl;
             };
@@ -19,6 +19,7 @@
 #include <aws/core/utils/crypto/HMAC.h>
 #include <aws/core/utils/crypto/SecureRandom.h>
 #include <aws/core/utils/crypto/Cipher.h>
+#include <CommonCrypto/CommonDigest.h>
 
 struct _CCCryptor;
 
@@ -58,25 +59,38 @@ namespace Aws
             {
             public:
 
-                MD5CommonCryptoImpl() {}
+                MD5CommonCryptoImpl() { CC_MD5_Init(&m_ctx); }
                 virtual ~MD5CommonCryptoImpl() {}
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                CC_MD5_CTX m_ctx;
             };
 
             class Sha256CommonCryptoImpl : public Hash
             {
             public:
 
-                Sha256CommonCryptoImpl() {}
+                Sha256CommonCryptoImpl() { CC_SHA256_Init(&m_ctx); }
                 virtual ~Sha256CommonCryptoImpl() {}
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                CC_SHA256_CTX m_ctx;
             };
 
             class Sha256HMACCommonCryptoImpl : public HMAC
@@ -69,28 +69,41 @@ namespace Aws
             {
             public:
 
-                MD5OpenSSLImpl()
-                { }
+                MD5OpenSSLImpl();
 
-                virtual ~MD5OpenSSLImpl() = default;
+                virtual ~MD5OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                // running digest for Update()/GetHash(), created on the first Update()
+                EVP_MD_CTX* m_ctx;
             };
 
             class Sha256OpenSSLImpl : public Hash
             {
             public:
-                Sha256OpenSSLImpl()
-                { }
+                Sha256OpenSSLImpl();
 
-                virtual ~Sha256OpenSSLImpl() = default;
+                virtual ~Sha256OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                // running digest for Update()/GetHash(), created on the first Update()
+                EVP_MD_CTX* m_ctx;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
@@ -0,0 +1,295 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/DateTime.h>
+
+#include <memory>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            enum class JsonToken
+            {
+                BEGIN_OBJECT,
+                END_OBJECT,
+                BEGIN_ARRAY,
+                END_ARRAY,
+                NAME,
+                STRING,
+                NUMBER,
+                BOOLEAN,
+                NULL_VALUE,
+                END_DOCUMENT,
+                PARSE_ERROR
+            };
+
+            /**
+             * Pull parser that tokenizes a JSON document straight from a stream, a chunk at a time, without building a
+             * document tree. Names and string values are unescaped into a buffer that can be moved out, so a value is
+             * copied only once on its way into a model object.
+             *
+             * Once a token is PARSE_ERROR every following call returns PARSE_ERROR, see GetErrorMessage().
+             */
+            class AWS_CORE_API JsonReader
+            {
+            public:
+                /**
+                 * The stream must outlive the reader, which reads it from its current position.
+                 */
+                JsonReader(Aws::IStream& stream);
+
+                JsonReader(const JsonReader&) = delete;
+                JsonReader& operator=(const JsonReader&) = delete;
+
+                /**
+                 * Consumes and returns the next token.
+                 */
+                JsonToken Next();
+
+                /**
+                 * Returns the next token without consuming it. The value accessors already describe the peeked token.
+                 */
+                JsonToken Peek();
+
+                /**
+                 * Name of the last NAME token. Reading the member's value may overwrite it for nested objects.
+                 */
+                inline const Aws::String& GetName() const { return m_name; }
+
+                /**
+                 * Unescaped value of the last STRING token, or the text of the last NUMBER token.
+                 */
+                inline const Aws::String& GetValue() const { return m_value; }
+
+                /**
+                 * Moves the value of the last STRING or NUMBER token out of the reader.
+                 */
+                inline Aws::String TakeValue() { return std::move(m_value); }
+
+                /**
+                 * Value of the last BOOLEAN token.
+                 */
+                inline bool GetBool() const { return m_bool; }
+
+                /**
+                 * Value of the last NUMBER token.
+                 */
+                double GetDouble() const;
+
+                /**
+                 * Value of the last NUMBER token, truncated if it isn't an integer.
+                 */
+                long long GetInt64() const;
+
+                /**
+                 * Consumes the next value, including everything nested in it.
+                 */
+                bool SkipValue();
+
+                /**
+                 * Finishes the value that starts with token, which has already been consumed: skips the rest of an
+                 * object or array, and is a no-op for scalars. Used to ignore values of an unexpected type.
+                 */
+                bool SkipValue(JsonToken token);
+
+                /**
+                 * Consumes the next value, which should be an object, calling
+                 * bool onMember(JsonReader& reader, const Aws::String& name) for every member. onMember must consume
+                 * exactly one value and return false only to abort. A null is treated as an empty object and values of
+                 * other types are skipped.
+                 */
+                template<typename MemberHandler>
+                bool ReadObject(MemberHandler&& onMember)
+                {
+                    JsonToken token = Next();
+                    if (token != JsonToken::BEGIN_OBJECT)
+                    {
+                        return SkipValue(token);
+                    }
+
+                    for (;;)
+                    {
+                        token = Next();
+                        if (token == JsonToken::END_OBJECT)
+                        {
+                            return true;
+                        }
+                        if (token != JsonToken::NAME || !onMember(*this, static_cast<const Aws::String&>(m_name)))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                /**
+                 * Consumes the next value, which should be an array, calling bool onElement(JsonReader& reader) for
+                 * every element. onElement must consume exactly one value and return false only to abort. A null is
+                 * treated as an empty array and values of other types are skipped.
+                 */
+                template<typename ElementHandler>
+                bool ReadArray(ElementHandler&& onElement)
+                {
+                    JsonToken token = Next();
+                    if (token != JsonToken::BEGIN_ARRAY)
+                    {
+                        return SkipValue(token);
+                    }
+
+                    for (;;)
+                    {
+                        token = Peek();
+                        if (token == JsonToken::END_ARRAY)
+                        {
+                            Next();
+                            return true;
+                        }
+                        if (token == JsonToken::PARSE_ERROR || !onElement(*this))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                inline bool WasParseSuccessful() const { return m_state != State::FAILED; }
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                enum class State
+                {
+                    VALUE,
+                    FIRST_NAME_OR_END,
+                    NAME,
+                    FIRST_VALUE_OR_END,
+                    COMMA_OR_END,
+                    DONE,
+                    FAILED
+                };
+
+                JsonToken ReadToken();
+                JsonToken ReadValue(int c);
+                JsonToken EndContainer(char container);
+                JsonToken EndScalar(JsonToken token);
+                JsonToken Fail(const char* reason);
+
+                int PeekChar();
+                int GetChar();
+                int SkipWhitespace();
+                bool Refill();
+                bool ReadString(Aws::String& out);
+                bool ReadEscape(Aws::String& out);
+                bool ReadHex4(unsigned& codePoint);
+                bool ReadNumber();
+                bool ReadLiteral(const char* literal);
+
+                Aws::IStream& m_stream;
+                Aws::Vector<char> m_buffer;
+                size_t m_position;
+                size_t m_end;
+                size_t m_consumed;
+
+                State m_state;
+                // '{' or '[' for every open container
+                Aws::Vector<char> m_containers;
+                bool m_hasPeeked;
+                JsonToken m_peeked;
+
+                Aws::String m_name;
+                Aws::String m_value;
+                bool m_bool;
+                Aws::String m_errorMessage;
+            };
+
+            /**
+             * Readers for the member types of generated models, reached through JsonReader from a model's ReadJson().
+             * Each consumes exactly one value and leaves the target untouched for a null or a value of another type.
+             * They return false only if the document can't be parsed.
+             */
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, Aws::String& value);
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, bool& value);
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, int& value);
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, long long& value);
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, double& value);
+            /**
+             * Blobs are base64 encoded strings.
+             */
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, ByteBuffer& value);
+            /**
+             * Timestamps are seconds since the epoch, or ISO 8601 strings.
+             */
+            AWS_CORE_API bool ReadJsonValue(JsonReader& reader, Aws::Utils::DateTime& value);
+
+            template<typename T>
+            bool ReadJsonValue(JsonReader& reader, Aws::Vector<T>& value);
+            template<typename T>
+            bool ReadJsonValue(JsonReader& reader, Aws::Map<Aws::String, T>& value);
+            template<typename T>
+            bool ReadJsonValue(JsonReader& reader, std::shared_ptr<T>& value);
+
+            /**
+             * Structures read themselves.
+             */
+            template<typename T>
+            auto ReadJsonValue(JsonReader& reader, T& value) -> decltype(value.ReadJson(reader))
+            {
+                return value.ReadJson(reader);
+            }
+
+            template<typename T>
+            bool ReadJsonValue(JsonReader& reader, Aws::Vector<T>& value)
+            {
+                return reader.ReadArray([&value](JsonReader& elementReader) -> bool
+                {
+                    value.emplace_back();
+                    return ReadJsonValue(elementReader, value.back());
+                });
+            }
+
+            template<typename T>
+            bool ReadJsonValue(JsonReader& reader, Aws::Map<Aws::String, T>& value)
+            {
+                return reader.ReadObject([&value](JsonReader& memberReader, const Aws::String& name) -> bool
+                {
+                    return ReadJsonValue(memberReader, value[name]);
+                });
+            }
+
+            template<typename T>
+            bool ReadJsonValue(JsonReader& reader, std::shared_ptr<T>& value)
+            {
+                if (reader.Peek() == JsonToken::NULL_VALUE)
+                {
+                    reader.Next();
+                    value = nullptr;
+                    return true;
+                }
+                value = Aws::MakeShared<T>("JsonReader");
+                return ReadJsonValue(reader, *value);
+            }
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
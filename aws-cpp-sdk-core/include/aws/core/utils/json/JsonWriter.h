@@ -0,0 +1,162 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/DateTime.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            // holds the text of a JsonWriter, defined in JsonWriter.cpp.
+            struct JsonWriterBuffer;
+
+            /**
+             * Writes compact JSON text token by token, escaping names and strings as they are appended, without building
+             * a document tree. Commas and colons are inserted automatically; the caller is responsible for balancing
+             * objects and arrays and for writing a name before every value in an object.
+             *
+             * The text is written into a per-thread buffer that keeps its capacity from one writer to the next, so
+             * serializing a payload doesn't keep reallocating as it grows. A writer created while another one is alive
+             * on the same thread uses a buffer of its own.
+             */
+            class AWS_CORE_API JsonWriter
+            {
+            public:
+                JsonWriter();
+                ~JsonWriter();
+
+                JsonWriter(const JsonWriter&) = delete;
+                JsonWriter& operator=(const JsonWriter&) = delete;
+
+                void WriteStartObject();
+                void WriteEndObject();
+                void WriteStartArray();
+                void WriteEndArray();
+
+                void WriteName(const char* name);
+                void WriteName(const Aws::String& name);
+
+                void WriteString(const char* value);
+                void WriteString(const Aws::String& value);
+                void WriteBool(bool value);
+                void WriteInt64(long long value);
+                /**
+                 * NaN and infinity can't be represented in JSON and are written as null.
+                 */
+                void WriteDouble(double value);
+                void WriteNull();
+
+                /**
+                 * Returns a copy of the text written so far.
+                 */
+                Aws::String GetOutput() const;
+
+                /**
+                 * Length of the text written so far.
+                 */
+                size_t GetLength() const;
+
+            private:
+                void BeginValue();
+                void WriteEscaped(const char* value, size_t length);
+
+                // either the per-thread buffer or, for a nested writer, one allocated for this writer.
+                JsonWriterBuffer* m_output;
+                bool m_usesThreadBuffer;
+                bool m_needsComma;
+            };
+
+            /**
+             * Writers for the member types of generated models, reached through JsonWriter from a model's WriteJson().
+             */
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, const Aws::String& value);
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, bool value);
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, int value);
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, long long value);
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, double value);
+            /**
+             * Blobs are written as base64 encoded strings.
+             */
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, const ByteBuffer& value);
+            /**
+             * Timestamps are written as seconds since the epoch.
+             */
+            AWS_CORE_API void WriteJsonValue(JsonWriter& writer, const Aws::Utils::DateTime& value);
+
+            template<typename T>
+            void WriteJsonValue(JsonWriter& writer, const Aws::Vector<T>& value);
+            template<typename T>
+            void WriteJsonValue(JsonWriter& writer, const Aws::Map<Aws::String, T>& value);
+            template<typename T>
+            void WriteJsonValue(JsonWriter& writer, const std::shared_ptr<T>& value);
+
+            /**
+             * Structures write themselves.
+             */
+            template<typename T>
+            auto WriteJsonValue(JsonWriter& writer, const T& value) -> decltype(value.WriteJson(writer))
+            {
+                return value.WriteJson(writer);
+            }
+
+            template<typename T>
+            void WriteJsonValue(JsonWriter& writer, const Aws::Vector<T>& value)
+            {
+                writer.WriteStartArray();
+                for (const auto& element : value)
+                {
+                    WriteJsonValue(writer, element);
+                }
+                writer.WriteEndArray();
+            }
+
+            template<typename T>
+            void WriteJsonValue(JsonWriter& writer, const Aws::Map<Aws::String, T>& value)
+            {
+                writer.WriteStartObject();
+                for (const auto& entry : value)
+                {
+                    writer.WriteName(entry.first);
+                    WriteJsonValue(writer, entry.second);
+                }
+                writer.WriteEndObject();
+            }
+
+            template<typename T>
+            void WriteJsonValue(JsonWriter& writer, const std::shared_ptr<T>& value)
+            {
+                if (value)
+                {
+                    WriteJsonValue(writer, *value);
+                }
+                else
+                {
+                    writer.WriteNull();
+                }
+            }
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,163 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <memory>
+#include <streambuf>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A file opened read only for positional reads. Reads never move a shared file position, so one instance can be read
+             * from several threads at once.
+             */
+            class AWS_CORE_API ReadOnlyFile
+            {
+            public:
+                ReadOnlyFile(const Aws::String& path);
+                ~ReadOnlyFile();
+
+                ReadOnlyFile(const ReadOnlyFile&) = delete;
+                ReadOnlyFile& operator=(const ReadOnlyFile&) = delete;
+
+                bool IsOpen() const;
+
+                /**
+                 * Reads up to length bytes starting at offset into buffer. Returns the number of bytes read, 0 at the end of the file
+                 * and -1 on failure.
+                 */
+                int64_t ReadAt(uint64_t offset, char* buffer, std::size_t length) const;
+
+                /**
+                 * Gets the time the file was last written, to the second. Returns false on failure.
+                 */
+                bool GetLastModified(Aws::Utils::DateTime& lastModified) const;
+
+            private:
+#ifdef _WIN32
+                void* m_handle;
+#else
+                int m_fd;
+#endif
+            };
+
+            /**
+             * A file opened write only for positional writes, created if it doesn't exist but never truncated on open. Writes never move a
+             * shared file position, so one instance can be written from several threads at once, as long as they write distinct ranges.
+             */
+            class AWS_CORE_API WritableFile
+            {
+            public:
+                WritableFile(const Aws::String& path);
+                ~WritableFile();
+
+                WritableFile(const WritableFile&) = delete;
+                WritableFile& operator=(const WritableFile&) = delete;
+
+                bool IsOpen() const;
+
+                /**
+                 * Sets the size of the file to size bytes, reserving the disk space for all of it up front where the platform can.
+                 */
+                bool Allocate(uint64_t size);
+
+                /**
+                 * Writes length bytes from buffer starting at offset. Returns false on failure.
+                 */
+                bool WriteAt(uint64_t offset, const char* buffer, std::size_t length) const;
+
+                /**
+                 * Blocks until everything written so far is on stable storage. Returns false on failure.
+                 */
+                bool Sync() const;
+
+            private:
+#ifdef _WIN32
+                void* m_handle;
+#else
+                int m_fd;
+#endif
+            };
+
+            /**
+             * This is a read only stream buf over [rangeBegin, rangeBegin + rangeLength) of a file. Bulk reads go from the file straight
+             * into the caller's buffer, so reading a range through this stream costs no copy beyond the one into the reader's own buffer;
+             * only single character reads go through a small internal buffer. Seeking is supported within the range.
+             */
+            class AWS_CORE_API FileRangeStreamBuf : public std::streambuf
+            {
+            public:
+                FileRangeStreamBuf(const std::shared_ptr<const ReadOnlyFile>& file, uint64_t rangeBegin, uint64_t rangeLength);
+
+                FileRangeStreamBuf(const FileRangeStreamBuf&) = delete;
+                FileRangeStreamBuf& operator=(const FileRangeStreamBuf&) = delete;
+
+            protected:
+                int_type underflow() override;
+                std::streamsize xsgetn(char_type* s, std::streamsize n) override;
+                std::streamsize showmanyc() override;
+
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                static const std::size_t GET_BUFFER_SIZE = 4096;
+
+                std::shared_ptr<const ReadOnlyFile> m_file;
+                const uint64_t m_rangeBegin;
+                const uint64_t m_rangeLength;
+                // offset into the range of the byte following the get area.
+                uint64_t m_readPosition;
+                char m_getBuffer[GET_BUFFER_SIZE];
+            };
+
+            /**
+             * This is a write only stream buf over [rangeBegin, rangeBegin + rangeLength) of a file. It holds no buffer: every write goes
+             * straight to the file at its offset, so a response body written to this stream lands in the file with no intermediate copy.
+             * Writes past the end of the range fail. Seeking is supported within the range.
+             */
+            class AWS_CORE_API FileRangeWriteStreamBuf : public std::streambuf
+            {
+            public:
+                FileRangeWriteStreamBuf(const std::shared_ptr<const WritableFile>& file, uint64_t rangeBegin, uint64_t rangeLength);
+
+                FileRangeWriteStreamBuf(const FileRangeWriteStreamBuf&) = delete;
+                FileRangeWriteStreamBuf& operator=(const FileRangeWriteStreamBuf&) = delete;
+
+            protected:
+                int_type overflow(int_type c) override;
+                std::streamsize xsputn(const char_type* s, std::streamsize n) override;
+
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                std::shared_ptr<const WritableFile> m_file;
+                const uint64_t m_rangeBegin;
+                const uint64_t m_rangeLength;
+                uint64_t m_writePosition;
+            };
+        }
+    }
+}
@@ -20,6 +20,7 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/threading/ExecutorTask.h>
 #include <functional>
 #include <future>
 #include <mutex>
@@ -43,13 +44,22 @@ namespace Aws
                 virtual ~Executor() = default;
 
                 /**
-                 * Send function and its arguments to the SubmitToThread function.
+                 * Send function to the SubmitTask function. Callables that fit in ExecutorTask's inline storage are
+                 * handed over without a heap allocation.
                  */
-                template<class Fn, class ... Args>
-                bool Submit(Fn&& fn, Args&& ... args)
+                template<class Fn>
+                bool Submit(Fn&& fn)
                 {
-                    std::function<void()> callable{ std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...) };
-                    return SubmitToThread(std::move(callable));
+                    return SubmitTask(ExecutorTask(std::forward<Fn>(fn)));
+                }
+
+                /**
+                 * Send function and its arguments to the SubmitTask function.
+                 */
+                template<class Fn, class Arg, class ... Args>
+                bool Submit(Fn&& fn, Arg&& arg, Args&& ... args)
+                {
+                    return SubmitTask(ExecutorTask(std::bind(std::forward<Fn>(fn), std::forward<Arg>(arg), std::forward<Args>(args)...)));
                 }
 
             protected:
@@ -57,6 +67,12 @@ namespace Aws
                 * To implement your own executor implementation, then simply subclass Executor and implement this method.
                 */
                 virtual bool SubmitToThread(std::function<void()>&&) = 0;
+
+                /**
+                * Executors which can store move-only tasks should override this to avoid the std::function wrapping.
+                * The default implementation hands the task to SubmitToThread().
+                */
+                virtual bool SubmitTask(ExecutorTask&& task);
             };
 
 
@@ -74,6 +90,8 @@ namespace Aws
                     Free, Locked, Shutdown
                 };
                 bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitTask(ExecutorTask&& task) override;
+                void RunTask(ExecutorTask task);
                 void Detach(std::thread::id id);
                 std::atomic<State> m_state;
                 Aws::UnorderedMap<std::thread::id, std::thread> m_threads;
@@ -105,9 +123,10 @@ namespace Aws
 
             protected:
                 bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitTask(ExecutorTask&& task) override;
 
             private:
-                Aws::Queue<std::function<void()>*> m_tasks;
+                Aws::Queue<ExecutorTask> m_tasks;
                 std::mutex m_queueLock;
                 Aws::Utils::Threading::Semaphore m_sync;
                 Aws::Vector<ThreadTask*> m_threadTaskHandles;
@@ -115,9 +134,9 @@ namespace Aws
                 OverflowPolicy m_overflowPolicy;
 
                 /**
-                 * Once you call this, you are responsible for freeing the memory pointed to by task.
+                 * Moves the oldest queued task into task. Returns false if there was none.
                  */
-                std::function<void()>* PopTask();
+                bool PopTask(ExecutorTask& task);
                 bool HasTasks();
 
                 friend class ThreadTask;
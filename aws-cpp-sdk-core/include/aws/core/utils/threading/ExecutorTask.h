@@ -0,0 +1,181 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <type_traits>
+#include <utility>
+#include <new>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Move-only, type-erased void() callable used by executors to store submitted work.
+            * Callables up to INLINE_STORAGE_SIZE bytes are stored inline, so submitting them does not allocate. Larger callables are
+            * moved to the heap. The buffer holds a closure of a few pointers, shared_ptrs and a std::function, such as the completion
+            * callback of an asynchronous operation that captures the client, the shared request, the handler and the context.
+            * Closures that copy a whole request are larger and take the heap path.
+            * Any return value of the callable is discarded.
+            */
+            class ExecutorTask
+            {
+            public:
+                static const size_t INLINE_STORAGE_SIZE = 128;
+
+                ExecutorTask() : m_operations(nullptr) {}
+
+                template<typename Fn, typename = typename std::enable_if<!std::is_same<typename std::decay<Fn>::type, ExecutorTask>::value>::type>
+                ExecutorTask(Fn&& fn) : m_operations(nullptr)
+                {
+                    typedef typename std::decay<Fn>::type Callable;
+                    Construct<Callable>(std::forward<Fn>(fn), std::integral_constant<bool, FitsInline<Callable>::value>());
+                }
+
+                ExecutorTask(ExecutorTask&& other) : m_operations(other.m_operations)
+                {
+                    if (m_operations)
+                    {
+                        m_operations->move(&other.m_storage, &m_storage);
+                        other.m_operations = nullptr;
+                    }
+                }
+
+                ExecutorTask& operator=(ExecutorTask&& other)
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        if (other.m_operations)
+                        {
+                            other.m_operations->move(&other.m_storage, &m_storage);
+                            m_operations = other.m_operations;
+                            other.m_operations = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+
+                ExecutorTask(const ExecutorTask&) = delete;
+                ExecutorTask& operator=(const ExecutorTask&) = delete;
+
+                ~ExecutorTask()
+                {
+                    Reset();
+                }
+
+                /**
+                * Runs the task. Must not be called on an empty task.
+                */
+                void operator()()
+                {
+                    m_operations->invoke(&m_storage);
+                }
+
+                explicit operator bool() const { return m_operations != nullptr; }
+
+                /**
+                * True if a callable of type Callable is stored inline rather than on the heap.
+                */
+                template<typename Callable>
+                static constexpr bool IsStoredInline()
+                {
+                    return FitsInline<typename std::decay<Callable>::type>::value;
+                }
+
+                /**
+                * Destroys the stored callable, leaving the task empty.
+                */
+                void Reset()
+                {
+                    if (m_operations)
+                    {
+                        m_operations->destroy(&m_storage);
+                        m_operations = nullptr;
+                    }
+                }
+
+            private:
+                typedef typename std::aligned_storage<INLINE_STORAGE_SIZE>::type Storage;
+
+                struct Operations
+                {
+                    void (*invoke)(void* storage);
+                    void (*move)(void* from, void* to);
+                    void (*destroy)(void* storage);
+                };
+
+                template<typename Callable>
+                struct FitsInline : std::integral_constant<bool, sizeof(Callable) <= sizeof(Storage) &&
+                    std::alignment_of<Callable>::value <= std::alignment_of<Storage>::value &&
+                    std::is_move_constructible<Callable>::value> {};
+
+                template<typename Callable>
+                struct InlineOperations
+                {
+                    static void Invoke(void* storage) { (*static_cast<Callable*>(storage))(); }
+                    static void Move(void* from, void* to)
+                    {
+                        new (to) Callable(std::move(*static_cast<Callable*>(from)));
+                        static_cast<Callable*>(from)->~Callable();
+                    }
+                    static void Destroy(void* storage) { static_cast<Callable*>(storage)->~Callable(); }
+                    static const Operations s_operations;
+                };
+
+                template<typename Callable>
+                struct HeapOperations
+                {
+                    static void Invoke(void* storage) { (**static_cast<Callable**>(storage))(); }
+                    static void Move(void* from, void* to) { *static_cast<Callable**>(to) = *static_cast<Callable**>(from); }
+                    static void Destroy(void* storage) { Aws::Delete(*static_cast<Callable**>(storage)); }
+                    static const Operations s_operations;
+                };
+
+                template<typename Callable, typename Fn>
+                void Construct(Fn&& fn, std::true_type /*fitsInline*/)
+                {
+                    new (&m_storage) Callable(std::forward<Fn>(fn));
+                    m_operations = &InlineOperations<Callable>::s_operations;
+                }
+
+                template<typename Callable, typename Fn>
+                void Construct(Fn&& fn, std::false_type /*fitsInline*/)
+                {
+                    *reinterpret_cast<Callable**>(&m_storage) = Aws::New<Callable>("ExecutorTask", std::forward<Fn>(fn));
+                    m_operations = &HeapOperations<Callable>::s_operations;
+                }
+
+                Storage m_storage;
+                const Operations* m_operations;
+            };
+
+            template<typename Callable>
+            const ExecutorTask::Operations ExecutorTask::InlineOperations<Callable>::s_operations =
+                { &ExecutorTask::InlineOperations<Callable>::Invoke, &ExecutorTask::InlineOperations<Callable>::Move, &ExecutorTask::InlineOperations<Callable>::Destroy };
+
+            template<typename Callable>
+            const ExecutorTask::Operations ExecutorTask::HeapOperations<Callable>::s_operations =
+                { &ExecutorTask::HeapOperations<Callable>::Invoke, &ExecutorTask::HeapOperations<Callable>::Move, &ExecutorTask::HeapOperations<Callable>::Destroy };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,91 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/threading/ExecutorTask.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Runs tasks after a delay without holding a thread per pending task. Timers are kept in a hashed wheel of
+            * slotCount slots, each covering tickDuration; a single thread, started on the first Schedule(), advances the
+            * wheel and runs the due tasks. Scheduling and expiring a timer are O(1), and timers fire at most one tick late.
+            *
+            * Tasks run on the wheel's thread and delay every other timer while they run, so anything more than a few
+            * microseconds of work should be handed to an executor from the task.
+            *
+            * Timers still pending when the wheel is destroyed are cancelled: their task is dropped and their cancellation task,
+            * if one was given, runs instead. Cancellation tasks run on the wheel's thread before the destructor returns (a timer
+            * scheduled while the wheel is being destroyed is cancelled right away on the scheduling thread), so they must not use
+            * anything the wheel's owner is tearing down.
+            */
+            class AWS_CORE_API TimerWheel
+            {
+            public:
+                TimerWheel(std::chrono::milliseconds tickDuration = std::chrono::milliseconds(10), size_t slotCount = 512);
+                ~TimerWheel();
+
+                TimerWheel(const TimerWheel&) = delete;
+                TimerWheel& operator =(const TimerWheel&) = delete;
+                TimerWheel(TimerWheel&&) = delete;
+                TimerWheel& operator =(TimerWheel&&) = delete;
+
+                /**
+                * Runs task once delay has elapsed, rounded up to whole ticks. If the wheel is destroyed first, onCancel runs instead.
+                */
+                void Schedule(std::chrono::milliseconds delay, ExecutorTask&& task, ExecutorTask&& onCancel = ExecutorTask());
+
+                /**
+                * Number of timers that have not fired yet.
+                */
+                size_t GetPendingTimers() const;
+
+            private:
+                struct Timer
+                {
+                    uint64_t m_expiryTick;
+                    ExecutorTask m_task;
+                    ExecutorTask m_onCancel;
+                };
+
+                void Run();
+                uint64_t CurrentTick() const;
+                void CollectDueTimers(uint64_t tick, Aws::Vector<ExecutorTask>& dueTasks);
+
+                std::chrono::steady_clock::time_point m_start;
+                std::chrono::milliseconds m_tickDuration;
+                Aws::Vector<Aws::Vector<Timer>> m_slots;
+                // last tick whose slot has been processed
+                uint64_t m_currentTick;
+                size_t m_pendingTimers;
+                bool m_stopping;
+                std::thread m_thread;
+                mutable std::mutex m_lock;
+                std::condition_variable m_timerScheduled;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,94 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Thread pool executor built for high fan-out on many-core hosts. Each worker owns a lock-free deque; tasks submitted
+            * from a worker go to its own deque, other submissions go through a bounded lock-free injection queue. Idle workers
+            * steal from the other workers' deques before going to sleep, so no single lock is shared by submitters and workers.
+            *
+            * queueCapacity bounds the injection queue (rounded up to a power of two). When it is full, OverflowPolicy::REJECT_IMMEDIATELY
+            * makes Submit() return false; otherwise the submitting thread is blocked until a worker frees up space. A worker
+            * submitting into a full executor runs the task itself instead of blocking.
+            *
+            * If pinThreadsToProcessors is set, worker i is pinned to processor (i % number of processors) where the platform supports it.
+            *
+            * Use it for the SDK by setting ClientConfiguration::executor.
+            */
+            class AWS_CORE_API WorkStealingThreadExecutor : public Executor
+            {
+            public:
+                WorkStealingThreadExecutor(size_t poolSize, size_t queueCapacity = 4096,
+                    OverflowPolicy overflowPolicy = OverflowPolicy::QUEUE_TASKS_EVENLY_ACCROSS_THREADS,
+                    bool pinThreadsToProcessors = false);
+                ~WorkStealingThreadExecutor();
+
+                /**
+                * Rule of 5 stuff.
+                * Don't copy or move
+                */
+                WorkStealingThreadExecutor(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor& operator =(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor(WorkStealingThreadExecutor&&) = delete;
+                WorkStealingThreadExecutor& operator =(WorkStealingThreadExecutor&&) = delete;
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitTask(ExecutorTask&& task) override;
+
+            private:
+                class InjectionQueue;
+                class WorkerDeque;
+                struct Worker;
+
+                void RunWorker(Worker* worker);
+                bool FindTask(Worker* worker, ExecutorTask& task);
+                bool HasVisibleTasks() const;
+                void WakeOneWorker();
+                void NotifySpaceAvailable();
+
+                InjectionQueue* m_injectionQueue;
+                Aws::Vector<Worker*> m_workers;
+                OverflowPolicy m_overflowPolicy;
+                bool m_pinThreadsToProcessors;
+                std::atomic<bool> m_running;
+
+                std::mutex m_sleepLock;
+                std::condition_variable m_sleepSignal;
+                std::atomic<size_t> m_sleepingWorkers;
+
+                std::mutex m_spaceLock;
+                std::condition_variable m_spaceSignal;
+                std::atomic<size_t> m_blockedSubmitters;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,280 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/DateTime.h>
+
+#include <cstring>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            /**
+             * A run of characters inside the document held by an XmlReader, valid for as long as the reader is.
+             */
+            class AWS_CORE_API XmlStringView
+            {
+            public:
+                XmlStringView() : m_data(nullptr), m_length(0) {}
+                XmlStringView(const char* data, size_t length) : m_data(data), m_length(length) {}
+
+                inline const char* GetData() const { return m_data; }
+                inline size_t GetLength() const { return m_length; }
+                inline bool IsEmpty() const { return m_length == 0; }
+
+                /**
+                 * The view without leading and trailing whitespace.
+                 */
+                XmlStringView Trim() const;
+
+                inline Aws::String ToString() const { return m_length ? Aws::String(m_data, m_length) : Aws::String(); }
+
+                inline bool operator==(const char* other) const
+                {
+                    return std::strncmp(m_data ? m_data : "", other, m_length) == 0 && other[m_length] == '\0';
+                }
+                inline bool operator!=(const char* other) const { return !(*this == other); }
+
+                inline bool operator==(const XmlStringView& other) const
+                {
+                    return m_length == other.m_length && (m_length == 0 || std::memcmp(m_data, other.m_data, m_length) == 0);
+                }
+
+            private:
+                const char* m_data;
+                size_t m_length;
+            };
+
+            enum class XmlToken
+            {
+                START_ELEMENT,
+                END_ELEMENT,
+                TEXT,
+                END_DOCUMENT,
+                PARSE_ERROR
+            };
+
+            /**
+             * Pull parser over an XML document, without building a document tree. The document is read into one buffer
+             * and everything the reader returns points into it: element names are never copied, and character
+             * references and CDATA sections are decoded in place. The XML declaration, comments, processing
+             * instructions and the doctype are skipped; attributes are parsed but not exposed.
+             *
+             * Once a token is PARSE_ERROR every following call returns PARSE_ERROR, see GetErrorMessage().
+             */
+            class AWS_CORE_API XmlReader
+            {
+            public:
+                /**
+                 * Reads the stream from its current position to the end.
+                 */
+                XmlReader(Aws::IStream& stream);
+
+                XmlReader(const XmlReader&) = delete;
+                XmlReader& operator=(const XmlReader&) = delete;
+
+                /**
+                 * Consumes and returns the next token. An empty element, <a/>, is a START_ELEMENT followed by an
+                 * END_ELEMENT.
+                 */
+                XmlToken Next();
+
+                /**
+                 * Name of the last START_ELEMENT or END_ELEMENT token.
+                 */
+                inline const XmlStringView& GetName() const { return m_name; }
+
+                /**
+                 * Decoded character data of the last TEXT token. One element's text may arrive as several TEXT tokens,
+                 * split around comments and CDATA sections.
+                 */
+                inline const XmlStringView& GetText() const { return m_text; }
+
+                /**
+                 * Consumes the rest of the element whose START_ELEMENT was just returned, setting text to all of its
+                 * character data. Child elements are skipped.
+                 */
+                bool ReadText(XmlStringView& text);
+
+                /**
+                 * Consumes the rest of the element whose START_ELEMENT was just returned, including its children.
+                 */
+                bool SkipElement();
+
+                /**
+                 * Consumes the rest of the element whose START_ELEMENT was just returned, calling
+                 * bool onChild(XmlReader& reader, const XmlStringView& name) for every child element. onChild must
+                 * consume the child, for instance through ReadText() or SkipElement(), and return false only to abort.
+                 */
+                template<typename ChildHandler>
+                bool ReadChildren(ChildHandler&& onChild)
+                {
+                    for (;;)
+                    {
+                        switch (Next())
+                        {
+                            case XmlToken::START_ELEMENT:
+                            {
+                                XmlStringView name = m_name;
+                                if (!onChild(*this, name))
+                                {
+                                    return false;
+                                }
+                                break;
+                            }
+                            case XmlToken::TEXT:
+                                break;
+                            case XmlToken::END_ELEMENT:
+                                return true;
+                            default:
+                                return false;
+                        }
+                    }
+                }
+
+                /**
+                 * Consumes the root element, calling onChild for each of its children, see ReadChildren().
+                 */
+                template<typename ChildHandler>
+                bool ReadDocument(ChildHandler&& onChild)
+                {
+                    return Next() == XmlToken::START_ELEMENT && ReadChildren(std::forward<ChildHandler>(onChild));
+                }
+
+                inline bool WasParseSuccessful() const { return m_state != State::FAILED; }
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                enum class State
+                {
+                    PROLOG,
+                    CONTENT,
+                    EPILOG,
+                    FAILED
+                };
+
+                XmlToken ReadStartElement();
+                XmlToken ReadEndElement();
+                XmlToken ReadCharacterData();
+                XmlToken ReadCData();
+                XmlToken EndElement(XmlStringView name);
+                XmlToken Fail(const char* reason);
+
+                bool StartsWith(const char* markup) const;
+                bool SkipPast(const char* terminator);
+                bool SkipDoctype();
+                void SkipWhitespace();
+                XmlStringView ReadName();
+                char* Decode(char* begin, char* end);
+
+                Aws::String m_document;
+                size_t m_position;
+
+                State m_state;
+                Aws::Vector<XmlStringView> m_openElements;
+                bool m_pendingEnd;
+
+                XmlStringView m_name;
+                XmlStringView m_text;
+                Aws::String m_errorMessage;
+            };
+
+            /**
+             * Readers for the member types of generated models, reached through XmlReader from a model's ReadXml().
+             * Each consumes the element whose START_ELEMENT was just returned and parses its trimmed text the way the
+             * XmlNode based deserializers do. They return false only if the document can't be parsed.
+             */
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, Aws::String& value);
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, bool& value);
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, int& value);
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, long long& value);
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, double& value);
+            /**
+             * Blobs are base64 encoded.
+             */
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, ByteBuffer& value);
+            /**
+             * Timestamps are ISO 8601.
+             */
+            AWS_CORE_API bool ReadXmlValue(XmlReader& reader, Aws::Utils::DateTime& value);
+
+            /**
+             * Enums, through their mapper's GetXForName().
+             */
+            template<typename T>
+            bool ReadXmlValue(XmlReader& reader, T& value, T (*getForName)(const Aws::String&))
+            {
+                XmlStringView text;
+                if (!reader.ReadText(text))
+                {
+                    return false;
+                }
+                value = getForName(text.Trim().ToString());
+                return true;
+            }
+
+            /**
+             * Structures read themselves.
+             */
+            template<typename T>
+            auto ReadXmlValue(XmlReader& reader, T& value) -> decltype(value.ReadXml(reader))
+            {
+                return value.ReadXml(reader);
+            }
+
+            /**
+             * Lists that wrap their elements, each named memberName, in an element of their own. Other children of
+             * the wrapper are skipped.
+             */
+            template<typename T>
+            bool ReadXmlList(XmlReader& reader, const char* memberName, Aws::Vector<T>& value)
+            {
+                return reader.ReadChildren([memberName, &value](XmlReader& childReader, const XmlStringView& name) -> bool
+                {
+                    if (name != memberName)
+                    {
+                        return childReader.SkipElement();
+                    }
+                    value.emplace_back();
+                    return ReadXmlValue(childReader, value.back());
+                });
+            }
+
+            template<typename T>
+            bool ReadXmlList(XmlReader& reader, const char* memberName, Aws::Vector<T>& value, T (*getForName)(const Aws::String&))
+            {
+                return reader.ReadChildren([memberName, &value, getForName](XmlReader& childReader, const XmlStringView& name) -> bool
+                {
+                    if (name != memberName)
+                    {
+                        return childReader.SkipElement();
+                    }
+                    value.emplace_back();
+                    return ReadXmlValue(childReader, value.back(), getForName);
+                });
+            }
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
@@ -16,6 +16,7 @@
 #include <aws/core/auth/AWSAuthSigner.h>
 
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/platform/Security.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
@@ -35,6 +36,8 @@
 #include <iomanip>
 #include <math.h>
 #include <cstring>
+#include <cctype>
+#include <algorithm>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -64,6 +67,15 @@ static const char* LONG_DATE_FORMAT_STR = "%Y%m%dT%H%M%SZ";
 static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
 static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
 
+// signing scratch buffers that grew beyond this (e.g. for a request with huge headers) are released rather than kept per thread.
+static const size_t MAX_RETAINED_SIGNING_BUFFER_SIZE = 64 * 1024;
+// the canonical headers are hashed whenever this much of them has been generated.
+static const size_t SIGNING_HASH_CHUNK_SIZE = 4 * 1024;
+// length of the yyyymmdd prefix of a long (yyyymmddThhmmssZ) date.
+static const size_t SIMPLE_DATE_LENGTH = 8;
+// distinct (credentials, day, region, service) signing keys kept by one signer; the least recently added is evicted first.
+static const size_t MAX_CACHED_SIGNING_KEYS = 8;
+
 static const char v4LogTag[] = "AWSAuthV4Signer";
 static const char v4StreamingLogTag[] = "AWSAuthEventStreamV4Signer";
 
@@ -80,11 +92,11 @@ namespace Aws
     }
 }
 
-static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath)
+template<typename STRING>
+static void AppendCanonicalRequestPrefix(HttpRequest& request, bool urlEscapePath, STRING& buffer)
 {
     request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
+    buffer.append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
 
     URI uriCpy = request.GetUri();
     // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
@@ -96,29 +108,37 @@ static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool u
         auto rfc3986EncodedPath = URI::URLEncodePathRFC3986(uriCpy.GetPath());
         uriCpy.SetPath(rfc3986EncodedPath);
         // However, SignatureV4 uses this URL encoding scheme
-        signingStringStream << NEWLINE << uriCpy.GetURLEncodedPath() << NEWLINE;
+        auto encodedPath = uriCpy.GetURLEncodedPath();
+        buffer.append(NEWLINE).append(encodedPath.c_str(), encodedPath.size()).append(NEWLINE);
     }
     else
     {
         // For the services that DO decode the URL first; we don't need to double encode it.
         uriCpy.SetPath(uriCpy.GetURLEncodedPath());
-        signingStringStream << NEWLINE << uriCpy.GetPath() << NEWLINE;
+        const Aws::String& path = uriCpy.GetPath();
+        buffer.append(NEWLINE).append(path.c_str(), path.size()).append(NEWLINE);
     }
 
-    if (request.GetQueryString().find('=') != std::string::npos)
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.find('=') != std::string::npos)
     {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
+        buffer.append(queryString.c_str() + 1, queryString.size() - 1).append(NEWLINE);
     }
-    else if (request.GetQueryString().size() > 1)
+    else if (queryString.size() > 1)
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
+        buffer.append(queryString.c_str() + 1, queryString.size() - 1).append("=").append(NEWLINE);
     }
     else
     {
-        signingStringStream << NEWLINE;
+        buffer.append(NEWLINE);
     }
+}
 
-    return signingStringStream.str();
+static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath)
+{
+    Aws::String signingString;
+    AppendCanonicalRequestPrefix(request, urlEscapePath, signingString);
+    return signingString;
 }
 
 static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollection&& headers)
@@ -155,6 +175,188 @@ static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollecti
     return canonicalHeaders;
 }
 
+// same definition of white space as StringUtils::Trim, so the streaming path canonicalizes exactly like CanonicalizeHeaders.
+static bool IsSigningSpace(char c)
+{
+    int ch = c;
+    if (ch < -1 || ch > 255)
+    {
+        return false;
+    }
+    return ::isspace(ch) != 0;
+}
+
+static bool HasTrimmedHeaderNames(const Http::HeaderValueCollection& headers)
+{
+    for (const auto& header : headers)
+    {
+        if (!header.first.empty() && (IsSigningSpace(header.first.front()) || IsSigningSpace(header.first.back())))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Appends the canonical form of a header value to buffer without intermediate strings: the value is trimmed, lines are
+ * trimmed and joined with ',' and runs of spaces are collapsed to one, the same as CanonicalizeHeaders does.
+ */
+static void AppendCanonicalHeaderValue(const Aws::String& value, std::string& buffer)
+{
+    const char* begin = value.c_str();
+    const char* end = begin + strlen(begin);
+    while (begin < end && IsSigningSpace(*begin))
+    {
+        ++begin;
+    }
+    while (end > begin && IsSigningSpace(*(end - 1)))
+    {
+        --end;
+    }
+
+    bool firstLine = true;
+    char previous = '\0';
+    while (begin < end)
+    {
+        const char* lineEnd = std::find(begin, end, '\n');
+        if (lineEnd != begin)
+        {
+            const char* lineBegin = begin;
+            const char* lineLast = lineEnd;
+            if (!firstLine)
+            {
+                while (lineBegin < lineLast && IsSigningSpace(*lineBegin))
+                {
+                    ++lineBegin;
+                }
+                while (lineLast > lineBegin && IsSigningSpace(*(lineLast - 1)))
+                {
+                    --lineLast;
+                }
+                buffer.push_back(',');
+                previous = ',';
+            }
+
+            for (const char* current = lineBegin; current < lineLast; ++current)
+            {
+                if (*current != ' ' || previous != ' ')
+                {
+                    buffer.push_back(*current);
+                }
+                previous = *current;
+            }
+            firstLine = false;
+        }
+
+        if (lineEnd == end)
+        {
+            break;
+        }
+        begin = lineEnd + 1;
+    }
+}
+
+template<typename STRING>
+static void AppendHex(const ByteBuffer& bytes, STRING& buffer)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    for (size_t i = 0; i < bytes.GetLength(); ++i)
+    {
+        buffer.push_back(HEX_DIGITS[bytes[i] >> 4]);
+        buffer.push_back(HEX_DIGITS[bytes[i] & 0x0f]);
+    }
+}
+
+namespace
+{
+    /**
+     * Per thread scratch space for AWSAuthV4Signer::SignRequest. The canonical request is generated into one buffer a chunk at a time,
+     * after which the buffer holds the signed headers list and the string to sign. It keeps its capacity from one request to the next,
+     * and the credential scope is rebuilt only when the date, region or service changes.
+     * These are std::strings on purpose: thread locals can outlive Aws::ShutdownAPI, so they must not allocate from the SDK's memory system.
+     */
+    struct SigV4SigningScratch
+    {
+        std::string m_buffer;
+        std::string m_scopeDate;
+        std::string m_scopeRegion;
+        std::string m_scopeService;
+        std::string m_scope;
+    };
+}
+
+static SigV4SigningScratch& GetSigningScratch()
+{
+    static thread_local SigV4SigningScratch scratch;
+    return scratch;
+}
+
+static const std::string& GetCredentialScope(SigV4SigningScratch& scratch, const Aws::String& longDate, const Aws::String& region,
+        const Aws::String& serviceName)
+{
+    size_t dateLength = (std::min)(longDate.size(), SIMPLE_DATE_LENGTH);
+    if (scratch.m_scope.empty() || scratch.m_scopeDate.compare(0, std::string::npos, longDate.c_str(), dateLength) != 0 ||
+        scratch.m_scopeRegion.compare(region.c_str()) != 0 || scratch.m_scopeService.compare(serviceName.c_str()) != 0)
+    {
+        scratch.m_scopeDate.assign(longDate.c_str(), dateLength);
+        scratch.m_scopeRegion.assign(region.c_str(), region.size());
+        scratch.m_scopeService.assign(serviceName.c_str(), serviceName.size());
+        scratch.m_scope.clear();
+        scratch.m_scope.append(scratch.m_scopeDate).append("/").append(scratch.m_scopeRegion).append("/").append(scratch.m_scopeService)
+            .append("/").append(AWS4_REQUEST);
+    }
+    return scratch.m_scope;
+}
+
+/**
+ * Immutable set of derived signing keys. Once published through m_signingKeys a snapshot is never modified, so signing threads can
+ * search it without synchronization beyond the atomic load of the pointer, which also keeps it alive for as long as they use a key of it.
+ */
+struct AWSAuthV4Signer::SigningKeySnapshot
+{
+    ~SigningKeySnapshot()
+    {
+        // the entries hold secret keys and keys derived from them, don't leave them behind in freed memory.
+        for (auto& entry : m_entries)
+        {
+            if (!entry.m_secretKey.empty())
+            {
+                Aws::Security::SecureMemClear(reinterpret_cast<unsigned char*>(&entry.m_secretKey[0]), entry.m_secretKey.size());
+            }
+            if (entry.m_signingKey.GetLength() > 0)
+            {
+                Aws::Security::SecureMemClear(entry.m_signingKey.GetUnderlyingData(), entry.m_signingKey.GetLength());
+            }
+        }
+    }
+
+    struct Entry
+    {
+        Aws::String m_secretKey;
+        Aws::String m_simpleDate;
+        Aws::String m_region;
+        Aws::String m_serviceName;
+        ByteBuffer m_signingKey;
+    };
+
+    const ByteBuffer* Find(const Aws::String& secretKey, const Aws::String& simpleDate, const Aws::String& region,
+            const Aws::String& serviceName) const
+    {
+        for (const auto& entry : m_entries)
+        {
+            if (entry.m_simpleDate == simpleDate && entry.m_region == region && entry.m_serviceName == serviceName &&
+                entry.m_secretKey == secretKey)
+            {
+                return &entry.m_signingKey;
+            }
+        }
+        return nullptr;
+    }
+
+    Aws::Vector<Entry> m_entries;
+};
+
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
     const char* serviceName, const Aws::String& region, PayloadSigningPolicy signingPolicy, bool urlEscapePath) :
     m_includeSha256HashHeader(true),
@@ -173,13 +375,18 @@ AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvi
 
 AWSAuthV4Signer::~AWSAuthV4Signer()
 {
-    // empty destructor in .cpp file to keep from needing the implementation of (AWSCredentialsProvider, Sha256, Sha256HMAC) in the header file 
+    // destructor in .cpp file to keep from needing the implementation of (AWSCredentialsProvider, Sha256, Sha256HMAC) in the header file
 }
 
 
 bool AWSAuthV4Signer::ShouldSignHeader(const Aws::String& header) const
 {
-    return m_unsignedHeaders.find(Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
+    // header names are normally lower case already, only pay for a lower cased copy when they are not.
+    if (std::any_of(header.begin(), header.end(), [](char c) { return c >= 'A' && c <= 'Z'; }))
+    {
+        return m_unsignedHeaders.find(Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
+    }
+    return m_unsignedHeaders.find(header) == m_unsignedHeaders.cend();
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
@@ -203,21 +410,7 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
     }
 
     Aws::String payloadHash(UNSIGNED_PAYLOAD);
-    switch(m_payloadSigningPolicy)
-    {
-        case PayloadSigningPolicy::Always:
-            signBody = true;
-            break;
-        case PayloadSigningPolicy::Never:
-            signBody = false;
-            break;
-        case PayloadSigningPolicy::RequestDependent:
-            // respect the request setting
-        default:
-            break;
-    }
-
-    if(signBody || request.GetUri().GetScheme() != Http::Scheme::HTTPS)
+    if (SignsPayload(request, signBody))
     {
         payloadHash = ComputePayloadHash(request);
         if (payloadHash.empty())
@@ -241,69 +434,122 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
     Aws::String dateHeaderValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
+    SigV4SigningScratch& scratch = GetSigningScratch();
+    std::string& buffer = scratch.m_buffer;
+    if (buffer.capacity() > MAX_RETAINED_SIGNING_BUFFER_SIZE)
     {
-        if(ShouldSignHeader(header.first))
+        std::string().swap(buffer);
+    }
+    buffer.clear();
+
+    //the canonical request is hashed a piece at a time as it is generated, so it is never held as a whole.
+    Utils::Crypto::Sha256 canonicalRequestHash;
+    auto logSystem = Aws::Utils::Logging::GetLogSystem();
+    const bool logCanonicalRequest = logSystem && logSystem->GetLogLevel() >= Aws::Utils::Logging::LogLevel::Debug;
+    Aws::String canonicalRequest;
+    auto hashBuffer = [&](size_t length)
+    {
+        if (logCanonicalRequest)
         {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
+            canonicalRequest.append(buffer.c_str(), length);
         }
-    }
+        canonicalRequestHash.Update(reinterpret_cast<unsigned char*>(&buffer[0]), length);
+    };
 
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
+    //generate generalized canonicalized request string.
+    AppendCanonicalRequestPrefix(request, m_urlEscapePath, buffer);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
+    Http::HeaderValueCollection headersCopy;
+    const Http::HeaderValueCollection* headers = request.PeekHeaders();
+    if (!headers)
     {
-        signedHeadersValue.pop_back();
+        headersCopy = request.GetHeaders();
+        headers = &headersCopy;
+    }
+    if (!HasTrimmedHeaderNames(*headers))
+    {
+        headersCopy = CanonicalizeHeaders(Http::HeaderValueCollection(*headers));
+        headers = &headersCopy;
     }
 
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+    //canonical headers, then the signed headers list.
+    for (const auto& header : *headers)
+    {
+        if(ShouldSignHeader(header.first))
+        {
+            buffer.append(header.first.c_str(), header.first.size()).append(":");
+            AppendCanonicalHeaderValue(header.second, buffer);
+            buffer.append(NEWLINE);
+            if (buffer.size() >= SIGNING_HASH_CHUNK_SIZE)
+            {
+                hashBuffer(buffer.size());
+                buffer.clear();
+            }
+        }
+    }
+    buffer.append(NEWLINE);
+    hashBuffer(buffer.size());
+    buffer.clear();
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+    //the signed headers list stays at the front of the buffer for the authorization header.
+    bool firstSignedHeader = true;
+    for (const auto& header : *headers)
+    {
+        if(ShouldSignHeader(header.first))
+        {
+            if (!firstSignedHeader)
+            {
+                buffer.append(";");
+            }
+            buffer.append(header.first.c_str(), header.first.size());
+            firstSignedHeader = false;
+        }
+    }
+    const size_t signedHeadersLength = buffer.size();
 
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
+    buffer.append(NEWLINE);
+    buffer.append(payloadHash.c_str(), payloadHash.size());
+    hashBuffer(buffer.size());
 
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequest);
 
-    //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = canonicalRequestHash.GetHash();
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string");
-        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequestString << "\"");
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "The request string is: \"" << canonicalRequest << "\"");
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-    Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
+    //the string to sign goes in the same buffer, right after the canonical request.
+    const std::string& scope = GetCredentialScope(scratch, dateHeaderValue, m_region, m_serviceName);
+    const size_t stringToSignBegin = buffer.size();
+    buffer.append(AWS_HMAC_SHA256).append(NEWLINE).append(dateHeaderValue.c_str(), dateHeaderValue.size()).append(NEWLINE).append(scope).append(NEWLINE);
+    AppendHex(hashResult.GetResult(), buffer);
 
-    Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash, m_region,
-            m_serviceName);
-    auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << buffer.c_str() + stringToSignBegin);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    auto key = ComputeHash(credentials.GetAWSSecretKey(), Aws::String(scratch.m_scopeDate.c_str(), scratch.m_scopeDate.size()));
+    auto signatureResult = m_HMAC->Calculate(ByteBuffer(reinterpret_cast<unsigned char*>(&buffer[stringToSignBegin]),
+            buffer.size() - stringToSignBegin), *key);
+    if (!signatureResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string");
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "The final string is: \"" << buffer.c_str() + stringToSignBegin << "\"");
+        return false;
+    }
+
+    const Aws::String& accessKeyId = credentials.GetAWSAccessKeyId();
+    Aws::String awsAuthString;
+    awsAuthString.reserve(strlen(AWS_HMAC_SHA256) + accessKeyId.size() + scope.size() + signedHeadersLength + 2 * signatureResult.GetResult().GetLength() + 64);
+    awsAuthString.append(AWS_HMAC_SHA256).append(" ").append(CREDENTIAL).append(EQ).append(accessKeyId).append("/").append(scope.c_str(), scope.size())
+        .append(", ").append(SIGNED_HEADERS).append(EQ).append(buffer.c_str(), signedHeadersLength)
+        .append(", ").append(SIGNATURE).append(EQ);
+    AppendHex(signatureResult.GetResult(), awsAuthString);
 
-    auto awsAuthString = ss.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
-    request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
+    request.SetSigningAccessKey(accessKeyId);
     request.SetSigningRegion(m_region);
     return true;
 }
@@ -438,14 +684,14 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
         const Aws::String& simpleDate) const
 {
     auto key = ComputeHash(credentials.GetAWSSecretKey(), simpleDate);
-    return GenerateSignature(stringToSign, key);
+    return GenerateSignature(stringToSign, *key);
 }
 
 Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials, const Aws::String& stringToSign,
         const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
 {
-    auto key = ComputeHash(credentials.GetAWSSecretKey(), simpleDate, region, serviceName);
-    return GenerateSignature(stringToSign, key);
+    auto key = GetSigningKey(credentials.GetAWSSecretKey(), simpleDate, region, serviceName);
+    return GenerateSignature(stringToSign, *key);
 }
 
 Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign, const ByteBuffer& key) const
@@ -471,6 +717,25 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
     return finalSigningHash;
 }
 
+bool AWSAuthV4Signer::SignsPayload(const Aws::Http::HttpRequest& request, bool signBody) const
+{
+    switch(m_payloadSigningPolicy)
+    {
+        case PayloadSigningPolicy::Always:
+            signBody = true;
+            break;
+        case PayloadSigningPolicy::Never:
+            signBody = false;
+            break;
+        case PayloadSigningPolicy::RequestDependent:
+            // respect the request setting
+        default:
+            break;
+    }
+
+    return signBody || request.GetUri().GetScheme() != Http::Scheme::HTTPS;
+}
+
 Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request) const
 {
     if (!request.GetContentBody())
@@ -479,6 +744,12 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
         return EMPTY_STRING_SHA256;
     }
 
+    if (!request.GetContentSha256().empty())
+    {
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "Using payload sha256 computed along with the other digests of the body.");
+        return request.GetContentSha256();
+    }
+
     //compute hash on payload if it exists.
     auto hashResult =  m_hash->Calculate(*request.GetContentBody());
 
@@ -513,21 +784,57 @@ Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue,
     return ss.str();
 }
 
-ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const
+std::shared_ptr<const ByteBuffer> AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const
+{
+    return GetSigningKey(secretKey, simpleDate, m_region, m_serviceName);
+}
+
+std::shared_ptr<const ByteBuffer> AWSAuthV4Signer::GetSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate,
+        const Aws::String& region, const Aws::String& serviceName) const
 {
-    Utils::Threading::ReaderLockGuard guard(m_partialSignatureLock);
-    if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
+    // the returned key shares ownership of its snapshot, so it stays valid however soon the snapshot is replaced.
+    std::shared_ptr<const SigningKeySnapshot> snapshot = std::atomic_load(&m_signingKeys);
+    const ByteBuffer* signingKey = snapshot ? snapshot->Find(secretKey, simpleDate, region, serviceName) : nullptr;
+    if (signingKey)
     {
-        guard.UpgradeToWriterLock();
-        // check again to prevent racing writers
-        if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
+        return std::shared_ptr<const ByteBuffer>(snapshot, signingKey);
+    }
+
+    std::lock_guard<std::mutex> locker(m_signingKeysWriteLock);
+    // another thread may have published this key while we waited.
+    snapshot = std::atomic_load(&m_signingKeys);
+    signingKey = snapshot ? snapshot->Find(secretKey, simpleDate, region, serviceName) : nullptr;
+    if (signingKey)
+    {
+        return std::shared_ptr<const ByteBuffer>(snapshot, signingKey);
+    }
+
+    SigningKeySnapshot::Entry entry;
+    entry.m_signingKey = ComputeHash(secretKey, simpleDate, region, serviceName);
+    if (entry.m_signingKey.GetLength() == 0)
+    {
+        // don't cache a failed derivation, the error has been logged already.
+        return Aws::MakeShared<ByteBuffer>(v4LogTag);
+    }
+    entry.m_secretKey = secretKey;
+    entry.m_simpleDate = simpleDate;
+    entry.m_region = region;
+    entry.m_serviceName = serviceName;
+
+    auto newSnapshot = Aws::MakeShared<SigningKeySnapshot>(v4LogTag);
+    newSnapshot->m_entries.reserve(MAX_CACHED_SIGNING_KEYS);
+    newSnapshot->m_entries.push_back(std::move(entry));
+    if (snapshot)
+    {
+        for (size_t i = 0; i < snapshot->m_entries.size() && newSnapshot->m_entries.size() < MAX_CACHED_SIGNING_KEYS; ++i)
         {
-            m_currentSecretKey = secretKey;
-            m_currentDateStr = simpleDate;
-            m_partialSignature = ComputeHash(m_currentSecretKey, m_currentDateStr, m_region, m_serviceName);
+            newSnapshot->m_entries.push_back(snapshot->m_entries[i]);
         }
     }
-    return m_partialSignature;
+
+    std::shared_ptr<const SigningKeySnapshot> published = newSnapshot;
+    std::atomic_store(&m_signingKeys, published);
+    return std::shared_ptr<const ByteBuffer>(published, &published->m_entries.front().m_signingKey);
 }
 
 Aws::Utils::ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey,
@@ -25,6 +25,7 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/FileSystemUtils.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <string.h>
@@ -223,7 +224,8 @@ static const char* INSTANCE_LOG_TAG = "InstanceProfileCredentialsProvider";
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
         m_ec2MetadataConfigLoader(Aws::MakeShared<Aws::Config::EC2InstanceProfileConfigLoader>(INSTANCE_LOG_TAG)),
-        m_loadFrequencyMs(refreshRateMs)
+        m_loadFrequencyMs(refreshRateMs),
+        m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
 }
@@ -232,7 +234,8 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refr
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std::shared_ptr<Aws::Config::EC2InstanceProfileConfigLoader>& loader,
                                                                        long refreshRateMs) :
         m_ec2MetadataConfigLoader(loader),
-        m_loadFrequencyMs(refreshRateMs)
+        m_loadFrequencyMs(refreshRateMs),
+        m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
 }
@@ -240,16 +243,7 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std
 
 AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
-
-    if(profileIter != m_ec2MetadataConfigLoader->GetProfiles().end())
-    {
-        return profileIter->second.GetCredentials();
-    }
-
-    return AWSCredentials();
+    return m_refreshAheadCredentials.GetCredentials();
 }
 
 void InstanceProfileCredentialsProvider::Reload()
@@ -259,21 +253,16 @@ void InstanceProfileCredentialsProvider::Reload()
     AWSCredentialsProvider::Reload();
 }
 
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+void InstanceProfileCredentialsProvider::LoadCredentials(AWSCredentials& credentials, DateTime& expiration)
 {
-    AWS_LOGSTREAM_DEBUG(INSTANCE_LOG_TAG, "Checking if latest credential pull has expired.");
-    ReaderLockGuard guard(m_reloadLock);
-    if (!IsTimeToRefresh(m_loadFrequencyMs))
-    {
-        return;
-    }
-
-    guard.UpgradeToWriterLock();
-    if (!IsTimeToRefresh(m_loadFrequencyMs)) // double-checked lock to avoid refreshing twice
+    WriterLockGuard guard(m_reloadLock);
+    Reload();
+    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
+    if(profileIter != m_ec2MetadataConfigLoader->GetProfiles().end())
     {
-        return; 
+        credentials = profileIter->second.GetCredentials();
     }
-    Reload();
+    expiration = DateTime::Now() + std::chrono::milliseconds(m_loadFrequencyMs);
 }
 
 static const char TASK_ROLE_LOG_TAG[] = "TaskRoleCredentialsProvider";
@@ -282,7 +271,8 @@ TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* URI, long r
     m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, URI)),
     m_loadFrequencyMs(refreshRateMs),
     m_expirationDate(DateTime::Now()),
-    m_credentials(Aws::Auth::AWSCredentials())
+    m_credentials(Aws::Auth::AWSCredentials()),
+    m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
@@ -292,7 +282,8 @@ TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, c
                 endpoint, token)),
     m_loadFrequencyMs(refreshRateMs),
     m_expirationDate(DateTime::Now()),
-    m_credentials(Aws::Auth::AWSCredentials())
+    m_credentials(Aws::Auth::AWSCredentials()),
+    m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
@@ -302,21 +293,15 @@ TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(
     m_ecsCredentialsClient(client),
     m_loadFrequencyMs(refreshRateMs),
     m_expirationDate(DateTime::Now()),
-    m_credentials(Aws::Auth::AWSCredentials())
+    m_credentials(Aws::Auth::AWSCredentials()),
+    m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
 
 AWSCredentials TaskRoleCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    return m_credentials;
-}
-
-bool TaskRoleCredentialsProvider::ExpiresSoon() const
-{
-    return (m_expirationDate.Millis() - Aws::Utils::DateTime::Now().Millis() < EXPIRATION_GRACE_PERIOD);
+    return m_refreshAheadCredentials.GetCredentials();
 }
 
 void TaskRoleCredentialsProvider::Reload()
@@ -347,29 +332,20 @@ void TaskRoleCredentialsProvider::Reload()
     AWSCredentialsProvider::Reload();
 }
 
-void TaskRoleCredentialsProvider::RefreshIfExpired()
+void TaskRoleCredentialsProvider::LoadCredentials(AWSCredentials& credentials, DateTime& expiration)
 {
-    AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Checking if latest credential pull has expired.");
-    ReaderLockGuard guard(m_reloadLock);
-    if (!IsTimeToRefresh(m_loadFrequencyMs) && !ExpiresSoon())
-    {
-        return;
-    }
-
-    guard.UpgradeToWriterLock();
-
-    if (!IsTimeToRefresh(m_loadFrequencyMs) && !ExpiresSoon())
-    {
-        return;
-    }
-
+    WriterLockGuard guard(m_reloadLock);
     Reload();
+    credentials = m_credentials;
+    // reloaded every m_loadFrequencyMs, and shortly before the credentials expire
+    expiration = (std::min)(DateTime::Now() + std::chrono::milliseconds(m_loadFrequencyMs), m_expirationDate - std::chrono::milliseconds(EXPIRATION_GRACE_PERIOD));
 }
 
 static const char PROCESS_LOG_TAG[] = "ProcessCredentialsProvider";
 ProcessCredentialsProvider::ProcessCredentialsProvider() :
     m_configFileLoader(GetConfigProfileFilename(), true),
-    m_expire(std::chrono::time_point<std::chrono::system_clock>::min())
+    m_expire(std::chrono::time_point<std::chrono::system_clock>::min()),
+    m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     auto profileFromVar = Aws::Environment::GetEnv(AWS_PROFILE_DEFAULT_ENV_VAR);
     if (profileFromVar.empty())
@@ -392,20 +368,15 @@ ProcessCredentialsProvider::ProcessCredentialsProvider() :
 ProcessCredentialsProvider::ProcessCredentialsProvider(const Aws::String& profile) :
     m_profileToUse(profile),
     m_configFileLoader(GetConfigProfileFilename(), true),
-    m_expire(std::chrono::time_point<std::chrono::system_clock>::min())
+    m_expire(std::chrono::time_point<std::chrono::system_clock>::min()),
+    m_refreshAheadCredentials([this](AWSCredentials& credentials, DateTime& expiration) { LoadCredentials(credentials, expiration); })
 {
     AWS_LOGSTREAM_INFO(PROCESS_LOG_TAG, "Setting process credentials provider to read config from " <<  m_profileToUse);
 }
 
 AWSCredentials ProcessCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    if (m_expire <= Aws::Utils::DateTime::Now())
-    {
-        return Aws::Auth::AWSCredentials();
-    }
-    return m_credentials;
+    return m_refreshAheadCredentials.GetCredentials();
 }
 
 
@@ -448,19 +419,13 @@ void ProcessCredentialsProvider::Reload()
     AWS_LOGSTREAM_DEBUG(PROCESS_LOG_TAG, "Successfully pulled credentials from process credential with AccessKey " << accessKey << ", Expiration:" << credentialsView.GetString("Expiration"));
 }
 
-void ProcessCredentialsProvider::RefreshIfExpired()
+void ProcessCredentialsProvider::LoadCredentials(AWSCredentials& credentials, DateTime& expiration)
 {
-    ReaderLockGuard guard(m_reloadLock);
+    WriterLockGuard guard(m_reloadLock);
+    Reload();
+    expiration = m_expire;
     if (Aws::Utils::DateTime::Now() < m_expire)
     {
-       return;
+        credentials = m_credentials;
     }
-
-    guard.UpgradeToWriterLock();
-    if (Aws::Utils::DateTime::Now() < m_expire) // double-checked lock to avoid refreshing twice
-    {
-        return;
-    }
-
-    Reload();
 }
@@ -18,6 +18,7 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <chrono>
 
 using namespace Aws::Auth;
 
@@ -26,18 +27,51 @@ static const char AWS_ECS_CONTAINER_CREDENTIALS_FULL_URI[] = "AWS_CONTAINER_CRED
 static const char AWS_ECS_CONTAINER_AUTHORIZATION_TOKEN[] = "AWS_CONTAINER_AUTHORIZATION_TOKEN";
 static const char AWS_EC2_METADATA_DISABLED[] = "AWS_EC2_METADATA_DISABLED";
 static const char DefaultCredentialsProviderChainTag[] = "DefaultAWSCredentialsProviderChain";
+static const char CredentialsProviderChainTag[] = "AWSCredentialsProviderChain";
+
+static long long MonotonicMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool HasCredentials(const AWSCredentials& credentials)
+{
+    return !credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty();
+}
 
 AWSCredentials AWSCredentialsProviderChain::GetAWSCredentials()
 {
-    for (auto&& credentialsProvider : m_providerChain)
+    int active = m_activeProvider.load(std::memory_order_acquire);
+    long long now = MonotonicMs();
+    if (active >= 0 && now - m_activeProviderSelectedMs.load(std::memory_order_relaxed) < REFRESH_THRESHOLD)
+    {
+        AWSCredentials credentials = m_providerChain[active]->GetAWSCredentials();
+        if (HasCredentials(credentials))
+        {
+            m_activeProviderHits.fetch_add(1, std::memory_order_relaxed);
+            return credentials;
+        }
+        AWS_LOGSTREAM_INFO(CredentialsProviderChainTag, "Active credentials provider " << active
+                << " returned empty credentials, walking the provider chain.");
+    }
+
+    m_chainWalks.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < m_providerChain.size(); ++i)
     {
-        AWSCredentials credentials = credentialsProvider->GetAWSCredentials();
-        if (!credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty())
+        AWSCredentials credentials = m_providerChain[i]->GetAWSCredentials();
+        if (HasCredentials(credentials))
         {
+            if (static_cast<int>(i) != active)
+            {
+                AWS_LOGSTREAM_DEBUG(CredentialsProviderChainTag, "Credentials provider " << i << " is now the active provider.");
+            }
+            m_activeProviderSelectedMs.store(now, std::memory_order_relaxed);
+            m_activeProvider.store(static_cast<int>(i), std::memory_order_release);
             return credentials;
         }
     }
 
+    m_activeProvider.store(-1, std::memory_order_release);
     return AWSCredentials("", "");
 }
 
@@ -0,0 +1,111 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/RefreshAheadCredentials.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+static const char* LOG_TAG = "RefreshAheadCredentials";
+static const long long MAX_REFRESH_WINDOW_MS = 5 * 60 * 1000;
+// keeps a refresh that didn't extend the credentials from being retried right away
+static const long long MIN_REFRESH_INTERVAL_MS = 1000;
+
+RefreshAheadCredentials::RefreshAheadCredentials(LoadFunction&& load) :
+    m_load(std::move(load)),
+    m_refreshing(false),
+    m_random(static_cast<unsigned>(std::chrono::steady_clock::now().time_since_epoch().count() ^ reinterpret_cast<uintptr_t>(this)))
+{
+}
+
+RefreshAheadCredentials::~RefreshAheadCredentials()
+{
+    if (m_refreshThread.joinable())
+    {
+        m_refreshThread.join();
+    }
+}
+
+AWSCredentials RefreshAheadCredentials::GetCredentials()
+{
+    std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&m_snapshot);
+    DateTime now = DateTime::Now();
+    if (snapshot && now < snapshot->expiration)
+    {
+        if (now >= snapshot->refreshAt)
+        {
+            // if the lock is taken, the credentials are being loaded already
+            std::unique_lock<std::mutex> locker(m_loadLock, std::try_to_lock);
+            if (locker.owns_lock() && !m_refreshing)
+            {
+                StartRefresh();
+            }
+        }
+        return snapshot->credentials;
+    }
+
+    std::lock_guard<std::mutex> locker(m_loadLock);
+    snapshot = std::atomic_load(&m_snapshot);
+    if (!snapshot || DateTime::Now() >= snapshot->expiration)
+    {
+        Load();
+        snapshot = std::atomic_load(&m_snapshot);
+    }
+    return snapshot->credentials;
+}
+
+void RefreshAheadCredentials::Load()
+{
+    auto snapshot = Aws::MakeShared<Snapshot>(LOG_TAG);
+    m_load(snapshot->credentials, snapshot->expiration);
+
+    snapshot->refreshAt = snapshot->expiration;
+    const DateTime now = DateTime::Now();
+    const long long lifetime = snapshot->expiration.Millis() - now.Millis();
+    if (lifetime > 0)
+    {
+        const long long window = (std::min)(lifetime / 4, MAX_REFRESH_WINDOW_MS);
+        const long long refreshIn = (std::max)(lifetime - std::uniform_int_distribution<long long>(window / 2, window)(m_random), MIN_REFRESH_INTERVAL_MS);
+        if (refreshIn < lifetime)
+        {
+            snapshot->refreshAt = now + std::chrono::milliseconds(refreshIn);
+        }
+    }
+    AWS_LOGSTREAM_DEBUG(LOG_TAG, "Loaded credentials expiring at " << snapshot->expiration.ToGmtString(DateFormat::ISO_8601)
+            << ", refreshing them from " << snapshot->refreshAt.ToGmtString(DateFormat::ISO_8601));
+    std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+}
+
+void RefreshAheadCredentials::StartRefresh()
+{
+    m_refreshing = true;
+    // the previous refresh has finished, it cleared m_refreshing
+    if (m_refreshThread.joinable())
+    {
+        m_refreshThread.join();
+    }
+
+    m_refreshThread = std::thread([this]
+    {
+        std::lock_guard<std::mutex> locker(m_loadLock);
+        AWS_LOGSTREAM_INFO(LOG_TAG, "Refreshing credentials ahead of their expiration.");
+        Load();
+        m_refreshing = false;
+    });
+}
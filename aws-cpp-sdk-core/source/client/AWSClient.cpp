@@ -22,28 +22,36 @@
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
 #include <aws/core/client/RetryStrategy.h>
+#include <aws/core/client/RetryTokenBucket.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/MultiDigestHasher.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/http/URI.h>
 #include <aws/core/monitoring/MonitoringManager.h>
 #include <aws/core/utils/event/EventStream.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/TimerWheel.h>
 
 #include <cstring>
 #include <cassert>
+#include <mutex>
+#include <condition_variable>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -75,6 +83,44 @@ static CoreErrors GuessBodylessErrorType(Aws::Http::HttpResponseCode responseCod
     }    
 }
 
+// Counts the callbacks of async requests running in the client. Once the client is stopped, no callback gets in anymore.
+struct AWSClient::AsyncRequestTracker
+{
+    AsyncRequestTracker() : m_stopped(false), m_running(0) {}
+
+    bool Enter()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_stopped)
+        {
+            return false;
+        }
+        m_running++;
+        return true;
+    }
+
+    void Leave()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (--m_running == 0)
+        {
+            m_signal.notify_all();
+        }
+    }
+
+    void Stop()
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        m_stopped = true;
+        m_signal.wait(locker, [this]() { return m_running == 0; });
+    }
+
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+    bool m_stopped;
+    size_t m_running;
+};
+
 AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     const std::shared_ptr<Aws::Client::AWSAuthSigner>& signer,
     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller) :
@@ -86,7 +132,11 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_executor(configuration.executor),
+    m_retryTokenBucket(Aws::MakeShared<RetryTokenBucket>(AWS_CLIENT_LOG_TAG, configuration.retryTokenBucketCapacity)),
+    m_asyncRequests(Aws::MakeShared<AsyncRequestTracker>(AWS_CLIENT_LOG_TAG)),
+    m_retryScheduler(Aws::MakeShared<Aws::Utils::Threading::TimerWheel>(AWS_CLIENT_LOG_TAG))
 {
 }
 
@@ -101,8 +151,22 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_executor(configuration.executor),
+    m_retryTokenBucket(Aws::MakeShared<RetryTokenBucket>(AWS_CLIENT_LOG_TAG, configuration.retryTokenBucketCapacity)),
+    m_asyncRequests(Aws::MakeShared<AsyncRequestTracker>(AWS_CLIENT_LOG_TAG)),
+    m_retryScheduler(Aws::MakeShared<Aws::Utils::Threading::TimerWheel>(AWS_CLIENT_LOG_TAG))
+{
+}
+
+AWSClient::~AWSClient()
 {
+    StopAsyncRequests();
+}
+
+void AWSClient::StopAsyncRequests()
+{
+    m_asyncRequests->Stop();
 }
 
 void AWSClient::DisableRequestProcessing() 
@@ -178,12 +242,14 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
     auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest);
 
+    unsigned retryTokens = 0;
     for (long retries = 0;; retries++)
     {
         outcome = AttemptOneRequest(httpRequest, request, signerName);
         coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
         if (outcome.IsSuccess())
         {
+            m_retryTokenBucket->ReleaseOnSuccess(retryTokens);
             Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome, coreMetrics, contexts);
             AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
             break;
@@ -207,6 +273,12 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
             break;
         }
 
+        if (!m_retryTokenBucket->AcquireForRetry(outcome.GetError(), retryTokens))
+        {
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed and the retry budget of the client is exhausted, not retrying.");
+            break;
+        }
+
         AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
         if(request.GetBody())
         {
@@ -237,12 +309,14 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
     auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), requestName, httpRequest);
 
+    unsigned retryTokens = 0;
     for (long retries = 0;; retries++)
     {
         outcome = AttemptOneRequest(httpRequest, signerName);
         coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
         if (outcome.IsSuccess())
         {
+            m_retryTokenBucket->ReleaseOnSuccess(retryTokens);
             Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), requestName, httpRequest, outcome, coreMetrics, contexts);
             AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
             break;
@@ -266,6 +340,12 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
             break;
         }
 
+        if (!m_retryTokenBucket->AcquireForRetry(outcome.GetError(), retryTokens))
+        {
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed and the retry budget of the client is exhausted, not retrying.");
+            break;
+        }
+
         AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
 
         if (shouldSleep)
@@ -288,21 +368,221 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 
 }
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
-    const Aws::AmazonWebServiceRequest& request, const char* signerName) const
+struct AWSClient::AsyncAttempt
 {
-    BuildHttpRequest(request, httpRequest);
-    auto signer = GetSignerByName(signerName);
-    if (!signer->SignRequest(*httpRequest, request.SignBody()))
+    AsyncAttempt(const char* serviceName, const Aws::Http::URI& uri, const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+        HttpMethod method, const char* signerName, const HttpResponseOutcomeReceivedHandler& handler) :
+        m_serviceName(serviceName), m_uri(uri), m_request(request), m_method(method), m_signerName(signerName), m_handler(handler),
+        m_retries(0), m_retryTokens(0), m_retryPending(false)
+    {}
+
+    //taken while the client is intact, the async callbacks must not call its virtual functions.
+    const char* m_serviceName;
+    Aws::Http::URI m_uri;
+    std::shared_ptr<const Aws::AmazonWebServiceRequest> m_request;
+    HttpMethod m_method;
+    const char* m_signerName;
+    HttpResponseOutcomeReceivedHandler m_handler;
+    std::shared_ptr<HttpRequest> m_httpRequest;
+    Aws::Monitoring::CoreMetricsCollection m_coreMetrics;
+    Aws::Vector<void*> m_contexts;
+    long m_retries;
+    unsigned m_retryTokens;
+    bool m_retryPending;
+    // failed outcome of the previous attempt while a retry is pending, the final outcome once the request is finished.
+    HttpResponseOutcome m_lastOutcome;
+};
+
+void AWSClient::RunAsyncStep(const std::shared_ptr<AsyncRequestTracker>& tracker, const std::shared_ptr<AsyncAttempt>& attempt,
+    const std::function<bool()>& step)
+{
+    bool finished = true;
+    if (tracker->Enter())
+    {
+        //once the step has handed the attempt on, another thread may be working on it.
+        finished = step();
+        tracker->Leave();
+    }
+    else
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Client destroyed while a request was in flight, completing the request without it.");
+        if (!attempt->m_retryPending)
+        {
+            attempt->m_lastOutcome = HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, "",
+                "Client was destroyed before the request completed", false/*retryable*/));
+        }
+        Aws::Monitoring::OnFinish(attempt->m_serviceName, attempt->m_request->GetServiceRequestName(), attempt->m_httpRequest, attempt->m_contexts);
+    }
+
+    //the handler runs outside of the client, it may well destroy it.
+    if (finished)
+    {
+        attempt->m_handler(attempt->m_lastOutcome);
+    }
+}
+
+bool AWSClient::FinishAsyncAttempt(const std::shared_ptr<AsyncAttempt>& attempt, HttpResponseOutcome&& outcome) const
+{
+    Aws::Monitoring::OnFinish(attempt->m_serviceName, attempt->m_request->GetServiceRequestName(), attempt->m_httpRequest, attempt->m_contexts);
+    attempt->m_lastOutcome = std::move(outcome);
+    return true;
+}
+
+void AWSClient::AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    HttpMethod method,
+    const char* signerName,
+    const HttpResponseOutcomeReceivedHandler& handler) const
+{
+    auto attempt = Aws::MakeShared<AsyncAttempt>(AWS_CLIENT_LOG_TAG, this->GetServiceClientName(), uri, request, method, signerName, handler);
+    attempt->m_httpRequest = CreateHttpRequest(uri, method, request->GetResponseStreamFactory());
+    attempt->m_contexts = Aws::Monitoring::OnRequestStarted(attempt->m_serviceName, request->GetServiceRequestName(), attempt->m_httpRequest);
+    auto tracker = m_asyncRequests;
+    if (m_httpClient->SupportsAsyncRequests())
+    {
+        RunAsyncStep(tracker, attempt, [this, &attempt]() { return SendAsyncAttempt(attempt); });
+    }
+    else
+    {
+        m_executor->Submit([this, tracker, attempt]()
+        {
+            RunAsyncStep(tracker, attempt, [this, &attempt]() { return SendAsyncAttempt(attempt); });
+        });
+    }
+}
+
+bool AWSClient::SendAsyncAttempt(const std::shared_ptr<AsyncAttempt>& attempt) const
+{
+    if (!m_httpClient->SupportsAsyncRequests())
+    {
+        //a blocking http client holds the current executor thread for the attempt only, not for the back-off after it.
+        return OnAsyncAttemptCompleted(attempt, AttemptOneRequest(attempt->m_httpRequest, *attempt->m_request, attempt->m_signerName));
+    }
+
+    const std::shared_ptr<HttpRequest>& httpRequest = attempt->m_httpRequest;
+    auto signer = GetSignerByName(attempt->m_signerName);
+    httpRequest->SetComputeContentSha256(signer->SignsPayload(*httpRequest, attempt->m_request->SignBody()));
+    BuildHttpRequest(*attempt->m_request, httpRequest);
+    if (!signer->SignRequest(*httpRequest, attempt->m_request->SignBody()))
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+        return OnAsyncAttemptCompleted(attempt,
+            HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/)));
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
-    std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    auto executor = m_executor;
+    auto tracker = m_asyncRequests;
+    m_httpClient->MakeRequestAsync(httpRequest,
+        [this, executor, tracker, attempt](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& httpResponse)
+    {
+        //this runs on the http client's event loop, so move error marshalling, retries and the caller's handler off of it.
+        //The client may be gone by now, it is only touched once the tracker lets the step in.
+        executor->Submit([this, tracker, attempt, httpResponse]()
+        {
+            RunAsyncStep(tracker, attempt, [this, &attempt, &httpResponse]()
+            {
+                return OnAsyncAttemptCompleted(attempt, BuildResponseOutcome(attempt->m_httpRequest, httpResponse));
+            });
+        });
+    }, m_readRateLimiter.get(), m_writeRateLimiter.get());
+    return false;
+}
 
+bool AWSClient::OnAsyncAttemptCompleted(const std::shared_ptr<AsyncAttempt>& attempt, HttpResponseOutcome&& outcome) const
+{
+    const Aws::AmazonWebServiceRequest& request = *attempt->m_request;
+    attempt->m_coreMetrics.httpClientMetrics = attempt->m_httpRequest->GetRequestMetrics();
+    if (outcome.IsSuccess())
+    {
+        m_retryTokenBucket->ReleaseOnSuccess(attempt->m_retryTokens);
+        Aws::Monitoring::OnRequestSucceeded(attempt->m_serviceName, request.GetServiceRequestName(), attempt->m_httpRequest, outcome, attempt->m_coreMetrics, attempt->m_contexts);
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
+        return FinishAsyncAttempt(attempt, std::move(outcome));
+    }
+
+    Aws::Monitoring::OnRequestFailed(attempt->m_serviceName, request.GetServiceRequestName(), attempt->m_httpRequest, outcome, attempt->m_coreMetrics, attempt->m_contexts);
+
+    bool shouldRetry = false;
+    bool shouldSleep = false;
+    long sleepMillis = 0;
+    if (!m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
+    }
+    else
+    {
+        sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), attempt->m_retries);
+        //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
+        //sleep if clock skew was NOT the problem. AdjustClockSkew may update error inside outcome.
+        shouldSleep = !AdjustClockSkew(outcome, attempt->m_signerName);
+        shouldRetry = m_retryStrategy->ShouldRetry(outcome.GetError(), attempt->m_retries);
+        if (shouldRetry && !m_retryTokenBucket->AcquireForRetry(outcome.GetError(), attempt->m_retryTokens))
+        {
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed and the retry budget of the client is exhausted, not retrying.");
+            shouldRetry = false;
+        }
+    }
+
+    if (!shouldRetry)
+    {
+        return FinishAsyncAttempt(attempt, std::move(outcome));
+    }
+
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
+    if(request.GetBody())
+    {
+        request.GetBody()->clear();
+        request.GetBody()->seekg(0);
+    }
+
+    if (request.GetRequestRetryHandler())
+    {
+        request.GetRequestRetryHandler()(request);
+    }
+
+    attempt->m_retries++;
+    if (shouldSleep && sleepMillis > 0)
+    {
+        //the timer wheel only hands the attempt back to the executor, so its thread is never held by a retry.
+        //If the client is destroyed first, the request completes with this attempt's outcome without touching the client, whether
+        //the retry is still on the wheel (cancelled) or already queued on the executor (turned away by the tracker).
+        auto executor = m_executor;
+        auto tracker = m_asyncRequests;
+        attempt->m_lastOutcome = std::move(outcome);
+        attempt->m_retryPending = true;
+        m_retryScheduler->Schedule(std::chrono::milliseconds(sleepMillis), [this, executor, tracker, attempt]()
+        {
+            executor->Submit([this, tracker, attempt]()
+            {
+                RunAsyncStep(tracker, attempt, [this, &attempt]() { return RetryAsyncAttempt(attempt); });
+            });
+        },
+        [attempt]()
+        {
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Client destroyed while a retry was pending, returning the last failed outcome.");
+            Aws::Monitoring::OnFinish(attempt->m_serviceName, attempt->m_request->GetServiceRequestName(), attempt->m_httpRequest, attempt->m_contexts);
+            attempt->m_handler(attempt->m_lastOutcome);
+        });
+        return false;
+    }
+
+    return RetryAsyncAttempt(attempt);
+}
+
+bool AWSClient::RetryAsyncAttempt(const std::shared_ptr<AsyncAttempt>& attempt) const
+{
+    const Aws::AmazonWebServiceRequest& request = *attempt->m_request;
+    attempt->m_lastOutcome = HttpResponseOutcome();
+    attempt->m_retryPending = false;
+    attempt->m_httpRequest = CreateHttpRequest(attempt->m_uri, attempt->m_method, request.GetResponseStreamFactory());
+    Aws::Monitoring::OnRequestRetry(attempt->m_serviceName, request.GetServiceRequestName(), attempt->m_httpRequest, attempt->m_contexts);
+    return SendAsyncAttempt(attempt);
+}
+
+HttpResponseOutcome AWSClient::BuildResponseOutcome(const std::shared_ptr<HttpRequest>& httpRequest,
+    const std::shared_ptr<HttpResponse>& httpResponse) const
+{
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
@@ -320,6 +600,25 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpReque
     return HttpResponseOutcome(httpResponse);
 }
 
+HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
+    const Aws::AmazonWebServiceRequest& request, const char* signerName) const
+{
+    auto signer = GetSignerByName(signerName);
+    httpRequest->SetComputeContentSha256(signer->SignsPayload(*httpRequest, request.SignBody()));
+    BuildHttpRequest(request, httpRequest);
+    if (!signer->SignRequest(*httpRequest, request.SignBody()))
+    {
+        AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+    }
+
+    AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
+    std::shared_ptr<HttpResponse> httpResponse(
+        m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+
+    return BuildResponseOutcome(httpRequest, httpResponse);
+}
+
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest, const char* signerName, const char* requestName) const
 {
     AWS_UNREFERENCED_PARAM(requestName);
@@ -457,15 +756,30 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
         AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Found body, and content-md5 needs to be set" <<
             ", attempting to compute content-md5");
 
-        //changing the internal state of the hash computation is not a logical state
-        //change as far as constness goes for this class. Due to the platform specificness
-        //of hash computations, we can't control the fact that computing a hash mutates
-        //state on some platforms such as windows (but that isn't a concern of this class.
-        auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
-        body->clear();
-        if (md5HashResult.IsSuccess())
+        if (httpRequest->ShouldComputeContentSha256() && httpRequest->GetContentSha256().empty())
         {
-            httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
+            //the signer is going to hash the payload as well, read the body once for both digests.
+            Utils::Crypto::MultiDigestHasher hasher;
+            hasher.AddDigest(Utils::Crypto::DigestAlgorithm::MD5);
+            hasher.AddDigest(Utils::Crypto::DigestAlgorithm::SHA256);
+            if (hasher.Calculate(*body))
+            {
+                httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(hasher.GetDigest(Utils::Crypto::DigestAlgorithm::MD5)));
+                httpRequest->SetContentSha256(HashingUtils::HexEncode(hasher.GetDigest(Utils::Crypto::DigestAlgorithm::SHA256)));
+            }
+        }
+        else
+        {
+            //changing the internal state of the hash computation is not a logical state
+            //change as far as constness goes for this class. Due to the platform specificness
+            //of hash computations, we can't control the fact that computing a hash mutates
+            //state on some platforms such as windows (but that isn't a concern of this class.
+            auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
+            body->clear();
+            if (md5HashResult.IsSuccess())
+            {
+                httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
+            }
         }
     }
 }
@@ -496,6 +810,7 @@ std::shared_ptr<Aws::Http::HttpRequest> AWSClient::BuildAndSignHttpRequest(const
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
     httpRequest->SetContinueRequestHandle(request.GetContinueRequestHandler());
+    httpRequest->SetResponseSink(request.GetResponseSink());
 
     request.AddQueryStringParameters(httpRequest->GetUri());
     auto signer = GetSignerByName(signerName);
@@ -520,6 +835,7 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
     httpRequest->SetContinueRequestHandle(request.GetContinueRequestHandler());
+    httpRequest->SetResponseSink(request.GetResponseSink());
 
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
@@ -658,13 +974,15 @@ AWSJsonClient::AWSJsonClient(const Aws::Client::ClientConfiguration& configurati
 {
 }
 
+AWSJsonClient::~AWSJsonClient()
+{
+    //async requests marshal their errors with BuildAWSError(), which is gone once this destructor returns.
+    StopAsyncRequests();
+}
 
-JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method,
-    const char* signerName) const
+
+static JsonOutcome MarshallJsonOutcome(const HttpResponseOutcome& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(httpOutcome.GetError());
@@ -680,6 +998,52 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
         return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* signerName) const
+{
+    return MarshallJsonOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
+}
+
+JsonReaderOutcome AWSJsonClient::MakeRequestWithJsonReader(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    const JsonPayloadReader& readPayload,
+    Http::HttpMethod method,
+    const char* signerName) const
+{
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
+    if (!httpOutcome.IsSuccess())
+    {
+        return JsonReaderOutcome(httpOutcome.GetError());
+    }
+
+    auto& body = httpOutcome.GetResult()->GetResponseBody();
+    if (body.tellp() > 0)
+    {
+        JsonReader reader(body);
+        if (!readPayload(reader) || reader.Next() != JsonToken::END_DOCUMENT)
+        {
+            Aws::String errorMessage = reader.WasParseSuccessful() ? "Failed to parse JSON. Unexpected value in the response." : reader.GetErrorMessage();
+            return JsonReaderOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", errorMessage, false));
+        }
+    }
+
+    return JsonReaderOutcome(NoResult());
+}
+
+void AWSJsonClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const JsonOutcomeReceivedHandler& handler,
+    Http::HttpMethod method,
+    const char* signerName) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, signerName, [handler](const HttpResponseOutcome& httpOutcome)
+    {
+        handler(MarshallJsonOutcome(httpOutcome));
+    });
+}
+
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName,
@@ -789,12 +1153,14 @@ AWSXMLClient::AWSXMLClient(const Aws::Client::ClientConfiguration& configuration
 {
 }
 
-XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method,
-    const char* signerName) const
+AWSXMLClient::~AWSXMLClient()
+{
+    //async requests marshal their errors with BuildAWSError(), which is gone once this destructor returns.
+    StopAsyncRequests();
+}
+
+XmlOutcome AWSXMLClient::ParseXmlOutcome(const HttpResponseOutcome& httpOutcome)
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
     if (!httpOutcome.IsSuccess())
     {
         return XmlOutcome(httpOutcome.GetError());
@@ -817,6 +1183,53 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
     return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
 }
 
+XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* signerName) const
+{
+    return ParseXmlOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
+}
+
+XmlReaderOutcome AWSXMLClient::MakeRequestWithXmlReader(const Aws::Http::URI& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    const XmlPayloadReader& readPayload,
+    Http::HttpMethod method,
+    const char* signerName) const
+{
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
+    if (!httpOutcome.IsSuccess())
+    {
+        return XmlReaderOutcome(httpOutcome.GetError());
+    }
+
+    auto& body = httpOutcome.GetResult()->GetResponseBody();
+    if (body.tellp() > 0)
+    {
+        XmlReader reader(body);
+        if (!readPayload(reader) || reader.Next() != XmlToken::END_DOCUMENT)
+        {
+            Aws::String errorMessage = reader.WasParseSuccessful() ? "Failed to parse XML. Unexpected content in the response." : reader.GetErrorMessage();
+            AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Xml parsing failed with message " << errorMessage);
+            return XmlReaderOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", errorMessage, false));
+        }
+    }
+
+    return XmlReaderOutcome(NoResult());
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    const XmlOutcomeReceivedHandler& handler,
+    Http::HttpMethod method,
+    const char* signerName) const
+{
+    BASECLASS::AttemptExhaustivelyAsync(uri, request, method, signerName, [handler](const HttpResponseOutcome& httpOutcome)
+    {
+        handler(ParseXmlOutcome(httpOutcome));
+    });
+}
+
 XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName,
@@ -55,6 +55,7 @@ ClientConfiguration::ClientConfiguration() :
     tcpKeepAliveIntervalMs(30000),
     lowSpeedLimit(1),
     retryStrategy(Aws::MakeShared<DefaultRetryStrategy>(CLIENT_CONFIG_TAG)),
+    retryTokenBucketCapacity(500),
     proxyScheme(Aws::Http::Scheme::HTTP),
     proxyPort(0),
     executor(Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(CLIENT_CONFIG_TAG)),
@@ -62,6 +63,9 @@ ClientConfiguration::ClientConfiguration() :
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
+    httpEventLoopThreads(1),
+    warmUpConnectionsPerEndpoint(1),
+    shareCurlCaches(false),
     followRedirects(true),
     disableExpectHeader(false),
     enableClockSkewAdjustment(true),
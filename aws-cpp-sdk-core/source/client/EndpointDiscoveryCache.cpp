@@ -0,0 +1,261 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/EndpointDiscoveryCache.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Threading;
+
+static const char* LOG_TAG = "EndpointDiscoveryCache";
+// how long to keep using an endpoint before trying again after its background refresh failed
+static const std::chrono::seconds REFRESH_RETRY_DELAY(5);
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct Entry
+    {
+        Entry() : discovering(false) {}
+
+        Aws::String address; // empty until the first discovery succeeded
+        Clock::time_point expiration;
+        Clock::time_point refreshAt;
+        bool discovering;
+    };
+}
+
+struct EndpointDiscoveryCache::State
+{
+    State(size_t maxSize, std::chrono::milliseconds refreshWindow) :
+        maxSize(maxSize), refreshWindow(refreshWindow), stopped(false), runningRefreshes(0)
+    {
+    }
+
+    /**
+     * Stores the result of discovering the endpoint for key. If it failed, the endpoint is dropped, unless
+     * keepOnFailure is set, which leaves it to be used until it expires. Requires mutex to be locked.
+     */
+    void Complete(const Aws::String& key, bool succeeded, Aws::String&& address, std::chrono::milliseconds cachePeriod, bool keepOnFailure)
+    {
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            Entry& entry = it->second;
+            Clock::time_point now = Clock::now();
+            if (succeeded && !address.empty())
+            {
+                entry.address = std::move(address);
+                entry.expiration = now + cachePeriod;
+                entry.refreshAt = entry.expiration - (std::min)(refreshWindow, cachePeriod / 2);
+                entry.discovering = false;
+            }
+            else if (keepOnFailure && !entry.address.empty())
+            {
+                entry.refreshAt = now + REFRESH_RETRY_DELAY;
+                entry.discovering = false;
+            }
+            else
+            {
+                entries.erase(it);
+            }
+        }
+        changed.notify_all();
+    }
+
+    /**
+     * Drops expired endpoints if there is no room for another key, or else the one closest to expiring. Endpoints that
+     * are being discovered stay. Requires mutex to be locked.
+     */
+    void MakeRoom()
+    {
+        if (entries.size() < maxSize)
+        {
+            return;
+        }
+
+        Clock::time_point now = Clock::now();
+        auto closestToExpiring = entries.end();
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            if (it->second.discovering)
+            {
+                ++it;
+            }
+            else if (it->second.expiration <= now)
+            {
+                it = entries.erase(it);
+            }
+            else
+            {
+                if (closestToExpiring == entries.end() || it->second.expiration < closestToExpiring->second.expiration)
+                {
+                    closestToExpiring = it;
+                }
+                ++it;
+            }
+        }
+
+        if (entries.size() >= maxSize && closestToExpiring != entries.end())
+        {
+            entries.erase(closestToExpiring);
+        }
+    }
+
+    void Refresh(const Aws::String& key, const DiscoverEndpointFunction& discover)
+    {
+        {
+            std::lock_guard<std::mutex> locker(mutex);
+            if (stopped)
+            {
+                Complete(key, false, Aws::String(), std::chrono::milliseconds(0), true);
+                return;
+            }
+            ++runningRefreshes;
+        }
+
+        Aws::String address;
+        std::chrono::milliseconds cachePeriod(0);
+        bool succeeded = discover(address, cachePeriod);
+
+        std::lock_guard<std::mutex> locker(mutex);
+        AWS_LOGSTREAM_DEBUG(LOG_TAG, "Background refresh of endpoint " << key << (succeeded ? " succeeded." : " failed."));
+        --runningRefreshes;
+        Complete(key, succeeded, std::move(address), cachePeriod, true);
+    }
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    Aws::Map<Aws::String, Entry> entries;
+    const size_t maxSize;
+    const std::chrono::milliseconds refreshWindow;
+    std::shared_ptr<Executor> executor;
+    bool stopped;
+    unsigned runningRefreshes;
+};
+
+EndpointDiscoveryCache::EndpointDiscoveryCache(size_t maxSize, std::chrono::milliseconds refreshWindow) :
+    m_state(Aws::MakeShared<State>(LOG_TAG, maxSize, refreshWindow))
+{
+}
+
+EndpointDiscoveryCache::~EndpointDiscoveryCache()
+{
+    StopRefreshing();
+}
+
+void EndpointDiscoveryCache::SetExecutor(const std::shared_ptr<Executor>& executor)
+{
+    std::lock_guard<std::mutex> locker(m_state->mutex);
+    m_state->executor = executor;
+}
+
+void EndpointDiscoveryCache::StopRefreshing()
+{
+    std::unique_lock<std::mutex> locker(m_state->mutex);
+    m_state->stopped = true;
+    m_state->changed.wait(locker, [this] { return m_state->runningRefreshes == 0; });
+}
+
+EndpointDiscoveryCache::LookupResult EndpointDiscoveryCache::Lookup(const Aws::String& key, Aws::String& endpoint)
+{
+    std::unique_lock<std::mutex> locker(m_state->mutex);
+    auto& entries = m_state->entries;
+    auto it = entries.find(key);
+    if (it == entries.end())
+    {
+        m_state->MakeRoom();
+        entries[key].discovering = true;
+        return LookupResult::DISCOVER;
+    }
+
+    if (it->second.address.empty())
+    {
+        // another lookup is discovering the endpoint; an entry without one is dropped if that fails.
+        m_state->changed.wait(locker, [&entries, &key]
+        {
+            auto found = entries.find(key);
+            return found == entries.end() || !found->second.discovering;
+        });
+        it = entries.find(key);
+        if (it == entries.end() || it->second.address.empty())
+        {
+            return LookupResult::NOT_FOUND;
+        }
+        endpoint = it->second.address;
+        return LookupResult::FOUND;
+    }
+
+    Entry& entry = it->second;
+    Clock::time_point now = Clock::now();
+    endpoint = entry.address;
+    if (entry.discovering)
+    {
+        return LookupResult::FOUND;
+    }
+
+    if (now < entry.expiration)
+    {
+        if (now < entry.refreshAt || !m_state->executor || m_state->stopped)
+        {
+            return LookupResult::FOUND;
+        }
+        entry.discovering = true;
+        return LookupResult::REFRESH;
+    }
+
+    entry.discovering = true;
+    return LookupResult::DISCOVER;
+}
+
+bool EndpointDiscoveryCache::Discover(const Aws::String& key, LookupResult result, DiscoverEndpointFunction&& discover, Aws::String& endpoint)
+{
+    if (result == LookupResult::REFRESH)
+    {
+        std::shared_ptr<Executor> executor;
+        {
+            std::lock_guard<std::mutex> locker(m_state->mutex);
+            executor = m_state->executor;
+        }
+
+        AWS_LOGSTREAM_TRACE(LOG_TAG, "Refreshing endpoint " << key << " in the background.");
+        if (!executor || !executor->Submit(&State::Refresh, m_state, key, std::move(discover)))
+        {
+            AWS_LOGSTREAM_WARN(LOG_TAG, "Failed to submit the refresh of endpoint " << key);
+            std::lock_guard<std::mutex> locker(m_state->mutex);
+            m_state->Complete(key, false, Aws::String(), std::chrono::milliseconds(0), true);
+        }
+        return true;
+    }
+
+    Aws::String address;
+    std::chrono::milliseconds cachePeriod(0);
+    bool succeeded = discover(address, cachePeriod) && !address.empty();
+    if (succeeded)
+    {
+        endpoint = address;
+    }
+
+    std::lock_guard<std::mutex> locker(m_state->mutex);
+    m_state->Complete(key, succeeded, std::move(address), cachePeriod, false);
+    return succeeded;
+}
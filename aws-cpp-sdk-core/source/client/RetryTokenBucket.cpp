@@ -0,0 +1,69 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/RetryTokenBucket.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+
+const unsigned RetryTokenBucket::RETRY_COST;
+const unsigned RetryTokenBucket::TIMEOUT_RETRY_COST;
+const unsigned RetryTokenBucket::NO_RETRY_INCREMENT;
+
+RetryTokenBucket::RetryTokenBucket(unsigned capacity) :
+    m_capacity(capacity), m_availableTokens(capacity)
+{
+}
+
+bool RetryTokenBucket::AcquireForRetry(const AWSError<CoreErrors>& error, unsigned& acquiredTokens)
+{
+    acquiredTokens = 0;
+    if (m_capacity == 0)
+    {
+        return true;
+    }
+
+    bool isTimeout = error.GetErrorType() == CoreErrors::REQUEST_TIMEOUT || error.GetErrorType() == CoreErrors::NETWORK_CONNECTION;
+    unsigned cost = isTimeout ? TIMEOUT_RETRY_COST : RETRY_COST;
+    unsigned available = m_availableTokens.load(std::memory_order_relaxed);
+    do
+    {
+        if (available < cost)
+        {
+            return false;
+        }
+    } while (!m_availableTokens.compare_exchange_weak(available, available - cost, std::memory_order_relaxed));
+
+    acquiredTokens = cost;
+    return true;
+}
+
+void RetryTokenBucket::ReleaseOnSuccess(unsigned acquiredTokens)
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    unsigned refill = acquiredTokens > 0 ? acquiredTokens : NO_RETRY_INCREMENT;
+    unsigned available = m_availableTokens.load(std::memory_order_relaxed);
+    while (available < m_capacity &&
+        !m_availableTokens.compare_exchange_weak(available, (std::min)(m_capacity, available + refill), std::memory_order_relaxed))
+    {
+    }
+}
@@ -26,6 +26,18 @@ HttpClient::HttpClient() :
 {
 }
 
+void HttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+    const HttpResponseReceivedHandler& handler,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+    Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    auto response = MakeRequest(request, readLimiter, writeLimiter);
+    if (handler)
+    {
+        handler(request, response);
+    }
+}
+
 void HttpClient::DisableRequestProcessing() 
 { 
     m_disableRequestProcessing = true;
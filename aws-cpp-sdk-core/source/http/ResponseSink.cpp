@@ -0,0 +1,161 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/ResponseSink.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+using namespace Aws::Http;
+
+static const char* RESPONSE_SINK_TAG = "ResponseSink";
+
+BufferResponseSink::BufferResponseSink() :
+    m_buffer(nullptr), m_capacity(0), m_length(0)
+{
+}
+
+BufferResponseSink::BufferResponseSink(unsigned char* buffer, size_t capacity) :
+    m_buffer(buffer), m_capacity(capacity), m_length(0)
+{
+}
+
+bool BufferResponseSink::BeginBody(int64_t contentLength)
+{
+    m_length = 0;
+    if (m_buffer)
+    {
+        if (contentLength > static_cast<int64_t>(m_capacity))
+        {
+            AWS_LOGSTREAM_ERROR(RESPONSE_SINK_TAG, "Response body of " << contentLength << " bytes doesn't fit into buffer of " << m_capacity << " bytes.");
+            return false;
+        }
+        return true;
+    }
+
+    m_ownedBuffer.clear();
+    if (contentLength > 0)
+    {
+        m_ownedBuffer.reserve(static_cast<size_t>(contentLength));
+    }
+    return true;
+}
+
+bool BufferResponseSink::Write(const unsigned char* data, size_t length)
+{
+    if (m_buffer)
+    {
+        if (length > m_capacity - m_length)
+        {
+            AWS_LOGSTREAM_ERROR(RESPONSE_SINK_TAG, "Response body exceeds buffer of " << m_capacity << " bytes.");
+            return false;
+        }
+        std::memcpy(m_buffer + m_length, data, length);
+    }
+    else
+    {
+        m_ownedBuffer.insert(m_ownedBuffer.end(), data, data + length);
+    }
+    m_length += length;
+    return true;
+}
+
+ScatterResponseSink::ScatterResponseSink(const Aws::Vector<ResponseSinkSegment>& segments) :
+    m_segments(segments), m_capacity(0), m_currentSegment(0), m_segmentOffset(0), m_bytesWritten(0)
+{
+    for (const auto& segment : m_segments)
+    {
+        m_capacity += segment.length;
+    }
+}
+
+bool ScatterResponseSink::BeginBody(int64_t contentLength)
+{
+    m_currentSegment = 0;
+    m_segmentOffset = 0;
+    m_bytesWritten = 0;
+    if (contentLength > static_cast<int64_t>(m_capacity))
+    {
+        AWS_LOGSTREAM_ERROR(RESPONSE_SINK_TAG, "Response body of " << contentLength << " bytes doesn't fit into segments of " << m_capacity << " bytes.");
+        return false;
+    }
+    return true;
+}
+
+bool ScatterResponseSink::Write(const unsigned char* data, size_t length)
+{
+    if (length > m_capacity - m_bytesWritten)
+    {
+        AWS_LOGSTREAM_ERROR(RESPONSE_SINK_TAG, "Response body exceeds segments of " << m_capacity << " bytes.");
+        return false;
+    }
+
+    m_bytesWritten += length;
+    while (length > 0)
+    {
+        ResponseSinkSegment& segment = m_segments[m_currentSegment];
+        size_t toCopy = (std::min)(length, segment.length - m_segmentOffset);
+        std::memcpy(segment.data + m_segmentOffset, data, toCopy);
+        data += toCopy;
+        length -= toCopy;
+        m_segmentOffset += toCopy;
+        if (m_segmentOffset == segment.length)
+        {
+            ++m_currentSegment;
+            m_segmentOffset = 0;
+        }
+    }
+    return true;
+}
+
+#if !defined(_WIN32)
+FileResponseSink::FileResponseSink(int fileDescriptor, int64_t offset) :
+    m_fileDescriptor(fileDescriptor), m_offset(offset), m_bytesWritten(0)
+{
+}
+
+bool FileResponseSink::BeginBody(int64_t)
+{
+    m_bytesWritten = 0;
+    return true;
+}
+
+bool FileResponseSink::Write(const unsigned char* data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = pwrite(m_fileDescriptor, data, length, static_cast<off_t>(m_offset + m_bytesWritten));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            AWS_LOGSTREAM_ERROR(RESPONSE_SINK_TAG, "pwrite to file descriptor " << m_fileDescriptor << " failed with errno " << errno);
+            return false;
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+        m_bytesWritten += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+#endif
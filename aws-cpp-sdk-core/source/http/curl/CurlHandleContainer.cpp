@@ -15,6 +15,7 @@
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 #include <algorithm>
 
@@ -24,9 +25,12 @@ using namespace Aws::Http;
 static const char* CURL_HANDLE_CONTAINER_TAG = "CurlHandleContainer";
 
 
-CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, bool enableTcpKeepAlive, unsigned long tcpKeepAliveIntervalMs, unsigned long lowSpeedLimit) :
+CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, bool enableTcpKeepAlive, unsigned long tcpKeepAliveIntervalMs, unsigned long lowSpeedLimit,
+                const std::shared_ptr<CurlShareHandle>& shareHandle) :
                 m_maxPoolSize(maxSize), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
-                m_enableTcpKeepAlive(enableTcpKeepAlive), m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedLimit(lowSpeedLimit), m_poolSize(0)
+                m_enableTcpKeepAlive(enableTcpKeepAlive), m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedLimit(lowSpeedLimit),
+                m_shareHandle(shareHandle && shareHandle->GetHandle() ? shareHandle : nullptr), m_poolSize(0),
+                m_idleCount(0), m_acquisitions(0), m_endpointHits(0), m_waits(0), m_shutdown(false)
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Initializing CurlHandleContainer with size " << maxSize);
 }
@@ -34,77 +38,184 @@ CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout,
 CurlHandleContainer::~CurlHandleContainer()
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Cleaning up CurlHandleContainer.");
-    for (CURL* handle : m_handleContainer.ShutdownAndWait(m_poolSize))
+    std::unique_lock<std::mutex> locker(m_containerLock);
+    m_shutdown = true;
+
+    //wait for all acquired handles to be released.
+    m_handleReleased.wait(locker, [this]() { return m_idleCount == m_poolSize; });
+
+    for (auto& endpointHandles : m_idleHandles)
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Cleaning up " << handle);
-        curl_easy_cleanup(handle);
+        for (CURL* handle : endpointHandles.second)
+        {
+            AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Cleaning up " << handle);
+            curl_easy_cleanup(handle);
+        }
     }
+    m_idleHandles.clear();
 }
 
-CURL* CurlHandleContainer::AcquireCurlHandle()
+Aws::String CurlHandleContainer::GetEndpointKey(const Aws::String& scheme, const Aws::String& authority, uint16_t port)
 {
-    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Attempting to acquire curl connection.");
-
-    if(!m_handleContainer.HasResourcesAvailable())
-    {
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "No current connections available in pool. Attempting to create new connections.");
-        CheckAndGrowPool();
-    }
+    Aws::StringStream ss;
+    ss << scheme << "://" << authority << ":" << port;
+    return ss.str();
+}
 
-    CURL* handle = m_handleContainer.Acquire();
-    AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Connection has been released. Continuing.");
+CURL* CurlHandleContainer::AcquireCurlHandle(const Aws::String& endpoint)
+{
+    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Attempting to acquire curl connection.");
+    CURL* handle = AcquireCurlHandle(endpoint, true /*waitForHandle*/);
     AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Returning connection handle " << handle);
     return handle;
 }
 
-void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
+CURL* CurlHandleContainer::TryAcquireCurlHandle(const Aws::String& endpoint)
 {
+    CURL* handle = AcquireCurlHandle(endpoint, false /*waitForHandle*/);
     if (handle)
     {
-        curl_easy_reset(handle);
-        SetDefaultOptionsOnHandle(handle);
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Releasing curl handle " << handle);
-        m_handleContainer.Release(handle);
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Notified waiting threads.");
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Returning connection handle " << handle);
+    }
+    else
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "No connections available in pool.");
     }
+    return handle;
 }
 
-bool CurlHandleContainer::CheckAndGrowPool()
+CURL* CurlHandleContainer::AcquireCurlHandle(const Aws::String& endpoint, bool waitForHandle)
 {
-    std::lock_guard<std::mutex> locker(m_containerLock);
-    if (m_poolSize < m_maxPoolSize)
+    std::unique_lock<std::mutex> locker(m_containerLock);
+    ++m_acquisitions;
+    bool waited = false;
+    for (;;)
     {
-        unsigned multiplier = m_poolSize > 0 ? m_poolSize : 1;
-        unsigned amountToAdd = (std::min)(multiplier * 2, m_maxPoolSize - m_poolSize);
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "attempting to grow pool size by " << amountToAdd);
-
-        unsigned actuallyAdded = 0;
-        for (unsigned i = 0; i < amountToAdd; ++i)
+        // handles to other endpoints are only taken once the pool cannot grow, so they keep their connections as long as possible.
+        auto idleIter = m_idleHandles.find(endpoint);
+        if (idleIter == m_idleHandles.end() && !endpoint.empty())
+        {
+            idleIter = m_idleHandles.find("");
+        }
+        if (idleIter != m_idleHandles.end())
         {
-            CURL* curlHandle = curl_easy_init();
+            if (!endpoint.empty() && idleIter->first == endpoint)
+            {
+                ++m_endpointHits;
+            }
+            return TakeIdleHandleLocked(idleIter->first);
+        }
 
-            if (curlHandle)
+        if (m_poolSize < m_maxPoolSize)
+        {
+            ++m_poolSize;
+            locker.unlock();
+            CURL* handle = CreateCurlHandle();
+            if (handle)
             {
-                SetDefaultOptionsOnHandle(curlHandle);
-                m_handleContainer.Release(curlHandle);
-                ++actuallyAdded;
+                return handle;
             }
-            else
+            locker.lock();
+            --m_poolSize;
+        }
+
+        if (m_idleCount > 0)
+        {
+            // take from the endpoint with the most idle handles.
+            auto mostIdle = m_idleHandles.begin();
+            for (auto iter = m_idleHandles.begin(); iter != m_idleHandles.end(); ++iter)
             {
-                AWS_LOGSTREAM_ERROR(CURL_HANDLE_CONTAINER_TAG, "curl_easy_init failed to allocate.");
-                break;
+                if (iter->second.size() > mostIdle->second.size())
+                {
+                    mostIdle = iter;
+                }
             }
+            return TakeIdleHandleLocked(mostIdle->first);
+        }
+
+        if (!waitForHandle || m_poolSize == 0)
+        {
+            return nullptr;
+        }
+
+        if (!waited)
+        {
+            ++m_waits;
+            waited = true;
+            AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Pool is at max size " << m_maxPoolSize << ", waiting for a connection to be released.");
         }
+        m_handleReleased.wait(locker);
+    }
+}
 
-        AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool grown by " << actuallyAdded);
-        m_poolSize += actuallyAdded;
+CURL* CurlHandleContainer::TakeIdleHandleLocked(const Aws::String& endpoint)
+{
+    auto idleIter = m_idleHandles.find(endpoint);
+    CURL* handle = idleIter->second.back();
+    idleIter->second.pop_back();
+    if (idleIter->second.empty())
+    {
+        m_idleHandles.erase(idleIter);
+    }
+    --m_idleCount;
+    return handle;
+}
 
-        return actuallyAdded > 0;
+CURL* CurlHandleContainer::CreateCurlHandle()
+{
+    CURL* curlHandle = curl_easy_init();
+    if (curlHandle)
+    {
+        SetDefaultOptionsOnHandle(curlHandle);
+        AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool grown by 1, created handle " << curlHandle);
+    }
+    else
+    {
+        AWS_LOGSTREAM_ERROR(CURL_HANDLE_CONTAINER_TAG, "curl_easy_init failed to allocate.");
     }
+    return curlHandle;
+}
 
-    AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool cannot be grown any further, already at max size.");
+void CurlHandleContainer::ReleaseCurlHandle(CURL* handle, const Aws::String& endpoint)
+{
+    if (handle)
+    {
+        // reset drops the options of the finished transfer but keeps the handle's connection, dns and tls session caches.
+        curl_easy_reset(handle);
+        SetDefaultOptionsOnHandle(handle);
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Releasing curl handle " << handle);
+        bool shuttingDown = false;
+        {
+            std::lock_guard<std::mutex> locker(m_containerLock);
+            m_idleHandles[endpoint].push_back(handle);
+            ++m_idleCount;
+            shuttingDown = m_shutdown;
+        }
+        // the destructor waits for every handle to come back, make sure it is among the woken threads.
+        if (shuttingDown)
+        {
+            m_handleReleased.notify_all();
+        }
+        else
+        {
+            m_handleReleased.notify_one();
+        }
+        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Notified waiting threads.");
+    }
+}
 
-    return false;
+CurlHandleContainer::PoolStats CurlHandleContainer::GetPoolStats() const
+{
+    std::lock_guard<std::mutex> locker(m_containerLock);
+    PoolStats stats;
+    stats.maxPoolSize = m_maxPoolSize;
+    stats.poolSize = m_poolSize;
+    stats.idleHandles = m_idleCount;
+    stats.idleEndpoints = static_cast<unsigned>(m_idleHandles.size() - m_idleHandles.count(""));
+    stats.acquisitions = m_acquisitions;
+    stats.endpointHits = m_endpointHits;
+    stats.waits = m_waits;
+    return stats;
 }
 
 void CurlHandleContainer::SetDefaultOptionsOnHandle(CURL* handle)
@@ -122,6 +233,10 @@ void CurlHandleContainer::SetDefaultOptionsOnHandle(CURL* handle)
     curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, m_enableTcpKeepAlive ? 1L : 0L);
     curl_easy_setopt(handle, CURLOPT_TCP_KEEPINTVL, m_tcpKeepAliveIntervalMs);
     curl_easy_setopt(handle, CURLOPT_TCP_KEEPIDLE, m_tcpKeepAliveIntervalMs);
+    if (m_shareHandle)
+    {
+        curl_easy_setopt(handle, CURLOPT_SHARE, m_shareHandle->GetHandle());
+    }
 #ifdef CURL_HAS_H2
     curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
 #endif
@@ -15,9 +15,12 @@
 
 #include <aws/core/http/curl/CurlHttpClient.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/ResponseSink.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
@@ -130,6 +133,51 @@ static char* strdup_callback(const char* str)
 
 #endif
 
+/**
+ * Charges the data of one direction of a transfer to its rate limiter. A blocking transfer sleeps off the delay right away. A transfer sharing
+ * its thread with others only notes until when the limiter is in debt; its next callback pauses it, and the event loop resumes it then.
+ */
+struct CurlRateLimit
+{
+    CurlRateLimit(Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+        m_rateLimiter(rateLimiter),
+        m_deferDelays(false),
+        m_paused(false)
+    {}
+
+    void PayForCost(int64_t cost)
+    {
+        if (!m_rateLimiter)
+        {
+            return;
+        }
+
+        if (!m_deferDelays)
+        {
+            m_rateLimiter->ApplyAndPayForCost(cost);
+            return;
+        }
+
+        auto delay = m_rateLimiter->ApplyCost(cost);
+        if (delay.count() > 0)
+        {
+            m_resumeAt = std::chrono::steady_clock::now() + delay;
+        }
+    }
+
+    // whether the callback has to pause the transfer rather than move more data.
+    bool ShouldPause()
+    {
+        m_paused = m_deferDelays && std::chrono::steady_clock::now() < m_resumeAt;
+        return m_paused;
+    }
+
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    bool m_deferDelays;
+    bool m_paused;
+    std::chrono::steady_clock::time_point m_resumeAt;
+};
+
 struct CurlWriteCallbackContext
 {
     CurlWriteCallbackContext(const CurlHttpClient* client,
@@ -139,32 +187,67 @@ struct CurlWriteCallbackContext
         m_client(client),
         m_request(request),
         m_response(response),
-        m_rateLimiter(rateLimiter),
-        m_numBytesResponseReceived(0)
+        m_rateLimit(rateLimiter),
+        m_numBytesResponseReceived(0),
+        m_curlHandle(nullptr),
+        m_sink(nullptr),
+        m_bodyStarted(false)
     {}
 
     const CurlHttpClient* m_client;
     HttpRequest* m_request;
     HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    CurlRateLimit m_rateLimit;
     int64_t m_numBytesResponseReceived;
+    CURL* m_curlHandle;
+    // where the body goes instead of the response stream, decided once the headers of the final response are in.
+    ResponseSink* m_sink;
+    bool m_bodyStarted;
 };
 
 struct CurlReadCallbackContext
 {
     CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
         m_client(client),
-        m_rateLimiter(limiter),
+        m_rateLimit(limiter),
         m_request(request)
     {}
 
     const CurlHttpClient* m_client;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    CurlRateLimit m_rateLimit;
     HttpRequest* m_request;
 };
 
 static const char* CURL_HTTP_CLIENT_TAG = "CurlHttpClient";
 
+// Picks the request's response sink if the response is a success, error bodies go to the response stream to be parsed.
+// Returns false if the sink rejects the body.
+static bool BeginResponseBody(CurlWriteCallbackContext* context)
+{
+    context->m_bodyStarted = true;
+    const std::shared_ptr<ResponseSink>& sink = context->m_request->GetResponseSink();
+    if (!sink)
+    {
+        return true;
+    }
+
+    long responseCode = 0;
+    curl_easy_getinfo(context->m_curlHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+    if (responseCode < 200 || responseCode > 299)
+    {
+        return true;
+    }
+
+    int64_t contentLength = -1;
+    if (context->m_response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+    {
+        contentLength = StringUtils::ConvertToInt64(context->m_response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER).c_str());
+    }
+
+    context->m_sink = sink.get();
+    return context->m_sink->BeginBody(contentLength);
+}
+
 static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
@@ -177,14 +260,31 @@ static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
             return 0;
         }
 
+        if (context->m_rateLimit.ShouldPause())
+        {
+            return CURL_WRITEFUNC_PAUSE;
+        }
+
         HttpResponse* response = context->m_response;
         size_t sizeToWrite = size * nmemb;
-        if (context->m_rateLimiter)
+        context->m_rateLimit.PayForCost(static_cast<int64_t>(sizeToWrite));
+
+        if (!context->m_bodyStarted && !BeginResponseBody(context))
         {
-            context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
+            return 0;
         }
 
-        response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        if (context->m_sink)
+        {
+            if (!context->m_sink->Write(reinterpret_cast<const unsigned char*>(ptr), sizeToWrite))
+            {
+                return 0;
+            }
+        }
+        else
+        {
+            response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        }
         auto& receivedHandler = context->m_request->GetDataReceivedEventHandler();
         if (receivedHandler)
         {
@@ -203,14 +303,26 @@ static size_t WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
     if (ptr)
     {
         AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, ptr);
-        HttpResponse* response = (HttpResponse*) userdata;
-        Aws::String headerLine(ptr);
+        CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
+        HttpResponse* response = context->m_response;
+        Aws::String headerLine(ptr, size * nmemb);
         Aws::Vector<Aws::String> keyValuePair = StringUtils::Split(headerLine, ':', 2);
 
         if (keyValuePair.size() == 2)
         {
             response->AddHeader(StringUtils::Trim(keyValuePair[0].c_str()), StringUtils::Trim(keyValuePair[1].c_str()));
         }
+        else if (!context->m_bodyStarted && StringUtils::Trim(headerLine.c_str()).empty())
+        {
+            //the blank line ends the headers. The sink is started here, not with the first byte of the body, so that it is
+            //reset for an empty body too. Interim 1xx responses are followed by the headers of the final one.
+            long responseCode = 0;
+            curl_easy_getinfo(context->m_curlHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+            if (responseCode >= 200 && !BeginResponseBody(context))
+            {
+                return 0;
+            }
+        }
 
         return size * nmemb;
     }
@@ -232,6 +344,11 @@ static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata)
         return CURL_READFUNC_ABORT;
     }
 
+    if (context->m_rateLimit.ShouldPause())
+    {
+        return CURL_READFUNC_PAUSE;
+    }
+
     HttpRequest* request = context->m_request;
     const std::shared_ptr<Aws::IOStream>& ioStream = request->GetContentBody();
 
@@ -246,10 +363,7 @@ static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata)
             sentHandler(request, static_cast<long long>(amountRead));
         }
 
-        if (context->m_rateLimiter)
-        {
-            context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(amountRead));
-        }
+        context->m_rateLimit.PayForCost(static_cast<int64_t>(amountRead));
 
         return amountRead;
     }
@@ -424,10 +538,26 @@ int CurlDebugCallback(CURL *handle, curl_infotype type, char *data, size_t size,
 }
 
 
+// Connections opened by a warm up live in the connection cache of the multi handle driving it unless the pool's handles use a
+// share handle's connection cache, so a client that warms up connections gets a share handle of its own if it has none.
+static std::shared_ptr<CurlShareHandle> GetPoolShareHandle(const ClientConfiguration& clientConfig)
+{
+    if (clientConfig.shareCurlCaches)
+    {
+        return CurlShareHandle::GetProcessShareHandle();
+    }
+    if (!clientConfig.warmUpEndpoints.empty() && clientConfig.warmUpConnectionsPerEndpoint > 0)
+    {
+        return Aws::MakeShared<CurlShareHandle>(CURL_HTTP_CLIENT_TAG);
+    }
+    return nullptr;
+}
+
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),   
     m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs,
-                          clientConfig.enableTcpKeepAlive, clientConfig.tcpKeepAliveIntervalMs, clientConfig.lowSpeedLimit),
+                          clientConfig.enableTcpKeepAlive, clientConfig.tcpKeepAliveIntervalMs, clientConfig.lowSpeedLimit,
+                          GetPoolShareHandle(clientConfig)),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyScheme(SchemeMapper::ToString(clientConfig.proxyScheme)), m_proxyHost(clientConfig.proxyHost),
     m_proxySSLCertPath(clientConfig.proxySSLCertPath), m_proxySSLCertType(clientConfig.proxySSLCertType),
@@ -438,23 +568,93 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     m_disableExpectHeader(clientConfig.disableExpectHeader),
     m_allowRedirects(clientConfig.followRedirects)
 {
+    for (const auto& endpoint : clientConfig.warmUpEndpoints)
+    {
+        WarmUpConnections(endpoint, clientConfig.warmUpConnectionsPerEndpoint);
+    }
 }
 
 
-void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
-        std::shared_ptr<StandardHttpResponse>& response,
-        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
-        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+struct CurlHttpClient::CurlRequestContext
 {
-    URI uri = request.GetUri();
+    CurlRequestContext(const CurlHttpClient* client, HttpRequest& request, const std::shared_ptr<StandardHttpResponse>& response,
+                       Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                       Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) :
+        m_request(request),
+        m_response(response),
+        m_writeContext(client, &request, response.get(), readLimiter),
+        m_readContext(client, &request, writeLimiter),
+        m_headers(nullptr),
+        m_connectionHandle(nullptr)
+    {}
+
+    ~CurlRequestContext()
+    {
+        if (m_headers)
+        {
+            curl_slist_free_all(m_headers);
+        }
+    }
+
+    HttpRequest& m_request;
+    std::shared_ptr<StandardHttpResponse> m_response;
+    CurlWriteCallbackContext m_writeContext;
+    CurlReadCallbackContext m_readContext;
+    struct curl_slist* m_headers;
+    CURL* m_connectionHandle;
+    Aws::String m_endpoint;
+    Aws::Utils::DateTime m_startTransmissionTime;
+    // when the write limiter has been paid for the request line and headers, if its delays are deferred.
+    std::chrono::steady_clock::time_point m_startAt;
+};
+
+// Rounded up, so that whoever waits for it doesn't wake up a millisecond early over and over.
+static std::chrono::milliseconds TimeUntil(std::chrono::steady_clock::time_point time, std::chrono::steady_clock::time_point now)
+{
+    if (time <= now)
+    {
+        return std::chrono::milliseconds(0);
+    }
+    auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(time - now);
+    return time - now > wait ? wait + std::chrono::milliseconds(1) : wait;
+}
+
+CurlHttpClient::CurlRequestContext* CurlHttpClient::PrepareRequest(HttpRequest& request,
+        const std::shared_ptr<StandardHttpResponse>& response,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter, bool waitForHandle, bool deferRateLimitDelays) const
+{
+    const URI& uri = request.GetUri();
+    Aws::String endpoint = CurlHandleContainer::GetEndpointKey(SchemeMapper::ToString(uri.GetScheme()), uri.GetAuthority(), uri.GetPort());
+    CURL* connectionHandle = waitForHandle ? m_curlHandleContainer.AcquireCurlHandle(endpoint) : m_curlHandleContainer.TryAcquireCurlHandle(endpoint);
+    if (!connectionHandle)
+    {
+        return nullptr;
+    }
+
+    AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
+
     Aws::String url = uri.GetURIString();
 
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Making request to " << url);
-    struct curl_slist* headers = NULL;
+    CurlRequestContext* context = Aws::New<CurlRequestContext>(CURL_HTTP_CLIENT_TAG, this, request, response, readLimiter, writeLimiter);
+    context->m_connectionHandle = connectionHandle;
+    context->m_writeContext.m_curlHandle = connectionHandle;
+    context->m_endpoint = std::move(endpoint);
+    context->m_writeContext.m_rateLimit.m_deferDelays = deferRateLimitDelays;
+    context->m_readContext.m_rateLimit.m_deferDelays = deferRateLimitDelays;
+    struct curl_slist*& headers = context->m_headers;
 
     if (writeLimiter != nullptr)
     {
-        writeLimiter->ApplyAndPayForCost(request.GetSize());
+        if (deferRateLimitDelays)
+        {
+            context->m_startAt = std::chrono::steady_clock::now() + writeLimiter->ApplyCost(request.GetSize());
+        }
+        else
+        {
+            writeLimiter->ApplyAndPayForCost(request.GetSize());
+        }
     }
 
     Aws::StringStream headerStream;
@@ -488,203 +688,257 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         headers = curl_slist_append(headers, "Expect:");
     }
 
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
-
-    if (connectionHandle)
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
-
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
-
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request, writeLimiter);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
+    SetOptCodeForHttpMethod(connectionHandle, request);
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &context->m_writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, &context->m_writeContext);
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
-        }
-        if(!m_caFile.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
-        }
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
+    if(!m_caFile.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
 
 #ifdef ENABLE_CURL_LOGGING
-        curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
-        curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
+    curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+    curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
 #endif
-        if (m_isUsingProxy)
+    if (m_isUsingProxy)
+    {
+        Aws::StringStream ss;
+        ss << m_proxyScheme << "://" << m_proxyHost;
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        if (!m_proxyUserName.empty() || !m_proxyPassword.empty())
         {
-            Aws::StringStream ss;
-            ss << m_proxyScheme << "://" << m_proxyHost;
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            if (!m_proxyUserName.empty() || !m_proxyPassword.empty())
-            {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-            }
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+        }
 #ifdef CURL_HAS_TLS_PROXY
-            if (!m_proxySSLCertPath.empty())
-            {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERT, m_proxySSLCertPath.c_str());
-                if (!m_proxySSLCertType.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERTTYPE, m_proxySSLCertType.c_str());
-                }
-            }
-            if (!m_proxySSLKeyPath.empty())
+        if (!m_proxySSLCertPath.empty())
+        {
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERT, m_proxySSLCertPath.c_str());
+            if (!m_proxySSLCertType.empty())
             {
-                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEY, m_proxySSLKeyPath.c_str());
-                if (!m_proxySSLKeyType.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEYTYPE, m_proxySSLKeyType.c_str());
-                }
-                if (!m_proxyKeyPasswd.empty())
-                {
-                    curl_easy_setopt(connectionHandle, CURLOPT_PROXY_KEYPASSWD, m_proxyKeyPasswd.c_str());
-                }
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLCERTTYPE, m_proxySSLCertType.c_str());
             }
-#endif //CURL_HAS_TLS_PROXY
         }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
-        }
-
-        if (request.GetContentBody())
+        if (!m_proxySSLKeyPath.empty())
         {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
-        }
-        Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        bool shouldContinueRequest = ContinueRequest(request);
-        if (curlResponseCode != CURLE_OK && shouldContinueRequest)
-        {
-            response = nullptr;
-            AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
-                    << " - " << curl_easy_strerror(curlResponseCode));
-        }
-        else if(!shouldContinueRequest)
-        {
-            response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
-        }
-        else
-        {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
+            curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEY, m_proxySSLKeyPath.c_str());
+            if (!m_proxySSLKeyType.empty())
             {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_SSLKEYTYPE, m_proxySSLKeyType.c_str());
             }
-
-            if (request.GetMethod() != HttpMethod::HTTP_HEAD &&
-                writeContext.m_client->IsRequestProcessingEnabled() &&
-                response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+            if (!m_proxyKeyPasswd.empty())
             {
-                const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
-                int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
-                if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
-                {
-                    response = nullptr;
-                    AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
-                }
+                curl_easy_setopt(connectionHandle, CURLOPT_PROXY_KEYPASSWD, m_proxyKeyPasswd.c_str());
             }
-
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
         }
+#endif //CURL_HAS_TLS_PROXY
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
+    }
 
-        double timep;
-        CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
-        if (ret == CURLE_OK)
-        {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
-        }
+    if (request.GetContentBody())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &context->m_readContext);
+        curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, SeekBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &context->m_readContext);
+    }
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency 
-        if (ret == CURLE_OK)
-        {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
-        }
+    context->m_startTransmissionTime = Aws::Utils::DateTime::Now();
+    return context;
+}
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
-        if (ret == CURLE_OK)
-        {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
-        }
+CURL* CurlHttpClient::GetCurlHandle(const CurlRequestContext* context)
+{
+    return context->m_connectionHandle;
+}
 
-        const char* ip = nullptr;
-        auto curlGetInfoResult = curl_easy_getinfo(connectionHandle, CURLINFO_PRIMARY_IP, &ip); // Get the IP address of the remote endpoint
-        if (curlGetInfoResult == CURLE_OK && ip)
+std::chrono::milliseconds CurlHttpClient::GetStartDelay(const CurlRequestContext* context)
+{
+    return TimeUntil(context->m_startAt, std::chrono::steady_clock::now());
+}
+
+std::chrono::milliseconds CurlHttpClient::ResumeRateLimitedTransfer(CurlRequestContext* context)
+{
+    CurlRateLimit& receiving = context->m_writeContext.m_rateLimit;
+    CurlRateLimit& sending = context->m_readContext.m_rateLimit;
+    if (!receiving.m_paused && !sending.m_paused)
+    {
+        return std::chrono::milliseconds(0);
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    bool resumeReceiving = receiving.m_paused && receiving.m_resumeAt <= now;
+    bool resumeSending = sending.m_paused && sending.m_resumeAt <= now;
+    if (resumeReceiving || resumeSending)
+    {
+        receiving.m_paused = receiving.m_paused && !resumeReceiving;
+        sending.m_paused = sending.m_paused && !resumeSending;
+        // curl may deliver data held back while paused from within curl_easy_pause(), which may pause the transfer again.
+        curl_easy_pause(context->m_connectionHandle, (receiving.m_paused ? CURLPAUSE_RECV : 0) | (sending.m_paused ? CURLPAUSE_SEND : 0));
+    }
+
+    std::chrono::milliseconds wait(0);
+    if (receiving.m_paused)
+    {
+        wait = (std::max)(TimeUntil(receiving.m_resumeAt, now), std::chrono::milliseconds(1));
+    }
+    if (sending.m_paused)
+    {
+        auto sendingWait = (std::max)(TimeUntil(sending.m_resumeAt, now), std::chrono::milliseconds(1));
+        wait = wait.count() > 0 ? (std::min)(wait, sendingWait) : sendingWait;
+    }
+    return wait;
+}
+
+std::shared_ptr<StandardHttpResponse> CurlHttpClient::CompleteRequest(CurlRequestContext* context, CURLcode curlResponseCode) const
+{
+    HttpRequest& request = context->m_request;
+    std::shared_ptr<StandardHttpResponse> response = context->m_response;
+    CURL* connectionHandle = context->m_connectionHandle;
+
+    bool shouldContinueRequest = ContinueRequest(request);
+    if (curlResponseCode != CURLE_OK && shouldContinueRequest)
+    {
+        response = nullptr;
+        AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
+                << " - " << curl_easy_strerror(curlResponseCode));
+    }
+    else if(!shouldContinueRequest)
+    {
+        response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
+    }
+    else
+    {
+        long responseCode;
+        curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+        response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
+
+        char* contentType = nullptr;
+        curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+        if (contentType)
         {
-            request.SetResolvedRemoteHost(ip);
+            response->SetContentType(contentType);
+            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
         }
 
-        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
-        //go ahead and flush the response body stream
-        if(response)
+        if (request.GetMethod() != HttpMethod::HTTP_HEAD &&
+            context->m_writeContext.m_client->IsRequestProcessingEnabled() &&
+            response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
         {
-            response->GetResponseBody().flush();
+            const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
+            int64_t numBytesResponseReceived = context->m_writeContext.m_numBytesResponseReceived;
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
+            if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
+            {
+                response = nullptr;
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
+            }
         }
-        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - startTransmissionTime).count());
+
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
     }
 
-    if (headers)
+    double timep;
+    CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
+    if (ret == CURLE_OK)
     {
-        curl_slist_free_all(headers);
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
+    }
+
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency 
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
+    }
+
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
+    }
+
+    const char* ip = nullptr;
+    auto curlGetInfoResult = curl_easy_getinfo(connectionHandle, CURLINFO_PRIMARY_IP, &ip); // Get the IP address of the remote endpoint
+    if (curlGetInfoResult == CURLE_OK && ip)
+    {
+        request.SetResolvedRemoteHost(ip);
+    }
+
+    //a failed transfer may have left the connection unusable, so don't advertise the handle as connected to the endpoint.
+    m_curlHandleContainer.ReleaseCurlHandle(connectionHandle, curlResponseCode == CURLE_OK ? context->m_endpoint : Aws::String());
+    //go ahead and flush the response body stream
+    if(response)
+    {
+        response->GetResponseBody().flush();
+    }
+    request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - context->m_startTransmissionTime).count());
+
+    Aws::Delete(context);
+    return response;
+}
+
+void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
+        std::shared_ptr<StandardHttpResponse>& response,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    CurlRequestContext* context = PrepareRequest(request, response, readLimiter, writeLimiter, true /*waitForHandle*/);
+    if (context)
+    {
+        CURLcode curlResponseCode = curl_easy_perform(GetCurlHandle(context));
+        response = CompleteRequest(context, curlResponseCode);
     }
 }
 
@@ -705,3 +959,90 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
     return response;
 }
 
+
+void CurlHttpClient::WarmUpConnections(const Aws::String& endpoint, unsigned connectionCount) const
+{
+    if (connectionCount == 0)
+    {
+        return;
+    }
+
+    if (!m_curlHandleContainer.IsSharingConnections())
+    {
+        AWS_LOGSTREAM_WARN(CURL_HTTP_CLIENT_TAG, "Skipping connection warm up to " << endpoint
+                << ", it needs libcurl 7.57.0 or newer and a client created with warmUpEndpoints or shareCurlCaches set.");
+        return;
+    }
+
+    AWS_LOGSTREAM_INFO(CURL_HTTP_CLIENT_TAG, "Warming up " << connectionCount << " connections to " << endpoint);
+    CURLM* multiHandle = curl_multi_init();
+    if (!multiHandle)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "curl_multi_init failed, skipping connection warm up.");
+        return;
+    }
+
+    //each warm up transfer is a HEAD request, which leaves a resolved, connected and (for https) negotiated connection in the
+    //shared connection cache, where it survives the cleanup of the multi handle. The handles are returned to the pool under the
+    //endpoint so the first real requests pick them up.
+    Aws::Vector<std::shared_ptr<HttpRequest>> requests;
+    Aws::Map<CURL*, CurlRequestContext*> contexts;
+    for (unsigned i = 0; i < connectionCount; ++i)
+    {
+        auto request = Aws::MakeShared<StandardHttpRequest>(CURL_HTTP_CLIENT_TAG, URI(endpoint), HttpMethod::HTTP_HEAD);
+        request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto response = Aws::MakeShared<StandardHttpResponse>(CURL_HTTP_CLIENT_TAG, request);
+        CurlRequestContext* context = PrepareRequest(*request, response, nullptr, nullptr, false /*waitForHandle*/);
+        if (!context)
+        {
+            AWS_LOGSTREAM_WARN(CURL_HTTP_CLIENT_TAG, "Connection pool exhausted after warming up " << i << " connections to " << endpoint);
+            break;
+        }
+        requests.push_back(request);
+        contexts[GetCurlHandle(context)] = context;
+        curl_multi_add_handle(multiHandle, GetCurlHandle(context));
+    }
+
+    int runningHandles = 0;
+    do
+    {
+        if (curl_multi_perform(multiHandle, &runningHandles) != CURLM_OK)
+        {
+            break;
+        }
+        if (runningHandles > 0)
+        {
+            curl_multi_wait(multiHandle, nullptr, 0, 100, nullptr);
+        }
+    } while (runningHandles > 0);
+
+    int messagesLeft = 0;
+    while (CURLMsg* message = curl_multi_info_read(multiHandle, &messagesLeft))
+    {
+        if (message->msg != CURLMSG_DONE)
+        {
+            continue;
+        }
+
+        auto contextIter = contexts.find(message->easy_handle);
+        if (contextIter != contexts.end())
+        {
+            curl_multi_remove_handle(multiHandle, message->easy_handle);
+            CompleteRequest(contextIter->second, message->data.result);
+            contexts.erase(contextIter);
+        }
+    }
+
+    //anything left did not finish, hand it back without an established connection.
+    for (auto& contextEntry : contexts)
+    {
+        curl_multi_remove_handle(multiHandle, contextEntry.first);
+        CompleteRequest(contextEntry.second, CURLE_OPERATION_TIMEDOUT);
+    }
+    curl_multi_cleanup(multiHandle);
+}
+
+CurlHandleContainer::PoolStats CurlHttpClient::GetConnectionPoolStats() const
+{
+    return m_curlHandleContainer.GetPoolStats();
+}
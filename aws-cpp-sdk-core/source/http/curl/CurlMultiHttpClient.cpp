@@ -0,0 +1,378 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Logging;
+
+static const char* CURL_MULTI_HTTP_CLIENT_TAG = "CurlMultiHttpClient";
+// Upper bound on how long an idle event loop sleeps before checking for shutdown and queued requests again.
+static const int EVENT_LOOP_POLL_TIMEOUT_MS = 1000;
+
+// curl_multi_poll() and curl_multi_wakeup() are available since libcurl 7.68.0
+#if LIBCURL_VERSION_NUM >= 0x074400
+#define CURL_MULTI_HAS_WAKEUP
+#else
+// Without curl_multi_wakeup() new requests are only noticed once the current wait times out, so keep it short.
+static const int EVENT_LOOP_WAIT_TIMEOUT_MS = 10;
+#endif
+
+struct CurlMultiHttpClient::PendingRequest
+{
+    PendingRequest(const std::shared_ptr<HttpRequest>& request, const HttpResponseReceivedHandler& handler,
+                   Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                   Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) :
+        m_request(request),
+        m_response(Aws::MakeShared<StandardHttpResponse>(CURL_MULTI_HTTP_CLIENT_TAG, *request)),
+        m_handler(handler),
+        m_readLimiter(readLimiter),
+        m_writeLimiter(writeLimiter),
+        m_context(nullptr),
+        m_started(false)
+    {}
+
+    std::shared_ptr<HttpRequest> m_request;
+    std::shared_ptr<StandardHttpResponse> m_response;
+    HttpResponseReceivedHandler m_handler;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_readLimiter;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_writeLimiter;
+    CurlRequestContext* m_context;
+    // false while the handle waits for the write limiter before it is added to the multi handle.
+    bool m_started;
+};
+
+struct CurlMultiHttpClient::EventLoop
+{
+    EventLoop() :
+        m_multiHandle(curl_multi_init()),
+        m_running(true),
+        m_wakeUpRequested(false)
+    {}
+
+    void WakeUp()
+    {
+#ifdef CURL_MULTI_HAS_WAKEUP
+        curl_multi_wakeup(m_multiHandle);
+#else
+        std::lock_guard<std::mutex> locker(m_queueLock);
+        m_wakeUpRequested = true;
+        m_signal.notify_one();
+#endif
+    }
+
+    CURLM* m_multiHandle;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    // guards m_pendingRequests and m_wakeUpRequested; everything else is only touched by the event loop thread.
+    std::mutex m_queueLock;
+    std::condition_variable m_signal;
+    bool m_wakeUpRequested;
+    Aws::Deque<PendingRequest*> m_pendingRequests;
+    // every transfer holding a handle, including those not started yet or paused for their rate limiters.
+    Aws::Set<PendingRequest*> m_activeTransfers;
+};
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig),
+    m_nextEventLoop(0)
+{
+    unsigned eventLoopCount = (std::max)(clientConfig.httpEventLoopThreads, 1u);
+    AWS_LOGSTREAM_INFO(CURL_MULTI_HTTP_CLIENT_TAG, "Starting " << eventLoopCount << " event loop threads.");
+
+    for (unsigned i = 0; i < eventLoopCount; ++i)
+    {
+        m_eventLoops.push_back(Aws::New<EventLoop>(CURL_MULTI_HTTP_CLIENT_TAG));
+    }
+
+    for (auto eventLoop : m_eventLoops)
+    {
+        if (!eventLoop->m_multiHandle)
+        {
+            AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "curl_multi_init failed to allocate.");
+            eventLoop->m_running = false;
+            continue;
+        }
+        eventLoop->m_thread = std::thread(&CurlMultiHttpClient::RunEventLoop, this, eventLoop);
+    }
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    AWS_LOGSTREAM_INFO(CURL_MULTI_HTTP_CLIENT_TAG, "Stopping event loop threads.");
+    for (auto eventLoop : m_eventLoops)
+    {
+        eventLoop->m_running = false;
+        if (eventLoop->m_multiHandle)
+        {
+            eventLoop->WakeUp();
+        }
+    }
+
+    // A loop thread that is still draining wakes up the other loops when it releases a handle, so every thread has to be
+    // joined before any loop or multi handle is torn down.
+    for (auto eventLoop : m_eventLoops)
+    {
+        if (eventLoop->m_thread.joinable())
+        {
+            eventLoop->m_thread.join();
+        }
+    }
+
+    for (auto eventLoop : m_eventLoops)
+    {
+        if (eventLoop->m_multiHandle)
+        {
+            curl_multi_cleanup(eventLoop->m_multiHandle);
+        }
+        Aws::Delete(eventLoop);
+    }
+    m_eventLoops.clear();
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+        const HttpResponseReceivedHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    PendingRequest* pendingRequest = Aws::New<PendingRequest>(CURL_MULTI_HTTP_CLIENT_TAG, request, handler, readLimiter, writeLimiter);
+    EventLoop* eventLoop = m_eventLoops[m_nextEventLoop.fetch_add(1) % m_eventLoops.size()];
+
+    {
+        std::lock_guard<std::mutex> locker(eventLoop->m_queueLock);
+        if (eventLoop->m_running.load())
+        {
+            eventLoop->m_pendingRequests.push_back(pendingRequest);
+            pendingRequest = nullptr;
+        }
+    }
+
+    if (pendingRequest)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop is not running, failing request to " << request->GetURIString());
+        Aws::Delete(pendingRequest);
+        if (handler)
+        {
+            handler(request, nullptr);
+        }
+        return;
+    }
+
+    AWS_LOGSTREAM_TRACE(CURL_MULTI_HTTP_CLIENT_TAG, "Queued request to " << request->GetURIString());
+    eventLoop->WakeUp();
+}
+
+void CurlMultiHttpClient::AdmitPendingRequests(EventLoop* eventLoop) const
+{
+    for (;;)
+    {
+        PendingRequest* pendingRequest = nullptr;
+        {
+            std::lock_guard<std::mutex> locker(eventLoop->m_queueLock);
+            if (eventLoop->m_pendingRequests.empty())
+            {
+                return;
+            }
+            pendingRequest = eventLoop->m_pendingRequests.front();
+        }
+
+        // Only this thread pops from the queue, so the front entry stays put while the handle is configured.
+        CurlRequestContext* context = PrepareRequest(*pendingRequest->m_request, pendingRequest->m_response,
+                pendingRequest->m_readLimiter, pendingRequest->m_writeLimiter, false /*waitForHandle*/, true /*deferRateLimitDelays*/);
+        if (!context)
+        {
+            AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Connection pool exhausted, request stays queued until a handle is released.");
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> locker(eventLoop->m_queueLock);
+            eventLoop->m_pendingRequests.pop_front();
+        }
+
+        pendingRequest->m_context = context;
+        curl_easy_setopt(GetCurlHandle(context), CURLOPT_PRIVATE, pendingRequest);
+        eventLoop->m_activeTransfers.insert(pendingRequest);
+        if (GetStartDelay(context).count() == 0)
+        {
+            StartTransfer(eventLoop, pendingRequest);
+        }
+    }
+}
+
+void CurlMultiHttpClient::StartTransfer(EventLoop* eventLoop, PendingRequest* pendingRequest) const
+{
+    CURLMcode multiResponseCode = curl_multi_add_handle(eventLoop->m_multiHandle, GetCurlHandle(pendingRequest->m_context));
+    if (multiResponseCode != CURLM_OK)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "curl_multi_add_handle returned error code " << multiResponseCode
+                << " - " << curl_multi_strerror(multiResponseCode));
+        CompleteTransfer(eventLoop, pendingRequest, CURLE_FAILED_INIT);
+        return;
+    }
+    pendingRequest->m_started = true;
+}
+
+std::chrono::milliseconds CurlMultiHttpClient::ServiceRateLimitedTransfers(EventLoop* eventLoop) const
+{
+    // starting a transfer may complete it, which takes it out of the set.
+    Aws::Vector<PendingRequest*> transfersToStart;
+    std::chrono::milliseconds wait(0);
+    for (auto pendingRequest : eventLoop->m_activeTransfers)
+    {
+        auto transferWait = pendingRequest->m_started ? ResumeRateLimitedTransfer(pendingRequest->m_context) : GetStartDelay(pendingRequest->m_context);
+        if (transferWait.count() > 0)
+        {
+            wait = wait.count() > 0 ? (std::min)(wait, transferWait) : transferWait;
+        }
+        else if (!pendingRequest->m_started)
+        {
+            transfersToStart.push_back(pendingRequest);
+        }
+    }
+
+    for (auto pendingRequest : transfersToStart)
+    {
+        StartTransfer(eventLoop, pendingRequest);
+    }
+    return wait;
+}
+
+void CurlMultiHttpClient::CompleteTransfer(EventLoop* eventLoop, PendingRequest* pendingRequest, CURLcode curlResponseCode) const
+{
+    if (pendingRequest->m_started)
+    {
+        curl_multi_remove_handle(eventLoop->m_multiHandle, GetCurlHandle(pendingRequest->m_context));
+    }
+    eventLoop->m_activeTransfers.erase(pendingRequest);
+
+    std::shared_ptr<HttpResponse> response = CompleteRequest(pendingRequest->m_context, curlResponseCode);
+    if (pendingRequest->m_handler)
+    {
+        pendingRequest->m_handler(pendingRequest->m_request, response);
+    }
+    Aws::Delete(pendingRequest);
+
+    // A handle went back to the pool; other loops may have requests waiting for one.
+    WakeUpEventLoops();
+}
+
+void CurlMultiHttpClient::WakeUpEventLoops() const
+{
+    if (m_eventLoops.size() < 2)
+    {
+        return;
+    }
+
+    for (auto eventLoop : m_eventLoops)
+    {
+        bool hasPendingRequests = false;
+        {
+            std::lock_guard<std::mutex> locker(eventLoop->m_queueLock);
+            hasPendingRequests = !eventLoop->m_pendingRequests.empty();
+        }
+
+        if (hasPendingRequests)
+        {
+            eventLoop->WakeUp();
+        }
+    }
+}
+
+void CurlMultiHttpClient::RunEventLoop(EventLoop* eventLoop)
+{
+    AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop started with multi handle " << eventLoop->m_multiHandle);
+    CURLM* multiHandle = eventLoop->m_multiHandle;
+
+    while (eventLoop->m_running.load())
+    {
+        AdmitPendingRequests(eventLoop);
+        // transfers waiting for their rate limiters cut the wait short, nothing on the sockets would wake the loop for them.
+        std::chrono::milliseconds rateLimitWait = ServiceRateLimitedTransfers(eventLoop);
+        int pollTimeoutMs = EVENT_LOOP_POLL_TIMEOUT_MS;
+        if (rateLimitWait.count() > 0)
+        {
+            pollTimeoutMs = static_cast<int>((std::min)(rateLimitWait.count(), static_cast<std::chrono::milliseconds::rep>(pollTimeoutMs)));
+        }
+
+        int runningHandles = 0;
+        CURLMcode multiResponseCode = curl_multi_perform(multiHandle, &runningHandles);
+        if (multiResponseCode != CURLM_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "curl_multi_perform returned error code " << multiResponseCode
+                    << " - " << curl_multi_strerror(multiResponseCode));
+        }
+
+        int messagesInQueue = 0;
+        while (CURLMsg* message = curl_multi_info_read(multiHandle, &messagesInQueue))
+        {
+            if (message->msg == CURLMSG_DONE)
+            {
+                char* privateData = nullptr;
+                curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &privateData);
+                CompleteTransfer(eventLoop, reinterpret_cast<PendingRequest*>(privateData), message->data.result);
+            }
+        }
+
+#ifdef CURL_MULTI_HAS_WAKEUP
+        curl_multi_poll(multiHandle, nullptr, 0, pollTimeoutMs, nullptr);
+#else
+        if (eventLoop->m_activeTransfers.empty())
+        {
+            std::unique_lock<std::mutex> locker(eventLoop->m_queueLock);
+            eventLoop->m_signal.wait_for(locker, std::chrono::milliseconds(pollTimeoutMs),
+                    [eventLoop](){ return eventLoop->m_wakeUpRequested || !eventLoop->m_running.load(); });
+            eventLoop->m_wakeUpRequested = false;
+        }
+        else
+        {
+            curl_multi_wait(multiHandle, nullptr, 0, (std::min)(pollTimeoutMs, EVENT_LOOP_WAIT_TIMEOUT_MS), nullptr);
+        }
+#endif
+    }
+
+    AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Event loop stopping with " << eventLoop->m_activeTransfers.size() << " transfers in flight.");
+    while (!eventLoop->m_activeTransfers.empty())
+    {
+        CompleteTransfer(eventLoop, *eventLoop->m_activeTransfers.begin(), CURLE_ABORTED_BY_CALLBACK);
+    }
+
+    Aws::Deque<PendingRequest*> pendingRequests;
+    {
+        std::lock_guard<std::mutex> locker(eventLoop->m_queueLock);
+        pendingRequests.swap(eventLoop->m_pendingRequests);
+    }
+
+    for (auto pendingRequest : pendingRequests)
+    {
+        if (pendingRequest->m_handler)
+        {
+            pendingRequest->m_handler(pendingRequest->m_request, nullptr);
+        }
+        Aws::Delete(pendingRequest);
+    }
+}
@@ -0,0 +1,93 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlShareHandle.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Utils::Logging;
+using namespace Aws::Http;
+
+static const char* CURL_SHARE_HANDLE_TAG = "CurlShareHandle";
+
+static std::mutex s_processShareHandleLock;
+static std::shared_ptr<CurlShareHandle> s_processShareHandle;
+
+CurlShareHandle::CurlShareHandle() :
+    m_shareHandle(curl_share_init()), m_sharingConnections(false)
+{
+    if (!m_shareHandle)
+    {
+        AWS_LOGSTREAM_ERROR(CURL_SHARE_HANDLE_TAG, "curl_share_init failed, DNS and TLS session caches will not be shared.");
+        return;
+    }
+
+    curl_share_setopt(m_shareHandle, CURLSHOPT_LOCKFUNC, &CurlShareHandle::LockShareData);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_UNLOCKFUNC, &CurlShareHandle::UnlockShareData);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900 //7.57.0
+    m_sharingConnections = curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT) == CURLSHE_OK;
+#endif
+    AWS_LOGSTREAM_INFO(CURL_SHARE_HANDLE_TAG, "Initialized curl share handle " << m_shareHandle
+            << (m_sharingConnections ? " sharing DNS, TLS sessions and connections." : " sharing DNS and TLS sessions."));
+}
+
+CurlShareHandle::~CurlShareHandle()
+{
+    if (m_shareHandle)
+    {
+        AWS_LOGSTREAM_INFO(CURL_SHARE_HANDLE_TAG, "Cleaning up curl share handle " << m_shareHandle);
+        CURLSHcode result = curl_share_cleanup(m_shareHandle);
+        if (result != CURLSHE_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CURL_SHARE_HANDLE_TAG, "curl_share_cleanup failed: " << curl_share_strerror(result));
+        }
+    }
+}
+
+std::shared_ptr<CurlShareHandle> CurlShareHandle::GetProcessShareHandle()
+{
+    std::lock_guard<std::mutex> locker(s_processShareHandleLock);
+    if (!s_processShareHandle)
+    {
+        s_processShareHandle = Aws::MakeShared<CurlShareHandle>(CURL_SHARE_HANDLE_TAG);
+    }
+    return s_processShareHandle;
+}
+
+void CurlShareHandle::ReleaseProcessShareHandle()
+{
+    std::lock_guard<std::mutex> locker(s_processShareHandleLock);
+    s_processShareHandle = nullptr;
+}
+
+void CurlShareHandle::LockShareData(CURL*, curl_lock_data data, curl_lock_access, void* userData)
+{
+    // shared and single access both take the lock exclusively, the critical sections are only cache lookups and updates.
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST)
+    {
+        static_cast<CurlShareHandle*>(userData)->m_dataLocks[data].lock();
+    }
+}
+
+void CurlShareHandle::UnlockShareData(CURL*, curl_lock_data data, void* userData)
+{
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST)
+    {
+        static_cast<CurlShareHandle*>(userData)->m_dataLocks[data].unlock();
+    }
+}
@@ -121,6 +121,13 @@ private:
         fileSize.LowPart = ffd.nFileSizeLow;
         entry.fileSize = static_cast<int64_t>(fileSize.QuadPart);
 
+        // FILETIME counts 100 nanosecond intervals since January 1, 1601.
+        static const int64_t FILETIME_TO_UNIX_EPOCH = 116444736000000000LL;
+        LARGE_INTEGER lastWriteTime;
+        lastWriteTime.HighPart = ffd.ftLastWriteTime.dwHighDateTime;
+        lastWriteTime.LowPart = ffd.ftLastWriteTime.dwLowDateTime;
+        entry.lastModified = Aws::Utils::DateTime((static_cast<int64_t>(lastWriteTime.QuadPart) - FILETIME_TO_UNIX_EPOCH) / 10000000 * 1000);
+
         if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
         {
             entry.fileType = FileType::Directory;
@@ -0,0 +1,248 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/Outcome.h>
+
+#include <cstring>
+
+#if defined(__SSE4_2__) && defined(__x86_64__)
+#include <nmmintrin.h>
+#define CRC32C_USE_SSE42
+#elif defined(__ARM_FEATURE_CRC32) && defined(__aarch64__)
+#include <arm_acle.h>
+#define CRC32_USE_ARMV8
+#endif
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+namespace
+{
+    const uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+    const uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;
+
+    /**
+     * Lookup tables for the slicing-by-8 software implementation of a reflected CRC.
+     */
+    struct CrcTables
+    {
+        explicit CrcTables(uint32_t polynomial)
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+                }
+                m_table[0][i] = crc;
+            }
+
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (int slice = 1; slice < 8; ++slice)
+                {
+                    m_table[slice][i] = (m_table[slice - 1][i] >> 8) ^ m_table[0][m_table[slice - 1][i] & 0xFF];
+                }
+            }
+        }
+
+        uint32_t m_table[8][256];
+    };
+
+    inline uint32_t LoadLittleEndian32(const unsigned char* data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    uint32_t UpdateCrcSoftware(const CrcTables& tables, uint32_t crc, const unsigned char* data, size_t length)
+    {
+        const uint32_t (&t)[8][256] = tables.m_table;
+        crc = ~crc;
+        while (length >= 8)
+        {
+            uint32_t low = crc ^ LoadLittleEndian32(data);
+            uint32_t high = LoadLittleEndian32(data + 4);
+            crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+                t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+            data += 8;
+            length -= 8;
+        }
+
+        while (length--)
+        {
+            crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+        }
+        return ~crc;
+    }
+
+    uint32_t UpdateCrc32(uint32_t crc, const unsigned char* data, size_t length)
+    {
+#if defined(CRC32_USE_ARMV8)
+        crc = ~crc;
+        while (length >= 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = __crc32d(crc, word);
+            data += 8;
+            length -= 8;
+        }
+        while (length--)
+        {
+            crc = __crc32b(crc, *data++);
+        }
+        return ~crc;
+#else
+        static const CrcTables tables(CRC32_POLYNOMIAL);
+        return UpdateCrcSoftware(tables, crc, data, length);
+#endif
+    }
+
+    uint32_t UpdateCrc32c(uint32_t crc, const unsigned char* data, size_t length)
+    {
+#if defined(CRC32C_USE_SSE42)
+        uint64_t crc64 = ~crc;
+        while (length >= 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            data += 8;
+            length -= 8;
+        }
+        crc = static_cast<uint32_t>(crc64);
+        while (length--)
+        {
+            crc = _mm_crc32_u8(crc, *data++);
+        }
+        return ~crc;
+#elif defined(CRC32_USE_ARMV8)
+        crc = ~crc;
+        while (length >= 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = __crc32cd(crc, word);
+            data += 8;
+            length -= 8;
+        }
+        while (length--)
+        {
+            crc = __crc32cb(crc, *data++);
+        }
+        return ~crc;
+#else
+        static const CrcTables tables(CRC32C_POLYNOMIAL);
+        return UpdateCrcSoftware(tables, crc, data, length);
+#endif
+    }
+
+    HashResult ToHashResult(uint32_t crc)
+    {
+        ByteBuffer checksum(4);
+        checksum[0] = static_cast<unsigned char>(crc >> 24);
+        checksum[1] = static_cast<unsigned char>(crc >> 16);
+        checksum[2] = static_cast<unsigned char>(crc >> 8);
+        checksum[3] = static_cast<unsigned char>(crc);
+        return HashResult(std::move(checksum));
+    }
+
+    template<typename UPDATE_FN>
+    HashResult CalculateCrcOnStream(Aws::IStream& stream, UPDATE_FN update)
+    {
+        auto currentPos = stream.tellg();
+        if (currentPos == -1)
+        {
+            currentPos = 0;
+            stream.clear();
+        }
+        stream.seekg(0, stream.beg);
+
+        uint32_t crc = 0;
+        char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+        while (stream.good())
+        {
+            stream.read(streamBuffer, Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+            auto bytesRead = stream.gcount();
+
+            if (bytesRead > 0)
+            {
+                crc = update(crc, reinterpret_cast<const unsigned char*>(streamBuffer), static_cast<size_t>(bytesRead));
+            }
+        }
+
+        stream.clear();
+        stream.seekg(currentPos, stream.beg);
+
+        return ToHashResult(crc);
+    }
+} // anonymous namespace
+
+CRC32::CRC32() :
+    m_runningCrc(0)
+{
+}
+
+HashResult CRC32::Calculate(const Aws::String& str)
+{
+    return ToHashResult(UpdateCrc32(0, reinterpret_cast<const unsigned char*>(str.c_str()), str.size()));
+}
+
+HashResult CRC32::Calculate(Aws::IStream& stream)
+{
+    return CalculateCrcOnStream(stream, UpdateCrc32);
+}
+
+void CRC32::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_runningCrc = UpdateCrc32(m_runningCrc, buffer, bufferSize);
+}
+
+HashResult CRC32::GetHash()
+{
+    HashResult result = ToHashResult(m_runningCrc);
+    m_runningCrc = 0;
+    return result;
+}
+
+CRC32C::CRC32C() :
+    m_runningCrc(0)
+{
+}
+
+HashResult CRC32C::Calculate(const Aws::String& str)
+{
+    return ToHashResult(UpdateCrc32c(0, reinterpret_cast<const unsigned char*>(str.c_str()), str.size()));
+}
+
+HashResult CRC32C::Calculate(Aws::IStream& stream)
+{
+    return CalculateCrcOnStream(stream, UpdateCrc32c);
+}
+
+void CRC32C::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_runningCrc = UpdateCrc32c(m_runningCrc, buffer, bufferSize);
+}
+
+HashResult CRC32C::GetHash()
+{
+    HashResult result = ToHashResult(m_runningCrc);
+    m_runningCrc = 0;
+    return result;
+}
@@ -0,0 +1,31 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/Outcome.h>
+
+using namespace Aws::Utils::Crypto;
+
+void Hash::Update(unsigned char* buffer, size_t bufferSize)
+{
+    m_pendingData.append(reinterpret_cast<const char*>(buffer), bufferSize);
+}
+
+HashResult Hash::GetHash()
+{
+    Aws::String pendingData;
+    pendingData.swap(m_pendingData);
+    return Calculate(pendingData);
+}
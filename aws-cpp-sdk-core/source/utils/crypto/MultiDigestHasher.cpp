@@ -0,0 +1,243 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/MultiDigestHasher.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/Outcome.h>
+
+#include <condition_variable>
+#include <mutex>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* MULTI_DIGEST_HASHER_TAG = "MultiDigestHasher";
+
+namespace
+{
+    /**
+     * Feeds one chunk to a set of hashes. Shared with the executor tasks so a task that only gets to run after the chunk has
+     * been fully digested (by other threads) finds nothing left to claim and returns without touching the chunk.
+     */
+    class DigestChunkJob
+    {
+    public:
+        DigestChunkJob(const Aws::Vector<Hash*>& hashes, unsigned char* data, size_t length) :
+            m_hashes(hashes), m_data(data), m_length(length), m_nextHash(0), m_remaining(hashes.size())
+        {
+        }
+
+        /**
+         * Claims and runs hashes until none are left.
+         */
+        void RunAvailable()
+        {
+            for (;;)
+            {
+                size_t index;
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    if (m_nextHash >= m_hashes.size())
+                    {
+                        return;
+                    }
+                    index = m_nextHash++;
+                }
+
+                m_hashes[index]->Update(m_data, m_length);
+
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (--m_remaining == 0)
+                {
+                    m_done.notify_all();
+                }
+            }
+        }
+
+        void WaitForCompletion()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_done.wait(locker, [this]() { return m_remaining == 0; });
+        }
+
+    private:
+        Aws::Vector<Hash*> m_hashes;
+        unsigned char* m_data;
+        size_t m_length;
+        size_t m_nextHash;
+        size_t m_remaining;
+        std::mutex m_lock;
+        std::condition_variable m_done;
+    };
+
+    size_t ReadChunk(Aws::IStream& stream, ByteBuffer& buffer)
+    {
+        if (!stream.good())
+        {
+            return 0;
+        }
+        stream.read(reinterpret_cast<char*>(buffer.GetUnderlyingData()), static_cast<std::streamsize>(buffer.GetLength()));
+        return static_cast<size_t>(stream.gcount());
+    }
+} // anonymous namespace
+
+MultiDigestHasher::MultiDigestHasher()
+{
+}
+
+MultiDigestHasher::MultiDigestHasher(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor) :
+    m_executor(executor)
+{
+}
+
+void MultiDigestHasher::AddDigest(DigestAlgorithm algorithm)
+{
+    if (HasDigest(algorithm))
+    {
+        return;
+    }
+
+    Digest digest;
+    digest.m_algorithm = algorithm;
+    switch (algorithm)
+    {
+        case DigestAlgorithm::SHA256:
+            digest.m_hash = CreateSha256Implementation();
+            break;
+        case DigestAlgorithm::MD5:
+            digest.m_hash = CreateMD5Implementation();
+            break;
+        case DigestAlgorithm::CRC32:
+            digest.m_hash = Aws::MakeShared<CRC32>(MULTI_DIGEST_HASHER_TAG);
+            break;
+        case DigestAlgorithm::CRC32C:
+            digest.m_hash = Aws::MakeShared<CRC32C>(MULTI_DIGEST_HASHER_TAG);
+            break;
+    }
+    m_digests.push_back(std::move(digest));
+}
+
+bool MultiDigestHasher::HasDigest(DigestAlgorithm algorithm) const
+{
+    for (const auto& digest : m_digests)
+    {
+        if (digest.m_algorithm == algorithm)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+const ByteBuffer& MultiDigestHasher::GetDigest(DigestAlgorithm algorithm) const
+{
+    for (const auto& digest : m_digests)
+    {
+        if (digest.m_algorithm == algorithm)
+        {
+            return digest.m_result;
+        }
+    }
+
+    static const ByteBuffer emptyDigest;
+    return emptyDigest;
+}
+
+bool MultiDigestHasher::Calculate(Aws::IStream& stream)
+{
+    auto currentPos = stream.tellg();
+    if (currentPos == -1)
+    {
+        currentPos = 0;
+        stream.clear();
+    }
+    stream.seekg(0, stream.beg);
+
+    if (m_executor && m_digests.size() > 1)
+    {
+        CalculateInParallel(stream);
+    }
+    else
+    {
+        CalculateSerially(stream);
+    }
+
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    bool success = true;
+    for (auto& digest : m_digests)
+    {
+        auto hashResult = digest.m_hash->GetHash();
+        if (hashResult.IsSuccess())
+        {
+            digest.m_result = hashResult.GetResult();
+        }
+        else
+        {
+            AWS_LOGSTREAM_ERROR(MULTI_DIGEST_HASHER_TAG, "Failed to compute digest " << static_cast<int>(digest.m_algorithm) << " of stream.");
+            digest.m_result = ByteBuffer();
+            success = false;
+        }
+    }
+    return success;
+}
+
+void MultiDigestHasher::CalculateSerially(Aws::IStream& stream)
+{
+    // the chunk stays in cache while every digest runs over it.
+    ByteBuffer buffer(SERIAL_CHUNK_SIZE);
+    size_t length = 0;
+    while ((length = ReadChunk(stream, buffer)) > 0)
+    {
+        for (auto& digest : m_digests)
+        {
+            digest.m_hash->Update(buffer.GetUnderlyingData(), length);
+        }
+    }
+}
+
+void MultiDigestHasher::CalculateInParallel(Aws::IStream& stream)
+{
+    Aws::Vector<Hash*> hashes;
+    hashes.reserve(m_digests.size());
+    for (auto& digest : m_digests)
+    {
+        hashes.push_back(digest.m_hash.get());
+    }
+
+    // double buffered: the next chunk is read while the digests of the current one are computed.
+    ByteBuffer buffers[2] = { ByteBuffer(PARALLEL_CHUNK_SIZE), ByteBuffer(PARALLEL_CHUNK_SIZE) };
+    size_t current = 0;
+    size_t length = ReadChunk(stream, buffers[current]);
+    while (length > 0)
+    {
+        auto job = Aws::MakeShared<DigestChunkJob>(MULTI_DIGEST_HASHER_TAG, hashes, buffers[current].GetUnderlyingData(), length);
+        for (size_t i = 1; i < hashes.size(); ++i)
+        {
+            m_executor->Submit([job]() { job->RunAvailable(); });
+        }
+
+        size_t next = 1 - current;
+        length = ReadChunk(stream, buffers[next]);
+
+        job->RunAvailable();
+        job->WaitForCompletion();
+        current = next;
+    }
+}
@@ -128,6 +128,8 @@ namespace Aws
                 m_hashBuffer(nullptr),
                 m_hashObjectLength(0),
                 m_hashObject(nullptr),
+                m_runningHashHandle(nullptr),
+                m_runningHashFailed(false),
                 m_algorithmMutex()
             {
                 NTSTATUS status = BCryptOpenAlgorithmProvider(&m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, isHMAC ? BCRYPT_ALG_HANDLE_HMAC_FLAG : 0);
@@ -170,6 +172,11 @@ namespace Aws
 
             BCryptHashImpl::~BCryptHashImpl()
             {
+                if (m_runningHashHandle)
+                {
+                    BCryptDestroyHash(m_runningHashHandle);
+                }
+
                 Aws::DeleteArray(m_hashObject);
                 Aws::DeleteArray(m_hashBuffer);
 
@@ -310,6 +317,75 @@ namespace Aws
                 return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
             }
 
+            void BCryptHashImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                if (!IsValid() || m_runningHashFailed)
+                {
+                    return;
+                }
+
+                std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+                if (!m_runningHashHandle)
+                {
+                    NTSTATUS status = BCryptCreateHash(m_algorithmHandle, &m_runningHashHandle, nullptr, 0, nullptr, 0, 0);
+                    if (!NT_SUCCESS(status))
+                    {
+                        AWS_LOGSTREAM_ERROR(logTag, "Error creating hash handle.");
+                        m_runningHashHandle = nullptr;
+                        m_runningHashFailed = true;
+                        return;
+                    }
+                }
+
+                NTSTATUS status = BCryptHashData(m_runningHashHandle, buffer, static_cast<ULONG>(bufferSize), 0);
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOGSTREAM_ERROR(logTag, "Error computing hash.");
+                    m_runningHashFailed = true;
+                }
+            }
+
+            HashResult BCryptHashImpl::GetHash()
+            {
+                if (!IsValid())
+                {
+                    return HashResult();
+                }
+
+                std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+                bool failed = m_runningHashFailed;
+                m_runningHashFailed = false;
+                if (!m_runningHashHandle)
+                {
+                    if (failed)
+                    {
+                        return HashResult();
+                    }
+
+                    // nothing was fed through Update(), this is the digest of empty input.
+                    BCryptHashContext context(m_algorithmHandle, m_hashObject, m_hashObjectLength);
+                    if (!context.IsValid())
+                    {
+                        AWS_LOGSTREAM_ERROR(logTag, "Error creating hash handle.");
+                        return HashResult();
+                    }
+                    return HashData(context, nullptr, 0);
+                }
+
+                NTSTATUS status = BCryptFinishHash(m_runningHashHandle, m_hashBuffer, m_hashBufferLength, 0);
+                BCryptDestroyHash(m_runningHashHandle);
+                m_runningHashHandle = nullptr;
+                if (failed || !NT_SUCCESS(status))
+                {
+                    AWS_LOGSTREAM_ERROR(logTag, "Error obtaining computed hash");
+                    return HashResult();
+                }
+
+                return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
+            }
+
             MD5BcryptImpl::MD5BcryptImpl() :
                 m_impl(BCRYPT_MD5_ALGORITHM, false)
             {
@@ -325,6 +401,16 @@ namespace Aws
                 return m_impl.Calculate(stream);
             }
 
+            void MD5BcryptImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                m_impl.Update(buffer, bufferSize);
+            }
+
+            HashResult MD5BcryptImpl::GetHash()
+            {
+                return m_impl.GetHash();
+            }
+
             Sha256BcryptImpl::Sha256BcryptImpl() :
                 m_impl(BCRYPT_SHA256_ALGORITHM, false)
             {
@@ -340,6 +426,16 @@ namespace Aws
                 return m_impl.Calculate(stream);
             }
 
+            void Sha256BcryptImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                m_impl.Update(buffer, bufferSize);
+            }
+
+            HashResult Sha256BcryptImpl::GetHash()
+            {
+                return m_impl.GetHash();
+            }
+
             Sha256HMACBcryptImpl::Sha256HMACBcryptImpl() :
                 m_impl(BCRYPT_SHA256_ALGORITHM, true)
             {
@@ -111,6 +111,20 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            void MD5CommonCryptoImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                CC_MD5_Update(&m_ctx, buffer, static_cast<CC_LONG>(bufferSize));
+            }
+
+            HashResult MD5CommonCryptoImpl::GetHash()
+            {
+                ByteBuffer hash(CC_MD5_DIGEST_LENGTH);
+                CC_MD5_Final(hash.GetUnderlyingData(), &m_ctx);
+                CC_MD5_Init(&m_ctx);
+
+                return HashResult(std::move(hash));
+            }
+
             HashResult Sha256CommonCryptoImpl::Calculate(const Aws::String& str)
             {
                 ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
@@ -148,6 +162,20 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            void Sha256CommonCryptoImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                CC_SHA256_Update(&m_ctx, buffer, static_cast<CC_LONG>(bufferSize));
+            }
+
+            HashResult Sha256CommonCryptoImpl::GetHash()
+            {
+                ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
+                CC_SHA256_Final(hash.GetUnderlyingData(), &m_ctx);
+                CC_SHA256_Init(&m_ctx);
+
+                return HashResult(std::move(hash));
+            }
+
             HashResult Sha256HMACCommonCryptoImpl::Calculate(const ByteBuffer& toSign, const ByteBuffer& secret)
             {
                 unsigned int length = CC_SHA256_DIGEST_LENGTH;
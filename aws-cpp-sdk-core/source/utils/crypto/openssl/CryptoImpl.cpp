@@ -147,6 +147,19 @@ namespace Aws
                 EVP_MD_CTX *m_ctx;
             };
 
+            MD5OpenSSLImpl::MD5OpenSSLImpl() :
+                m_ctx(nullptr)
+            {
+            }
+
+            MD5OpenSSLImpl::~MD5OpenSSLImpl()
+            {
+                if (m_ctx)
+                {
+                    EVP_MD_CTX_destroy(m_ctx);
+                }
+            }
+
             HashResult MD5OpenSSLImpl::Calculate(const Aws::String& str)
             {
                 OpensslCtxRAIIGuard guard;
@@ -197,6 +210,45 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            void MD5OpenSSLImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                if (!m_ctx)
+                {
+                    m_ctx = EVP_MD_CTX_create();
+                    assert(m_ctx != nullptr);
+                    EVP_MD_CTX_set_flags(m_ctx, EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
+                    EVP_DigestInit_ex(m_ctx, EVP_md5(), nullptr);
+                }
+                EVP_DigestUpdate(m_ctx, buffer, bufferSize);
+            }
+
+            HashResult MD5OpenSSLImpl::GetHash()
+            {
+                if (!m_ctx)
+                {
+                    return Calculate(Aws::String());
+                }
+
+                ByteBuffer hash(EVP_MD_size(EVP_md5()));
+                EVP_DigestFinal_ex(m_ctx, hash.GetUnderlyingData(), nullptr);
+                EVP_DigestInit_ex(m_ctx, EVP_md5(), nullptr);
+
+                return HashResult(std::move(hash));
+            }
+
+            Sha256OpenSSLImpl::Sha256OpenSSLImpl() :
+                m_ctx(nullptr)
+            {
+            }
+
+            Sha256OpenSSLImpl::~Sha256OpenSSLImpl()
+            {
+                if (m_ctx)
+                {
+                    EVP_MD_CTX_destroy(m_ctx);
+                }
+            }
+
             HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
             {
                 OpensslCtxRAIIGuard guard;
@@ -247,6 +299,31 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            void Sha256OpenSSLImpl::Update(unsigned char* buffer, size_t bufferSize)
+            {
+                if (!m_ctx)
+                {
+                    m_ctx = EVP_MD_CTX_create();
+                    assert(m_ctx != nullptr);
+                    EVP_DigestInit_ex(m_ctx, EVP_sha256(), nullptr);
+                }
+                EVP_DigestUpdate(m_ctx, buffer, bufferSize);
+            }
+
+            HashResult Sha256OpenSSLImpl::GetHash()
+            {
+                if (!m_ctx)
+                {
+                    return Calculate(Aws::String());
+                }
+
+                ByteBuffer hash(EVP_MD_size(EVP_sha256()));
+                EVP_DigestFinal_ex(m_ctx, hash.GetUnderlyingData(), nullptr);
+                EVP_DigestInit_ex(m_ctx, EVP_sha256(), nullptr);
+
+                return HashResult(std::move(hash));
+            }
+
             class HMACRAIIGuard {
             public:
                 HMACRAIIGuard() {
@@ -0,0 +1,549 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstdlib>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+static const size_t READ_BUFFER_SIZE = 16 * 1024;
+
+JsonReader::JsonReader(Aws::IStream& stream) :
+    m_stream(stream),
+    m_buffer(READ_BUFFER_SIZE),
+    m_position(0),
+    m_end(0),
+    m_consumed(0),
+    m_state(State::VALUE),
+    m_hasPeeked(false),
+    m_peeked(JsonToken::END_DOCUMENT),
+    m_bool(false)
+{
+}
+
+JsonToken JsonReader::Next()
+{
+    if (m_hasPeeked)
+    {
+        m_hasPeeked = false;
+        return m_peeked;
+    }
+    return ReadToken();
+}
+
+JsonToken JsonReader::Peek()
+{
+    if (!m_hasPeeked)
+    {
+        m_peeked = ReadToken();
+        m_hasPeeked = true;
+    }
+    return m_peeked;
+}
+
+double JsonReader::GetDouble() const
+{
+    return std::strtod(m_value.c_str(), nullptr);
+}
+
+long long JsonReader::GetInt64() const
+{
+    if (m_value.find_first_of(".eE") != Aws::String::npos)
+    {
+        return static_cast<long long>(GetDouble());
+    }
+    return std::strtoll(m_value.c_str(), nullptr, 10);
+}
+
+bool JsonReader::SkipValue()
+{
+    return SkipValue(Next());
+}
+
+bool JsonReader::SkipValue(JsonToken token)
+{
+    switch (token)
+    {
+        case JsonToken::STRING:
+        case JsonToken::NUMBER:
+        case JsonToken::BOOLEAN:
+        case JsonToken::NULL_VALUE:
+            return true;
+        case JsonToken::BEGIN_OBJECT:
+        case JsonToken::BEGIN_ARRAY:
+            break;
+        default:
+            return false;
+    }
+
+    size_t depth = 1;
+    while (depth > 0)
+    {
+        switch (Next())
+        {
+            case JsonToken::BEGIN_OBJECT:
+            case JsonToken::BEGIN_ARRAY:
+                ++depth;
+                break;
+            case JsonToken::END_OBJECT:
+            case JsonToken::END_ARRAY:
+                --depth;
+                break;
+            case JsonToken::END_DOCUMENT:
+            case JsonToken::PARSE_ERROR:
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+JsonToken JsonReader::ReadToken()
+{
+    for (;;)
+    {
+        int c = SkipWhitespace();
+        switch (m_state)
+        {
+            case State::FAILED:
+                return JsonToken::PARSE_ERROR;
+            case State::DONE:
+                return c < 0 ? JsonToken::END_DOCUMENT : Fail("unexpected data after the document");
+            case State::VALUE:
+                return ReadValue(c);
+            case State::FIRST_VALUE_OR_END:
+                if (c == ']')
+                {
+                    return EndContainer('[');
+                }
+                return ReadValue(c);
+            case State::FIRST_NAME_OR_END:
+                if (c == '}')
+                {
+                    return EndContainer('{');
+                }
+                // fall through
+            case State::NAME:
+                if (c != '"')
+                {
+                    return Fail("expected a member name");
+                }
+                GetChar();
+                if (!ReadString(m_name))
+                {
+                    return JsonToken::PARSE_ERROR;
+                }
+                if (SkipWhitespace() != ':')
+                {
+                    return Fail("expected ':' after a member name");
+                }
+                GetChar();
+                m_state = State::VALUE;
+                return JsonToken::NAME;
+            case State::COMMA_OR_END:
+                if (c == ',')
+                {
+                    GetChar();
+                    m_state = m_containers.back() == '{' ? State::NAME : State::VALUE;
+                    continue;
+                }
+                if (c == '}' || c == ']')
+                {
+                    return EndContainer(c == '}' ? '{' : '[');
+                }
+                return Fail("expected ',' or the end of the container");
+        }
+    }
+}
+
+JsonToken JsonReader::ReadValue(int c)
+{
+    switch (c)
+    {
+        case '{':
+        case '[':
+            GetChar();
+            m_containers.push_back(static_cast<char>(c));
+            m_state = c == '{' ? State::FIRST_NAME_OR_END : State::FIRST_VALUE_OR_END;
+            return c == '{' ? JsonToken::BEGIN_OBJECT : JsonToken::BEGIN_ARRAY;
+        case '"':
+            GetChar();
+            m_value.clear();
+            return ReadString(m_value) ? EndScalar(JsonToken::STRING) : JsonToken::PARSE_ERROR;
+        case 't':
+            m_bool = true;
+            return ReadLiteral("true") ? EndScalar(JsonToken::BOOLEAN) : JsonToken::PARSE_ERROR;
+        case 'f':
+            m_bool = false;
+            return ReadLiteral("false") ? EndScalar(JsonToken::BOOLEAN) : JsonToken::PARSE_ERROR;
+        case 'n':
+            return ReadLiteral("null") ? EndScalar(JsonToken::NULL_VALUE) : JsonToken::PARSE_ERROR;
+        case -1:
+            return Fail("unexpected end of input");
+        default:
+            if (c == '-' || (c >= '0' && c <= '9'))
+            {
+                return ReadNumber() ? EndScalar(JsonToken::NUMBER) : JsonToken::PARSE_ERROR;
+            }
+            return Fail("expected a value");
+    }
+}
+
+JsonToken JsonReader::EndContainer(char container)
+{
+    if (m_containers.empty() || m_containers.back() != container)
+    {
+        return Fail("mismatched end of container");
+    }
+    GetChar();
+    m_containers.pop_back();
+    m_state = m_containers.empty() ? State::DONE : State::COMMA_OR_END;
+    return container == '{' ? JsonToken::END_OBJECT : JsonToken::END_ARRAY;
+}
+
+JsonToken JsonReader::EndScalar(JsonToken token)
+{
+    m_state = m_containers.empty() ? State::DONE : State::COMMA_OR_END;
+    return token;
+}
+
+JsonToken JsonReader::Fail(const char* reason)
+{
+    if (m_state != State::FAILED)
+    {
+        Aws::StringStream ss;
+        ss << "Failed to parse JSON at offset " << m_consumed + m_position << ": " << reason;
+        m_errorMessage = ss.str();
+        m_state = State::FAILED;
+    }
+    return JsonToken::PARSE_ERROR;
+}
+
+bool JsonReader::Refill()
+{
+    m_consumed += m_end;
+    m_position = 0;
+    m_end = 0;
+    if (m_stream.good())
+    {
+        m_stream.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_end = static_cast<size_t>(m_stream.gcount());
+    }
+    return m_end > 0;
+}
+
+int JsonReader::PeekChar()
+{
+    if (m_position == m_end && !Refill())
+    {
+        return -1;
+    }
+    return static_cast<unsigned char>(m_buffer[m_position]);
+}
+
+int JsonReader::GetChar()
+{
+    int c = PeekChar();
+    if (c >= 0)
+    {
+        ++m_position;
+    }
+    return c;
+}
+
+int JsonReader::SkipWhitespace()
+{
+    for (;;)
+    {
+        int c = PeekChar();
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        {
+            return c;
+        }
+        ++m_position;
+    }
+}
+
+bool JsonReader::ReadString(Aws::String& out)
+{
+    out.clear();
+    for (;;)
+    {
+        if (m_position == m_end && !Refill())
+        {
+            Fail("unterminated string");
+            return false;
+        }
+
+        // copy the run of plain characters in one go.
+        const char* start = m_buffer.data() + m_position;
+        const char* end = m_buffer.data() + m_end;
+        const char* special = start;
+        while (special != end && *special != '"' && *special != '\\')
+        {
+            ++special;
+        }
+        out.append(start, special);
+        m_position += static_cast<size_t>(special - start);
+        if (special == end)
+        {
+            continue;
+        }
+
+        ++m_position;
+        if (*special == '"')
+        {
+            return true;
+        }
+        if (!ReadEscape(out))
+        {
+            return false;
+        }
+    }
+}
+
+bool JsonReader::ReadEscape(Aws::String& out)
+{
+    int c = GetChar();
+    switch (c)
+    {
+        case '"':
+        case '\\':
+        case '/':
+            out.push_back(static_cast<char>(c));
+            return true;
+        case 'b':
+            out.push_back('\b');
+            return true;
+        case 'f':
+            out.push_back('\f');
+            return true;
+        case 'n':
+            out.push_back('\n');
+            return true;
+        case 'r':
+            out.push_back('\r');
+            return true;
+        case 't':
+            out.push_back('\t');
+            return true;
+        case 'u':
+            break;
+        default:
+            Fail("invalid escape sequence");
+            return false;
+    }
+
+    unsigned codePoint = 0;
+    if (!ReadHex4(codePoint))
+    {
+        return false;
+    }
+    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+    {
+        unsigned lowSurrogate = 0;
+        if (GetChar() != '\\' || GetChar() != 'u' || !ReadHex4(lowSurrogate) || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+        {
+            Fail("invalid surrogate pair");
+            return false;
+        }
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+    }
+    else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+    {
+        Fail("invalid surrogate pair");
+        return false;
+    }
+
+    if (codePoint < 0x80)
+    {
+        out.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    return true;
+}
+
+bool JsonReader::ReadHex4(unsigned& codePoint)
+{
+    codePoint = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        int c = GetChar();
+        unsigned digit;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<unsigned>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<unsigned>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<unsigned>(c - 'A' + 10);
+        }
+        else
+        {
+            Fail("invalid \\u escape");
+            return false;
+        }
+        codePoint = (codePoint << 4) | digit;
+    }
+    return true;
+}
+
+bool JsonReader::ReadNumber()
+{
+    m_value.clear();
+    for (;;)
+    {
+        int c = PeekChar();
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')
+        {
+            m_value.push_back(static_cast<char>(c));
+            ++m_position;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    char* end = nullptr;
+    std::strtod(m_value.c_str(), &end);
+    if (end != m_value.c_str() + m_value.size())
+    {
+        Fail("invalid number");
+        return false;
+    }
+    return true;
+}
+
+bool JsonReader::ReadLiteral(const char* literal)
+{
+    for (const char* expected = literal; *expected; ++expected)
+    {
+        if (GetChar() != static_cast<unsigned char>(*expected))
+        {
+            Fail("invalid literal");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, Aws::String& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::STRING)
+    {
+        value = reader.TakeValue();
+        return true;
+    }
+    return reader.SkipValue(token);
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, bool& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::BOOLEAN)
+    {
+        value = reader.GetBool();
+        return true;
+    }
+    return reader.SkipValue(token);
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, int& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::NUMBER)
+    {
+        value = static_cast<int>(reader.GetInt64());
+        return true;
+    }
+    return reader.SkipValue(token);
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, long long& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::NUMBER)
+    {
+        value = reader.GetInt64();
+        return true;
+    }
+    return reader.SkipValue(token);
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, double& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::NUMBER)
+    {
+        value = reader.GetDouble();
+        return true;
+    }
+    return reader.SkipValue(token);
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, ByteBuffer& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::STRING)
+    {
+        value = HashingUtils::Base64Decode(reader.GetValue());
+        return true;
+    }
+    return reader.SkipValue(token);
+}
+
+bool Aws::Utils::Json::ReadJsonValue(JsonReader& reader, DateTime& value)
+{
+    JsonToken token = reader.Next();
+    if (token == JsonToken::NUMBER)
+    {
+        value = DateTime(reader.GetDouble());
+        return true;
+    }
+    if (token == JsonToken::STRING)
+    {
+        value = DateTime(reader.GetValue(), DateFormat::ISO_8601);
+        return true;
+    }
+    return reader.SkipValue(token);
+}
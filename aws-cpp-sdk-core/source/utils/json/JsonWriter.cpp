@@ -0,0 +1,313 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonWriter.h>
+#include <aws/core/utils/HashingUtils.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+// a buffer that grew past this for one large payload is released instead of being kept for the thread's lifetime.
+static const size_t MAX_RETAINED_BUFFER_SIZE = 1024 * 1024;
+
+static const char* JSON_WRITER_TAG = "JsonWriter";
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            // GetOutput() copies the text into an Aws::String, so no memory of the buffer is ever handed to the caller and the
+            // standard allocator will do. That also keeps freeing the buffer a thread holds on to independent of the SDK's state.
+            struct JsonWriterBuffer
+            {
+                std::string text;
+            };
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
+
+struct JsonWriterThreadBuffer
+{
+    JsonWriterThreadBuffer() : inUse(false) {}
+
+    JsonWriterBuffer buffer;
+    bool inUse;
+};
+
+static JsonWriterThreadBuffer& GetThreadBuffer()
+{
+    static thread_local JsonWriterThreadBuffer threadBuffer;
+    return threadBuffer;
+}
+
+JsonWriter::JsonWriter() :
+    m_output(nullptr),
+    m_usesThreadBuffer(false),
+    m_needsComma(false)
+{
+    auto& threadBuffer = GetThreadBuffer();
+    if (!threadBuffer.inUse)
+    {
+        threadBuffer.inUse = true;
+        threadBuffer.buffer.text.clear();
+        m_output = &threadBuffer.buffer;
+        m_usesThreadBuffer = true;
+    }
+    else
+    {
+        m_output = Aws::New<JsonWriterBuffer>(JSON_WRITER_TAG);
+    }
+}
+
+JsonWriter::~JsonWriter()
+{
+    if (m_usesThreadBuffer)
+    {
+        auto& threadBuffer = GetThreadBuffer();
+        if (threadBuffer.buffer.text.capacity() > MAX_RETAINED_BUFFER_SIZE)
+        {
+            std::string().swap(threadBuffer.buffer.text);
+        }
+        threadBuffer.inUse = false;
+    }
+    else
+    {
+        Aws::Delete(m_output);
+    }
+}
+
+size_t JsonWriter::GetLength() const
+{
+    return m_output->text.size();
+}
+
+void JsonWriter::BeginValue()
+{
+    if (m_needsComma)
+    {
+        m_output->text.push_back(',');
+    }
+    m_needsComma = true;
+}
+
+void JsonWriter::WriteStartObject()
+{
+    BeginValue();
+    m_output->text.push_back('{');
+    m_needsComma = false;
+}
+
+void JsonWriter::WriteEndObject()
+{
+    m_output->text.push_back('}');
+    m_needsComma = true;
+}
+
+void JsonWriter::WriteStartArray()
+{
+    BeginValue();
+    m_output->text.push_back('[');
+    m_needsComma = false;
+}
+
+void JsonWriter::WriteEndArray()
+{
+    m_output->text.push_back(']');
+    m_needsComma = true;
+}
+
+void JsonWriter::WriteName(const char* name)
+{
+    BeginValue();
+    WriteEscaped(name, std::strlen(name));
+    m_output->text.push_back(':');
+    m_needsComma = false;
+}
+
+void JsonWriter::WriteName(const Aws::String& name)
+{
+    BeginValue();
+    WriteEscaped(name.c_str(), name.size());
+    m_output->text.push_back(':');
+    m_needsComma = false;
+}
+
+void JsonWriter::WriteString(const char* value)
+{
+    BeginValue();
+    WriteEscaped(value, std::strlen(value));
+}
+
+void JsonWriter::WriteString(const Aws::String& value)
+{
+    BeginValue();
+    WriteEscaped(value.c_str(), value.size());
+}
+
+void JsonWriter::WriteBool(bool value)
+{
+    BeginValue();
+    m_output->text.append(value ? "true" : "false");
+}
+
+void JsonWriter::WriteInt64(long long value)
+{
+    BeginValue();
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    char* start = end;
+    // negate as unsigned, so the minimum value doesn't overflow.
+    unsigned long long magnitude = value < 0 ? 0ull - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+    do
+    {
+        *--start = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+    {
+        *--start = '-';
+    }
+    m_output->text.append(start, end);
+}
+
+void JsonWriter::WriteDouble(double value)
+{
+    if (std::isnan(value) || std::isinf(value))
+    {
+        WriteNull();
+        return;
+    }
+    if (std::floor(value) == value && std::fabs(value) < 1e15)
+    {
+        WriteInt64(static_cast<long long>(value));
+        return;
+    }
+
+    BeginValue();
+    // the shortest of the two precisions that reads back as the same value, like cJSON does.
+    char number[32];
+    int length = snprintf(number, sizeof(number), "%1.15g", value);
+    if (std::strtod(number, nullptr) != value)
+    {
+        length = snprintf(number, sizeof(number), "%1.17g", value);
+    }
+    m_output->text.append(number, static_cast<size_t>(length));
+}
+
+void JsonWriter::WriteNull()
+{
+    BeginValue();
+    m_output->text.append("null");
+}
+
+Aws::String JsonWriter::GetOutput() const
+{
+    return Aws::String(m_output->text.c_str(), m_output->text.size());
+}
+
+void JsonWriter::WriteEscaped(const char* value, size_t length)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    m_output->text.push_back('"');
+    const char* end = value + length;
+    const char* runStart = value;
+    for (const char* current = value; current != end; ++current)
+    {
+        unsigned char c = static_cast<unsigned char>(*current);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        m_output->text.append(runStart, current);
+        runStart = current + 1;
+        switch (c)
+        {
+            case '"':
+                m_output->text.append("\\\"");
+                break;
+            case '\\':
+                m_output->text.append("\\\\");
+                break;
+            case '\b':
+                m_output->text.append("\\b");
+                break;
+            case '\f':
+                m_output->text.append("\\f");
+                break;
+            case '\n':
+                m_output->text.append("\\n");
+                break;
+            case '\r':
+                m_output->text.append("\\r");
+                break;
+            case '\t':
+                m_output->text.append("\\t");
+                break;
+            default:
+            {
+                char escape[] = { '\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0xF] };
+                m_output->text.append(escape, sizeof(escape));
+                break;
+            }
+        }
+    }
+    m_output->text.append(runStart, end);
+    m_output->text.push_back('"');
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, const Aws::String& value)
+{
+    writer.WriteString(value);
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, bool value)
+{
+    writer.WriteBool(value);
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, int value)
+{
+    writer.WriteInt64(value);
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, long long value)
+{
+    writer.WriteInt64(value);
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, double value)
+{
+    writer.WriteDouble(value);
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, const ByteBuffer& value)
+{
+    writer.WriteString(HashingUtils::Base64Encode(value));
+}
+
+void Aws::Utils::Json::WriteJsonValue(JsonWriter& writer, const DateTime& value)
+{
+    writer.WriteDouble(value.SecondsWithMSPrecision());
+}
@@ -0,0 +1,383 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/FileRangeStreamBuf.h>
+#include <aws/core/utils/StringUtils.h>
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+#ifdef _WIN32
+            ReadOnlyFile::ReadOnlyFile(const Aws::String& path) :
+                m_handle(CreateFileW(StringUtils::ToWString(path.c_str()).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL, nullptr))
+            {
+            }
+
+            ReadOnlyFile::~ReadOnlyFile()
+            {
+                if (IsOpen())
+                {
+                    CloseHandle(m_handle);
+                }
+            }
+
+            bool ReadOnlyFile::IsOpen() const
+            {
+                return m_handle != INVALID_HANDLE_VALUE;
+            }
+
+            int64_t ReadOnlyFile::ReadAt(uint64_t offset, char* buffer, std::size_t length) const
+            {
+                OVERLAPPED overlapped;
+                memset(&overlapped, 0, sizeof(overlapped));
+                overlapped.Offset = static_cast<DWORD>(offset);
+                overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+                DWORD bytesRead = 0;
+                DWORD toRead = static_cast<DWORD>((std::min)(length, static_cast<std::size_t>(MAXDWORD)));
+                if (!ReadFile(m_handle, buffer, toRead, &bytesRead, &overlapped))
+                {
+                    return GetLastError() == ERROR_HANDLE_EOF ? 0 : -1;
+                }
+                return static_cast<int64_t>(bytesRead);
+            }
+
+            bool ReadOnlyFile::GetLastModified(Aws::Utils::DateTime& lastModified) const
+            {
+                FILETIME lastWriteTime;
+                if (!GetFileTime(m_handle, nullptr, nullptr, &lastWriteTime))
+                {
+                    return false;
+                }
+                // 100 nanosecond intervals since 1601-01-01, truncated to seconds since the epoch.
+                ULARGE_INTEGER intervals;
+                intervals.LowPart = lastWriteTime.dwLowDateTime;
+                intervals.HighPart = lastWriteTime.dwHighDateTime;
+                int64_t seconds = static_cast<int64_t>(intervals.QuadPart / 10000000ULL) - 11644473600LL;
+                lastModified = Aws::Utils::DateTime(seconds * 1000);
+                return true;
+            }
+
+            WritableFile::WritableFile(const Aws::String& path) :
+                m_handle(CreateFileW(StringUtils::ToWString(path.c_str()).c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+                    FILE_ATTRIBUTE_NORMAL, nullptr))
+            {
+            }
+
+            WritableFile::~WritableFile()
+            {
+                if (IsOpen())
+                {
+                    CloseHandle(m_handle);
+                }
+            }
+
+            bool WritableFile::IsOpen() const
+            {
+                return m_handle != INVALID_HANDLE_VALUE;
+            }
+
+            bool WritableFile::Allocate(uint64_t size)
+            {
+                LARGE_INTEGER distance;
+                distance.QuadPart = static_cast<LONGLONG>(size);
+                // extending the file with SetEndOfFile allocates its clusters.
+                return SetFilePointerEx(m_handle, distance, nullptr, FILE_BEGIN) && SetEndOfFile(m_handle);
+            }
+
+            bool WritableFile::WriteAt(uint64_t offset, const char* buffer, std::size_t length) const
+            {
+                while (length > 0)
+                {
+                    OVERLAPPED overlapped;
+                    memset(&overlapped, 0, sizeof(overlapped));
+                    overlapped.Offset = static_cast<DWORD>(offset);
+                    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+                    DWORD bytesWritten = 0;
+                    DWORD toWrite = static_cast<DWORD>((std::min)(length, static_cast<std::size_t>(MAXDWORD)));
+                    if (!WriteFile(m_handle, buffer, toWrite, &bytesWritten, &overlapped) || bytesWritten == 0)
+                    {
+                        return false;
+                    }
+                    offset += bytesWritten;
+                    buffer += bytesWritten;
+                    length -= bytesWritten;
+                }
+                return true;
+            }
+
+            bool WritableFile::Sync() const
+            {
+                return FlushFileBuffers(m_handle) != 0;
+            }
+#else
+            ReadOnlyFile::ReadOnlyFile(const Aws::String& path) : m_fd(open(path.c_str(), O_RDONLY | O_CLOEXEC))
+            {
+            }
+
+            ReadOnlyFile::~ReadOnlyFile()
+            {
+                if (IsOpen())
+                {
+                    close(m_fd);
+                }
+            }
+
+            bool ReadOnlyFile::IsOpen() const
+            {
+                return m_fd >= 0;
+            }
+
+            int64_t ReadOnlyFile::ReadAt(uint64_t offset, char* buffer, std::size_t length) const
+            {
+                for (;;)
+                {
+                    ssize_t bytesRead = pread(m_fd, buffer, length, static_cast<off_t>(offset));
+                    if (bytesRead >= 0 || errno != EINTR)
+                    {
+                        return static_cast<int64_t>(bytesRead);
+                    }
+                }
+            }
+
+            bool ReadOnlyFile::GetLastModified(Aws::Utils::DateTime& lastModified) const
+            {
+                struct stat fileInfo;
+                if (fstat(m_fd, &fileInfo) != 0)
+                {
+                    return false;
+                }
+                lastModified = Aws::Utils::DateTime(static_cast<int64_t>(fileInfo.st_mtime) * 1000);
+                return true;
+            }
+
+            WritableFile::WritableFile(const Aws::String& path) : m_fd(open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644))
+            {
+            }
+
+            WritableFile::~WritableFile()
+            {
+                if (IsOpen())
+                {
+                    close(m_fd);
+                }
+            }
+
+            bool WritableFile::IsOpen() const
+            {
+                return m_fd >= 0;
+            }
+
+            bool WritableFile::Allocate(uint64_t size)
+            {
+                if (ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+                {
+                    return false;
+                }
+#if defined(__linux__) && !defined(__ANDROID__)
+                // reserving the blocks up front keeps parts written out of order from fragmenting the file. Not every file system
+                // supports it, the file is usable either way.
+                if (size > 0)
+                {
+                    posix_fallocate(m_fd, 0, static_cast<off_t>(size));
+                }
+#endif
+                return true;
+            }
+
+            bool WritableFile::WriteAt(uint64_t offset, const char* buffer, std::size_t length) const
+            {
+                while (length > 0)
+                {
+                    ssize_t bytesWritten = pwrite(m_fd, buffer, length, static_cast<off_t>(offset));
+                    if (bytesWritten < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if (bytesWritten <= 0)
+                    {
+                        return false;
+                    }
+                    offset += static_cast<uint64_t>(bytesWritten);
+                    buffer += bytesWritten;
+                    length -= static_cast<std::size_t>(bytesWritten);
+                }
+                return true;
+            }
+
+            bool WritableFile::Sync() const
+            {
+                return fsync(m_fd) == 0;
+            }
+#endif
+
+            FileRangeStreamBuf::FileRangeStreamBuf(const std::shared_ptr<const ReadOnlyFile>& file, uint64_t rangeBegin, uint64_t rangeLength) :
+                m_file(file), m_rangeBegin(rangeBegin), m_rangeLength(rangeLength), m_readPosition(0)
+            {
+                setg(m_getBuffer, m_getBuffer, m_getBuffer);
+            }
+
+            FileRangeStreamBuf::int_type FileRangeStreamBuf::underflow()
+            {
+                if (gptr() < egptr())
+                {
+                    return traits_type::to_int_type(*gptr());
+                }
+
+                std::size_t toRead = static_cast<std::size_t>((std::min)(m_rangeLength - m_readPosition, static_cast<uint64_t>(GET_BUFFER_SIZE)));
+                int64_t bytesRead = toRead ? m_file->ReadAt(m_rangeBegin + m_readPosition, m_getBuffer, toRead) : 0;
+                if (bytesRead <= 0)
+                {
+                    return traits_type::eof();
+                }
+
+                m_readPosition += static_cast<uint64_t>(bytesRead);
+                setg(m_getBuffer, m_getBuffer, m_getBuffer + bytesRead);
+                return traits_type::to_int_type(*gptr());
+            }
+
+            std::streamsize FileRangeStreamBuf::xsgetn(char_type* s, std::streamsize n)
+            {
+                std::streamsize copied = (std::min)(n, static_cast<std::streamsize>(egptr() - gptr()));
+                if (copied > 0)
+                {
+                    std::memcpy(s, gptr(), static_cast<std::size_t>(copied));
+                    gbump(static_cast<int>(copied));
+                }
+
+                while (copied < n && m_readPosition < m_rangeLength)
+                {
+                    std::size_t toRead = static_cast<std::size_t>((std::min)(static_cast<uint64_t>(n - copied), m_rangeLength - m_readPosition));
+                    int64_t bytesRead = m_file->ReadAt(m_rangeBegin + m_readPosition, s + copied, toRead);
+                    if (bytesRead <= 0)
+                    {
+                        break;
+                    }
+                    m_readPosition += static_cast<uint64_t>(bytesRead);
+                    copied += static_cast<std::streamsize>(bytesRead);
+                }
+                return copied;
+            }
+
+            std::streamsize FileRangeStreamBuf::showmanyc()
+            {
+                return m_readPosition < m_rangeLength ? static_cast<std::streamsize>(m_rangeLength - m_readPosition) : -1;
+            }
+
+            FileRangeStreamBuf::pos_type FileRangeStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+            {
+                if (dir == std::ios_base::beg)
+                {
+                    return seekpos(off, which);
+                }
+                else if (dir == std::ios_base::end)
+                {
+                    return seekpos(static_cast<off_type>(m_rangeLength) + off, which);
+                }
+                else if (dir == std::ios_base::cur)
+                {
+                    return seekpos(static_cast<off_type>(m_readPosition) - (egptr() - gptr()) + off, which);
+                }
+
+                return pos_type(off_type(-1));
+            }
+
+            FileRangeStreamBuf::pos_type FileRangeStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+            {
+                if (!(which & std::ios_base::in) || static_cast<off_type>(pos) < 0 || static_cast<uint64_t>(static_cast<off_type>(pos)) > m_rangeLength)
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                m_readPosition = static_cast<uint64_t>(static_cast<off_type>(pos));
+                setg(m_getBuffer, m_getBuffer, m_getBuffer);
+                return pos;
+            }
+
+            FileRangeWriteStreamBuf::FileRangeWriteStreamBuf(const std::shared_ptr<const WritableFile>& file, uint64_t rangeBegin, uint64_t rangeLength) :
+                m_file(file), m_rangeBegin(rangeBegin), m_rangeLength(rangeLength), m_writePosition(0)
+            {
+            }
+
+            FileRangeWriteStreamBuf::int_type FileRangeWriteStreamBuf::overflow(int_type c)
+            {
+                if (traits_type::eq_int_type(c, traits_type::eof()))
+                {
+                    return traits_type::not_eof(c);
+                }
+
+                char_type character = traits_type::to_char_type(c);
+                return xsputn(&character, 1) == 1 ? c : traits_type::eof();
+            }
+
+            std::streamsize FileRangeWriteStreamBuf::xsputn(const char_type* s, std::streamsize n)
+            {
+                if (n <= 0 || m_writePosition + static_cast<uint64_t>(n) > m_rangeLength ||
+                    !m_file->WriteAt(m_rangeBegin + m_writePosition, s, static_cast<std::size_t>(n)))
+                {
+                    return 0;
+                }
+
+                m_writePosition += static_cast<uint64_t>(n);
+                return n;
+            }
+
+            FileRangeWriteStreamBuf::pos_type FileRangeWriteStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+            {
+                if (dir == std::ios_base::beg)
+                {
+                    return seekpos(off, which);
+                }
+                else if (dir == std::ios_base::end)
+                {
+                    return seekpos(static_cast<off_type>(m_rangeLength) + off, which);
+                }
+                else if (dir == std::ios_base::cur)
+                {
+                    return seekpos(static_cast<off_type>(m_writePosition) + off, which);
+                }
+
+                return pos_type(off_type(-1));
+            }
+
+            FileRangeWriteStreamBuf::pos_type FileRangeWriteStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+            {
+                if (!(which & std::ios_base::out) || static_cast<off_type>(pos) < 0 || static_cast<uint64_t>(static_cast<off_type>(pos)) > m_rangeLength)
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                m_writePosition = static_cast<uint64_t>(static_cast<off_type>(pos));
+                return pos;
+            }
+        }
+    }
+}
@@ -18,24 +18,37 @@
 #include <thread>
 #include <cassert>
 
-static const char* POOLED_CLASS_TAG = "PooledThreadExecutor";
+static const char* EXECUTOR_CLASS_TAG = "Executor";
 
 using namespace Aws::Utils::Threading;
 
+bool Executor::SubmitTask(ExecutorTask&& task)
+{
+    //std::function needs a copyable target, so share ownership of the move-only task.
+    auto sharedTask = Aws::MakeShared<ExecutorTask>(EXECUTOR_CLASS_TAG, std::move(task));
+    return SubmitToThread([sharedTask]() { (*sharedTask)(); });
+}
+
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
-    auto main = [fx, this] { 
-        fx(); 
-        Detach(std::this_thread::get_id()); 
-    };
+    return SubmitTask(ExecutorTask(std::move(fx)));
+}
+
+void DefaultExecutor::RunTask(ExecutorTask task)
+{
+    task();
+    Detach(std::this_thread::get_id());
+}
 
+bool DefaultExecutor::SubmitTask(ExecutorTask&& task)
+{
     State expected;
     do
     {
         expected = State::Free;
         if(m_state.compare_exchange_strong(expected, State::Locked))
         {
-            std::thread t(main);
+            std::thread t(&DefaultExecutor::RunTask, this, std::move(task));
             const auto id = t.get_id(); // copy the id before we std::move the thread
             m_threads.emplace(id, std::move(t));
             m_state = State::Free;
@@ -88,7 +101,7 @@ PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, OverflowPolicy overf
 {
     for (size_t index = 0; index < m_poolSize; ++index)
     {
-        m_threadTaskHandles.push_back(Aws::New<ThreadTask>(POOLED_CLASS_TAG, *this));
+        m_threadTaskHandles.push_back(Aws::New<ThreadTask>(EXECUTOR_CLASS_TAG, *this));
     }
 }
 
@@ -106,34 +119,27 @@ PooledThreadExecutor::~PooledThreadExecutor()
         Aws::Delete(threadTask);
     }
 
-    while(m_tasks.size() > 0)
-    {
-        std::function<void()>* fn = m_tasks.front();
-        m_tasks.pop();
-
-        if(fn)
-        {
-            Aws::Delete(fn);
-        }
-    }
-
+    Aws::Queue<ExecutorTask> empty;
+    std::swap(m_tasks, empty);
 }
 
 bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
 {
-    //avoid the need to do copies inside the lock. Instead lets do a pointer push.
-    std::function<void()>* fnCpy = Aws::New<std::function<void()>>(POOLED_CLASS_TAG, std::forward<std::function<void()>>(fn));
+    return SubmitTask(ExecutorTask(std::move(fn)));
+}
 
+bool PooledThreadExecutor::SubmitTask(ExecutorTask&& task)
+{
     {
         std::lock_guard<std::mutex> locker(m_queueLock);
 
         if (m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY && m_tasks.size() >= m_poolSize)
         {
-            Aws::Delete(fnCpy);
             return false;
         }
 
-        m_tasks.push(fnCpy);
+        //tasks are moved into the queue's own storage, so queueing does not allocate per task.
+        m_tasks.push(std::move(task));
     }
 
     m_sync.Release();
@@ -141,21 +147,18 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
     return true;
 }
 
-std::function<void()>* PooledThreadExecutor::PopTask()
+bool PooledThreadExecutor::PopTask(ExecutorTask& task)
 {
     std::lock_guard<std::mutex> locker(m_queueLock);
 
     if (m_tasks.size() > 0)
     {
-        std::function<void()>* fn = m_tasks.front();
-        if (fn)
-        {           
-            m_tasks.pop();
-            return fn;
-        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop();
+        return true;
     }
 
-    return nullptr;
+    return false;
 }
 
 bool PooledThreadExecutor::HasTasks()
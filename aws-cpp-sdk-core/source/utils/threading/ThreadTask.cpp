@@ -35,11 +35,10 @@ void ThreadTask::MainTaskRunner()
     {        
         while (m_continue && m_executor.HasTasks())
         {      
-            auto fn = m_executor.PopTask();
-            if(fn)
+            ExecutorTask task;
+            if(m_executor.PopTask(task))
             {
-                (*fn)();
-                Aws::Delete(fn);               
+                task();
             }
         }
      
@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/TimerWheel.h>
+
+#include <algorithm>
+
+using namespace Aws::Utils::Threading;
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tickDuration, size_t slotCount) :
+    m_start(std::chrono::steady_clock::now()),
+    m_tickDuration((std::max)(tickDuration, std::chrono::milliseconds(1))),
+    m_slots((std::max)(slotCount, static_cast<size_t>(1))),
+    m_currentTick(0),
+    m_pendingTimers(0),
+    m_stopping(false)
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_stopping = true;
+    }
+    m_timerScheduled.notify_one();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void TimerWheel::Schedule(std::chrono::milliseconds delay, ExecutorTask&& task, ExecutorTask&& onCancel)
+{
+    auto ticks = (std::max)(static_cast<uint64_t>((delay.count() + m_tickDuration.count() - 1) / m_tickDuration.count()), static_cast<uint64_t>(1));
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        if (m_stopping)
+        {
+            // scheduled while the wheel is being destroyed, nothing would advance it anymore.
+            locker.unlock();
+            if (onCancel)
+            {
+                onCancel();
+            }
+            return;
+        }
+
+        uint64_t now = CurrentTick();
+        // an idle wheel hasn't been advanced, skip the empty ticks instead of walking through them.
+        if (m_pendingTimers == 0)
+        {
+            m_currentTick = (std::max)(m_currentTick, now);
+        }
+
+        Timer timer;
+        timer.m_expiryTick = (std::max)(now + ticks, m_currentTick + 1);
+        timer.m_task = std::move(task);
+        timer.m_onCancel = std::move(onCancel);
+        m_slots[timer.m_expiryTick % m_slots.size()].push_back(std::move(timer));
+        ++m_pendingTimers;
+
+        if (!m_thread.joinable())
+        {
+            m_thread = std::thread(&TimerWheel::Run, this);
+        }
+    }
+    m_timerScheduled.notify_one();
+}
+
+size_t TimerWheel::GetPendingTimers() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_pendingTimers;
+}
+
+uint64_t TimerWheel::CurrentTick() const
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start);
+    return static_cast<uint64_t>(elapsed.count() / m_tickDuration.count());
+}
+
+void TimerWheel::CollectDueTimers(uint64_t tick, Aws::Vector<ExecutorTask>& dueTasks)
+{
+    auto& slot = m_slots[tick % m_slots.size()];
+    for (size_t i = 0; i < slot.size();)
+    {
+        // a slot also holds timers of later rotations of the wheel.
+        if (slot[i].m_expiryTick <= tick)
+        {
+            dueTasks.push_back(std::move(slot[i].m_task));
+            if (i + 1 != slot.size())
+            {
+                slot[i] = std::move(slot.back());
+            }
+            slot.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void TimerWheel::Run()
+{
+    Aws::Vector<ExecutorTask> dueTasks;
+    std::unique_lock<std::mutex> locker(m_lock);
+    while (!m_stopping)
+    {
+        if (m_pendingTimers == 0)
+        {
+            m_timerScheduled.wait(locker, [this]() { return m_stopping || m_pendingTimers > 0; });
+            continue;
+        }
+
+        uint64_t now = CurrentTick();
+        if (now <= m_currentTick)
+        {
+            m_timerScheduled.wait_until(locker, m_start + m_tickDuration * static_cast<int64_t>(m_currentTick + 1));
+            continue;
+        }
+
+        while (m_currentTick < now && dueTasks.size() < m_pendingTimers)
+        {
+            CollectDueTimers(++m_currentTick, dueTasks);
+        }
+        // every pending timer has been collected if the loop stopped early, the remaining ticks are empty.
+        m_currentTick = now;
+        m_pendingTimers -= dueTasks.size();
+
+        locker.unlock();
+        for (auto& task : dueTasks)
+        {
+            task();
+        }
+        dueTasks.clear();
+        locker.lock();
+    }
+
+    // the dropped tasks are destroyed outside the lock as well, whatever they captured may call back into the wheel.
+    Aws::Vector<Timer> cancelledTimers;
+    for (auto& slot : m_slots)
+    {
+        for (auto& timer : slot)
+        {
+            cancelledTimers.push_back(std::move(timer));
+        }
+        slot.clear();
+    }
+    m_pendingTimers = 0;
+    locker.unlock();
+    for (auto& timer : cancelledTimers)
+    {
+        timer.m_task.Reset();
+        if (timer.m_onCancel)
+        {
+            timer.m_onCancel();
+        }
+    }
+}
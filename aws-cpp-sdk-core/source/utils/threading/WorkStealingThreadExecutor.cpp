@@ -0,0 +1,512 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/core/utils/threading/WorkStealingThreadExecutor.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace Aws::Utils::Threading;
+
+static const char* WORK_STEALING_CLASS_TAG = "WorkStealingThreadExecutor";
+// Capacity of each worker's own deque. When it is full, the worker spills into the shared injection queue.
+static const size_t WORKER_QUEUE_CAPACITY = 256;
+// Rounds of stealing attempts (with a yield in between) before an idle worker goes to sleep.
+static const int IDLE_SPIN_COUNT = 16;
+// Upper bound on how long a blocked submitter waits before re-checking the injection queue.
+static const std::chrono::milliseconds SUBMIT_RETRY_INTERVAL(10);
+
+static size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+static void PinCurrentThreadToProcessor(size_t workerIndex)
+{
+    unsigned processorCount = std::thread::hardware_concurrency();
+    if (processorCount == 0)
+    {
+        return;
+    }
+
+    unsigned processor = static_cast<unsigned>(workerIndex % processorCount);
+#if defined(_WIN32)
+    if (processor < sizeof(DWORD_PTR) * 8 && SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << processor))
+    {
+        return;
+    }
+#elif defined(__linux__)
+    cpu_set_t processorSet;
+    CPU_ZERO(&processorSet);
+    CPU_SET(processor, &processorSet);
+    if (sched_setaffinity(0, sizeof(processorSet), &processorSet) == 0)
+    {
+        return;
+    }
+#endif
+    AWS_LOGSTREAM_WARN(WORK_STEALING_CLASS_TAG, "Unable to pin worker " << workerIndex << " to processor " << processor);
+}
+
+/**
+ * Bounded multi-producer/multi-consumer queue. Each cell carries a sequence number which tells producers and consumers whether
+ * the cell is ready for them, so both sides only contend on a single atomic position counter.
+ */
+class WorkStealingThreadExecutor::InjectionQueue
+{
+public:
+    InjectionQueue(size_t capacity) :
+        m_mask(RoundUpToPowerOfTwo((std::max)(capacity, static_cast<size_t>(2))) - 1),
+        m_cells(Aws::NewArray<Cell>(m_mask + 1, WORK_STEALING_CLASS_TAG)),
+        m_enqueuePosition(0),
+        m_dequeuePosition(0)
+    {
+        for (size_t i = 0; i <= m_mask; ++i)
+        {
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~InjectionQueue()
+    {
+        Aws::DeleteArray(m_cells);
+    }
+
+    /**
+     * Moves task into the queue on success; on failure task is left untouched.
+     */
+    bool Enqueue(ExecutorTask& task)
+    {
+        Cell* cell = nullptr;
+        size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_cells[position & m_mask];
+            size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+            intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->m_task = std::move(task);
+        cell->m_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Dequeue(ExecutorTask& task)
+    {
+        Cell* cell = nullptr;
+        size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &m_cells[position & m_mask];
+            size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+            intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (difference == 0)
+            {
+                if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        task = std::move(cell->m_task);
+        cell->m_sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool IsEmpty() const
+    {
+        return m_dequeuePosition.load(std::memory_order_seq_cst) >= m_enqueuePosition.load(std::memory_order_seq_cst);
+    }
+
+private:
+    struct Cell
+    {
+        Cell() : m_sequence(0) {}
+        std::atomic<size_t> m_sequence;
+        ExecutorTask m_task;
+    };
+
+    const size_t m_mask;
+    Cell* m_cells;
+    std::atomic<size_t> m_enqueuePosition;
+    std::atomic<size_t> m_dequeuePosition;
+};
+
+/**
+ * Fixed size Chase-Lev deque storing the tasks in its slots. Only the owning worker pushes and pops at the bottom; any thread may steal
+ * from the top. A thief claims the top slot before it moves the task out, so it never reads a slot that is being written, and the slot
+ * stays marked full until the task has been moved out, so the owner doesn't reuse a slot that a thief is still reading.
+ */
+class WorkStealingThreadExecutor::WorkerDeque
+{
+public:
+    WorkerDeque(size_t capacity) :
+        m_mask(RoundUpToPowerOfTwo(capacity) - 1),
+        m_slots(Aws::NewArray<Slot>(m_mask + 1, WORK_STEALING_CLASS_TAG)),
+        m_top(0),
+        m_bottom(0)
+    {
+    }
+
+    ~WorkerDeque()
+    {
+        Aws::DeleteArray(m_slots);
+    }
+
+    /**
+     * Moves task into the deque on success; on failure task is left untouched.
+     */
+    bool Push(ExecutorTask& task)
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top > m_mask)
+        {
+            return false;
+        }
+
+        Slot& slot = m_slots[bottom & m_mask];
+        if (slot.m_full.load(std::memory_order_acquire))
+        {
+            // a thief claimed the task of this slot, but hasn't moved it out yet.
+            return false;
+        }
+
+        slot.m_task = std::move(task);
+        slot.m_full.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool Pop(ExecutorTask& task)
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (top == bottom)
+        {
+            // last task, race against thieves for it.
+            bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (!won)
+            {
+                return false;
+            }
+        }
+        Take(m_slots[bottom & m_mask], task);
+        return true;
+    }
+
+    bool Steal(ExecutorTask& task)
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        Take(m_slots[top & m_mask], task);
+        return true;
+    }
+
+    bool IsEmpty() const
+    {
+        return m_top.load(std::memory_order_seq_cst) >= m_bottom.load(std::memory_order_seq_cst);
+    }
+
+private:
+    struct Slot
+    {
+        Slot() : m_full(false) {}
+        std::atomic<bool> m_full;
+        ExecutorTask m_task;
+    };
+
+    static void Take(Slot& slot, ExecutorTask& task)
+    {
+        task = std::move(slot.m_task);
+        slot.m_full.store(false, std::memory_order_release);
+    }
+
+    const int64_t m_mask;
+    Slot* m_slots;
+    std::atomic<int64_t> m_top;
+    std::atomic<int64_t> m_bottom;
+};
+
+struct WorkStealingThreadExecutor::Worker
+{
+    Worker(WorkStealingThreadExecutor* executor, size_t index) :
+        m_executor(executor), m_index(index), m_tasks(WORKER_QUEUE_CAPACITY)
+    {}
+
+    WorkStealingThreadExecutor* m_executor;
+    size_t m_index;
+    WorkerDeque m_tasks;
+    std::thread m_thread;
+};
+
+// The worker running on the current thread, if any, so that tasks submitted from within a task stay on the local deque.
+static thread_local void* s_currentWorker = nullptr;
+
+WorkStealingThreadExecutor::WorkStealingThreadExecutor(size_t poolSize, size_t queueCapacity, OverflowPolicy overflowPolicy, bool pinThreadsToProcessors) :
+    m_injectionQueue(Aws::New<InjectionQueue>(WORK_STEALING_CLASS_TAG, queueCapacity)),
+    m_overflowPolicy(overflowPolicy),
+    m_pinThreadsToProcessors(pinThreadsToProcessors),
+    m_running(true),
+    m_sleepingWorkers(0),
+    m_blockedSubmitters(0)
+{
+    size_t workerCount = (std::max)(poolSize, static_cast<size_t>(1));
+    for (size_t index = 0; index < workerCount; ++index)
+    {
+        m_workers.push_back(Aws::New<Worker>(WORK_STEALING_CLASS_TAG, this, index));
+    }
+
+    // start threads only once every worker exists, they steal from each other right away.
+    for (auto worker : m_workers)
+    {
+        worker->m_thread = std::thread(&WorkStealingThreadExecutor::RunWorker, this, worker);
+    }
+}
+
+WorkStealingThreadExecutor::~WorkStealingThreadExecutor()
+{
+    m_running = false;
+    {
+        std::lock_guard<std::mutex> locker(m_sleepLock);
+        m_sleepSignal.notify_all();
+    }
+    NotifySpaceAvailable();
+
+    for (auto worker : m_workers)
+    {
+        worker->m_thread.join();
+    }
+
+    for (auto worker : m_workers)
+    {
+        Aws::Delete(worker);
+    }
+
+    Aws::Delete(m_injectionQueue);
+}
+
+bool WorkStealingThreadExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return SubmitTask(ExecutorTask(std::move(fn)));
+}
+
+bool WorkStealingThreadExecutor::SubmitTask(ExecutorTask&& task)
+{
+    if (!m_running.load())
+    {
+        return false;
+    }
+
+    Worker* currentWorker = static_cast<Worker*>(s_currentWorker);
+    bool isWorkerThread = currentWorker && currentWorker->m_executor == this;
+    if (isWorkerThread)
+    {
+        if (currentWorker->m_tasks.Push(task))
+        {
+            WakeOneWorker();
+            return true;
+        }
+    }
+
+    if (!m_injectionQueue->Enqueue(task))
+    {
+        if (m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY)
+        {
+            return false;
+        }
+
+        if (isWorkerThread)
+        {
+            // blocking a worker on a full executor could deadlock the pool, run the task in place instead.
+            task();
+            return true;
+        }
+
+        std::unique_lock<std::mutex> locker(m_spaceLock);
+        ++m_blockedSubmitters;
+        while (!m_injectionQueue->Enqueue(task))
+        {
+            if (!m_running.load())
+            {
+                --m_blockedSubmitters;
+                return false;
+            }
+            WakeOneWorker();
+            m_spaceSignal.wait_for(locker, SUBMIT_RETRY_INTERVAL);
+        }
+        --m_blockedSubmitters;
+    }
+
+    WakeOneWorker();
+    return true;
+}
+
+void WorkStealingThreadExecutor::WakeOneWorker()
+{
+    // pairs with the fence in RunWorker: either the sleeping worker sees the new task or we see the sleeping worker.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_sleepLock);
+        m_sleepSignal.notify_one();
+    }
+}
+
+void WorkStealingThreadExecutor::NotifySpaceAvailable()
+{
+    if (m_blockedSubmitters.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_spaceLock);
+        m_spaceSignal.notify_all();
+    }
+}
+
+bool WorkStealingThreadExecutor::HasVisibleTasks() const
+{
+    if (!m_injectionQueue->IsEmpty())
+    {
+        return true;
+    }
+
+    for (auto worker : m_workers)
+    {
+        if (!worker->m_tasks.IsEmpty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingThreadExecutor::FindTask(Worker* worker, ExecutorTask& task)
+{
+    if (worker->m_tasks.Pop(task))
+    {
+        return true;
+    }
+
+    if (m_injectionQueue->Dequeue(task))
+    {
+        NotifySpaceAvailable();
+        return true;
+    }
+
+    size_t workerCount = m_workers.size();
+    for (size_t offset = 1; offset < workerCount; ++offset)
+    {
+        if (m_workers[(worker->m_index + offset) % workerCount]->m_tasks.Steal(task))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingThreadExecutor::RunWorker(Worker* worker)
+{
+    s_currentWorker = worker;
+    if (m_pinThreadsToProcessors)
+    {
+        PinCurrentThreadToProcessor(worker->m_index);
+    }
+
+    int idleSpins = 0;
+    while (m_running.load())
+    {
+        ExecutorTask task;
+        if (FindTask(worker, task))
+        {
+            idleSpins = 0;
+            task();
+            continue;
+        }
+
+        if (++idleSpins < IDLE_SPIN_COUNT)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        idleSpins = 0;
+        std::unique_lock<std::mutex> locker(m_sleepLock);
+        ++m_sleepingWorkers;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_running.load() && !HasVisibleTasks())
+        {
+            m_sleepSignal.wait(locker);
+        }
+        --m_sleepingWorkers;
+    }
+    s_currentWorker = nullptr;
+}
@@ -0,0 +1,604 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Xml;
+
+static const size_t READ_BUFFER_SIZE = 16 * 1024;
+// long enough for any number in a response, anything longer is converted through a string.
+static const size_t NUMBER_BUFFER_SIZE = 64;
+// longest entity worth decoding, "&#x10FFFF;".
+static const size_t MAX_ENTITY_LENGTH = 10;
+
+static inline bool IsXmlWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+XmlStringView XmlStringView::Trim() const
+{
+    // same whitespace as StringUtils::Trim().
+    const char* begin = m_data;
+    const char* end = m_data + m_length;
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+    {
+        ++begin;
+    }
+    while (end != begin && std::isspace(static_cast<unsigned char>(*(end - 1))))
+    {
+        --end;
+    }
+    return XmlStringView(begin, static_cast<size_t>(end - begin));
+}
+
+XmlReader::XmlReader(Aws::IStream& stream) :
+    m_position(0),
+    m_state(State::PROLOG),
+    m_pendingEnd(false)
+{
+    auto start = stream.tellg();
+    if (start != static_cast<std::streampos>(-1) && stream.seekg(0, std::ios_base::end))
+    {
+        auto end = stream.tellg();
+        stream.seekg(start);
+        if (end > start)
+        {
+            m_document.reserve(static_cast<size_t>(end - start));
+        }
+    }
+    stream.clear();
+
+    char chunk[READ_BUFFER_SIZE];
+    while (stream.read(chunk, sizeof(chunk)) || stream.gcount() > 0)
+    {
+        m_document.append(chunk, static_cast<size_t>(stream.gcount()));
+    }
+
+    // byte order mark
+    if (StartsWith("\xEF\xBB\xBF"))
+    {
+        m_position = 3;
+    }
+}
+
+XmlToken XmlReader::Next()
+{
+    if (m_state == State::FAILED)
+    {
+        return XmlToken::PARSE_ERROR;
+    }
+
+    if (m_pendingEnd)
+    {
+        m_pendingEnd = false;
+        return EndElement(m_openElements.back());
+    }
+
+    for (;;)
+    {
+        if (m_position >= m_document.size())
+        {
+            if (m_state == State::EPILOG)
+            {
+                return XmlToken::END_DOCUMENT;
+            }
+            return Fail(m_state == State::PROLOG ? "Missing root element." : "Unexpected end of document.");
+        }
+
+        if (m_document[m_position] != '<')
+        {
+            if (m_state == State::CONTENT)
+            {
+                return ReadCharacterData();
+            }
+            if (!IsXmlWhitespace(m_document[m_position]))
+            {
+                return Fail("Unexpected text outside of the root element.");
+            }
+            SkipWhitespace();
+        }
+        else if (StartsWith("<?"))
+        {
+            if (!SkipPast("?>"))
+            {
+                return Fail("Unterminated processing instruction.");
+            }
+        }
+        else if (StartsWith("<!--"))
+        {
+            if (!SkipPast("-->"))
+            {
+                return Fail("Unterminated comment.");
+            }
+        }
+        else if (StartsWith("<![CDATA["))
+        {
+            if (m_state != State::CONTENT)
+            {
+                return Fail("CDATA section outside of the root element.");
+            }
+            return ReadCData();
+        }
+        else if (StartsWith("<!"))
+        {
+            if (m_state != State::PROLOG || !SkipDoctype())
+            {
+                return Fail("Unexpected markup declaration.");
+            }
+        }
+        else if (StartsWith("</"))
+        {
+            return ReadEndElement();
+        }
+        else
+        {
+            return ReadStartElement();
+        }
+    }
+}
+
+bool XmlReader::ReadText(XmlStringView& text)
+{
+    // runs after the first one are moved back to follow it, over the markup that separated them.
+    char* document = &m_document[0];
+    char* textBegin = nullptr;
+    char* textEnd = nullptr;
+    for (;;)
+    {
+        switch (Next())
+        {
+            case XmlToken::TEXT:
+            {
+                char* runBegin = document + (m_text.GetData() - document);
+                if (textBegin == nullptr)
+                {
+                    textBegin = runBegin;
+                    textEnd = runBegin + m_text.GetLength();
+                }
+                else
+                {
+                    std::memmove(textEnd, runBegin, m_text.GetLength());
+                    textEnd += m_text.GetLength();
+                }
+                break;
+            }
+            case XmlToken::START_ELEMENT:
+                if (!SkipElement())
+                {
+                    return false;
+                }
+                break;
+            case XmlToken::END_ELEMENT:
+                text = textBegin ? XmlStringView(textBegin, static_cast<size_t>(textEnd - textBegin)) : XmlStringView();
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+bool XmlReader::SkipElement()
+{
+    size_t depth = 1;
+    while (depth > 0)
+    {
+        switch (Next())
+        {
+            case XmlToken::START_ELEMENT:
+                ++depth;
+                break;
+            case XmlToken::END_ELEMENT:
+                --depth;
+                break;
+            case XmlToken::TEXT:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+XmlToken XmlReader::ReadStartElement()
+{
+    if (m_state == State::EPILOG)
+    {
+        return Fail("More than one root element.");
+    }
+
+    ++m_position;
+    XmlStringView name = ReadName();
+    if (name.IsEmpty())
+    {
+        return Fail("Missing element name.");
+    }
+
+    for (;;)
+    {
+        SkipWhitespace();
+        if (m_position >= m_document.size())
+        {
+            return Fail("Unterminated start tag.");
+        }
+
+        char c = m_document[m_position];
+        if (c == '>')
+        {
+            ++m_position;
+            break;
+        }
+        if (c == '/')
+        {
+            if (!StartsWith("/>"))
+            {
+                return Fail("Malformed empty element.");
+            }
+            m_position += 2;
+            m_pendingEnd = true;
+            break;
+        }
+
+        if (ReadName().IsEmpty())
+        {
+            return Fail("Malformed attribute.");
+        }
+        SkipWhitespace();
+        if (m_position >= m_document.size() || m_document[m_position] != '=')
+        {
+            return Fail("Attribute without a value.");
+        }
+        ++m_position;
+        SkipWhitespace();
+        char quote = m_position < m_document.size() ? m_document[m_position] : '\0';
+        if (quote != '"' && quote != '\'')
+        {
+            return Fail("Attribute value isn't quoted.");
+        }
+        size_t closingQuote = m_document.find(quote, m_position + 1);
+        if (closingQuote == Aws::String::npos)
+        {
+            return Fail("Unterminated attribute value.");
+        }
+        m_position = closingQuote + 1;
+    }
+
+    m_state = State::CONTENT;
+    m_openElements.push_back(name);
+    m_name = name;
+    return XmlToken::START_ELEMENT;
+}
+
+XmlToken XmlReader::ReadEndElement()
+{
+    m_position += 2;
+    XmlStringView name = ReadName();
+    SkipWhitespace();
+    if (m_position >= m_document.size() || m_document[m_position] != '>')
+    {
+        return Fail("Malformed end tag.");
+    }
+    ++m_position;
+
+    if (m_openElements.empty() || !(m_openElements.back() == name))
+    {
+        return Fail("End tag doesn't match the open element.");
+    }
+    return EndElement(name);
+}
+
+XmlToken XmlReader::EndElement(XmlStringView name)
+{
+    m_openElements.pop_back();
+    if (m_openElements.empty())
+    {
+        m_state = State::EPILOG;
+    }
+    m_name = name;
+    return XmlToken::END_ELEMENT;
+}
+
+XmlToken XmlReader::ReadCharacterData()
+{
+    size_t end = m_document.find('<', m_position);
+    if (end == Aws::String::npos)
+    {
+        end = m_document.size();
+    }
+
+    char* begin = &m_document[m_position];
+    char* decodedEnd = Decode(begin, begin + (end - m_position));
+    m_text = XmlStringView(begin, static_cast<size_t>(decodedEnd - begin));
+    m_position = end;
+    return XmlToken::TEXT;
+}
+
+XmlToken XmlReader::ReadCData()
+{
+    size_t begin = m_position + sizeof("<![CDATA[") - 1;
+    size_t end = m_document.find("]]>", begin);
+    if (end == Aws::String::npos)
+    {
+        return Fail("Unterminated CDATA section.");
+    }
+
+    m_text = XmlStringView(m_document.c_str() + begin, end - begin);
+    m_position = end + sizeof("]]>") - 1;
+    return XmlToken::TEXT;
+}
+
+XmlToken XmlReader::Fail(const char* reason)
+{
+    if (m_state != State::FAILED)
+    {
+        Aws::StringStream ss;
+        ss << "Failed to parse XML at offset " << m_position << ": " << reason;
+        m_errorMessage = ss.str();
+        m_state = State::FAILED;
+    }
+    return XmlToken::PARSE_ERROR;
+}
+
+bool XmlReader::StartsWith(const char* markup) const
+{
+    return m_document.compare(m_position, std::strlen(markup), markup) == 0;
+}
+
+bool XmlReader::SkipPast(const char* terminator)
+{
+    size_t found = m_document.find(terminator, m_position);
+    if (found == Aws::String::npos)
+    {
+        return false;
+    }
+    m_position = found + std::strlen(terminator);
+    return true;
+}
+
+bool XmlReader::SkipDoctype()
+{
+    // <!DOCTYPE name [ internal subset ]>, where the subset may contain '>' of its own.
+    size_t depth = 0;
+    for (size_t i = m_position + 2; i < m_document.size(); ++i)
+    {
+        char c = m_document[i];
+        if (c == '[')
+        {
+            ++depth;
+        }
+        else if (c == ']' && depth > 0)
+        {
+            --depth;
+        }
+        else if (c == '>' && depth == 0)
+        {
+            m_position = i + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+void XmlReader::SkipWhitespace()
+{
+    while (m_position < m_document.size() && IsXmlWhitespace(m_document[m_position]))
+    {
+        ++m_position;
+    }
+}
+
+XmlStringView XmlReader::ReadName()
+{
+    size_t begin = m_position;
+    while (m_position < m_document.size())
+    {
+        char c = m_document[m_position];
+        if (IsXmlWhitespace(c) || c == '/' || c == '>' || c == '=' || c == '<')
+        {
+            break;
+        }
+        ++m_position;
+    }
+    return XmlStringView(m_document.c_str() + begin, m_position - begin);
+}
+
+static char* EncodeUtf8(unsigned long codePoint, char* out)
+{
+    if (codePoint < 0x80)
+    {
+        *out++ = static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+        *out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        *out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+// Decodes entity and character references and normalizes line breaks to '\n'. Every reference is at least as long as
+// its decoded form, so the text is rewritten in place. Unknown references are kept as they are, like tinyxml2 does.
+char* XmlReader::Decode(char* begin, char* end)
+{
+    char* out = begin;
+    for (char* in = begin; in != end;)
+    {
+        char c = *in;
+        if (c == '\r')
+        {
+            *out++ = '\n';
+            ++in;
+            if (in != end && *in == '\n')
+            {
+                ++in;
+            }
+            continue;
+        }
+        if (c != '&')
+        {
+            *out++ = c;
+            ++in;
+            continue;
+        }
+
+        size_t searchLength = std::min(static_cast<size_t>(end - in), MAX_ENTITY_LENGTH);
+        char* semicolon = static_cast<char*>(std::memchr(in, ';', searchLength));
+        XmlStringView entity(in + 1, semicolon ? static_cast<size_t>(semicolon - in - 1) : 0);
+        char decoded = '\0';
+        if (entity == "amp")
+        {
+            decoded = '&';
+        }
+        else if (entity == "lt")
+        {
+            decoded = '<';
+        }
+        else if (entity == "gt")
+        {
+            decoded = '>';
+        }
+        else if (entity == "quot")
+        {
+            decoded = '"';
+        }
+        else if (entity == "apos")
+        {
+            decoded = '\'';
+        }
+        else if (entity.GetLength() > 1 && in[1] == '#')
+        {
+            bool hex = in[2] == 'x' || in[2] == 'X';
+            const char* digits = in + (hex ? 3 : 2);
+            char* digitsEnd = nullptr;
+            unsigned long codePoint = std::strtoul(digits, &digitsEnd, hex ? 16 : 10);
+            if (digitsEnd == semicolon && digits != semicolon && codePoint > 0 && codePoint <= 0x10FFFF)
+            {
+                out = EncodeUtf8(codePoint, out);
+                in = semicolon + 1;
+                continue;
+            }
+        }
+
+        if (decoded != '\0')
+        {
+            *out++ = decoded;
+            in = semicolon + 1;
+        }
+        else
+        {
+            *out++ = *in++;
+        }
+    }
+    return out;
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, Aws::String& value)
+{
+    XmlStringView text;
+    if (!reader.ReadText(text))
+    {
+        return false;
+    }
+    XmlStringView trimmed = text.Trim();
+    value.assign(trimmed.GetData() ? trimmed.GetData() : "", trimmed.GetLength());
+    return true;
+}
+
+// The StringUtils conversions take a null terminated string, numbers are copied to the stack for them.
+template<typename T, typename Converter>
+static bool ReadXmlNumber(XmlReader& reader, T& value, Converter convert)
+{
+    XmlStringView text;
+    if (!reader.ReadText(text))
+    {
+        return false;
+    }
+    XmlStringView trimmed = text.Trim();
+    if (trimmed.GetLength() < NUMBER_BUFFER_SIZE)
+    {
+        char number[NUMBER_BUFFER_SIZE];
+        std::memcpy(number, trimmed.GetData() ? trimmed.GetData() : "", trimmed.GetLength());
+        number[trimmed.GetLength()] = '\0';
+        value = static_cast<T>(convert(number));
+    }
+    else
+    {
+        value = static_cast<T>(convert(trimmed.ToString().c_str()));
+    }
+    return true;
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, bool& value)
+{
+    return ReadXmlNumber(reader, value, StringUtils::ConvertToBool);
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, int& value)
+{
+    return ReadXmlNumber(reader, value, StringUtils::ConvertToInt32);
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, long long& value)
+{
+    return ReadXmlNumber(reader, value, StringUtils::ConvertToInt64);
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, double& value)
+{
+    return ReadXmlNumber(reader, value, StringUtils::ConvertToDouble);
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, ByteBuffer& value)
+{
+    XmlStringView text;
+    if (!reader.ReadText(text))
+    {
+        return false;
+    }
+    value = HashingUtils::Base64Decode(text.Trim().ToString());
+    return true;
+}
+
+bool Aws::Utils::Xml::ReadXmlValue(XmlReader& reader, Aws::Utils::DateTime& value)
+{
+    XmlStringView text;
+    if (!reader.ReadText(text))
+    {
+        return false;
+    }
+    value = DateTime(text.Trim().ToString(), DateFormat::ISO_8601);
+    return true;
+}
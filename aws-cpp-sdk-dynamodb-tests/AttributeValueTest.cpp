@@ -0,0 +1,219 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <aws/dynamodb/model/AttributeValueValue.h>
+
+#include <type_traits>
+
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Utils;
+
+namespace
+{
+    const char* ALLOCATION_TAG = "AttributeValueTest";
+
+    // One value of every type, each holding enough data to allocate.
+    Aws::Vector<AttributeValue> MakeValueOfEachType()
+    {
+        Aws::Vector<AttributeValue> values;
+        values.emplace_back(AttributeValue().SetS("a string too long to fit in the small string buffer"));
+        values.emplace_back(AttributeValue().SetN("12345678901234567890.0123456789"));
+        values.emplace_back(AttributeValue().SetB(ByteBuffer(reinterpret_cast<const unsigned char*>("bytes"), 5)));
+        values.emplace_back(AttributeValue().SetSS({"one", "two", "three"}));
+        values.emplace_back(AttributeValue().SetNS({"1", "2", "3"}));
+        values.emplace_back(AttributeValue().SetBS({ByteBuffer(reinterpret_cast<const unsigned char*>("x"), 1),
+                                                    ByteBuffer(reinterpret_cast<const unsigned char*>("yz"), 2)}));
+
+        AttributeValue map;
+        map.AddMEntry("s", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "nested"));
+        map.AddMEntry("n", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, AttributeValue().SetN("42")));
+        values.push_back(map);
+
+        AttributeValue list;
+        list.AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "first"));
+        list.AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, AttributeValue().SetBool(true)));
+        values.push_back(list);
+
+        values.emplace_back(AttributeValue().SetBool(true));
+        values.emplace_back(AttributeValue().SetNull(true));
+        return values;
+    }
+
+    AttributeValue MakeNestedMap()
+    {
+        AttributeValue inner;
+        inner.AddMEntry("leaf", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "original"));
+
+        AttributeValue outer;
+        outer.AddMEntry("inner", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, inner));
+        return outer;
+    }
+
+    AttributeValue MakeNestedList()
+    {
+        AttributeValue inner;
+        inner.AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "original"));
+
+        AttributeValue outer;
+        outer.AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, inner));
+        return outer;
+    }
+}
+
+TEST(AttributeValueTest, TestCopyConstructEachType)
+{
+    for (const auto& value : MakeValueOfEachType())
+    {
+        AttributeValue copy(value);
+        ASSERT_EQ(value.GetType(), copy.GetType());
+        ASSERT_EQ(value, copy);
+    }
+}
+
+TEST(AttributeValueTest, TestMoveConstructEachType)
+{
+    auto expected = MakeValueOfEachType();
+    auto values = MakeValueOfEachType();
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        AttributeValue moved(std::move(values[i]));
+        ASSERT_EQ(expected[i].GetType(), moved.GetType());
+        ASSERT_EQ(expected[i], moved);
+        // the source is left uninitialized, and can be destroyed or reused.
+        ASSERT_EQ(ValueType::NULLVALUE, values[i].GetType());
+        values[i].SetS("reused");
+        ASSERT_EQ("reused", values[i].GetS());
+    }
+}
+
+TEST(AttributeValueTest, TestCopyAssignOverEachType)
+{
+    auto values = MakeValueOfEachType();
+    for (const auto& source : values)
+    {
+        for (const auto& target : values)
+        {
+            AttributeValue assigned(target);
+            assigned = source;
+            ASSERT_EQ(source.GetType(), assigned.GetType());
+            ASSERT_EQ(source, assigned);
+        }
+
+        AttributeValue self(source);
+        const AttributeValue& alias = self;
+        self = alias;
+        ASSERT_EQ(source, self);
+    }
+}
+
+TEST(AttributeValueTest, TestMovesDontThrow)
+{
+    // containers such as Aws::Vector only move their elements when they grow if the move can't throw.
+    ASSERT_TRUE(std::is_nothrow_move_constructible<AttributeValue>::value);
+    ASSERT_TRUE(std::is_nothrow_move_assignable<AttributeValue>::value);
+}
+
+TEST(AttributeValueTest, TestMoveAssignOverEachType)
+{
+    auto expected = MakeValueOfEachType();
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        for (const auto& target : expected)
+        {
+            AttributeValue source(expected[i]);
+            AttributeValue assigned(target);
+            assigned = std::move(source);
+            ASSERT_EQ(expected[i].GetType(), assigned.GetType());
+            ASSERT_EQ(expected[i], assigned);
+            ASSERT_EQ(ValueType::NULLVALUE, source.GetType());
+        }
+    }
+}
+
+TEST(AttributeValueTest, TestDestroyReleasesNestedValues)
+{
+    auto nested = Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "nested");
+    {
+        AttributeValue map;
+        map.AddMEntry("key", nested);
+        AttributeValue list;
+        list.AddLItem(nested);
+        ASSERT_EQ(3, nested.use_count());
+    }
+    ASSERT_EQ(1, nested.use_count());
+}
+
+TEST(AttributeValueTest, TestCopyOfMapOwnsNestedValues)
+{
+    auto original = MakeNestedMap();
+    AttributeValue copy(original);
+    ASSERT_NE(original.GetM().at("inner").get(), copy.GetM().at("inner").get());
+
+    copy.GetM().at("inner")->AddMEntry("added", Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "copy only"));
+    ASSERT_EQ(1u, original.GetM().at("inner")->GetM().size());
+    ASSERT_EQ(2u, copy.GetM().at("inner")->GetM().size());
+    ASSERT_NE(original, copy);
+
+    AttributeValue assigned;
+    assigned = original;
+    ASSERT_NE(original.GetM().at("inner").get(), assigned.GetM().at("inner").get());
+    ASSERT_NE(original.GetM().at("inner")->GetM().at("leaf").get(), assigned.GetM().at("inner")->GetM().at("leaf").get());
+    ASSERT_EQ(original, assigned);
+}
+
+TEST(AttributeValueTest, TestCopyOfListOwnsNestedValues)
+{
+    auto original = MakeNestedList();
+    AttributeValue copy(original);
+    ASSERT_NE(original.GetL()[0].get(), copy.GetL()[0].get());
+
+    copy.GetL()[0]->AddLItem(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, "copy only"));
+    ASSERT_EQ(1u, original.GetL()[0]->GetL().size());
+    ASSERT_EQ(2u, copy.GetL()[0]->GetL().size());
+    ASSERT_NE(original, copy);
+
+    AttributeValue assigned;
+    assigned = original;
+    ASSERT_NE(original.GetL()[0].get(), assigned.GetL()[0].get());
+    ASSERT_NE(original.GetL()[0]->GetL()[0].get(), assigned.GetL()[0]->GetL()[0].get());
+    ASSERT_EQ(original, assigned);
+}
+
+TEST(AttributeValueTest, TestMoveOfMapKeepsNestedValues)
+{
+    auto original = MakeNestedMap();
+    const AttributeValue* inner = original.GetM().at("inner").get();
+    AttributeValue moved(std::move(original));
+    ASSERT_EQ(inner, moved.GetM().at("inner").get());
+
+    AttributeValue assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(inner, assigned.GetM().at("inner").get());
+}
+
+TEST(AttributeValueTest, TestAssignFromValueNestedInTarget)
+{
+    auto outer = MakeNestedList();
+    // the source lives inside the target, and is destroyed while the target is reset.
+    outer = *outer.GetL()[0];
+    ASSERT_EQ(ValueType::ATTRIBUTE_LIST, outer.GetType());
+    ASSERT_EQ(1u, outer.GetL().size());
+    ASSERT_EQ("original", outer.GetL()[0]->GetS());
+}
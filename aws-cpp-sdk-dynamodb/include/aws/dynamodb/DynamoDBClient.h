@@ -58,7 +58,7 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
-#include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/client/EndpointDiscoveryCache.h>
 #include <future>
 #include <functional>
 
@@ -2755,6 +2755,7 @@ namespace Model
       void OverrideEndpoint(const Aws::String& endpoint);
     private:
       void init(const Aws::Client::ClientConfiguration& clientConfiguration);
+      bool DiscoverEndpoint(const Model::DescribeEndpointsRequest& request, Aws::String& address, std::chrono::milliseconds& cachePeriod) const;
         void BatchGetItemAsyncHelper(const Model::BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
         void BatchWriteItemAsyncHelper(const Model::BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
         void CreateBackupAsyncHelper(const Model::CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
@@ -2793,7 +2794,7 @@ namespace Model
         void UpdateTimeToLiveAsyncHelper(const Model::UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
 
       Aws::String m_uri;
-      mutable Aws::Utils::ConcurrentCache<Aws::String, Aws::String> m_endpointsCache;
+      mutable Aws::Client::EndpointDiscoveryCache m_endpointsCache;
       bool m_enableEndpointDiscovery;
       Aws::String m_configScheme;
       std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
@@ -18,62 +18,96 @@
 #include <aws/dynamodb/DynamoDB_EXPORTS.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 
+#include <memory>
+#include <utility>
+
 namespace Aws
 {
+namespace Utils
+{
+namespace Json
+{
+class JsonReader;
+class JsonWriter;
+} // namespace Json
+} // namespace Utils
 namespace DynamoDB
 {
 namespace Model
 {
-class AttributeValueValue;
 
 enum class ValueType {STRING, NUMBER, BYTEBUFFER, STRING_SET, NUMBER_SET, BYTEBUFFER_SET, ATTRIBUTE_MAP, ATTRIBUTE_LIST, BOOL, NULLVALUE};
 
 /// http://docs.aws.amazon.com/amazondynamodb/latest/APIReference/API_AttributeValue.html
+///
+/// The value is held inline, tagged with its type, so specializing it doesn't allocate anything beyond the String,
+/// ByteBuffer or container it holds, and the getters return references to it instead of copies.
+/// Copies are deep: copying a map or list value also copies the values nested in it.
 class AWS_DYNAMODB_API AttributeValue
 {
 public:
-    AttributeValue() {};
-    explicit AttributeValue(const Aws::String& s) { SetS(s); }
-    explicit AttributeValue(const Aws::Vector<Aws::String>& ss) { SetSS(ss); }
-    AttributeValue(Aws::Utils::Json::JsonView jsonValue) { *this = jsonValue; }
+    AttributeValue() : m_type(ValueType::NULLVALUE), m_isSpecialized(false) {}
+    explicit AttributeValue(const Aws::String& s) : AttributeValue() { SetS(s); }
+    explicit AttributeValue(Aws::String&& s) : AttributeValue() { SetS(std::move(s)); }
+    explicit AttributeValue(const Aws::Vector<Aws::String>& ss) : AttributeValue() { SetSS(ss); }
+    AttributeValue(Aws::Utils::Json::JsonView jsonValue) : AttributeValue() { *this = jsonValue; }
+
+    AttributeValue(const AttributeValue& other);
+    AttributeValue(AttributeValue&& other) noexcept;
+    AttributeValue& operator = (const AttributeValue& other);
+    AttributeValue& operator = (AttributeValue&& other) noexcept;
+    ~AttributeValue() { Reset(); }
 
     /// returns the String value if the value is specialized to this type, otherwise an empty String
-    const Aws::String GetS() const;
+    const Aws::String& GetS() const;
     /// if already specialized to a String, sets the value to this String
     /// if uninitialized, specializes the type to a String with specified value
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetS(const Aws::String& s);
     /// if uninitialized, specializes the type to a String with specified value
     /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetS(Aws::String&& s);
+    /// if uninitialized, specializes the type to a String with specified value
+    /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetS(const char* n) { return SetS(Aws::String(n)); }
 
     /// returns the Number value if the value is specialized to this type, otherwise an empty String
-    const Aws::String GetN() const;
+    const Aws::String& GetN() const;
     /// if already specialized to a Number, sets the value to this Number
     /// if uninitialized, specializes the type to a Number with specified value
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetN(const Aws::String& n);
+    /// if uninitialized, specializes the type to a Number with specified value
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetN(Aws::String&& n);
     /// if already specialized to a Number, sets the value to this Number
     /// if uninitialized, specializes the type to a Number with specified value
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetN(const char* n) { return SetN(Aws::String(n)); }
 
     /// returns the ByteBuffer if the value is specialized to this type, otherwise an empty Buffer
-    const Aws::Utils::ByteBuffer GetB() const;
+    const Aws::Utils::ByteBuffer& GetB() const;
     /// if already specialized to a ByteBuffer, sets the value to this value
     /// if uninitialized, specializes the type to a ByteBuffer with the specified value
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetB(const Aws::Utils::ByteBuffer& b);
+    /// if uninitialized, specializes the type to a ByteBuffer with the specified value
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetB(Aws::Utils::ByteBuffer&& b);
 
     /// returns the String Vector if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<Aws::String> GetSS() const;
+    const Aws::Vector<Aws::String>& GetSS() const;
     /// if already specialized to a String Set, sets to these values
     /// if uninitialized, specializes the type to a String Set with specified values
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetSS(const Aws::Vector<Aws::String>& ss);
+    /// if uninitialized, specializes the type to a String Set with specified values
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetSS(Aws::Vector<Aws::String>&& ss);
     /// if the value is already specialized to a String Set then this value is appended
     /// if uninitialized, specializes the type to a String Set with this initial value
     /// if already specialized to another type then the behavior is undefined
@@ -84,11 +118,14 @@ public:
     AttributeValue& AddSItem(const char* sItem) { return AddSItem(Aws::String(sItem)); }
 
     /// returns the Number Vector if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<Aws::String> GetNS() const;
+    const Aws::Vector<Aws::String>& GetNS() const;
     /// if already specialized to a Number Set, sets to these values
     /// if uninitialized, specializes the type to a Number Set with specified values
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetNS(const Aws::Vector<Aws::String>& ns);
+    /// if uninitialized, specializes the type to a Number Set with specified values
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetNS(Aws::Vector<Aws::String>&& ns);
     /// if the value is already specialized to a Number Set then this value is appended
     /// if uninitialized, specializes the type to a Number Set with this initial value
     /// if already specialized to another type then the behavior is undefined
@@ -99,11 +136,14 @@ public:
     AttributeValue& AddNItem(const char* nItem) { return AddNItem(Aws::String(nItem)); }
 
     /// returns the ByteBuffer Vector if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<Aws::Utils::ByteBuffer> GetBS() const;
+    const Aws::Vector<Aws::Utils::ByteBuffer>& GetBS() const;
     /// if already specialized to a ByteBuffer Set, sets to these values
     /// if uninitialized, specializes the type to a ByteBuffer Set with specified values
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetBS(const Aws::Vector<Aws::Utils::ByteBuffer>& bs);
+    /// if uninitialized, specializes the type to a ByteBuffer Set with specified values
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetBS(Aws::Vector<Aws::Utils::ByteBuffer>&& bs);
     /// if the value is already specialized to a ByteBuffer Set then this value is appended
     /// if uninitialized, specializes the type to a ByteBuffer Set with this initial value
     /// if already specialized to another type then the behavior is undefined
@@ -114,11 +154,14 @@ public:
     AttributeValue& AddBItem(const unsigned char* bItem, size_t size);
 
     /// returns the Attribute Map if the value is specialized to this type, otherwise an empty Map
-    const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> GetM() const;
+    const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& GetM() const;
     /// if already specialized to an Attribute Map, sets to these values
     /// if uninitialized, specializes the type to an Attribute Map with specified values
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetM(const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& map);
+    /// if uninitialized, specializes the type to an Attribute Map with specified values
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetM(Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>&& map);
     /// if the value is already specialized to a Map then this value is inserted
     /// if uninitialized, specializes the type to a Map with these initial values
     /// if already specialized to another type then the behavior is undefined
@@ -129,11 +172,14 @@ public:
     AttributeValue& AddMEntry(const char* key, const std::shared_ptr<AttributeValue>& value) { return AddMEntry(Aws::String(key), value); }
 
     /// returns the Attribute List if the value is specialized to this type, otherwise an empty Vector
-    const Aws::Vector<std::shared_ptr<AttributeValue>> GetL() const;
+    const Aws::Vector<std::shared_ptr<AttributeValue>>& GetL() const;
     /// if already specialized to an Attribute List, sets to these values
     /// if uninitialized, specializes the type to an Attribute List with specified values
     /// if already specialized to another type then the behavior is undefined
     AttributeValue& SetL(const Aws::Vector<std::shared_ptr<AttributeValue>>& list);
+    /// if uninitialized, specializes the type to an Attribute List with specified values
+    /// if already specialized to another type then the behavior is undefined
+    AttributeValue& SetL(Aws::Vector<std::shared_ptr<AttributeValue>>&& list);
     /// if the value is already specialized to a List then this value is appended
     /// if uninitialized, specializes the type to a List with these initial values
     /// if already specialized to another type then the behavior is undefined
@@ -154,16 +200,55 @@ public:
     AttributeValue& SetNull(bool value);
 
     AttributeValue& operator = (Aws::Utils::Json::JsonView);
+    /// reads the value straight from a response stream, without building a JsonValue first
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
     bool operator == (const AttributeValue& other) const;
     inline bool operator != (const AttributeValue& other) const { return !(*this == other); }
 
     Aws::String SerializeAttribute() const;
     Aws::Utils::Json::JsonValue Jsonize() const;
+    /// writes the value straight into a request payload, without building a JsonValue first
+    void WriteJson(Aws::Utils::Json::JsonWriter& writer) const;
+    /// the type the value is specialized to, NULLVALUE if it is uninitialized
     ValueType GetType() const;
 
 private:
-    std::shared_ptr<AttributeValueValue> m_value;
+    typedef Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> AttributeMap;
+    typedef Aws::Vector<std::shared_ptr<AttributeValue>> AttributeList;
+
+    template<typename T, typename V>
+    AttributeValue& Specialize(T* member, ValueType type, V&& value);
+    template<typename T>
+    T& Specialize(T* member, ValueType type);
+    template<typename V>
+    void Construct(V&& other);
+    /// a copy owns its nested values, so copying a map or list clones every element; moving one hands them over
+    static AttributeMap CopyNested(const AttributeMap& map);
+    static AttributeMap&& CopyNested(AttributeMap&& map) { return std::move(map); }
+    static AttributeList CopyNested(const AttributeList& list);
+    static AttributeList&& CopyNested(AttributeList&& list) { return std::move(list); }
+    void Reset();
+    bool IsDefault() const;
+
+    /// Only the member that matches m_type is alive, and only while m_isSpecialized is set.
+    union Value
+    {
+        Value() {}
+        ~Value() {}
+
+        Aws::String s; // STRING and NUMBER
+        Aws::Utils::ByteBuffer b;
+        Aws::Vector<Aws::String> strings; // STRING_SET and NUMBER_SET
+        Aws::Vector<Aws::Utils::ByteBuffer> buffers;
+        AttributeMap m;
+        AttributeList l;
+        bool flag; // BOOL and NULLVALUE
+    };
+
+    Value m_value;
+    ValueType m_type;
+    bool m_isSpecialized;
 };
 
 } // namespace Model
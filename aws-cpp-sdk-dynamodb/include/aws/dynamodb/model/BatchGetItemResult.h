@@ -33,6 +33,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -51,6 +52,10 @@ namespace Model
     BatchGetItemResult();
     BatchGetItemResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     BatchGetItemResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /**
+     * Reads the response payload straight from the response stream.
+     */
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
@@ -24,6 +24,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -44,6 +45,7 @@ namespace Model
     Capacity(Aws::Utils::Json::JsonView jsonValue);
     Capacity& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
@@ -28,6 +28,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -53,6 +54,7 @@ namespace Model
     ConsumedCapacity(Aws::Utils::Json::JsonView jsonValue);
     ConsumedCapacity& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
@@ -28,6 +28,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonWriter;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -65,6 +66,7 @@ namespace Model
     ExpectedAttributeValue(Aws::Utils::Json::JsonView jsonValue);
     ExpectedAttributeValue& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    void WriteJson(Aws::Utils::Json::JsonWriter& writer) const;
 
 
     /**
@@ -31,6 +31,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -49,6 +50,10 @@ namespace Model
     GetItemResult();
     GetItemResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     GetItemResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /**
+     * Reads the response payload straight from the response stream.
+     */
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
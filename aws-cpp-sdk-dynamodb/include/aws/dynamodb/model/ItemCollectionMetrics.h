@@ -29,6 +29,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -51,6 +52,7 @@ namespace Model
     ItemCollectionMetrics(Aws::Utils::Json::JsonView jsonValue);
     ItemCollectionMetrics& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
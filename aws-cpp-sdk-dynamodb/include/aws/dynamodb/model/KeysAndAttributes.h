@@ -29,6 +29,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -53,6 +54,7 @@ namespace Model
     KeysAndAttributes(Aws::Utils::Json::JsonView jsonValue);
     KeysAndAttributes& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
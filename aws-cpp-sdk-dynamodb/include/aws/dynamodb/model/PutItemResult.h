@@ -32,6 +32,7 @@ namespace Utils
 namespace Json
 {
   class JsonValue;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -50,6 +51,10 @@ namespace Model
     PutItemResult();
     PutItemResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     PutItemResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /**
+     * Reads the response payload straight from the response stream.
+     */
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
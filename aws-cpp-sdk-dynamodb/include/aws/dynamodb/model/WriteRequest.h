@@ -27,6 +27,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonWriter;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -50,6 +51,7 @@ namespace Model
     WriteRequest(Aws::Utils::Json::JsonView jsonValue);
     WriteRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    void WriteJson(Aws::Utils::Json::JsonWriter& writer) const;
 
 
     /**
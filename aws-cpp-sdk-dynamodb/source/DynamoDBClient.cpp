@@ -112,6 +112,8 @@ DynamoDBClient::DynamoDBClient(const std::shared_ptr<AWSCredentialsProvider>& cr
 
 DynamoDBClient::~DynamoDBClient()
 {
+  // background refreshes call back into the client
+  m_endpointsCache.StopRefreshing();
 }
 
 void DynamoDBClient::init(const ClientConfiguration& config)
@@ -133,6 +135,7 @@ void DynamoDBClient::init(const ClientConfiguration& config)
   {
     m_enableEndpointDiscovery = config.enableEndpointDiscovery;
   }
+  m_endpointsCache.SetExecutor(m_executor);
 }
 
 void DynamoDBClient::OverrideEndpoint(const Aws::String& endpoint)
@@ -148,43 +151,49 @@ void DynamoDBClient::OverrideEndpoint(const Aws::String& endpoint)
   m_enableEndpointDiscovery = false;
 }
 
+bool DynamoDBClient::DiscoverEndpoint(const DescribeEndpointsRequest& request, Aws::String& address, std::chrono::milliseconds& cachePeriod) const
+{
+  AWS_LOGSTREAM_TRACE("DescribeEndpoints", "Discovering endpoints from service...");
+  auto endpointOutcome = DescribeEndpoints(request);
+  if (!endpointOutcome.IsSuccess() || endpointOutcome.GetResult().GetEndpoints().empty())
+  {
+    AWS_LOGSTREAM_ERROR("DescribeEndpoints", "Failed to discover endpoints " << endpointOutcome.GetError());
+    return false;
+  }
+
+  const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
+  address = item.GetAddress();
+  cachePeriod = std::chrono::minutes(item.GetCachePeriodInMinutes());
+  AWS_LOGSTREAM_TRACE("DescribeEndpoints", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes.");
+  return true;
+}
+
 BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& request) const
 {
   Aws::Http::URI uri = m_uri;
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("BatchGetItem", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("BatchGetItem", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("BatchGetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("BatchGetItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("BatchGetItem", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  BatchGetItemResult result;
+  JsonReaderOutcome outcome = MakeRequestWithJsonReader(uri, request, [&result](JsonReader& reader) { return result.ReadJson(reader); }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return BatchGetItemOutcome(BatchGetItemResult(outcome.GetResult()));
+    return BatchGetItemOutcome(std::move(result));
   }
   else
   {
@@ -216,28 +225,16 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("BatchWriteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("BatchWriteItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("BatchWriteItem", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -256,15 +253,34 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
 
 BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< BatchWriteItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->BatchWriteItem(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< BatchWriteItemOutcome > >(ALLOCATION_TAG);
+  BatchWriteItemAsync(request, [promise](const DynamoDBClient*, const BatchWriteItemRequest&, const BatchWriteItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->BatchWriteItemAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->BatchWriteItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<BatchWriteItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, BatchWriteItemOutcome(BatchWriteItemResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, BatchWriteItemOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -278,28 +294,16 @@ CreateBackupOutcome DynamoDBClient::CreateBackup(const CreateBackupRequest& requ
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("CreateBackup", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("CreateBackup", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("CreateBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("CreateBackup", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -318,15 +322,34 @@ CreateBackupOutcome DynamoDBClient::CreateBackup(const CreateBackupRequest& requ
 
 CreateBackupOutcomeCallable DynamoDBClient::CreateBackupCallable(const CreateBackupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBackup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateBackupOutcome > >(ALLOCATION_TAG);
+  CreateBackupAsync(request, [promise](const DynamoDBClient*, const CreateBackupRequest&, const CreateBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::CreateBackupAsync(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateBackupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateBackupOutcome(CreateBackupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateBackupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::CreateBackupAsyncHelper(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,28 +363,16 @@ CreateGlobalTableOutcome DynamoDBClient::CreateGlobalTable(const CreateGlobalTab
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("CreateGlobalTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -380,15 +391,34 @@ CreateGlobalTableOutcome DynamoDBClient::CreateGlobalTable(const CreateGlobalTab
 
 CreateGlobalTableOutcomeCallable DynamoDBClient::CreateGlobalTableCallable(const CreateGlobalTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateGlobalTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateGlobalTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateGlobalTableOutcome > >(ALLOCATION_TAG);
+  CreateGlobalTableAsync(request, [promise](const DynamoDBClient*, const CreateGlobalTableRequest&, const CreateGlobalTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::CreateGlobalTableAsync(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateGlobalTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateGlobalTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateGlobalTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateGlobalTableOutcome(CreateGlobalTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateGlobalTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::CreateGlobalTableAsyncHelper(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -402,28 +432,16 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("CreateTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("CreateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("CreateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("CreateTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -442,15 +460,34 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
 
 CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< CreateTableOutcome > >(ALLOCATION_TAG);
+  CreateTableAsync(request, [promise](const DynamoDBClient*, const CreateTableRequest&, const CreateTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateTableOutcome(CreateTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -464,28 +501,16 @@ DeleteBackupOutcome DynamoDBClient::DeleteBackup(const DeleteBackupRequest& requ
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DeleteBackup", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DeleteBackup", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DeleteBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DeleteBackup", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -504,15 +529,34 @@ DeleteBackupOutcome DynamoDBClient::DeleteBackup(const DeleteBackupRequest& requ
 
 DeleteBackupOutcomeCallable DynamoDBClient::DeleteBackupCallable(const DeleteBackupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBackup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteBackupOutcome > >(ALLOCATION_TAG);
+  DeleteBackupAsync(request, [promise](const DynamoDBClient*, const DeleteBackupRequest&, const DeleteBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DeleteBackupAsync(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteBackupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBackupOutcome(DeleteBackupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBackupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DeleteBackupAsyncHelper(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -526,28 +570,16 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DeleteItem", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DeleteItem", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DeleteItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DeleteItem", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -566,15 +598,34 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
 
 DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteItem(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteItemOutcome > >(ALLOCATION_TAG);
+  DeleteItemAsync(request, [promise](const DynamoDBClient*, const DeleteItemRequest&, const DeleteItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteItemAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteItemOutcome(DeleteItemResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteItemOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -588,28 +639,16 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DeleteTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DeleteTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DeleteTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -628,15 +667,34 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
 
 DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DeleteTableOutcome > >(ALLOCATION_TAG);
+  DeleteTableAsync(request, [promise](const DynamoDBClient*, const DeleteTableRequest&, const DeleteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTableOutcome(DeleteTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -650,28 +708,16 @@ DescribeBackupOutcome DynamoDBClient::DescribeBackup(const DescribeBackupRequest
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeBackup", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeBackup", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeBackup", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -690,15 +736,34 @@ DescribeBackupOutcome DynamoDBClient::DescribeBackup(const DescribeBackupRequest
 
 DescribeBackupOutcomeCallable DynamoDBClient::DescribeBackupCallable(const DescribeBackupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeBackup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeBackupOutcome > >(ALLOCATION_TAG);
+  DescribeBackupAsync(request, [promise](const DynamoDBClient*, const DescribeBackupRequest&, const DescribeBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeBackupAsync(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeBackupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeBackupOutcome(DescribeBackupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeBackupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeBackupAsyncHelper(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -712,28 +777,16 @@ DescribeContinuousBackupsOutcome DynamoDBClient::DescribeContinuousBackups(const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeContinuousBackups", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -752,15 +805,34 @@ DescribeContinuousBackupsOutcome DynamoDBClient::DescribeContinuousBackups(const
 
 DescribeContinuousBackupsOutcomeCallable DynamoDBClient::DescribeContinuousBackupsCallable(const DescribeContinuousBackupsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeContinuousBackupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeContinuousBackups(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeContinuousBackupsOutcome > >(ALLOCATION_TAG);
+  DescribeContinuousBackupsAsync(request, [promise](const DynamoDBClient*, const DescribeContinuousBackupsRequest&, const DescribeContinuousBackupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeContinuousBackupsAsync(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeContinuousBackupsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeContinuousBackupsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeContinuousBackupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeContinuousBackupsOutcome(DescribeContinuousBackupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeContinuousBackupsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeContinuousBackupsAsyncHelper(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -787,15 +859,29 @@ DescribeEndpointsOutcome DynamoDBClient::DescribeEndpoints(const DescribeEndpoin
 
 DescribeEndpointsOutcomeCallable DynamoDBClient::DescribeEndpointsCallable(const DescribeEndpointsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeEndpointsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeEndpoints(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeEndpointsOutcome > >(ALLOCATION_TAG);
+  DescribeEndpointsAsync(request, [promise](const DynamoDBClient*, const DescribeEndpointsRequest&, const DescribeEndpointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeEndpointsAsync(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeEndpointsOutcome(DescribeEndpointsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeEndpointsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -809,28 +895,16 @@ DescribeGlobalTableOutcome DynamoDBClient::DescribeGlobalTable(const DescribeGlo
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeGlobalTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -849,15 +923,34 @@ DescribeGlobalTableOutcome DynamoDBClient::DescribeGlobalTable(const DescribeGlo
 
 DescribeGlobalTableOutcomeCallable DynamoDBClient::DescribeGlobalTableCallable(const DescribeGlobalTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeGlobalTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeGlobalTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeGlobalTableOutcome > >(ALLOCATION_TAG);
+  DescribeGlobalTableAsync(request, [promise](const DynamoDBClient*, const DescribeGlobalTableRequest&, const DescribeGlobalTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeGlobalTableAsync(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeGlobalTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeGlobalTableOutcome(DescribeGlobalTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeGlobalTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeGlobalTableAsyncHelper(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -871,28 +964,16 @@ DescribeGlobalTableSettingsOutcome DynamoDBClient::DescribeGlobalTableSettings(c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeGlobalTableSettings", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -911,15 +992,34 @@ DescribeGlobalTableSettingsOutcome DynamoDBClient::DescribeGlobalTableSettings(c
 
 DescribeGlobalTableSettingsOutcomeCallable DynamoDBClient::DescribeGlobalTableSettingsCallable(const DescribeGlobalTableSettingsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeGlobalTableSettingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeGlobalTableSettings(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeGlobalTableSettingsOutcome > >(ALLOCATION_TAG);
+  DescribeGlobalTableSettingsAsync(request, [promise](const DynamoDBClient*, const DescribeGlobalTableSettingsRequest&, const DescribeGlobalTableSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsync(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeGlobalTableSettingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeGlobalTableSettingsOutcome(DescribeGlobalTableSettingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeGlobalTableSettingsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsyncHelper(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -933,28 +1033,16 @@ DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeLimits", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeLimits", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeLimits", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeLimits", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeLimits", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -973,15 +1061,34 @@ DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest
 
 DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const DescribeLimitsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeLimitsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLimits(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeLimitsOutcome > >(ALLOCATION_TAG);
+  DescribeLimitsAsync(request, [promise](const DynamoDBClient*, const DescribeLimitsRequest&, const DescribeLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeLimitsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeLimitsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeLimitsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLimitsOutcome(DescribeLimitsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLimitsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeLimitsAsyncHelper(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -995,28 +1102,16 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1035,15 +1130,34 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
 
 DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeTableOutcome > >(ALLOCATION_TAG);
+  DescribeTableAsync(request, [promise](const DynamoDBClient*, const DescribeTableRequest&, const DescribeTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTableOutcome(DescribeTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1057,28 +1171,16 @@ DescribeTimeToLiveOutcome DynamoDBClient::DescribeTimeToLive(const DescribeTimeT
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("DescribeTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("DescribeTimeToLive", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1097,15 +1199,34 @@ DescribeTimeToLiveOutcome DynamoDBClient::DescribeTimeToLive(const DescribeTimeT
 
 DescribeTimeToLiveOutcomeCallable DynamoDBClient::DescribeTimeToLiveCallable(const DescribeTimeToLiveRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeTimeToLiveOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTimeToLive(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< DescribeTimeToLiveOutcome > >(ALLOCATION_TAG);
+  DescribeTimeToLiveAsync(request, [promise](const DynamoDBClient*, const DescribeTimeToLiveRequest&, const DescribeTimeToLiveOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::DescribeTimeToLiveAsync(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeTimeToLiveAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeTimeToLiveAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTimeToLiveRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTimeToLiveOutcome(DescribeTimeToLiveResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTimeToLiveOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::DescribeTimeToLiveAsyncHelper(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1119,37 +1240,26 @@ GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("GetItem", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("GetItem", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("GetItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("GetItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("GetItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("GetItem", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  GetItemResult result;
+  JsonReaderOutcome outcome = MakeRequestWithJsonReader(uri, request, [&result](JsonReader& reader) { return result.ReadJson(reader); }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return GetItemOutcome(GetItemResult(outcome.GetResult()));
+    return GetItemOutcome(std::move(result));
   }
   else
   {
@@ -1181,28 +1291,16 @@ ListBackupsOutcome DynamoDBClient::ListBackups(const ListBackupsRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("ListBackups", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("ListBackups", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("ListBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("ListBackups", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("ListBackups", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1221,15 +1319,34 @@ ListBackupsOutcome DynamoDBClient::ListBackups(const ListBackupsRequest& request
 
 ListBackupsOutcomeCallable DynamoDBClient::ListBackupsCallable(const ListBackupsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListBackupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListBackups(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListBackupsOutcome > >(ALLOCATION_TAG);
+  ListBackupsAsync(request, [promise](const DynamoDBClient*, const ListBackupsRequest&, const ListBackupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::ListBackupsAsync(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListBackupsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListBackupsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBackupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListBackupsOutcome(ListBackupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListBackupsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::ListBackupsAsyncHelper(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1243,28 +1360,16 @@ ListGlobalTablesOutcome DynamoDBClient::ListGlobalTables(const ListGlobalTablesR
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListGlobalTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("ListGlobalTables", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("ListGlobalTables", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1283,15 +1388,34 @@ ListGlobalTablesOutcome DynamoDBClient::ListGlobalTables(const ListGlobalTablesR
 
 ListGlobalTablesOutcomeCallable DynamoDBClient::ListGlobalTablesCallable(const ListGlobalTablesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListGlobalTablesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListGlobalTables(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListGlobalTablesOutcome > >(ALLOCATION_TAG);
+  ListGlobalTablesAsync(request, [promise](const DynamoDBClient*, const ListGlobalTablesRequest&, const ListGlobalTablesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::ListGlobalTablesAsync(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListGlobalTablesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListGlobalTablesAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListGlobalTablesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListGlobalTablesOutcome(ListGlobalTablesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListGlobalTablesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::ListGlobalTablesAsyncHelper(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1305,28 +1429,16 @@ ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("ListTables", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("ListTables", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("ListTables", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListTables", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("ListTables", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1345,15 +1457,34 @@ ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) c
 
 ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTablesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTables(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListTablesOutcome > >(ALLOCATION_TAG);
+  ListTablesAsync(request, [promise](const DynamoDBClient*, const ListTablesRequest&, const ListTablesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTablesAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListTablesAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTablesOutcome(ListTablesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTablesOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1367,28 +1498,16 @@ ListTagsOfResourceOutcome DynamoDBClient::ListTagsOfResource(const ListTagsOfRes
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("ListTagsOfResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("ListTagsOfResource", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1407,15 +1526,34 @@ ListTagsOfResourceOutcome DynamoDBClient::ListTagsOfResource(const ListTagsOfRes
 
 ListTagsOfResourceOutcomeCallable DynamoDBClient::ListTagsOfResourceCallable(const ListTagsOfResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTagsOfResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsOfResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ListTagsOfResourceOutcome > >(ALLOCATION_TAG);
+  ListTagsOfResourceAsync(request, [promise](const DynamoDBClient*, const ListTagsOfResourceRequest&, const ListTagsOfResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::ListTagsOfResourceAsync(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsOfResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListTagsOfResourceAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsOfResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsOfResourceOutcome(ListTagsOfResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsOfResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::ListTagsOfResourceAsyncHelper(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1429,37 +1567,26 @@ PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("PutItem", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("PutItem", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("PutItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("PutItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("PutItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("PutItem", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  PutItemResult result;
+  JsonReaderOutcome outcome = MakeRequestWithJsonReader(uri, request, [&result](JsonReader& reader) { return result.ReadJson(reader); }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return PutItemOutcome(PutItemResult(outcome.GetResult()));
+    return PutItemOutcome(std::move(result));
   }
   else
   {
@@ -1491,37 +1618,26 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("Query", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("Query", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("Query", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("Query", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("Query", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  QueryResult result;
+  JsonReaderOutcome outcome = MakeRequestWithJsonReader(uri, request, [&result](JsonReader& reader) { return result.ReadJson(reader); }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return QueryOutcome(QueryResult(outcome.GetResult()));
+    return QueryOutcome(std::move(result));
   }
   else
   {
@@ -1553,28 +1669,16 @@ RestoreTableFromBackupOutcome DynamoDBClient::RestoreTableFromBackup(const Resto
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("RestoreTableFromBackup", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("RestoreTableFromBackup", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1593,15 +1697,34 @@ RestoreTableFromBackupOutcome DynamoDBClient::RestoreTableFromBackup(const Resto
 
 RestoreTableFromBackupOutcomeCallable DynamoDBClient::RestoreTableFromBackupCallable(const RestoreTableFromBackupRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RestoreTableFromBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RestoreTableFromBackup(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RestoreTableFromBackupOutcome > >(ALLOCATION_TAG);
+  RestoreTableFromBackupAsync(request, [promise](const DynamoDBClient*, const RestoreTableFromBackupRequest&, const RestoreTableFromBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::RestoreTableFromBackupAsync(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreTableFromBackupAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->RestoreTableFromBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreTableFromBackupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RestoreTableFromBackupOutcome(RestoreTableFromBackupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RestoreTableFromBackupOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::RestoreTableFromBackupAsyncHelper(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1615,28 +1738,16 @@ RestoreTableToPointInTimeOutcome DynamoDBClient::RestoreTableToPointInTime(const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("RestoreTableToPointInTime", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("RestoreTableToPointInTime", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1655,15 +1766,34 @@ RestoreTableToPointInTimeOutcome DynamoDBClient::RestoreTableToPointInTime(const
 
 RestoreTableToPointInTimeOutcomeCallable DynamoDBClient::RestoreTableToPointInTimeCallable(const RestoreTableToPointInTimeRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< RestoreTableToPointInTimeOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RestoreTableToPointInTime(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< RestoreTableToPointInTimeOutcome > >(ALLOCATION_TAG);
+  RestoreTableToPointInTimeAsync(request, [promise](const DynamoDBClient*, const RestoreTableToPointInTimeRequest&, const RestoreTableToPointInTimeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::RestoreTableToPointInTimeAsync(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreTableToPointInTimeAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->RestoreTableToPointInTimeAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreTableToPointInTimeRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RestoreTableToPointInTimeOutcome(RestoreTableToPointInTimeResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RestoreTableToPointInTimeOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::RestoreTableToPointInTimeAsyncHelper(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1677,37 +1807,26 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("Scan", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("Scan", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("Scan", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("Scan", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("Scan", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("Scan", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  ScanResult result;
+  JsonReaderOutcome outcome = MakeRequestWithJsonReader(uri, request, [&result](JsonReader& reader) { return result.ReadJson(reader); }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return ScanOutcome(ScanResult(outcome.GetResult()));
+    return ScanOutcome(std::move(result));
   }
   else
   {
@@ -1739,28 +1858,16 @@ TagResourceOutcome DynamoDBClient::TagResource(const TagResourceRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("TagResource", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("TagResource", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("TagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("TagResource", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1779,15 +1886,34 @@ TagResourceOutcome DynamoDBClient::TagResource(const TagResourceRequest& request
 
 TagResourceOutcomeCallable DynamoDBClient::TagResourceCallable(const TagResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TagResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TagResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< TagResourceOutcome > >(ALLOCATION_TAG);
+  TagResourceAsync(request, [promise](const DynamoDBClient*, const TagResourceRequest&, const TagResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::TagResourceAsync(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TagResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TagResourceAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TagResourceOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TagResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::TagResourceAsyncHelper(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1801,28 +1927,16 @@ TransactGetItemsOutcome DynamoDBClient::TransactGetItems(const TransactGetItemsR
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("TransactGetItems", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("TransactGetItems", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TransactGetItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("TransactGetItems", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("TransactGetItems", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1841,15 +1955,34 @@ TransactGetItemsOutcome DynamoDBClient::TransactGetItems(const TransactGetItemsR
 
 TransactGetItemsOutcomeCallable DynamoDBClient::TransactGetItemsCallable(const TransactGetItemsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TransactGetItemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransactGetItems(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< TransactGetItemsOutcome > >(ALLOCATION_TAG);
+  TransactGetItemsAsync(request, [promise](const DynamoDBClient*, const TransactGetItemsRequest&, const TransactGetItemsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::TransactGetItemsAsync(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TransactGetItemsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TransactGetItemsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TransactGetItemsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TransactGetItemsOutcome(TransactGetItemsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TransactGetItemsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::TransactGetItemsAsyncHelper(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1863,28 +1996,16 @@ TransactWriteItemsOutcome DynamoDBClient::TransactWriteItems(const TransactWrite
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("TransactWriteItems", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("TransactWriteItems", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("TransactWriteItems", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1903,15 +2024,34 @@ TransactWriteItemsOutcome DynamoDBClient::TransactWriteItems(const TransactWrite
 
 TransactWriteItemsOutcomeCallable DynamoDBClient::TransactWriteItemsCallable(const TransactWriteItemsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TransactWriteItemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransactWriteItems(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< TransactWriteItemsOutcome > >(ALLOCATION_TAG);
+  TransactWriteItemsAsync(request, [promise](const DynamoDBClient*, const TransactWriteItemsRequest&, const TransactWriteItemsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::TransactWriteItemsAsync(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TransactWriteItemsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TransactWriteItemsOutcome(TransactWriteItemsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TransactWriteItemsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::TransactWriteItemsAsyncHelper(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1925,28 +2065,16 @@ UntagResourceOutcome DynamoDBClient::UntagResource(const UntagResourceRequest& r
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UntagResource", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UntagResource", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UntagResource", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UntagResource", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -1965,15 +2093,34 @@ UntagResourceOutcome DynamoDBClient::UntagResource(const UntagResourceRequest& r
 
 UntagResourceOutcomeCallable DynamoDBClient::UntagResourceCallable(const UntagResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UntagResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UntagResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UntagResourceOutcome > >(ALLOCATION_TAG);
+  UntagResourceAsync(request, [promise](const DynamoDBClient*, const UntagResourceRequest&, const UntagResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UntagResourceAsync(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UntagResourceAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UntagResourceAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UntagResourceOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UntagResourceOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UntagResourceAsyncHelper(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1987,28 +2134,16 @@ UpdateContinuousBackupsOutcome DynamoDBClient::UpdateContinuousBackups(const Upd
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateContinuousBackups", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UpdateContinuousBackups", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -2027,15 +2162,34 @@ UpdateContinuousBackupsOutcome DynamoDBClient::UpdateContinuousBackups(const Upd
 
 UpdateContinuousBackupsOutcomeCallable DynamoDBClient::UpdateContinuousBackupsCallable(const UpdateContinuousBackupsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateContinuousBackupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateContinuousBackups(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateContinuousBackupsOutcome > >(ALLOCATION_TAG);
+  UpdateContinuousBackupsAsync(request, [promise](const DynamoDBClient*, const UpdateContinuousBackupsRequest&, const UpdateContinuousBackupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UpdateContinuousBackupsAsync(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateContinuousBackupsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateContinuousBackupsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateContinuousBackupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateContinuousBackupsOutcome(UpdateContinuousBackupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateContinuousBackupsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UpdateContinuousBackupsAsyncHelper(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2049,28 +2203,16 @@ UpdateGlobalTableOutcome DynamoDBClient::UpdateGlobalTable(const UpdateGlobalTab
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateGlobalTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UpdateGlobalTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -2089,15 +2231,34 @@ UpdateGlobalTableOutcome DynamoDBClient::UpdateGlobalTable(const UpdateGlobalTab
 
 UpdateGlobalTableOutcomeCallable DynamoDBClient::UpdateGlobalTableCallable(const UpdateGlobalTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateGlobalTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateGlobalTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateGlobalTableOutcome > >(ALLOCATION_TAG);
+  UpdateGlobalTableAsync(request, [promise](const DynamoDBClient*, const UpdateGlobalTableRequest&, const UpdateGlobalTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UpdateGlobalTableAsync(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGlobalTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateGlobalTableOutcome(UpdateGlobalTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateGlobalTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UpdateGlobalTableAsyncHelper(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2111,28 +2272,16 @@ UpdateGlobalTableSettingsOutcome DynamoDBClient::UpdateGlobalTableSettings(const
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateGlobalTableSettings", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UpdateGlobalTableSettings", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -2151,15 +2300,34 @@ UpdateGlobalTableSettingsOutcome DynamoDBClient::UpdateGlobalTableSettings(const
 
 UpdateGlobalTableSettingsOutcomeCallable DynamoDBClient::UpdateGlobalTableSettingsCallable(const UpdateGlobalTableSettingsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateGlobalTableSettingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateGlobalTableSettings(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateGlobalTableSettingsOutcome > >(ALLOCATION_TAG);
+  UpdateGlobalTableSettingsAsync(request, [promise](const DynamoDBClient*, const UpdateGlobalTableSettingsRequest&, const UpdateGlobalTableSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsync(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGlobalTableSettingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateGlobalTableSettingsOutcome(UpdateGlobalTableSettingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateGlobalTableSettingsOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsyncHelper(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2173,28 +2341,16 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UpdateItem", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UpdateItem", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateItem", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UpdateItem", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UpdateItem", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -2213,15 +2369,34 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
 
 UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateItem(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateItemOutcome > >(ALLOCATION_TAG);
+  UpdateItemAsync(request, [promise](const DynamoDBClient*, const UpdateItemRequest&, const UpdateItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateItemAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateItemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateItemOutcome(UpdateItemResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateItemOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2235,28 +2410,16 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UpdateTable", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateTable", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UpdateTable", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -2275,15 +2438,34 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
 
 UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTableRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateTable(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateTableOutcome > >(ALLOCATION_TAG);
+  UpdateTableAsync(request, [promise](const DynamoDBClient*, const UpdateTableRequest&, const UpdateTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateTableAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateTableOutcome(UpdateTableResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateTableOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2297,28 +2479,16 @@ UpdateTimeToLiveOutcome DynamoDBClient::UpdateTimeToLive(const UpdateTimeToLiveR
   if (m_enableEndpointDiscovery)
   {
     Aws::String endpointKey = "Shared";
+    auto discoverEndpoint = [this](Aws::String& address, std::chrono::milliseconds& cachePeriod) { return DiscoverEndpoint(DescribeEndpointsRequest(), address, cachePeriod); };
     Aws::String endpoint;
-    if (m_endpointsCache.Get(endpointKey, endpoint))
+    if (m_endpointsCache.GetEndpoint(endpointKey, discoverEndpoint, endpoint))
     {
-      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Making request to cached endpoint: " << endpoint);
+      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Making request to discovered endpoint: " << endpoint);
       uri = endpoint;
     }
     else
     {
-      AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoint discovery is enabled and there is no usable endpoint in cache. Discovering endpoints from service...");
-      DescribeEndpointsRequest endpointRequest;
-      auto endpointOutcome = DescribeEndpoints(endpointRequest);
-      if (endpointOutcome.IsSuccess() && !endpointOutcome.GetResult().GetEndpoints().empty())
-      {
-        const auto& item = endpointOutcome.GetResult().GetEndpoints()[0];
-        m_endpointsCache.Put(endpointKey, item.GetAddress(), std::chrono::minutes(item.GetCachePeriodInMinutes()));
-        uri = item.GetAddress();
-        AWS_LOGSTREAM_TRACE("UpdateTimeToLive", "Endpoints cache updated. Address: " << item.GetAddress() << ". Valid in: " << item.GetCachePeriodInMinutes() << " minutes. Making request to newly discovered endpoint.");
-      }
-      else 
-      {
-        AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Failed to discover endpoints " << endpointOutcome.GetError() << "\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
-      }
+      AWS_LOGSTREAM_ERROR("UpdateTimeToLive", "Failed to discover endpoints.\n Endpoint discovery is not required for this operation, falling back to the regional endpoint.");
     }
   }
   Aws::StringStream ss;
@@ -2337,15 +2507,34 @@ UpdateTimeToLiveOutcome DynamoDBClient::UpdateTimeToLive(const UpdateTimeToLiveR
 
 UpdateTimeToLiveOutcomeCallable DynamoDBClient::UpdateTimeToLiveCallable(const UpdateTimeToLiveRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateTimeToLiveOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateTimeToLive(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< UpdateTimeToLiveOutcome > >(ALLOCATION_TAG);
+  UpdateTimeToLiveAsync(request, [promise](const DynamoDBClient*, const UpdateTimeToLiveRequest&, const UpdateTimeToLiveOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void DynamoDBClient::UpdateTimeToLiveAsync(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateTimeToLiveAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  if (m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateTimeToLiveAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTimeToLiveRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateTimeToLiveOutcome(UpdateTimeToLiveResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateTimeToLiveOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void DynamoDBClient::UpdateTimeToLiveAsyncHelper(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
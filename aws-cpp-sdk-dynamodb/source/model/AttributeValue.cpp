@@ -14,163 +14,331 @@
 */
 
 #include <aws/dynamodb/model/AttributeValue.h>
-#include <aws/dynamodb/model/AttributeValueValue.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
+#include <cassert>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 using namespace Aws::DynamoDB::Model;
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
 
-const Aws::String AttributeValue::GetS() const
+static const char* ALLOCATION_TAG = "AttributeValue";
+
+// what the getters return for a value that isn't specialized to their type. These are never destroyed, so the
+// references stay valid while other statics are torn down.
+template<typename T>
+static const T& EmptyValue()
+{
+    static typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    static const T* value = new (&storage) T();
+    return *value;
+}
+
+template<typename T>
+static void Destroy(T& value)
+{
+    value.~T();
+}
+
+AttributeValue::AttributeValue(const AttributeValue& other) :
+    m_type(ValueType::NULLVALUE),
+    m_isSpecialized(false)
 {
-    if (m_value)
+    Construct(other);
+}
+
+AttributeValue::AttributeValue(AttributeValue&& other) noexcept :
+    m_type(ValueType::NULLVALUE),
+    m_isSpecialized(false)
+{
+    Construct(std::move(other));
+    other.Reset();
+}
+
+AttributeValue& AttributeValue::operator =(const AttributeValue& other)
+{
+    if (this != &other)
     {
-        return m_value->GetS();
+        // other may live inside this value, in a nested map or list that Reset() destroys.
+        AttributeValue copy(other);
+        Reset();
+        Construct(std::move(copy));
     }
-    else
+    return *this;
+}
+
+AttributeValue& AttributeValue::operator =(AttributeValue&& other) noexcept
+{
+    if (this != &other)
     {
-        return {};
+        AttributeValue moved(std::move(other));
+        Reset();
+        Construct(std::move(moved));
     }
+    return *this;
 }
 
-AttributeValue& AttributeValue::SetS(const Aws::String& s)
+template<typename V>
+void AttributeValue::Construct(V&& other)
 {
-    m_value = Aws::MakeShared<AttributeValueString>("AttributeValue", s);
-    return *this;
+    if (!other.m_isSpecialized)
+    {
+        return;
+    }
+
+    switch (other.m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            new (&m_value.s) Aws::String(std::forward<V>(other).m_value.s);
+            break;
+        case ValueType::BYTEBUFFER:
+            new (&m_value.b) ByteBuffer(std::forward<V>(other).m_value.b);
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            new (&m_value.strings) Aws::Vector<Aws::String>(std::forward<V>(other).m_value.strings);
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            new (&m_value.buffers) Aws::Vector<ByteBuffer>(std::forward<V>(other).m_value.buffers);
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            new (&m_value.m) AttributeMap(CopyNested(std::forward<V>(other).m_value.m));
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            new (&m_value.l) AttributeList(CopyNested(std::forward<V>(other).m_value.l));
+            break;
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            m_value.flag = other.m_value.flag;
+            break;
+    }
+    m_type = other.m_type;
+    m_isSpecialized = true;
 }
 
-const Aws::String AttributeValue::GetN() const
+AttributeValue::AttributeMap AttributeValue::CopyNested(const AttributeMap& map)
 {
-    if (m_value)
+    AttributeMap copy;
+    for (const auto& entry : map)
     {
-        return m_value->GetN();
+        copy.emplace(entry.first, entry.second ? Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, *entry.second) : nullptr);
     }
-    else
+    return copy;
+}
+
+AttributeValue::AttributeList AttributeValue::CopyNested(const AttributeList& list)
+{
+    AttributeList copy;
+    copy.reserve(list.size());
+    for (const auto& item : list)
     {
-        return {};
+        copy.push_back(item ? Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, *item) : nullptr);
     }
+    return copy;
 }
 
-AttributeValue& AttributeValue::SetN(const Aws::String& n)
+void AttributeValue::Reset()
+{
+    if (!m_isSpecialized)
+    {
+        return;
+    }
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            Destroy(m_value.s);
+            break;
+        case ValueType::BYTEBUFFER:
+            Destroy(m_value.b);
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            Destroy(m_value.strings);
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            Destroy(m_value.buffers);
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+            Destroy(m_value.m);
+            break;
+        case ValueType::ATTRIBUTE_LIST:
+            Destroy(m_value.l);
+            break;
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            break;
+    }
+    m_type = ValueType::NULLVALUE;
+    m_isSpecialized = false;
+}
+
+template<typename T, typename V>
+AttributeValue& AttributeValue::Specialize(T* member, ValueType type, V&& value)
 {
-    m_value = Aws::MakeShared<AttributeValueNumeric>("AttributeValue", n);
+    // value may refer into the current value, so it is taken before that is destroyed.
+    T specialized(std::forward<V>(value));
+    Reset();
+    new (member) T(std::move(specialized));
+    m_type = type;
+    m_isSpecialized = true;
     return *this;
 }
 
-const ByteBuffer AttributeValue::GetB() const
+template<typename T>
+T& AttributeValue::Specialize(T* member, ValueType type)
 {
-    if (m_value)
-    {
-        return m_value->GetB();
-    }
-    else
-    {
-        return {};
-    }
+    Specialize(member, type, T());
+    return *member;
+}
+
+const Aws::String& AttributeValue::GetS() const
+{
+    return m_isSpecialized && m_type == ValueType::STRING ? m_value.s : EmptyValue<Aws::String>();
+}
+
+AttributeValue& AttributeValue::SetS(const Aws::String& s)
+{
+    return Specialize(&m_value.s, ValueType::STRING, s);
+}
+
+AttributeValue& AttributeValue::SetS(Aws::String&& s)
+{
+    return Specialize(&m_value.s, ValueType::STRING, std::move(s));
+}
+
+const Aws::String& AttributeValue::GetN() const
+{
+    return m_isSpecialized && m_type == ValueType::NUMBER ? m_value.s : EmptyValue<Aws::String>();
+}
+
+AttributeValue& AttributeValue::SetN(const Aws::String& n)
+{
+    return Specialize(&m_value.s, ValueType::NUMBER, n);
+}
+
+AttributeValue& AttributeValue::SetN(Aws::String&& n)
+{
+    return Specialize(&m_value.s, ValueType::NUMBER, std::move(n));
+}
+
+const ByteBuffer& AttributeValue::GetB() const
+{
+    return m_isSpecialized && m_type == ValueType::BYTEBUFFER ? m_value.b : EmptyValue<ByteBuffer>();
 }
 
 AttributeValue& AttributeValue::SetB(const ByteBuffer& b)
 {
-    m_value = Aws::MakeShared<AttributeValueByteBuffer>("AttributeValue", b);
-    return *this;
+    return Specialize(&m_value.b, ValueType::BYTEBUFFER, b);
 }
 
-const Aws::Vector<Aws::String> AttributeValue::GetSS() const
+AttributeValue& AttributeValue::SetB(ByteBuffer&& b)
 {
-    if (m_value)
-    {
-        return m_value->GetSS();
-    }
-    else
-    {
-        return {};
-    }
+    return Specialize(&m_value.b, ValueType::BYTEBUFFER, std::move(b));
+}
+
+const Aws::Vector<Aws::String>& AttributeValue::GetSS() const
+{
+    return m_isSpecialized && m_type == ValueType::STRING_SET ? m_value.strings : EmptyValue<Aws::Vector<Aws::String>>();
 }
 
 AttributeValue& AttributeValue::SetSS(const Aws::Vector<Aws::String>& ss)
 {
-    m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", ss);
-    return *this;
+    return Specialize(&m_value.strings, ValueType::STRING_SET, ss);
+}
+
+AttributeValue& AttributeValue::SetSS(Aws::Vector<Aws::String>&& ss)
+{
+    return Specialize(&m_value.strings, ValueType::STRING_SET, std::move(ss));
 }
 
 AttributeValue& AttributeValue::AddSItem(const Aws::String& sItem)
 {
-    if (!m_value)
+    if (!m_isSpecialized)
     {
-        Aws::Vector<Aws::String> ss;
-        ss.push_back(sItem);
-        m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", ss);
+        Specialize(&m_value.strings, ValueType::STRING_SET);
+    }
+
+    if (m_type == ValueType::STRING_SET)
+    {
+        m_value.strings.push_back(sItem);
     }
     else
     {
-        m_value->AddSItem(sItem);
+        assert(false);
     }
     return *this;
 }
 
-const Aws::Vector<Aws::String> AttributeValue::GetNS() const
+const Aws::Vector<Aws::String>& AttributeValue::GetNS() const
 {
-    if (m_value)
-    {
-        return m_value->GetNS();
-    }
-    else
-    {
-        return {};
-    }
+    return m_isSpecialized && m_type == ValueType::NUMBER_SET ? m_value.strings : EmptyValue<Aws::Vector<Aws::String>>();
 }
 
 AttributeValue& AttributeValue::SetNS(const Aws::Vector<Aws::String>& ns)
 {
-    m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", ns);
-    return *this;
+    return Specialize(&m_value.strings, ValueType::NUMBER_SET, ns);
+}
+
+AttributeValue& AttributeValue::SetNS(Aws::Vector<Aws::String>&& ns)
+{
+    return Specialize(&m_value.strings, ValueType::NUMBER_SET, std::move(ns));
 }
 
 AttributeValue& AttributeValue::AddNItem(const Aws::String& nItem)
 {
-    if (!m_value)
+    if (!m_isSpecialized)
+    {
+        Specialize(&m_value.strings, ValueType::NUMBER_SET);
+    }
+
+    if (m_type == ValueType::NUMBER_SET)
     {
-        Aws::Vector<Aws::String> ns;
-        ns.push_back(nItem);
-        m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", ns);
+        m_value.strings.push_back(nItem);
     }
     else
     {
-        m_value->AddNItem(nItem);
+        assert(false);
     }
     return *this;
 }
 
-const Aws::Vector<ByteBuffer> AttributeValue::GetBS() const
+const Aws::Vector<ByteBuffer>& AttributeValue::GetBS() const
 {
-    if (m_value)
-    {
-        return m_value->GetBS();
-    }
-    else
-    {
-        return {};
-    }
+    return m_isSpecialized && m_type == ValueType::BYTEBUFFER_SET ? m_value.buffers : EmptyValue<Aws::Vector<ByteBuffer>>();
 }
 
 AttributeValue& AttributeValue::SetBS(const Aws::Vector<ByteBuffer>& bs)
 {
-    m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", bs);
-    return *this;
+    return Specialize(&m_value.buffers, ValueType::BYTEBUFFER_SET, bs);
+}
+
+AttributeValue& AttributeValue::SetBS(Aws::Vector<ByteBuffer>&& bs)
+{
+    return Specialize(&m_value.buffers, ValueType::BYTEBUFFER_SET, std::move(bs));
 }
 
 AttributeValue& AttributeValue::AddBItem(const ByteBuffer& bItem)
 {
-    if (!m_value)
+    if (!m_isSpecialized)
     {
-        Aws::Vector<ByteBuffer> bs;
-        bs.push_back(bItem);
-        m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", bs);
+        Specialize(&m_value.buffers, ValueType::BYTEBUFFER_SET);
+    }
+
+    if (m_type == ValueType::BYTEBUFFER_SET)
+    {
+        m_value.buffers.push_back(bItem);
     }
     else
     {
-        m_value->AddBItem(bItem);
+        assert(false);
     }
     return *this;
 }
@@ -180,210 +348,477 @@ AttributeValue& AttributeValue::AddBItem(const unsigned char* bItem, size_t size
     return AddBItem(ByteBuffer(bItem, size));
 }
 
-const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> AttributeValue::GetM() const
+const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& AttributeValue::GetM() const
 {
-    if (m_value)
-    {
-        return m_value->GetM();
-    }
-    else
-    {
-        return {};
-    }
+    return m_isSpecialized && m_type == ValueType::ATTRIBUTE_MAP ? m_value.m : EmptyValue<AttributeMap>();
 }
 
 AttributeValue& AttributeValue::SetM(const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& map)
 {
-    m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", map);
-    return *this;
+    return Specialize(&m_value.m, ValueType::ATTRIBUTE_MAP, map);
+}
+
+AttributeValue& AttributeValue::SetM(Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>&& map)
+{
+    return Specialize(&m_value.m, ValueType::ATTRIBUTE_MAP, std::move(map));
 }
 
 AttributeValue& AttributeValue::AddMEntry(const Aws::String& key, const std::shared_ptr<AttributeValue>& value)
 {
-    if (!m_value)
+    if (!m_isSpecialized)
+    {
+        Specialize(&m_value.m, ValueType::ATTRIBUTE_MAP);
+    }
+
+    if (m_type == ValueType::ATTRIBUTE_MAP)
     {
-        Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> map;
-        auto kvp = std::pair<Aws::String, const std::shared_ptr<AttributeValue>>(key, value);
-        map.insert(map.begin(), kvp);
-        m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", map);
+        m_value.m.insert(m_value.m.begin(), std::pair<Aws::String, const std::shared_ptr<AttributeValue>>(key, value));
     }
     else
     {
-        m_value->AddMEntry(key, value);
+        assert(false);
     }
-
     return *this;
 }
 
-const Aws::Vector<std::shared_ptr<AttributeValue>> AttributeValue::GetL() const
+const Aws::Vector<std::shared_ptr<AttributeValue>>& AttributeValue::GetL() const
 {
-    if (m_value)
-    {
-        return m_value->GetL();
-    }
-    else
-    {
-        return {};
-    }
+    return m_isSpecialized && m_type == ValueType::ATTRIBUTE_LIST ? m_value.l : EmptyValue<AttributeList>();
 }
 
 AttributeValue& AttributeValue::SetL(const Aws::Vector<std::shared_ptr<AttributeValue>>& list)
 {
-    m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", list);
-    return *this;
+    return Specialize(&m_value.l, ValueType::ATTRIBUTE_LIST, list);
+}
+
+AttributeValue& AttributeValue::SetL(Aws::Vector<std::shared_ptr<AttributeValue>>&& list)
+{
+    return Specialize(&m_value.l, ValueType::ATTRIBUTE_LIST, std::move(list));
 }
 
 AttributeValue& AttributeValue::AddLItem(const std::shared_ptr<AttributeValue>& listItem)
 {
-    if (!m_value)
+    if (!m_isSpecialized)
+    {
+        Specialize(&m_value.l, ValueType::ATTRIBUTE_LIST);
+    }
+
+    if (m_type == ValueType::ATTRIBUTE_LIST)
     {
-        Aws::Vector<std::shared_ptr<AttributeValue>> list;
-        list.push_back(listItem);
-        m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", list);
+        m_value.l.push_back(listItem);
     }
     else
     {
-        m_value->AddLItem(listItem);
+        assert(false);
     }
-
     return *this;
 }
 
 bool AttributeValue::GetBool() const
 {
-    if (m_value)
-    {
-        return m_value->GetBool();
-    }
-    else
-    {
-        return false;
-    }
+    return m_isSpecialized && m_type == ValueType::BOOL && m_value.flag;
 }
 
 AttributeValue& AttributeValue::SetBool(bool value)
 {
-    m_value = Aws::MakeShared<AttributeValueBool>("AttributeValue", value);
-    return *this;
+    return Specialize(&m_value.flag, ValueType::BOOL, value);
 }
 
 bool AttributeValue::GetNull() const
 {
-    if (m_value)
-    {
-        return m_value->GetNull();
-    }
-    else
-    {
-        return false;
-    }
+    return m_isSpecialized && m_type == ValueType::NULLVALUE && m_value.flag;
 }
 
 AttributeValue& AttributeValue::SetNull(bool value)
 {
-    m_value = Aws::MakeShared<AttributeValueNull>("AttributeValue", value);
-    return *this;
+    return Specialize(&m_value.flag, ValueType::NULLVALUE, value);
 }
 
 AttributeValue& AttributeValue::operator =(JsonView jsonValue)
 {
     if (jsonValue.ValueExists("S"))
     {
-        m_value = Aws::MakeShared<AttributeValueString>("AttributeValue", jsonValue);
-        return *this;
+        return SetS(jsonValue.GetString("S"));
     }
 
     if (jsonValue.ValueExists("N"))
     {
-        m_value = Aws::MakeShared<AttributeValueNumeric>("AttributeValue", jsonValue);
-        return *this;
+        return SetN(jsonValue.GetString("N"));
     }
 
     if (jsonValue.ValueExists("B"))
     {
-        m_value = Aws::MakeShared<AttributeValueByteBuffer>("AttributeValue", jsonValue);
-        return *this;
+        return SetB(HashingUtils::Base64Decode(jsonValue.GetString("B")));
     }
 
     if (jsonValue.ValueExists("SS"))
     {
-        m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", jsonValue);
+        Array<JsonView> ss = jsonValue.GetArray("SS");
+        Aws::Vector<Aws::String>& strings = Specialize(&m_value.strings, ValueType::STRING_SET);
+        strings.reserve(ss.GetLength());
+        for (unsigned i = 0; i < ss.GetLength(); ++i)
+        {
+            strings.push_back(ss[i].AsString());
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("NS"))
     {
-        m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", jsonValue);
+        Array<JsonView> ns = jsonValue.GetArray("NS");
+        Aws::Vector<Aws::String>& strings = Specialize(&m_value.strings, ValueType::NUMBER_SET);
+        strings.reserve(ns.GetLength());
+        for (unsigned i = 0; i < ns.GetLength(); ++i)
+        {
+            strings.push_back(ns[i].AsString());
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("BS"))
     {
-        m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", jsonValue);
+        Array<JsonView> bs = jsonValue.GetArray("BS");
+        Aws::Vector<ByteBuffer>& buffers = Specialize(&m_value.buffers, ValueType::BYTEBUFFER_SET);
+        buffers.reserve(bs.GetLength());
+        for (unsigned i = 0; i < bs.GetLength(); ++i)
+        {
+            buffers.push_back(HashingUtils::Base64Decode(bs[i].AsString()));
+        }
         return *this;
     }
 
     if (jsonValue.ValueExists("M"))
     {
-        m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", jsonValue);
-        return *this;
+        AttributeMap map;
+        for (auto& item : jsonValue.GetObject("M").GetAllObjects())
+        {
+            map.emplace(item.first, Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, item.second));
+        }
+        return SetM(std::move(map));
     }
 
     if (jsonValue.ValueExists("L"))
     {
-        m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", jsonValue);
-        return *this;
+        Array<JsonView> array = jsonValue.GetArray("L");
+        AttributeList list;
+        list.reserve(array.GetLength());
+        for (unsigned i = 0; i < array.GetLength(); ++i)
+        {
+            list.push_back(Aws::MakeShared<AttributeValue>(ALLOCATION_TAG, array[i]));
+        }
+        return SetL(std::move(list));
     }
 
     if (jsonValue.ValueExists("BOOL"))
     {
-        m_value = Aws::MakeShared<AttributeValueBool>("AttributeValue", jsonValue);
-        return *this;
+        return SetBool(jsonValue.GetBool("BOOL"));
     }
 
     if (jsonValue.ValueExists("NULL"))
     {
-        m_value = Aws::MakeShared<AttributeValueNull>("AttributeValue", jsonValue);
-        return *this;
+        return SetNull(jsonValue.GetBool("NULL"));
     }
 
     return *this;
 }
 
+bool AttributeValue::ReadJson(JsonReader& reader)
+{
+    return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+    {
+        if (name == "S")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.s, ValueType::STRING));
+        }
+
+        if (name == "N")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.s, ValueType::NUMBER));
+        }
+
+        if (name == "B")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.b, ValueType::BYTEBUFFER));
+        }
+
+        if (name == "SS")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.strings, ValueType::STRING_SET));
+        }
+
+        if (name == "NS")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.strings, ValueType::NUMBER_SET));
+        }
+
+        if (name == "BS")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.buffers, ValueType::BYTEBUFFER_SET));
+        }
+
+        if (name == "M")
+        {
+            AttributeMap& map = Specialize(&m_value.m, ValueType::ATTRIBUTE_MAP);
+            return reader.ReadObject([&map](JsonReader& reader, const Aws::String& key) -> bool
+            {
+                auto value = Aws::MakeShared<AttributeValue>(ALLOCATION_TAG);
+                map.emplace(key, value);
+                return value->ReadJson(reader);
+            });
+        }
+
+        if (name == "L")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.l, ValueType::ATTRIBUTE_LIST));
+        }
+
+        if (name == "BOOL")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.flag, ValueType::BOOL));
+        }
+
+        if (name == "NULL")
+        {
+            return ReadJsonValue(reader, Specialize(&m_value.flag, ValueType::NULLVALUE));
+        }
+
+        return reader.SkipValue();
+    });
+}
+
+bool AttributeValue::IsDefault() const
+{
+    if (!m_isSpecialized)
+    {
+        return true;
+    }
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            return m_value.s.empty();
+        case ValueType::BYTEBUFFER:
+            return m_value.b.GetLength() == 0;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            return m_value.strings.empty();
+        case ValueType::BYTEBUFFER_SET:
+            return m_value.buffers.empty();
+        case ValueType::ATTRIBUTE_MAP:
+            return m_value.m.empty();
+        case ValueType::ATTRIBUTE_LIST:
+            return m_value.l.empty();
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            return !m_value.flag;
+    }
+    return true;
+}
+
 bool AttributeValue::operator ==(const AttributeValue& other) const
 {
     if (this == &other)
         return true;
 
-    if (m_value)
+    if (!m_isSpecialized || !other.m_isSpecialized)
     {
-        if (other.m_value)
+        return IsDefault() && other.IsDefault();
+    }
+
+    if (m_type != other.m_type)
+        return false;
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            return m_value.s == other.m_value.s;
+        case ValueType::BYTEBUFFER:
+            return m_value.b == other.m_value.b;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            return m_value.strings == other.m_value.strings;
+        case ValueType::BYTEBUFFER_SET:
+            return m_value.buffers == other.m_value.buffers;
+        case ValueType::ATTRIBUTE_MAP:
         {
-            return *m_value == *other.m_value;
+            if (m_value.m.size() != other.m_value.m.size())
+                return false;
+
+            for (auto& mapItem : m_value.m)
+            {
+                auto foundItem = other.m_value.m.find(mapItem.first);
+                if (foundItem == other.m_value.m.end())
+                    return false;
+
+                if (*foundItem->second != *mapItem.second)
+                    return false;
+            }
+            return true;
         }
-        else
+        case ValueType::ATTRIBUTE_LIST:
         {
-            return m_value->IsDefault();
+            if (m_value.l.size() != other.m_value.l.size())
+                return false;
+
+            for (unsigned i = 0; i < m_value.l.size(); ++i)
+            {
+                if (*m_value.l[i] != *other.m_value.l[i])
+                    return false;
+            }
+            return true;
         }
+        case ValueType::BOOL:
+        case ValueType::NULLVALUE:
+            return m_value.flag == other.m_value.flag;
     }
-    else if (other.m_value)
-    {
-        return other.m_value->IsDefault();
-    }
-
     return true;
 }
 
 JsonValue AttributeValue::Jsonize() const
 {
-    if (m_value)
-    {
-        return m_value->Jsonize();
-    }
-    else
+    JsonValue value;
+    if (!m_isSpecialized)
+    {
+        return value;
+    }
+
+    switch (m_type)
+    {
+        case ValueType::STRING:
+        case ValueType::NUMBER:
+            if (!m_value.s.empty())
+            {
+                value.WithString(m_type == ValueType::STRING ? "S" : "N", m_value.s);
+            }
+            break;
+        case ValueType::BYTEBUFFER:
+            if (m_value.b.GetLength() > 0)
+            {
+                value.WithString("B", HashingUtils::Base64Encode(m_value.b));
+            }
+            break;
+        case ValueType::STRING_SET:
+        case ValueType::NUMBER_SET:
+            if (m_value.strings.size() > 0)
+            {
+                Array<JsonValue> array(m_value.strings.size());
+                for (unsigned i = 0; i < m_value.strings.size(); ++i)
+                {
+                    array[i].AsString(m_value.strings[i]);
+                }
+                value.WithArray(m_type == ValueType::STRING_SET ? "SS" : "NS", std::move(array));
+            }
+            break;
+        case ValueType::BYTEBUFFER_SET:
+            if (m_value.buffers.size() > 0)
+            {
+                Array<JsonValue> array(m_value.buffers.size());
+                for (unsigned i = 0; i < m_value.buffers.size(); ++i)
+                {
+                    array[i].AsString(HashingUtils::Base64Encode(m_value.buffers[i]));
+                }
+                value.WithArray("BS", std::move(array));
+            }
+            break;
+        case ValueType::ATTRIBUTE_MAP:
+        {
+            JsonValue mapValue;
+            for (auto& mapItem : m_value.m)
+            {
+                mapValue.WithObject(mapItem.first, mapItem.second->Jsonize());
+            }
+            value.WithObject("M", std::move(mapValue));
+            break;
+        }
+        case ValueType::ATTRIBUTE_LIST:
+        {
+            Array<JsonValue> list(m_value.l.size());
+            for (unsigned i = 0; i < m_value.l.size(); ++i)
+            {
+                list[i] = m_value.l[i]->Jsonize();
+            }
+            value.WithArray("L", std::move(list));
+            break;
+        }
+        case ValueType::BOOL:
+            value.WithBool("BOOL", m_value.flag);
+            break;
+        case ValueType::NULLVALUE:
+            value.WithBool("NULL", m_value.flag);
+            break;
+    }
+    return value;
+}
+
+void AttributeValue::WriteJson(JsonWriter& writer) const
+{
+    writer.WriteStartObject();
+    if (m_isSpecialized)
     {
-        return JsonValue();
+        switch (m_type)
+        {
+            case ValueType::STRING:
+            case ValueType::NUMBER:
+                if (!m_value.s.empty())
+                {
+                    writer.WriteName(m_type == ValueType::STRING ? "S" : "N");
+                    writer.WriteString(m_value.s);
+                }
+                break;
+            case ValueType::BYTEBUFFER:
+                if (m_value.b.GetLength() > 0)
+                {
+                    writer.WriteName("B");
+                    WriteJsonValue(writer, m_value.b);
+                }
+                break;
+            case ValueType::STRING_SET:
+            case ValueType::NUMBER_SET:
+                if (m_value.strings.size() > 0)
+                {
+                    writer.WriteName(m_type == ValueType::STRING_SET ? "SS" : "NS");
+                    WriteJsonValue(writer, m_value.strings);
+                }
+                break;
+            case ValueType::BYTEBUFFER_SET:
+                if (m_value.buffers.size() > 0)
+                {
+                    writer.WriteName("BS");
+                    WriteJsonValue(writer, m_value.buffers);
+                }
+                break;
+            case ValueType::ATTRIBUTE_MAP:
+                writer.WriteName("M");
+                writer.WriteStartObject();
+                for (auto& mapItem : m_value.m)
+                {
+                    writer.WriteName(mapItem.first);
+                    mapItem.second->WriteJson(writer);
+                }
+                writer.WriteEndObject();
+                break;
+            case ValueType::ATTRIBUTE_LIST:
+                writer.WriteName("L");
+                writer.WriteStartArray();
+                for (auto& listItem : m_value.l)
+                {
+                    listItem->WriteJson(writer);
+                }
+                writer.WriteEndArray();
+                break;
+            case ValueType::BOOL:
+                writer.WriteName("BOOL");
+                writer.WriteBool(m_value.flag);
+                break;
+            case ValueType::NULLVALUE:
+                writer.WriteName("NULL");
+                writer.WriteBool(m_value.flag);
+                break;
+        }
     }
+    writer.WriteEndObject();
 }
 
 Aws::String AttributeValue::SerializeAttribute() const
@@ -394,5 +829,5 @@ Aws::String AttributeValue::SerializeAttribute() const
 
 Aws::DynamoDB::Model::ValueType AttributeValue::GetType() const
 {
-    return m_value->GetType();
+    return m_type;
 }
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/BatchGetItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -82,3 +83,26 @@ BatchGetItemResult& BatchGetItemResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+bool BatchGetItemResult::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "Responses")
+    {
+      return ReadJsonValue(reader, m_responses);
+    }
+
+    if(name == "UnprocessedKeys")
+    {
+      return ReadJsonValue(reader, m_unprocessedKeys);
+    }
+
+    if(name == "ConsumedCapacity")
+    {
+      return ReadJsonValue(reader, m_consumedCapacity);
+    }
+
+    return reader.SkipValue();
+  });
+}
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/BatchWriteItemRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -33,35 +34,29 @@ BatchWriteItemRequest::BatchWriteItemRequest() :
 
 Aws::String BatchWriteItemRequest::SerializePayload() const
 {
-  JsonValue payload;
+  JsonWriter writer;
 
+  writer.WriteStartObject();
   if(m_requestItemsHasBeenSet)
   {
-   JsonValue requestItemsJsonMap;
-   for(auto& requestItemsItem : m_requestItems)
-   {
-     Array<JsonValue> writeRequestsJsonList(requestItemsItem.second.size());
-     for(unsigned writeRequestsIndex = 0; writeRequestsIndex < writeRequestsJsonList.GetLength(); ++writeRequestsIndex)
-     {
-       writeRequestsJsonList[writeRequestsIndex].AsObject(requestItemsItem.second[writeRequestsIndex].Jsonize());
-     }
-     requestItemsJsonMap.WithArray(requestItemsItem.first, std::move(writeRequestsJsonList));
-   }
-   payload.WithObject("RequestItems", std::move(requestItemsJsonMap));
-
+   writer.WriteName("RequestItems");
+   WriteJsonValue(writer, m_requestItems);
   }
 
   if(m_returnConsumedCapacityHasBeenSet)
   {
-   payload.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
+   writer.WriteName("ReturnConsumedCapacity");
+   writer.WriteString(ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
   }
 
   if(m_returnItemCollectionMetricsHasBeenSet)
   {
-   payload.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
+   writer.WriteName("ReturnItemCollectionMetrics");
+   writer.WriteString(ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
   }
 
-  return payload.View().WriteReadable();
+  writer.WriteEndObject();
+  return writer.GetOutput();
 }
 
 Aws::Http::HeaderValueCollection BatchWriteItemRequest::GetRequestSpecificHeaders() const
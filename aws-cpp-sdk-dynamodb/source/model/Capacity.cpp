@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/Capacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -75,6 +76,32 @@ Capacity& Capacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+bool Capacity::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "ReadCapacityUnits")
+    {
+      m_readCapacityUnitsHasBeenSet = true;
+      return ReadJsonValue(reader, m_readCapacityUnits);
+    }
+
+    if(name == "WriteCapacityUnits")
+    {
+      m_writeCapacityUnitsHasBeenSet = true;
+      return ReadJsonValue(reader, m_writeCapacityUnits);
+    }
+
+    if(name == "CapacityUnits")
+    {
+      m_capacityUnitsHasBeenSet = true;
+      return ReadJsonValue(reader, m_capacityUnits);
+    }
+
+    return reader.SkipValue();
+  });
+}
+
 JsonValue Capacity::Jsonize() const
 {
   JsonValue payload;
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -117,6 +118,56 @@ ConsumedCapacity& ConsumedCapacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+bool ConsumedCapacity::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "TableName")
+    {
+      m_tableNameHasBeenSet = true;
+      return ReadJsonValue(reader, m_tableName);
+    }
+
+    if(name == "CapacityUnits")
+    {
+      m_capacityUnitsHasBeenSet = true;
+      return ReadJsonValue(reader, m_capacityUnits);
+    }
+
+    if(name == "ReadCapacityUnits")
+    {
+      m_readCapacityUnitsHasBeenSet = true;
+      return ReadJsonValue(reader, m_readCapacityUnits);
+    }
+
+    if(name == "WriteCapacityUnits")
+    {
+      m_writeCapacityUnitsHasBeenSet = true;
+      return ReadJsonValue(reader, m_writeCapacityUnits);
+    }
+
+    if(name == "Table")
+    {
+      m_tableHasBeenSet = true;
+      return ReadJsonValue(reader, m_table);
+    }
+
+    if(name == "LocalSecondaryIndexes")
+    {
+      m_localSecondaryIndexesHasBeenSet = true;
+      return ReadJsonValue(reader, m_localSecondaryIndexes);
+    }
+
+    if(name == "GlobalSecondaryIndexes")
+    {
+      m_globalSecondaryIndexesHasBeenSet = true;
+      return ReadJsonValue(reader, m_globalSecondaryIndexes);
+    }
+
+    return reader.SkipValue();
+  });
+}
+
 JsonValue ConsumedCapacity::Jsonize() const
 {
   JsonValue payload;
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/DeleteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -72,6 +73,18 @@ JsonValue DeleteRequest::Jsonize() const
   return payload;
 }
 
+void DeleteRequest::WriteJson(JsonWriter& writer) const
+{
+  writer.WriteStartObject();
+  if(m_keyHasBeenSet)
+  {
+   writer.WriteName("Key");
+   WriteJsonValue(writer, m_key);
+  }
+
+  writer.WriteEndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
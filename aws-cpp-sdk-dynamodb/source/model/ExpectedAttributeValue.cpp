@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/ExpectedAttributeValue.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -120,6 +121,36 @@ JsonValue ExpectedAttributeValue::Jsonize() const
   return payload;
 }
 
+void ExpectedAttributeValue::WriteJson(JsonWriter& writer) const
+{
+  writer.WriteStartObject();
+  if(m_valueHasBeenSet)
+  {
+   writer.WriteName("Value");
+   WriteJsonValue(writer, m_value);
+  }
+
+  if(m_existsHasBeenSet)
+  {
+   writer.WriteName("Exists");
+   WriteJsonValue(writer, m_exists);
+  }
+
+  if(m_comparisonOperatorHasBeenSet)
+  {
+   writer.WriteName("ComparisonOperator");
+   writer.WriteString(ComparisonOperatorMapper::GetNameForComparisonOperator(m_comparisonOperator));
+  }
+
+  if(m_attributeValueListHasBeenSet)
+  {
+   writer.WriteName("AttributeValueList");
+   WriteJsonValue(writer, m_attributeValueList);
+  }
+
+  writer.WriteEndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
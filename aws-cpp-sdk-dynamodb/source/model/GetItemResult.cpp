@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/GetItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -57,3 +58,21 @@ GetItemResult& GetItemResult::operator =(const Aws::AmazonWebServiceResult<JsonV
 
   return *this;
 }
+
+bool GetItemResult::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "Item")
+    {
+      return ReadJsonValue(reader, m_item);
+    }
+
+    if(name == "ConsumedCapacity")
+    {
+      return ReadJsonValue(reader, m_consumedCapacity);
+    }
+
+    return reader.SkipValue();
+  });
+}
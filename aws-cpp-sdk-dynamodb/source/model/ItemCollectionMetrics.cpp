@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/ItemCollectionMetrics.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ ItemCollectionMetrics& ItemCollectionMetrics::operator =(JsonView jsonValue)
   return *this;
 }
 
+bool ItemCollectionMetrics::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "ItemCollectionKey")
+    {
+      m_itemCollectionKeyHasBeenSet = true;
+      return ReadJsonValue(reader, m_itemCollectionKey);
+    }
+
+    if(name == "SizeEstimateRangeGB")
+    {
+      m_sizeEstimateRangeGBHasBeenSet = true;
+      return ReadJsonValue(reader, m_sizeEstimateRangeGB);
+    }
+
+    return reader.SkipValue();
+  });
+}
+
 JsonValue ItemCollectionMetrics::Jsonize() const
 {
   JsonValue payload;
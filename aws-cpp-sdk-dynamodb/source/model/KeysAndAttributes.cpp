@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/KeysAndAttributes.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -104,6 +105,44 @@ KeysAndAttributes& KeysAndAttributes::operator =(JsonView jsonValue)
   return *this;
 }
 
+bool KeysAndAttributes::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "Keys")
+    {
+      m_keysHasBeenSet = true;
+      return ReadJsonValue(reader, m_keys);
+    }
+
+    if(name == "AttributesToGet")
+    {
+      m_attributesToGetHasBeenSet = true;
+      return ReadJsonValue(reader, m_attributesToGet);
+    }
+
+    if(name == "ConsistentRead")
+    {
+      m_consistentReadHasBeenSet = true;
+      return ReadJsonValue(reader, m_consistentRead);
+    }
+
+    if(name == "ProjectionExpression")
+    {
+      m_projectionExpressionHasBeenSet = true;
+      return ReadJsonValue(reader, m_projectionExpression);
+    }
+
+    if(name == "ExpressionAttributeNames")
+    {
+      m_expressionAttributeNamesHasBeenSet = true;
+      return ReadJsonValue(reader, m_expressionAttributeNames);
+    }
+
+    return reader.SkipValue();
+  });
+}
+
 JsonValue KeysAndAttributes::Jsonize() const
 {
   JsonValue payload;
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/PutItemRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -42,85 +43,71 @@ PutItemRequest::PutItemRequest() :
 
 Aws::String PutItemRequest::SerializePayload() const
 {
-  JsonValue payload;
+  JsonWriter writer;
 
+  writer.WriteStartObject();
   if(m_tableNameHasBeenSet)
   {
-   payload.WithString("TableName", m_tableName);
-
+   writer.WriteName("TableName");
+   WriteJsonValue(writer, m_tableName);
   }
 
   if(m_itemHasBeenSet)
   {
-   JsonValue itemJsonMap;
-   for(auto& itemItem : m_item)
-   {
-     itemJsonMap.WithObject(itemItem.first, itemItem.second.Jsonize());
-   }
-   payload.WithObject("Item", std::move(itemJsonMap));
-
+   writer.WriteName("Item");
+   WriteJsonValue(writer, m_item);
   }
 
   if(m_expectedHasBeenSet)
   {
-   JsonValue expectedJsonMap;
-   for(auto& expectedItem : m_expected)
-   {
-     expectedJsonMap.WithObject(expectedItem.first, expectedItem.second.Jsonize());
-   }
-   payload.WithObject("Expected", std::move(expectedJsonMap));
-
+   writer.WriteName("Expected");
+   WriteJsonValue(writer, m_expected);
   }
 
   if(m_returnValuesHasBeenSet)
   {
-   payload.WithString("ReturnValues", ReturnValueMapper::GetNameForReturnValue(m_returnValues));
+   writer.WriteName("ReturnValues");
+   writer.WriteString(ReturnValueMapper::GetNameForReturnValue(m_returnValues));
   }
 
   if(m_returnConsumedCapacityHasBeenSet)
   {
-   payload.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
+   writer.WriteName("ReturnConsumedCapacity");
+   writer.WriteString(ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
   }
 
   if(m_returnItemCollectionMetricsHasBeenSet)
   {
-   payload.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
+   writer.WriteName("ReturnItemCollectionMetrics");
+   writer.WriteString(ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
   }
 
   if(m_conditionalOperatorHasBeenSet)
   {
-   payload.WithString("ConditionalOperator", ConditionalOperatorMapper::GetNameForConditionalOperator(m_conditionalOperator));
+   writer.WriteName("ConditionalOperator");
+   writer.WriteString(ConditionalOperatorMapper::GetNameForConditionalOperator(m_conditionalOperator));
   }
 
   if(m_conditionExpressionHasBeenSet)
   {
-   payload.WithString("ConditionExpression", m_conditionExpression);
-
+   writer.WriteName("ConditionExpression");
+   WriteJsonValue(writer, m_conditionExpression);
   }
 
   if(m_expressionAttributeNamesHasBeenSet)
   {
-   JsonValue expressionAttributeNamesJsonMap;
-   for(auto& expressionAttributeNamesItem : m_expressionAttributeNames)
-   {
-     expressionAttributeNamesJsonMap.WithString(expressionAttributeNamesItem.first, expressionAttributeNamesItem.second);
-   }
-   payload.WithObject("ExpressionAttributeNames", std::move(expressionAttributeNamesJsonMap));
-
+   writer.WriteName("ExpressionAttributeNames");
+   WriteJsonValue(writer, m_expressionAttributeNames);
   }
 
   if(m_expressionAttributeValuesHasBeenSet)
   {
-   JsonValue expressionAttributeValuesJsonMap;
-   for(auto& expressionAttributeValuesItem : m_expressionAttributeValues)
-   {
-     expressionAttributeValuesJsonMap.WithObject(expressionAttributeValuesItem.first, expressionAttributeValuesItem.second.Jsonize());
-   }
-   payload.WithObject("ExpressionAttributeValues", std::move(expressionAttributeValuesJsonMap));
-
+   writer.WriteName("ExpressionAttributeValues");
+   WriteJsonValue(writer, m_expressionAttributeValues);
   }
 
-  return payload.View().WriteReadable();
+  writer.WriteEndObject();
+  return writer.GetOutput();
 }
 
 Aws::Http::HeaderValueCollection PutItemRequest::GetRequestSpecificHeaders() const
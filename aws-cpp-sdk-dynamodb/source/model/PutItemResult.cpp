@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/PutItemResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -63,3 +64,26 @@ PutItemResult& PutItemResult::operator =(const Aws::AmazonWebServiceResult<JsonV
 
   return *this;
 }
+
+bool PutItemResult::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "Attributes")
+    {
+      return ReadJsonValue(reader, m_attributes);
+    }
+
+    if(name == "ConsumedCapacity")
+    {
+      return ReadJsonValue(reader, m_consumedCapacity);
+    }
+
+    if(name == "ItemCollectionMetrics")
+    {
+      return ReadJsonValue(reader, m_itemCollectionMetrics);
+    }
+
+    return reader.SkipValue();
+  });
+}
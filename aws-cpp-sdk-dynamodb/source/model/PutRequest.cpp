@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/PutRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -72,6 +73,18 @@ JsonValue PutRequest::Jsonize() const
   return payload;
 }
 
+void PutRequest::WriteJson(JsonWriter& writer) const
+{
+  writer.WriteStartObject();
+  if(m_itemHasBeenSet)
+  {
+   writer.WriteName("Item");
+   WriteJsonValue(writer, m_item);
+  }
+
+  writer.WriteEndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
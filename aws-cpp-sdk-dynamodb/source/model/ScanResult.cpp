@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/ScanResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -88,3 +89,36 @@ ScanResult& ScanResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>&
 
   return *this;
 }
+
+bool ScanResult::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "Items")
+    {
+      return ReadJsonValue(reader, m_items);
+    }
+
+    if(name == "Count")
+    {
+      return ReadJsonValue(reader, m_count);
+    }
+
+    if(name == "ScannedCount")
+    {
+      return ReadJsonValue(reader, m_scannedCount);
+    }
+
+    if(name == "LastEvaluatedKey")
+    {
+      return ReadJsonValue(reader, m_lastEvaluatedKey);
+    }
+
+    if(name == "ConsumedCapacity")
+    {
+      return ReadJsonValue(reader, m_consumedCapacity);
+    }
+
+    return reader.SkipValue();
+  });
+}
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/WriteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -79,6 +80,24 @@ JsonValue WriteRequest::Jsonize() const
   return payload;
 }
 
+void WriteRequest::WriteJson(JsonWriter& writer) const
+{
+  writer.WriteStartObject();
+  if(m_putRequestHasBeenSet)
+  {
+   writer.WriteName("PutRequest");
+   WriteJsonValue(writer, m_putRequest);
+  }
+
+  if(m_deleteRequestHasBeenSet)
+  {
+   writer.WriteName("DeleteRequest");
+   WriteJsonValue(writer, m_deleteRequest);
+  }
+
+  writer.WriteEndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
@@ -30,6 +30,7 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace EC2
@@ -42,6 +43,10 @@ namespace Model
     DescribeImagesResponse();
     DescribeImagesResponse(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     DescribeImagesResponse& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /**
+     * Reads the response payload in a single pass, without building an XmlDocument.
+     */
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
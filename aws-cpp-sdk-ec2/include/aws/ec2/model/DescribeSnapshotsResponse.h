@@ -31,6 +31,7 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace EC2
@@ -43,6 +44,10 @@ namespace Model
     DescribeSnapshotsResponse();
     DescribeSnapshotsResponse(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     DescribeSnapshotsResponse& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /**
+     * Reads the response payload in a single pass, without building an XmlDocument.
+     */
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
@@ -27,6 +27,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace EC2
@@ -49,6 +50,7 @@ namespace Model
 
     void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     void OutputToStream(Aws::OStream& oStream, const char* location) const;
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
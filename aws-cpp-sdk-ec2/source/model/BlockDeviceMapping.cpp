@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -82,6 +83,38 @@ BlockDeviceMapping& BlockDeviceMapping::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool BlockDeviceMapping::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "deviceName")
+    {
+      m_deviceNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_deviceName);
+    }
+
+    if(name == "virtualName")
+    {
+      m_virtualNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_virtualName);
+    }
+
+    if(name == "ebs")
+    {
+      m_ebsHasBeenSet = true;
+      return ReadXmlValue(reader, m_ebs);
+    }
+
+    if(name == "noDevice")
+    {
+      m_noDeviceHasBeenSet = true;
+      return ReadXmlValue(reader, m_noDevice);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void BlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_deviceNameHasBeenSet)
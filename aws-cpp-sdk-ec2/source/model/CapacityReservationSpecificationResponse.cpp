@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -68,6 +69,26 @@ CapacityReservationSpecificationResponse& CapacityReservationSpecificationRespon
   return *this;
 }
 
+bool CapacityReservationSpecificationResponse::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "capacityReservationPreference")
+    {
+      m_capacityReservationPreferenceHasBeenSet = true;
+      return ReadXmlValue(reader, m_capacityReservationPreference, CapacityReservationPreferenceMapper::GetCapacityReservationPreferenceForName);
+    }
+
+    if(name == "capacityReservationTarget")
+    {
+      m_capacityReservationTargetHasBeenSet = true;
+      return ReadXmlValue(reader, m_capacityReservationTarget);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void CapacityReservationSpecificationResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_capacityReservationPreferenceHasBeenSet)
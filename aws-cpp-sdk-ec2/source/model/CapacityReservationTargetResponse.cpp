@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -58,6 +59,20 @@ CapacityReservationTargetResponse& CapacityReservationTargetResponse::operator =
   return *this;
 }
 
+bool CapacityReservationTargetResponse::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "capacityReservationId")
+    {
+      m_capacityReservationIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_capacityReservationId);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void CapacityReservationTargetResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_capacityReservationIdHasBeenSet)
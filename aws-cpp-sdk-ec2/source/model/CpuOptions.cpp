@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -70,6 +71,26 @@ CpuOptions& CpuOptions::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool CpuOptions::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "coreCount")
+    {
+      m_coreCountHasBeenSet = true;
+      return ReadXmlValue(reader, m_coreCount);
+    }
+
+    if(name == "threadsPerCore")
+    {
+      m_threadsPerCoreHasBeenSet = true;
+      return ReadXmlValue(reader, m_threadsPerCore);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void CpuOptions::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_coreCountHasBeenSet)
@@ -18,6 +18,7 @@
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -71,3 +72,25 @@ DescribeImagesResponse& DescribeImagesResponse::operator =(const Aws::AmazonWebS
   }
   return *this;
 }
+
+bool DescribeImagesResponse::ReadXml(XmlReader& reader)
+{
+  return reader.ReadDocument([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "imagesSet")
+    {
+      return ReadXmlList(reader, "item", m_images);
+    }
+
+    if(name == "requestId")
+    {
+      Aws::String requestId;
+      bool succeeded = ReadXmlValue(reader, requestId);
+      m_responseMetadata.SetRequestId(requestId);
+      AWS_LOGSTREAM_DEBUG("Aws::EC2::Model::DescribeImagesResponse", "x-amzn-request-id: " << requestId);
+      return succeeded;
+    }
+
+    return reader.SkipElement();
+  });
+}
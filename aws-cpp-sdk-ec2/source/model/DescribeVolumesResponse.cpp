@@ -18,6 +18,7 @@
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -76,3 +77,30 @@ DescribeVolumesResponse& DescribeVolumesResponse::operator =(const Aws::AmazonWe
   }
   return *this;
 }
+
+bool DescribeVolumesResponse::ReadXml(XmlReader& reader)
+{
+  return reader.ReadDocument([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "volumeSet")
+    {
+      return ReadXmlList(reader, "item", m_volumes);
+    }
+
+    if(name == "nextToken")
+    {
+      return ReadXmlValue(reader, m_nextToken);
+    }
+
+    if(name == "requestId")
+    {
+      Aws::String requestId;
+      bool succeeded = ReadXmlValue(reader, requestId);
+      m_responseMetadata.SetRequestId(requestId);
+      AWS_LOGSTREAM_DEBUG("Aws::EC2::Model::DescribeVolumesResponse", "x-amzn-request-id: " << requestId);
+      return succeeded;
+    }
+
+    return reader.SkipElement();
+  });
+}
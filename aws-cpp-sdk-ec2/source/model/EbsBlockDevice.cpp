@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -116,6 +117,56 @@ EbsBlockDevice& EbsBlockDevice::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool EbsBlockDevice::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "deleteOnTermination")
+    {
+      m_deleteOnTerminationHasBeenSet = true;
+      return ReadXmlValue(reader, m_deleteOnTermination);
+    }
+
+    if(name == "iops")
+    {
+      m_iopsHasBeenSet = true;
+      return ReadXmlValue(reader, m_iops);
+    }
+
+    if(name == "snapshotId")
+    {
+      m_snapshotIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_snapshotId);
+    }
+
+    if(name == "volumeSize")
+    {
+      m_volumeSizeHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeSize);
+    }
+
+    if(name == "volumeType")
+    {
+      m_volumeTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeType, VolumeTypeMapper::GetVolumeTypeForName);
+    }
+
+    if(name == "encrypted")
+    {
+      m_encryptedHasBeenSet = true;
+      return ReadXmlValue(reader, m_encrypted);
+    }
+
+    if(name == "KmsKeyId")
+    {
+      m_kmsKeyIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_kmsKeyId);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void EbsBlockDevice::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_deleteOnTerminationHasBeenSet)
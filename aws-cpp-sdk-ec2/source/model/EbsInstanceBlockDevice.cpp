@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -86,6 +87,38 @@ EbsInstanceBlockDevice& EbsInstanceBlockDevice::operator =(const XmlNode& xmlNod
   return *this;
 }
 
+bool EbsInstanceBlockDevice::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "attachTime")
+    {
+      m_attachTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_attachTime);
+    }
+
+    if(name == "deleteOnTermination")
+    {
+      m_deleteOnTerminationHasBeenSet = true;
+      return ReadXmlValue(reader, m_deleteOnTermination);
+    }
+
+    if(name == "status")
+    {
+      m_statusHasBeenSet = true;
+      return ReadXmlValue(reader, m_status, AttachmentStatusMapper::GetAttachmentStatusForName);
+    }
+
+    if(name == "volumeId")
+    {
+      m_volumeIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeId);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void EbsInstanceBlockDevice::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_attachTimeHasBeenSet)
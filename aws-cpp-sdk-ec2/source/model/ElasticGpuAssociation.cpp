@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -82,6 +83,38 @@ ElasticGpuAssociation& ElasticGpuAssociation::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool ElasticGpuAssociation::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "elasticGpuId")
+    {
+      m_elasticGpuIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticGpuId);
+    }
+
+    if(name == "elasticGpuAssociationId")
+    {
+      m_elasticGpuAssociationIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticGpuAssociationId);
+    }
+
+    if(name == "elasticGpuAssociationState")
+    {
+      m_elasticGpuAssociationStateHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticGpuAssociationState);
+    }
+
+    if(name == "elasticGpuAssociationTime")
+    {
+      m_elasticGpuAssociationTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticGpuAssociationTime);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void ElasticGpuAssociation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_elasticGpuIdHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -82,6 +83,38 @@ ElasticInferenceAcceleratorAssociation& ElasticInferenceAcceleratorAssociation::
   return *this;
 }
 
+bool ElasticInferenceAcceleratorAssociation::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "elasticInferenceAcceleratorArn")
+    {
+      m_elasticInferenceAcceleratorArnHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticInferenceAcceleratorArn);
+    }
+
+    if(name == "elasticInferenceAcceleratorAssociationId")
+    {
+      m_elasticInferenceAcceleratorAssociationIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticInferenceAcceleratorAssociationId);
+    }
+
+    if(name == "elasticInferenceAcceleratorAssociationState")
+    {
+      m_elasticInferenceAcceleratorAssociationStateHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticInferenceAcceleratorAssociationState);
+    }
+
+    if(name == "elasticInferenceAcceleratorAssociationTime")
+    {
+      m_elasticInferenceAcceleratorAssociationTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_elasticInferenceAcceleratorAssociationTime);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void ElasticInferenceAcceleratorAssociation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_elasticInferenceAcceleratorArnHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ GroupIdentifier& GroupIdentifier::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool GroupIdentifier::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "groupName")
+    {
+      m_groupNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_groupName);
+    }
+
+    if(name == "groupId")
+    {
+      m_groupIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_groupId);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void GroupIdentifier::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_groupNameHasBeenSet)
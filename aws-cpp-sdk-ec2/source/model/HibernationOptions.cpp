@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -60,6 +61,20 @@ HibernationOptions& HibernationOptions::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool HibernationOptions::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "configured")
+    {
+      m_configuredHasBeenSet = true;
+      return ReadXmlValue(reader, m_configured);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void HibernationOptions::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_configuredHasBeenSet)
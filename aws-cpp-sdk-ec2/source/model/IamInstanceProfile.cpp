@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ IamInstanceProfile& IamInstanceProfile::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool IamInstanceProfile::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "arn")
+    {
+      m_arnHasBeenSet = true;
+      return ReadXmlValue(reader, m_arn);
+    }
+
+    if(name == "id")
+    {
+      m_idHasBeenSet = true;
+      return ReadXmlValue(reader, m_id);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void IamInstanceProfile::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_arnHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -278,6 +279,158 @@ Image& Image::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Image::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "architecture")
+    {
+      m_architectureHasBeenSet = true;
+      return ReadXmlValue(reader, m_architecture, ArchitectureValuesMapper::GetArchitectureValuesForName);
+    }
+
+    if(name == "creationDate")
+    {
+      m_creationDateHasBeenSet = true;
+      return ReadXmlValue(reader, m_creationDate);
+    }
+
+    if(name == "imageId")
+    {
+      m_imageIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_imageId);
+    }
+
+    if(name == "imageLocation")
+    {
+      m_imageLocationHasBeenSet = true;
+      return ReadXmlValue(reader, m_imageLocation);
+    }
+
+    if(name == "imageType")
+    {
+      m_imageTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_imageType, ImageTypeValuesMapper::GetImageTypeValuesForName);
+    }
+
+    if(name == "isPublic")
+    {
+      m_publicHasBeenSet = true;
+      return ReadXmlValue(reader, m_public);
+    }
+
+    if(name == "kernelId")
+    {
+      m_kernelIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_kernelId);
+    }
+
+    if(name == "imageOwnerId")
+    {
+      m_ownerIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ownerId);
+    }
+
+    if(name == "platform")
+    {
+      m_platformHasBeenSet = true;
+      return ReadXmlValue(reader, m_platform, PlatformValuesMapper::GetPlatformValuesForName);
+    }
+
+    if(name == "productCodes")
+    {
+      m_productCodesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_productCodes);
+    }
+
+    if(name == "ramdiskId")
+    {
+      m_ramdiskIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ramdiskId);
+    }
+
+    if(name == "imageState")
+    {
+      m_stateHasBeenSet = true;
+      return ReadXmlValue(reader, m_state, ImageStateMapper::GetImageStateForName);
+    }
+
+    if(name == "blockDeviceMapping")
+    {
+      m_blockDeviceMappingsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_blockDeviceMappings);
+    }
+
+    if(name == "description")
+    {
+      m_descriptionHasBeenSet = true;
+      return ReadXmlValue(reader, m_description);
+    }
+
+    if(name == "enaSupport")
+    {
+      m_enaSupportHasBeenSet = true;
+      return ReadXmlValue(reader, m_enaSupport);
+    }
+
+    if(name == "hypervisor")
+    {
+      m_hypervisorHasBeenSet = true;
+      return ReadXmlValue(reader, m_hypervisor, HypervisorTypeMapper::GetHypervisorTypeForName);
+    }
+
+    if(name == "imageOwnerAlias")
+    {
+      m_imageOwnerAliasHasBeenSet = true;
+      return ReadXmlValue(reader, m_imageOwnerAlias);
+    }
+
+    if(name == "name")
+    {
+      m_nameHasBeenSet = true;
+      return ReadXmlValue(reader, m_name);
+    }
+
+    if(name == "rootDeviceName")
+    {
+      m_rootDeviceNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_rootDeviceName);
+    }
+
+    if(name == "rootDeviceType")
+    {
+      m_rootDeviceTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_rootDeviceType, DeviceTypeMapper::GetDeviceTypeForName);
+    }
+
+    if(name == "sriovNetSupport")
+    {
+      m_sriovNetSupportHasBeenSet = true;
+      return ReadXmlValue(reader, m_sriovNetSupport);
+    }
+
+    if(name == "stateReason")
+    {
+      m_stateReasonHasBeenSet = true;
+      return ReadXmlValue(reader, m_stateReason);
+    }
+
+    if(name == "tagSet")
+    {
+      m_tagsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_tags);
+    }
+
+    if(name == "virtualizationType")
+    {
+      m_virtualizationTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_virtualizationType, VirtualizationTypeMapper::GetVirtualizationTypeForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_architectureHasBeenSet)
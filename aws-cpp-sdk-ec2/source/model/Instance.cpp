@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -480,6 +481,284 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Instance::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "amiLaunchIndex")
+    {
+      m_amiLaunchIndexHasBeenSet = true;
+      return ReadXmlValue(reader, m_amiLaunchIndex);
+    }
+
+    if(name == "imageId")
+    {
+      m_imageIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_imageId);
+    }
+
+    if(name == "instanceId")
+    {
+      m_instanceIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_instanceId);
+    }
+
+    if(name == "instanceType")
+    {
+      m_instanceTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_instanceType, InstanceTypeMapper::GetInstanceTypeForName);
+    }
+
+    if(name == "kernelId")
+    {
+      m_kernelIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_kernelId);
+    }
+
+    if(name == "keyName")
+    {
+      m_keyNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_keyName);
+    }
+
+    if(name == "launchTime")
+    {
+      m_launchTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_launchTime);
+    }
+
+    if(name == "monitoring")
+    {
+      m_monitoringHasBeenSet = true;
+      return ReadXmlValue(reader, m_monitoring);
+    }
+
+    if(name == "placement")
+    {
+      m_placementHasBeenSet = true;
+      return ReadXmlValue(reader, m_placement);
+    }
+
+    if(name == "platform")
+    {
+      m_platformHasBeenSet = true;
+      return ReadXmlValue(reader, m_platform, PlatformValuesMapper::GetPlatformValuesForName);
+    }
+
+    if(name == "privateDnsName")
+    {
+      m_privateDnsNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_privateDnsName);
+    }
+
+    if(name == "privateIpAddress")
+    {
+      m_privateIpAddressHasBeenSet = true;
+      return ReadXmlValue(reader, m_privateIpAddress);
+    }
+
+    if(name == "productCodes")
+    {
+      m_productCodesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_productCodes);
+    }
+
+    if(name == "dnsName")
+    {
+      m_publicDnsNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_publicDnsName);
+    }
+
+    if(name == "ipAddress")
+    {
+      m_publicIpAddressHasBeenSet = true;
+      return ReadXmlValue(reader, m_publicIpAddress);
+    }
+
+    if(name == "ramdiskId")
+    {
+      m_ramdiskIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ramdiskId);
+    }
+
+    if(name == "instanceState")
+    {
+      m_stateHasBeenSet = true;
+      return ReadXmlValue(reader, m_state);
+    }
+
+    if(name == "reason")
+    {
+      m_stateTransitionReasonHasBeenSet = true;
+      return ReadXmlValue(reader, m_stateTransitionReason);
+    }
+
+    if(name == "subnetId")
+    {
+      m_subnetIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_subnetId);
+    }
+
+    if(name == "vpcId")
+    {
+      m_vpcIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_vpcId);
+    }
+
+    if(name == "architecture")
+    {
+      m_architectureHasBeenSet = true;
+      return ReadXmlValue(reader, m_architecture, ArchitectureValuesMapper::GetArchitectureValuesForName);
+    }
+
+    if(name == "blockDeviceMapping")
+    {
+      m_blockDeviceMappingsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_blockDeviceMappings);
+    }
+
+    if(name == "clientToken")
+    {
+      m_clientTokenHasBeenSet = true;
+      return ReadXmlValue(reader, m_clientToken);
+    }
+
+    if(name == "ebsOptimized")
+    {
+      m_ebsOptimizedHasBeenSet = true;
+      return ReadXmlValue(reader, m_ebsOptimized);
+    }
+
+    if(name == "enaSupport")
+    {
+      m_enaSupportHasBeenSet = true;
+      return ReadXmlValue(reader, m_enaSupport);
+    }
+
+    if(name == "hypervisor")
+    {
+      m_hypervisorHasBeenSet = true;
+      return ReadXmlValue(reader, m_hypervisor, HypervisorTypeMapper::GetHypervisorTypeForName);
+    }
+
+    if(name == "iamInstanceProfile")
+    {
+      m_iamInstanceProfileHasBeenSet = true;
+      return ReadXmlValue(reader, m_iamInstanceProfile);
+    }
+
+    if(name == "instanceLifecycle")
+    {
+      m_instanceLifecycleHasBeenSet = true;
+      return ReadXmlValue(reader, m_instanceLifecycle, InstanceLifecycleTypeMapper::GetInstanceLifecycleTypeForName);
+    }
+
+    if(name == "elasticGpuAssociationSet")
+    {
+      m_elasticGpuAssociationsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_elasticGpuAssociations);
+    }
+
+    if(name == "elasticInferenceAcceleratorAssociationSet")
+    {
+      m_elasticInferenceAcceleratorAssociationsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_elasticInferenceAcceleratorAssociations);
+    }
+
+    if(name == "networkInterfaceSet")
+    {
+      m_networkInterfacesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_networkInterfaces);
+    }
+
+    if(name == "rootDeviceName")
+    {
+      m_rootDeviceNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_rootDeviceName);
+    }
+
+    if(name == "rootDeviceType")
+    {
+      m_rootDeviceTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_rootDeviceType, DeviceTypeMapper::GetDeviceTypeForName);
+    }
+
+    if(name == "groupSet")
+    {
+      m_securityGroupsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_securityGroups);
+    }
+
+    if(name == "sourceDestCheck")
+    {
+      m_sourceDestCheckHasBeenSet = true;
+      return ReadXmlValue(reader, m_sourceDestCheck);
+    }
+
+    if(name == "spotInstanceRequestId")
+    {
+      m_spotInstanceRequestIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_spotInstanceRequestId);
+    }
+
+    if(name == "sriovNetSupport")
+    {
+      m_sriovNetSupportHasBeenSet = true;
+      return ReadXmlValue(reader, m_sriovNetSupport);
+    }
+
+    if(name == "stateReason")
+    {
+      m_stateReasonHasBeenSet = true;
+      return ReadXmlValue(reader, m_stateReason);
+    }
+
+    if(name == "tagSet")
+    {
+      m_tagsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_tags);
+    }
+
+    if(name == "virtualizationType")
+    {
+      m_virtualizationTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_virtualizationType, VirtualizationTypeMapper::GetVirtualizationTypeForName);
+    }
+
+    if(name == "cpuOptions")
+    {
+      m_cpuOptionsHasBeenSet = true;
+      return ReadXmlValue(reader, m_cpuOptions);
+    }
+
+    if(name == "capacityReservationId")
+    {
+      m_capacityReservationIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_capacityReservationId);
+    }
+
+    if(name == "capacityReservationSpecification")
+    {
+      m_capacityReservationSpecificationHasBeenSet = true;
+      return ReadXmlValue(reader, m_capacityReservationSpecification);
+    }
+
+    if(name == "hibernationOptions")
+    {
+      m_hibernationOptionsHasBeenSet = true;
+      return ReadXmlValue(reader, m_hibernationOptions);
+    }
+
+    if(name == "licenseSet")
+    {
+      m_licensesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_licenses);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_amiLaunchIndexHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ InstanceBlockDeviceMapping& InstanceBlockDeviceMapping::operator =(const XmlNode
   return *this;
 }
 
+bool InstanceBlockDeviceMapping::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "deviceName")
+    {
+      m_deviceNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_deviceName);
+    }
+
+    if(name == "ebs")
+    {
+      m_ebsHasBeenSet = true;
+      return ReadXmlValue(reader, m_ebs);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstanceBlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_deviceNameHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -58,6 +59,20 @@ InstanceIpv6Address& InstanceIpv6Address::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool InstanceIpv6Address::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "ipv6Address")
+    {
+      m_ipv6AddressHasBeenSet = true;
+      return ReadXmlValue(reader, m_ipv6Address);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstanceIpv6Address::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_ipv6AddressHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -200,6 +201,110 @@ InstanceNetworkInterface& InstanceNetworkInterface::operator =(const XmlNode& xm
   return *this;
 }
 
+bool InstanceNetworkInterface::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "association")
+    {
+      m_associationHasBeenSet = true;
+      return ReadXmlValue(reader, m_association);
+    }
+
+    if(name == "attachment")
+    {
+      m_attachmentHasBeenSet = true;
+      return ReadXmlValue(reader, m_attachment);
+    }
+
+    if(name == "description")
+    {
+      m_descriptionHasBeenSet = true;
+      return ReadXmlValue(reader, m_description);
+    }
+
+    if(name == "groupSet")
+    {
+      m_groupsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_groups);
+    }
+
+    if(name == "ipv6AddressesSet")
+    {
+      m_ipv6AddressesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_ipv6Addresses);
+    }
+
+    if(name == "macAddress")
+    {
+      m_macAddressHasBeenSet = true;
+      return ReadXmlValue(reader, m_macAddress);
+    }
+
+    if(name == "networkInterfaceId")
+    {
+      m_networkInterfaceIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_networkInterfaceId);
+    }
+
+    if(name == "ownerId")
+    {
+      m_ownerIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ownerId);
+    }
+
+    if(name == "privateDnsName")
+    {
+      m_privateDnsNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_privateDnsName);
+    }
+
+    if(name == "privateIpAddress")
+    {
+      m_privateIpAddressHasBeenSet = true;
+      return ReadXmlValue(reader, m_privateIpAddress);
+    }
+
+    if(name == "privateIpAddressesSet")
+    {
+      m_privateIpAddressesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_privateIpAddresses);
+    }
+
+    if(name == "sourceDestCheck")
+    {
+      m_sourceDestCheckHasBeenSet = true;
+      return ReadXmlValue(reader, m_sourceDestCheck);
+    }
+
+    if(name == "status")
+    {
+      m_statusHasBeenSet = true;
+      return ReadXmlValue(reader, m_status, NetworkInterfaceStatusMapper::GetNetworkInterfaceStatusForName);
+    }
+
+    if(name == "subnetId")
+    {
+      m_subnetIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_subnetId);
+    }
+
+    if(name == "vpcId")
+    {
+      m_vpcIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_vpcId);
+    }
+
+    if(name == "interfaceType")
+    {
+      m_interfaceTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_interfaceType);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_associationHasBeenSet)
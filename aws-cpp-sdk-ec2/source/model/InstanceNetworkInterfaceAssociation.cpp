@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -74,6 +75,32 @@ InstanceNetworkInterfaceAssociation& InstanceNetworkInterfaceAssociation::operat
   return *this;
 }
 
+bool InstanceNetworkInterfaceAssociation::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "ipOwnerId")
+    {
+      m_ipOwnerIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ipOwnerId);
+    }
+
+    if(name == "publicDnsName")
+    {
+      m_publicDnsNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_publicDnsName);
+    }
+
+    if(name == "publicIp")
+    {
+      m_publicIpHasBeenSet = true;
+      return ReadXmlValue(reader, m_publicIp);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstanceNetworkInterfaceAssociation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_ipOwnerIdHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -96,6 +97,44 @@ InstanceNetworkInterfaceAttachment& InstanceNetworkInterfaceAttachment::operator
   return *this;
 }
 
+bool InstanceNetworkInterfaceAttachment::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "attachTime")
+    {
+      m_attachTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_attachTime);
+    }
+
+    if(name == "attachmentId")
+    {
+      m_attachmentIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_attachmentId);
+    }
+
+    if(name == "deleteOnTermination")
+    {
+      m_deleteOnTerminationHasBeenSet = true;
+      return ReadXmlValue(reader, m_deleteOnTermination);
+    }
+
+    if(name == "deviceIndex")
+    {
+      m_deviceIndexHasBeenSet = true;
+      return ReadXmlValue(reader, m_deviceIndex);
+    }
+
+    if(name == "status")
+    {
+      m_statusHasBeenSet = true;
+      return ReadXmlValue(reader, m_status, AttachmentStatusMapper::GetAttachmentStatusForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstanceNetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_attachTimeHasBeenSet)
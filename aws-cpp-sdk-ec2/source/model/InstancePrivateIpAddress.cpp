@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -84,6 +85,38 @@ InstancePrivateIpAddress& InstancePrivateIpAddress::operator =(const XmlNode& xm
   return *this;
 }
 
+bool InstancePrivateIpAddress::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "association")
+    {
+      m_associationHasBeenSet = true;
+      return ReadXmlValue(reader, m_association);
+    }
+
+    if(name == "primary")
+    {
+      m_primaryHasBeenSet = true;
+      return ReadXmlValue(reader, m_primary);
+    }
+
+    if(name == "privateDnsName")
+    {
+      m_privateDnsNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_privateDnsName);
+    }
+
+    if(name == "privateIpAddress")
+    {
+      m_privateIpAddressHasBeenSet = true;
+      return ReadXmlValue(reader, m_privateIpAddress);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstancePrivateIpAddress::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_associationHasBeenSet)
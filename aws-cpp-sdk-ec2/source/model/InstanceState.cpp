@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -70,6 +71,26 @@ InstanceState& InstanceState::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool InstanceState::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "code")
+    {
+      m_codeHasBeenSet = true;
+      return ReadXmlValue(reader, m_code);
+    }
+
+    if(name == "name")
+    {
+      m_nameHasBeenSet = true;
+      return ReadXmlValue(reader, m_name, InstanceStateNameMapper::GetInstanceStateNameForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void InstanceState::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_codeHasBeenSet)
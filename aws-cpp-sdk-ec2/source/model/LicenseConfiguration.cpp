@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -58,6 +59,20 @@ LicenseConfiguration& LicenseConfiguration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool LicenseConfiguration::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "licenseConfigurationArn")
+    {
+      m_licenseConfigurationArnHasBeenSet = true;
+      return ReadXmlValue(reader, m_licenseConfigurationArn);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void LicenseConfiguration::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_licenseConfigurationArnHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -60,6 +61,20 @@ Monitoring& Monitoring::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Monitoring::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "state")
+    {
+      m_stateHasBeenSet = true;
+      return ReadXmlValue(reader, m_state, MonitoringStateMapper::GetMonitoringStateForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Monitoring::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_stateHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -110,6 +111,56 @@ Placement& Placement::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Placement::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "availabilityZone")
+    {
+      m_availabilityZoneHasBeenSet = true;
+      return ReadXmlValue(reader, m_availabilityZone);
+    }
+
+    if(name == "affinity")
+    {
+      m_affinityHasBeenSet = true;
+      return ReadXmlValue(reader, m_affinity);
+    }
+
+    if(name == "groupName")
+    {
+      m_groupNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_groupName);
+    }
+
+    if(name == "partitionNumber")
+    {
+      m_partitionNumberHasBeenSet = true;
+      return ReadXmlValue(reader, m_partitionNumber);
+    }
+
+    if(name == "hostId")
+    {
+      m_hostIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_hostId);
+    }
+
+    if(name == "tenancy")
+    {
+      m_tenancyHasBeenSet = true;
+      return ReadXmlValue(reader, m_tenancy, TenancyMapper::GetTenancyForName);
+    }
+
+    if(name == "spreadDomain")
+    {
+      m_spreadDomainHasBeenSet = true;
+      return ReadXmlValue(reader, m_spreadDomain);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Placement::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_availabilityZoneHasBeenSet)
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -68,6 +69,26 @@ ProductCode& ProductCode::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool ProductCode::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "productCode")
+    {
+      m_productCodeIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_productCodeId);
+    }
+
+    if(name == "type")
+    {
+      m_productCodeTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_productCodeType, ProductCodeValuesMapper::GetProductCodeValuesForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void ProductCode::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_productCodeIdHasBeenSet)
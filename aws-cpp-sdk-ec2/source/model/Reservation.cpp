@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -104,6 +105,44 @@ Reservation& Reservation::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Reservation::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "groupSet")
+    {
+      m_groupsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_groups);
+    }
+
+    if(name == "instancesSet")
+    {
+      m_instancesHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_instances);
+    }
+
+    if(name == "ownerId")
+    {
+      m_ownerIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ownerId);
+    }
+
+    if(name == "requesterId")
+    {
+      m_requesterIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_requesterId);
+    }
+
+    if(name == "reservationId")
+    {
+      m_reservationIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_reservationId);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Reservation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_groupsHasBeenSet)
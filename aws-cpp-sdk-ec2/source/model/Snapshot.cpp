@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -176,6 +177,98 @@ Snapshot& Snapshot::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Snapshot::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "dataEncryptionKeyId")
+    {
+      m_dataEncryptionKeyIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_dataEncryptionKeyId);
+    }
+
+    if(name == "description")
+    {
+      m_descriptionHasBeenSet = true;
+      return ReadXmlValue(reader, m_description);
+    }
+
+    if(name == "encrypted")
+    {
+      m_encryptedHasBeenSet = true;
+      return ReadXmlValue(reader, m_encrypted);
+    }
+
+    if(name == "kmsKeyId")
+    {
+      m_kmsKeyIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_kmsKeyId);
+    }
+
+    if(name == "ownerId")
+    {
+      m_ownerIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_ownerId);
+    }
+
+    if(name == "progress")
+    {
+      m_progressHasBeenSet = true;
+      return ReadXmlValue(reader, m_progress);
+    }
+
+    if(name == "snapshotId")
+    {
+      m_snapshotIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_snapshotId);
+    }
+
+    if(name == "startTime")
+    {
+      m_startTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_startTime);
+    }
+
+    if(name == "status")
+    {
+      m_stateHasBeenSet = true;
+      return ReadXmlValue(reader, m_state, SnapshotStateMapper::GetSnapshotStateForName);
+    }
+
+    if(name == "statusMessage")
+    {
+      m_stateMessageHasBeenSet = true;
+      return ReadXmlValue(reader, m_stateMessage);
+    }
+
+    if(name == "volumeId")
+    {
+      m_volumeIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeId);
+    }
+
+    if(name == "volumeSize")
+    {
+      m_volumeSizeHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeSize);
+    }
+
+    if(name == "ownerAlias")
+    {
+      m_ownerAliasHasBeenSet = true;
+      return ReadXmlValue(reader, m_ownerAlias);
+    }
+
+    if(name == "tagSet")
+    {
+      m_tagsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_tags);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_dataEncryptionKeyIdHasBeenSet)
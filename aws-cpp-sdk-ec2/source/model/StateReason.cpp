@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ StateReason& StateReason::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool StateReason::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "code")
+    {
+      m_codeHasBeenSet = true;
+      return ReadXmlValue(reader, m_code);
+    }
+
+    if(name == "message")
+    {
+      m_messageHasBeenSet = true;
+      return ReadXmlValue(reader, m_message);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void StateReason::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_codeHasBeenSet)
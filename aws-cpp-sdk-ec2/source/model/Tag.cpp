@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ Tag& Tag::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Tag::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "key")
+    {
+      m_keyHasBeenSet = true;
+      return ReadXmlValue(reader, m_key);
+    }
+
+    if(name == "value")
+    {
+      m_valueHasBeenSet = true;
+      return ReadXmlValue(reader, m_value);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Tag::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_keyHasBeenSet)
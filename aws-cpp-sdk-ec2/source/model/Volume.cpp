@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -170,6 +171,86 @@ Volume& Volume::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Volume::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "attachmentSet")
+    {
+      m_attachmentsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_attachments);
+    }
+
+    if(name == "availabilityZone")
+    {
+      m_availabilityZoneHasBeenSet = true;
+      return ReadXmlValue(reader, m_availabilityZone);
+    }
+
+    if(name == "createTime")
+    {
+      m_createTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_createTime);
+    }
+
+    if(name == "encrypted")
+    {
+      m_encryptedHasBeenSet = true;
+      return ReadXmlValue(reader, m_encrypted);
+    }
+
+    if(name == "kmsKeyId")
+    {
+      m_kmsKeyIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_kmsKeyId);
+    }
+
+    if(name == "size")
+    {
+      m_sizeHasBeenSet = true;
+      return ReadXmlValue(reader, m_size);
+    }
+
+    if(name == "snapshotId")
+    {
+      m_snapshotIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_snapshotId);
+    }
+
+    if(name == "status")
+    {
+      m_stateHasBeenSet = true;
+      return ReadXmlValue(reader, m_state, VolumeStateMapper::GetVolumeStateForName);
+    }
+
+    if(name == "volumeId")
+    {
+      m_volumeIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeId);
+    }
+
+    if(name == "iops")
+    {
+      m_iopsHasBeenSet = true;
+      return ReadXmlValue(reader, m_iops);
+    }
+
+    if(name == "tagSet")
+    {
+      m_tagsHasBeenSet = true;
+      return ReadXmlList(reader, "item", m_tags);
+    }
+
+    if(name == "volumeType")
+    {
+      m_volumeTypeHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeType, VolumeTypeMapper::GetVolumeTypeForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_attachmentsHasBeenSet)
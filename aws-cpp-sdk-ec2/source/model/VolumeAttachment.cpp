@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -104,6 +105,50 @@ VolumeAttachment& VolumeAttachment::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool VolumeAttachment::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "attachTime")
+    {
+      m_attachTimeHasBeenSet = true;
+      return ReadXmlValue(reader, m_attachTime);
+    }
+
+    if(name == "device")
+    {
+      m_deviceHasBeenSet = true;
+      return ReadXmlValue(reader, m_device);
+    }
+
+    if(name == "instanceId")
+    {
+      m_instanceIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_instanceId);
+    }
+
+    if(name == "status")
+    {
+      m_stateHasBeenSet = true;
+      return ReadXmlValue(reader, m_state, VolumeAttachmentStateMapper::GetVolumeAttachmentStateForName);
+    }
+
+    if(name == "volumeId")
+    {
+      m_volumeIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_volumeId);
+    }
+
+    if(name == "deleteOnTermination")
+    {
+      m_deleteOnTerminationHasBeenSet = true;
+      return ReadXmlValue(reader, m_deleteOnTermination);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void VolumeAttachment::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_attachTimeHasBeenSet)
@@ -26,6 +26,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace CloudWatchLogs
@@ -45,6 +46,7 @@ namespace Model
     OutputLogEvent(Aws::Utils::Json::JsonView jsonValue);
     OutputLogEvent& operator=(Aws::Utils::Json::JsonView jsonValue);
     Aws::Utils::Json::JsonValue Jsonize() const;
+    bool ReadJson(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
@@ -15,6 +15,7 @@
 
 #include <aws/logs/model/GetLogEventsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
@@ -63,3 +64,26 @@ GetLogEventsResult& GetLogEventsResult::operator =(const Aws::AmazonWebServiceRe
 
   return *this;
 }
+
+bool GetLogEventsResult::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "events")
+    {
+      return ReadJsonValue(reader, m_events);
+    }
+
+    if(name == "nextForwardToken")
+    {
+      return ReadJsonValue(reader, m_nextForwardToken);
+    }
+
+    if(name == "nextBackwardToken")
+    {
+      return ReadJsonValue(reader, m_nextBackwardToken);
+    }
+
+    return reader.SkipValue();
+  });
+}
@@ -15,6 +15,7 @@
 
 #include <aws/logs/model/OutputLogEvent.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -73,6 +74,32 @@ OutputLogEvent& OutputLogEvent::operator =(JsonView jsonValue)
   return *this;
 }
 
+bool OutputLogEvent::ReadJson(JsonReader& reader)
+{
+  return reader.ReadObject([this](JsonReader& reader, const Aws::String& name) -> bool
+  {
+    if(name == "timestamp")
+    {
+      m_timestampHasBeenSet = true;
+      return ReadJsonValue(reader, m_timestamp);
+    }
+
+    if(name == "message")
+    {
+      m_messageHasBeenSet = true;
+      return ReadJsonValue(reader, m_message);
+    }
+
+    if(name == "ingestionTime")
+    {
+      m_ingestionTimeHasBeenSet = true;
+      return ReadJsonValue(reader, m_ingestionTime);
+    }
+
+    return reader.SkipValue();
+  });
+}
+
 JsonValue OutputLogEvent::Jsonize() const
 {
   JsonValue payload;
@@ -36,6 +36,68 @@ namespace Aws
     {
         namespace Sqs
         {
+            class SQSQueueConsumer;
+            class SQSQueueProducer;
+
+            /**
+             * Settings for SQSQueue::StartConsuming().
+             */
+            struct SQSQueueConsumerConfiguration
+            {
+                SQSQueueConsumerConfiguration() : workerCount(4), prefetchCount(20), waitTimeSeconds(20), deleteFlushDelayMs(100), extendVisibilityTimeout(true)
+                {
+                }
+
+                /**
+                 * Number of threads calling the message received handler. The handler is called concurrently from all of them.
+                 */
+                size_t workerCount;
+                /**
+                 * Number of received messages waiting for a worker. Receiving pauses while this many are waiting.
+                 */
+                size_t prefetchCount;
+                /**
+                 * How long each ReceiveMessage call long polls an empty queue, at most 20 seconds. StopConsuming() waits for the
+                 * receive in progress, so this also bounds how long it blocks.
+                 */
+                unsigned waitTimeSeconds;
+                /**
+                 * Messages to delete are sent in DeleteMessageBatch calls of up to 10, once 10 are pending or the oldest has been
+                 * pending this long.
+                 */
+                unsigned deleteFlushDelayMs;
+                /**
+                 * Whether to keep messages that are waiting for a worker or still being handled invisible to other consumers, by
+                 * renewing their visibility timeout once half of it has elapsed.
+                 */
+                bool extendVisibilityTimeout;
+            };
+
+            /**
+             * Settings for SQSQueue::StartBatchingPushes().
+             */
+            struct SQSQueueProducerConfiguration
+            {
+                SQSQueueProducerConfiguration() : lingerMs(20), maxAttempts(3), retryDelayMs(100)
+                {
+                }
+
+                /**
+                 * How long a pushed message waits for others to share its SendMessageBatch call. A batch is sent as soon as it
+                 * holds 10 messages or 256 KB of payload.
+                 */
+                unsigned lingerMs;
+                /**
+                 * How many times a message is sent in all when SendMessageBatch reports it as failed. Failures that are the
+                 * sender's fault aren't retried.
+                 */
+                unsigned maxAttempts;
+                /**
+                 * How long a failed message waits before it is sent again, doubled for each further attempt.
+                 */
+                unsigned retryDelayMs;
+            };
+
             /**
              * SQS implementation of the Queue interface. See Queue documentation for more details.
              */
@@ -86,6 +148,8 @@ namespace Aws
                  */
                 SQSQueue(const std::shared_ptr<SQS::SQSClient>& client, const char* queueName, unsigned visibilityTimeout, unsigned pollingFrequencyMs = 10000);
 
+                ~SQSQueue();
+
                 /**
                  * Will continue polling until a message is received or StopPolling is called.
                  */
@@ -98,6 +162,7 @@ namespace Aws
 
                 /**
                  * Does not block. Register for notifications of success or failure with the appropriate handlers.
+                 * Sends the message in a batch with others after StartBatchingPushes() has been called.
                  */
                 void Push(const  Aws::SQS::Model::Message&) override;
 
@@ -111,10 +176,44 @@ namespace Aws
                  */
                 void EnsureQueueIsInitialized();
 
+                /**
+                 * High throughput alternative to StartPolling(), don't use both. Receives up to 10 messages per long polling
+                 * ReceiveMessage call into a prefetch buffer, from which a pool of worker threads hands them to the message received
+                 * handler. Messages the handler marks for deletion are deleted in batches, and the delete handlers are called for
+                 * each of them. See SQSQueueConsumerConfiguration.
+                 */
+                void StartConsuming(const SQSQueueConsumerConfiguration& config = SQSQueueConsumerConfiguration());
+
+                /**
+                 * Stops receiving, waits for the workers to handle the messages already received and sends the pending deletes.
+                 * Called by the destructor. StartConsuming() can be called again afterwards.
+                 * Called from a handler, it can't wait for the handler's own thread, so it only stops receiving: the messages
+                 * already received are still handled, and the threads are joined by the next StartConsuming() or StopConsuming()
+                 * from another thread, or by the destructor.
+                 */
+                void StopConsuming();
+
+                /**
+                 * Makes Push() queue messages for SendMessageBatch calls instead of sending each one with SendMessage. Batches are
+                 * sent asynchronously on the client's executor, only the entries the service reports as failed are retried, and the
+                 * send handlers are called for each message. Messages may be sent out of order. Call this before pushing from
+                 * other threads, see SQSQueueProducerConfiguration.
+                 */
+                void StartBatchingPushes(const SQSQueueProducerConfiguration& config = SQSQueueProducerConfiguration());
+
+                /**
+                 * Sends the queued messages and waits for every batch to complete, retries included, then goes back to sending
+                 * each pushed message on its own. Called by the destructor. Don't call this while other threads are pushing.
+                 */
+                void StopBatchingPushes();
+
                 inline bool IsInitialized() const { return !m_queueUrl.empty(); }
                 inline const Aws::String& GetQueueUrl() const { return m_queueUrl; }
 
             private:
+                friend class SQSQueueConsumer;
+                friend class SQSQueueProducer;
+
                 std::shared_ptr<SQS::SQSClient> m_client;
                 Aws::String m_queueUrl;
                 Aws::String m_queueName;
@@ -134,6 +233,8 @@ namespace Aws
                 QueueAttributeSuccessEventHandler m_queueAttributeSuccessHandler;
                 QueueAttributeFailedEventHandler m_queueAttributeFailedHandler;
 
+                Aws::UniquePtr<SQSQueueConsumer> m_consumer;
+                Aws::UniquePtr<SQSQueueProducer> m_producer;
             };
         }
     }
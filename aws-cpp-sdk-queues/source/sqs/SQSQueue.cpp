@@ -20,11 +20,22 @@
 #include <aws/sqs/model/GetQueueUrlRequest.h>
 #include <aws/sqs/model/GetQueueAttributesRequest.h>
 #include <aws/sqs/model/CreateQueueRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/ChangeMessageVisibilityBatchRequest.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSMultiMap.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/logging/LogSystemInterface.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/StringUtils.h>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 
 using namespace Aws::SQS;
 using namespace Aws::SQS::Model;
@@ -33,6 +44,12 @@ using namespace Aws::Client;
 
 static const char* CLASS_TAG = "Aws::Queues::Sqs::SQSQueue";
 static const int QUEUE_DELETED_RECENTLY_WAIT_TIME = 10;
+static const size_t MAX_BATCH_SIZE = 10;
+static const unsigned MAX_WAIT_TIME_SECONDS = 20;
+static const int RECEIVE_RETRY_DELAY_MS = 1000;
+static const int MAINTENANCE_INTERVAL_MS = 1000;
+static const size_t MAX_BATCH_PAYLOAD_BYTES = 256 * 1024;
+static const unsigned MAX_RETRY_DELAY_DOUBLINGS = 10;
 
 class QueueMessageContext : public AsyncCallerContext
 {
@@ -45,6 +62,608 @@ private:
     Message m_message;
 };
 
+namespace Aws
+{
+    namespace Queues
+    {
+        namespace Sqs
+        {
+            class SQSQueueConsumer;
+
+            // the consumer whose thread this is, so that StopConsuming() called from a handler doesn't join the calling thread.
+            static thread_local SQSQueueConsumer* s_currentConsumer = nullptr;
+
+            /**
+             * The threads behind SQSQueue::StartConsuming(): one receiving into the prefetch buffer, the workers, and one sending
+             * batched deletes and visibility timeout extensions. Messages are tracked by receipt handle, with the time they become
+             * visible again, from the moment they are received until their handler returns.
+             * Once Stop() is called the threads wind down in that order by themselves, so the destructor only has to join them.
+             */
+            class SQSQueueConsumer
+            {
+                typedef std::chrono::steady_clock Clock;
+
+            public:
+                SQSQueueConsumer(SQSQueue& queue, const SQSQueueConsumerConfiguration& config) :
+                    m_queue(queue), m_config(config), m_receiving(true), m_receiverStopped(false), m_workersRunning(0), m_workersStopped(false)
+                {
+                    m_config.workerCount = (std::max)(m_config.workerCount, static_cast<size_t>(1));
+                    m_config.prefetchCount = (std::max)(m_config.prefetchCount, static_cast<size_t>(1));
+                    m_config.waitTimeSeconds = (std::min)(m_config.waitTimeSeconds, MAX_WAIT_TIME_SECONDS);
+                    m_workersRunning = m_config.workerCount;
+                }
+
+                ~SQSQueueConsumer()
+                {
+                    Stop();
+                    m_receiver.join();
+                    for (auto& worker : m_workers)
+                    {
+                        worker.join();
+                    }
+                    m_maintainer.join();
+                }
+
+                /**
+                 * Starts the threads. Kept out of the constructor so that a handler can't see the queue before it owns the consumer.
+                 */
+                void Start()
+                {
+                    m_receiver = std::thread(&SQSQueueConsumer::Receive, this);
+                    for (size_t i = 0; i < m_config.workerCount; ++i)
+                    {
+                        m_workers.emplace_back(&SQSQueueConsumer::Work, this);
+                    }
+                    m_maintainer = std::thread(&SQSQueueConsumer::Maintain, this);
+                }
+
+                /**
+                 * Stops receiving without waiting for anything, so it can be called from the consumer's own threads.
+                 */
+                void Stop()
+                {
+                    {
+                        std::lock_guard<std::mutex> locker(m_lock);
+                        m_receiving = false;
+                    }
+                    m_spaceAvailable.notify_all();
+                }
+
+                bool IsStopping()
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    return !m_receiving;
+                }
+
+                /**
+                 * The consumer of queue whose thread is calling, if any.
+                 */
+                static SQSQueueConsumer* GetCurrent(const SQSQueue& queue)
+                {
+                    return s_currentConsumer && &s_currentConsumer->m_queue == &queue ? s_currentConsumer : nullptr;
+                }
+
+            private:
+                void Receive()
+                {
+                    s_currentConsumer = this;
+                    const auto visibilityTimeout = std::chrono::seconds(m_queue.m_visibilityTimeout);
+                    for (;;)
+                    {
+                        size_t count = 0;
+                        {
+                            std::unique_lock<std::mutex> locker(m_lock);
+                            m_spaceAvailable.wait(locker, [this] { return !m_receiving || m_buffer.size() < m_config.prefetchCount; });
+                            if (!m_receiving)
+                            {
+                                m_receiverStopped = true;
+                                locker.unlock();
+                                m_messagesAvailable.notify_all();
+                                return;
+                            }
+                            count = (std::min)(MAX_BATCH_SIZE, m_config.prefetchCount - m_buffer.size());
+                        }
+
+                        AWS_LOGSTREAM_TRACE(CLASS_TAG, "Polling for up to " << count << " messages with a wait time of " << m_config.waitTimeSeconds << " seconds.");
+                        ReceiveMessageRequest receiveMessageRequest;
+                        receiveMessageRequest.SetMaxNumberOfMessages(static_cast<int>(count));
+                        receiveMessageRequest.SetQueueUrl(m_queue.m_queueUrl);
+                        receiveMessageRequest.SetVisibilityTimeout(m_queue.m_visibilityTimeout);
+                        receiveMessageRequest.SetWaitTimeSeconds(m_config.waitTimeSeconds);
+
+                        // Taken before the call, so that the visibility timeout is never assumed to last longer than it does.
+                        auto visibleAt = Clock::now() + visibilityTimeout;
+                        ReceiveMessageOutcome receiveMessageOutcome = m_queue.m_client->ReceiveMessage(receiveMessageRequest);
+                        if (!receiveMessageOutcome.IsSuccess())
+                        {
+                            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Receive message failed with error: " << receiveMessageOutcome.GetError().GetExceptionName() <<
+                                                                                                  " and message: " << receiveMessageOutcome.GetError().GetMessage());
+                            std::unique_lock<std::mutex> locker(m_lock);
+                            m_spaceAvailable.wait_for(locker, std::chrono::milliseconds(RECEIVE_RETRY_DELAY_MS), [this] { return !m_receiving; });
+                            continue;
+                        }
+
+                        const auto& messages = receiveMessageOutcome.GetResult().GetMessages();
+                        if (messages.empty())
+                        {
+                            continue;
+                        }
+
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Received " << messages.size() << " messages.");
+                        {
+                            std::lock_guard<std::mutex> locker(m_lock);
+                            for (const auto& message : messages)
+                            {
+                                m_invisibleUntil[message.GetReceiptHandle()] = visibleAt;
+                                m_buffer.push_back(message);
+                            }
+                        }
+                        m_messagesAvailable.notify_all();
+                    }
+                }
+
+                void Work()
+                {
+                    s_currentConsumer = this;
+                    for (;;)
+                    {
+                        Message message;
+                        {
+                            std::unique_lock<std::mutex> locker(m_lock);
+                            m_messagesAvailable.wait(locker, [this] { return !m_buffer.empty() || m_receiverStopped; });
+                            if (m_buffer.empty())
+                            {
+                                // the last worker out lets the maintainer send the remaining deletes and finish.
+                                m_workersStopped = --m_workersRunning == 0;
+                                locker.unlock();
+                                m_maintenanceNeeded.notify_all();
+                                return;
+                            }
+                            message = std::move(m_buffer.front());
+                            m_buffer.pop_front();
+                        }
+                        m_spaceAvailable.notify_one();
+
+                        bool deleteMessage = false;
+                        auto& receivedHandler = m_queue.GetMessageReceivedEventHandler();
+                        if (receivedHandler)
+                        {
+                            receivedHandler(&m_queue, message, deleteMessage);
+                        }
+
+                        bool batchIsFull = false;
+                        {
+                            std::lock_guard<std::mutex> locker(m_lock);
+                            m_invisibleUntil.erase(message.GetReceiptHandle());
+                            if (deleteMessage)
+                            {
+                                if (m_pendingDeletes.empty())
+                                {
+                                    m_firstDeletePendingSince = Clock::now();
+                                }
+                                m_pendingDeletes.push_back(std::move(message));
+                                batchIsFull = m_pendingDeletes.size() >= MAX_BATCH_SIZE;
+                            }
+                        }
+                        if (batchIsFull)
+                        {
+                            m_maintenanceNeeded.notify_one();
+                        }
+                    }
+                }
+
+                void Maintain()
+                {
+                    const auto flushDelay = std::chrono::milliseconds(m_config.deleteFlushDelayMs);
+                    const auto visibilityTimeout = std::chrono::seconds(m_queue.m_visibilityTimeout);
+                    const bool extendVisibilityTimeout = m_config.extendVisibilityTimeout && m_queue.m_visibilityTimeout > 0;
+
+                    s_currentConsumer = this;
+                    std::unique_lock<std::mutex> locker(m_lock);
+                    for (;;)
+                    {
+                        auto now = Clock::now();
+                        if (!m_pendingDeletes.empty() &&
+                            (m_workersStopped || m_pendingDeletes.size() >= MAX_BATCH_SIZE || now - m_firstDeletePendingSince >= flushDelay))
+                        {
+                            size_t count = (std::min)(MAX_BATCH_SIZE, m_pendingDeletes.size());
+                            Aws::Vector<Message> batch(std::make_move_iterator(m_pendingDeletes.begin()), std::make_move_iterator(m_pendingDeletes.begin() + count));
+                            m_pendingDeletes.erase(m_pendingDeletes.begin(), m_pendingDeletes.begin() + count);
+                            m_firstDeletePendingSince = now;
+
+                            locker.unlock();
+                            DeleteMessages(batch);
+                            locker.lock();
+                            continue;
+                        }
+
+                        if (m_workersStopped)
+                        {
+                            return;
+                        }
+
+                        if (extendVisibilityTimeout)
+                        {
+                            Aws::Vector<Aws::String> receiptHandles;
+                            auto extendBefore = now + std::chrono::duration_cast<Clock::duration>(visibilityTimeout) / 2;
+                            for (auto& message : m_invisibleUntil)
+                            {
+                                if (message.second <= extendBefore)
+                                {
+                                    message.second = now + visibilityTimeout;
+                                    receiptHandles.push_back(message.first);
+                                    if (receiptHandles.size() == MAX_BATCH_SIZE)
+                                    {
+                                        break;
+                                    }
+                                }
+                            }
+
+                            if (!receiptHandles.empty())
+                            {
+                                locker.unlock();
+                                ExtendVisibilityTimeout(receiptHandles);
+                                locker.lock();
+                                continue;
+                            }
+                        }
+
+                        auto wait = std::chrono::milliseconds(MAINTENANCE_INTERVAL_MS);
+                        if (!m_pendingDeletes.empty())
+                        {
+                            wait = (std::min)(wait, std::chrono::duration_cast<std::chrono::milliseconds>(m_firstDeletePendingSince + flushDelay - now));
+                        }
+                        m_maintenanceNeeded.wait_for(locker, wait);
+                    }
+                }
+
+                void DeleteMessages(const Aws::Vector<Message>& messages)
+                {
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Deleting " << messages.size() << " messages from queue " << m_queue.m_queueUrl);
+                    DeleteMessageBatchRequest deleteMessageBatchRequest;
+                    deleteMessageBatchRequest.SetQueueUrl(m_queue.m_queueUrl);
+                    for (size_t i = 0; i < messages.size(); ++i)
+                    {
+                        DeleteMessageBatchRequestEntry entry;
+                        entry.SetId(Aws::Utils::StringUtils::to_string(i));
+                        entry.SetReceiptHandle(messages[i].GetReceiptHandle());
+                        deleteMessageBatchRequest.AddEntries(std::move(entry));
+                    }
+
+                    DeleteMessageBatchOutcome deleteMessageBatchOutcome = m_queue.m_client->DeleteMessageBatch(deleteMessageBatchRequest);
+                    auto& deleteSuccess = m_queue.GetMessageDeleteSuccessEventHandler();
+                    auto& deleteFailed = m_queue.GetMessageDeleteFailedEventHandler();
+                    if (!deleteMessageBatchOutcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Delete message batch failed with error: " << deleteMessageBatchOutcome.GetError().GetExceptionName() <<
+                                                     " and message: " << deleteMessageBatchOutcome.GetError().GetMessage());
+                        if (deleteFailed)
+                        {
+                            for (const auto& message : messages)
+                            {
+                                deleteFailed(&m_queue, message);
+                            }
+                        }
+                        return;
+                    }
+
+                    for (const auto& entry : deleteMessageBatchOutcome.GetResult().GetSuccessful())
+                    {
+                        size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(entry.GetId().c_str()));
+                        if (deleteSuccess && index < messages.size())
+                        {
+                            deleteSuccess(&m_queue, messages[index]);
+                        }
+                    }
+
+                    for (const auto& entry : deleteMessageBatchOutcome.GetResult().GetFailed())
+                    {
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Delete message failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage());
+                        size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(entry.GetId().c_str()));
+                        if (deleteFailed && index < messages.size())
+                        {
+                            deleteFailed(&m_queue, messages[index]);
+                        }
+                    }
+                }
+
+                void ExtendVisibilityTimeout(const Aws::Vector<Aws::String>& receiptHandles)
+                {
+                    AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Extending the visibility timeout of " << receiptHandles.size() << " messages.");
+                    ChangeMessageVisibilityBatchRequest changeMessageVisibilityBatchRequest;
+                    changeMessageVisibilityBatchRequest.SetQueueUrl(m_queue.m_queueUrl);
+                    for (size_t i = 0; i < receiptHandles.size(); ++i)
+                    {
+                        ChangeMessageVisibilityBatchRequestEntry entry;
+                        entry.SetId(Aws::Utils::StringUtils::to_string(i));
+                        entry.SetReceiptHandle(receiptHandles[i]);
+                        entry.SetVisibilityTimeout(static_cast<int>(m_queue.m_visibilityTimeout));
+                        changeMessageVisibilityBatchRequest.AddEntries(std::move(entry));
+                    }
+
+                    // Failures only mean that another consumer may receive the message too, so they are logged and not retried.
+                    ChangeMessageVisibilityBatchOutcome changeMessageVisibilityBatchOutcome =
+                        m_queue.m_client->ChangeMessageVisibilityBatch(changeMessageVisibilityBatchRequest);
+                    if (!changeMessageVisibilityBatchOutcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Change message visibility batch failed with error: " << changeMessageVisibilityBatchOutcome.GetError().GetExceptionName() <<
+                                                    " and message: " << changeMessageVisibilityBatchOutcome.GetError().GetMessage());
+                        return;
+                    }
+
+                    for (const auto& entry : changeMessageVisibilityBatchOutcome.GetResult().GetFailed())
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Change message visibility failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage());
+                    }
+                }
+
+                SQSQueue& m_queue;
+                SQSQueueConsumerConfiguration m_config;
+
+                std::mutex m_lock;
+                std::condition_variable m_spaceAvailable;
+                std::condition_variable m_messagesAvailable;
+                std::condition_variable m_maintenanceNeeded;
+                bool m_receiving;
+                bool m_receiverStopped;
+                size_t m_workersRunning;
+                bool m_workersStopped;
+
+                Aws::Deque<Message> m_buffer;
+                Aws::Map<Aws::String, Clock::time_point> m_invisibleUntil;
+                Aws::Vector<Message> m_pendingDeletes;
+                Clock::time_point m_firstDeletePendingSince;
+
+                std::thread m_receiver;
+                Aws::Vector<std::thread> m_workers;
+                std::thread m_maintainer;
+            };
+
+            /**
+             * Queues the messages pushed while SQSQueue::StartBatchingPushes() is in effect, and sends them in SendMessageBatch
+             * calls from its own thread. Failed entries wait out a backoff that doubles with each attempt, then go back to the
+             * front of the queue.
+             */
+            class SQSQueueProducer
+            {
+                typedef std::chrono::steady_clock Clock;
+
+                struct PendingMessage
+                {
+                    Message message;
+                    size_t payloadBytes;
+                    unsigned attempts;
+                    Clock::time_point queuedAt;
+                };
+
+                typedef Aws::Vector<PendingMessage> Batch;
+
+            public:
+                SQSQueueProducer(SQSQueue& queue, const SQSQueueProducerConfiguration& config) :
+                    m_queue(queue), m_config(config), m_pendingBytes(0), m_batchesInFlight(0), m_stopping(false)
+                {
+                    m_config.maxAttempts = (std::max)(m_config.maxAttempts, 1u);
+                    m_sender = std::thread(&SQSQueueProducer::Send, this);
+                }
+
+                ~SQSQueueProducer()
+                {
+                    {
+                        std::lock_guard<std::mutex> locker(m_lock);
+                        m_stopping = true;
+                    }
+                    m_signal.notify_all();
+                    m_sender.join();
+                }
+
+                void Push(const Message& message)
+                {
+                    PendingMessage pending;
+                    pending.message = message;
+                    pending.payloadBytes = PayloadSize(message);
+                    pending.attempts = 0;
+                    pending.queuedAt = Clock::now();
+
+                    bool batchIsFull = false;
+                    {
+                        std::lock_guard<std::mutex> locker(m_lock);
+                        m_pendingBytes += pending.payloadBytes;
+                        m_pending.push_back(std::move(pending));
+                        batchIsFull = m_pending.size() >= MAX_BATCH_SIZE || m_pendingBytes >= MAX_BATCH_PAYLOAD_BYTES;
+                    }
+                    if (batchIsFull)
+                    {
+                        m_signal.notify_all();
+                    }
+                }
+
+            private:
+                /**
+                 * What SQS counts against the batch payload limit: the body and each attribute's name, type and value.
+                 */
+                static size_t PayloadSize(const Message& message)
+                {
+                    size_t size = message.GetBody().size();
+                    for (const auto& attribute : message.GetMessageAttributes())
+                    {
+                        size += attribute.first.size() + attribute.second.GetDataType().size() +
+                            attribute.second.GetStringValue().size() + attribute.second.GetBinaryValue().GetLength();
+                    }
+                    return size;
+                }
+
+                void Send()
+                {
+                    const auto linger = std::chrono::milliseconds(m_config.lingerMs);
+
+                    std::unique_lock<std::mutex> locker(m_lock);
+                    for (;;)
+                    {
+                        // retries whose backoff has ended go ahead of the messages pushed since, oldest first.
+                        auto now = Clock::now();
+                        size_t readyRetries = 0;
+                        while (!m_retrying.empty() && m_retrying.begin()->first <= now)
+                        {
+                            m_pendingBytes += m_retrying.begin()->second.payloadBytes;
+                            m_pending.insert(m_pending.begin() + readyRetries++, std::move(m_retrying.begin()->second));
+                            m_retrying.erase(m_retrying.begin());
+                        }
+
+                        if (!m_pending.empty() && (m_stopping || m_pending.size() >= MAX_BATCH_SIZE ||
+                            m_pendingBytes >= MAX_BATCH_PAYLOAD_BYTES || now - m_pending.front().queuedAt >= linger))
+                        {
+                            auto batch = Aws::MakeShared<Batch>(CLASS_TAG);
+                            size_t batchBytes = 0;
+                            while (!m_pending.empty() && batch->size() < MAX_BATCH_SIZE &&
+                                (batch->empty() || batchBytes + m_pending.front().payloadBytes <= MAX_BATCH_PAYLOAD_BYTES))
+                            {
+                                batchBytes += m_pending.front().payloadBytes;
+                                batch->push_back(std::move(m_pending.front()));
+                                m_pending.pop_front();
+                            }
+                            m_pendingBytes -= batchBytes;
+                            ++m_batchesInFlight;
+
+                            locker.unlock();
+                            SendBatch(batch);
+                            locker.lock();
+                            continue;
+                        }
+
+                        if (m_stopping && m_pending.empty() && m_retrying.empty() && m_batchesInFlight == 0)
+                        {
+                            return;
+                        }
+
+                        if (m_pending.empty() && m_retrying.empty())
+                        {
+                            m_signal.wait(locker);
+                            continue;
+                        }
+
+                        // whichever comes first: the oldest pending message lingering long enough, or the next backoff ending.
+                        auto deadline = m_pending.empty() ? m_retrying.begin()->first : m_pending.front().queuedAt + linger;
+                        if (!m_retrying.empty())
+                        {
+                            deadline = (std::min)(deadline, m_retrying.begin()->first);
+                        }
+                        m_signal.wait_until(locker, deadline);
+                    }
+                }
+
+                Clock::duration RetryDelay(unsigned attempts) const
+                {
+                    unsigned doublings = (std::min)(attempts > 0 ? attempts - 1 : 0, MAX_RETRY_DELAY_DOUBLINGS);
+                    return std::chrono::milliseconds(m_config.retryDelayMs) * (1u << doublings);
+                }
+
+                void SendBatch(const std::shared_ptr<Batch>& batch)
+                {
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending " << batch->size() << " messages to " << m_queue.m_queueUrl);
+                    SendMessageBatchRequest sendMessageBatchRequest;
+                    sendMessageBatchRequest.SetQueueUrl(m_queue.m_queueUrl);
+                    for (size_t i = 0; i < batch->size(); ++i)
+                    {
+                        PendingMessage& pending = (*batch)[i];
+                        ++pending.attempts;
+
+                        SendMessageBatchRequestEntry entry;
+                        entry.SetId(Aws::Utils::StringUtils::to_string(i));
+                        entry.SetMessageBody(pending.message.GetBody());
+                        entry.SetMessageAttributes(pending.message.GetMessageAttributes());
+                        sendMessageBatchRequest.AddEntries(std::move(entry));
+                    }
+
+                    m_queue.m_client->SendMessageBatchAsync(sendMessageBatchRequest,
+                        [this, batch](const SQSClient*, const SendMessageBatchRequest&, const SendMessageBatchOutcome& sendMessageBatchOutcome,
+                                      const std::shared_ptr<const AsyncCallerContext>&)
+                        {
+                            OnBatchSent(*batch, sendMessageBatchOutcome);
+                        });
+                }
+
+                void OnBatchSent(Batch& batch, const SendMessageBatchOutcome& sendMessageBatchOutcome)
+                {
+                    auto& sendSuccess = m_queue.GetMessageSendSuccessEventHandler();
+                    auto& sendFailed = m_queue.GetMessageSendFailedEventHandler();
+                    Batch retries;
+
+                    if (!sendMessageBatchOutcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Send message batch failed with error: " << sendMessageBatchOutcome.GetError().GetExceptionName() <<
+                                                     " and message: " << sendMessageBatchOutcome.GetError().GetMessage());
+                        if (sendFailed)
+                        {
+                            for (const auto& pending : batch)
+                            {
+                                sendFailed(&m_queue, pending.message);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (const auto& entry : sendMessageBatchOutcome.GetResult().GetSuccessful())
+                        {
+                            size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(entry.GetId().c_str()));
+                            if (sendSuccess && index < batch.size())
+                            {
+                                sendSuccess(&m_queue, batch[index].message);
+                            }
+                        }
+
+                        for (const auto& entry : sendMessageBatchOutcome.GetResult().GetFailed())
+                        {
+                            size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(entry.GetId().c_str()));
+                            if (index >= batch.size())
+                            {
+                                continue;
+                            }
+
+                            if (!entry.GetSenderFault() && batch[index].attempts < m_config.maxAttempts)
+                            {
+                                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Send message failed with error: " << entry.GetCode() << ", retrying.");
+                                retries.push_back(std::move(batch[index]));
+                                continue;
+                            }
+
+                            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Send message failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage());
+                            if (sendFailed)
+                            {
+                                sendFailed(&m_queue, batch[index].message);
+                            }
+                        }
+                    }
+
+                    // Notified under the lock: once the last batch is done the destructor may complete as soon as it is released.
+                    auto now = Clock::now();
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    for (auto& retry : retries)
+                    {
+                        auto retryAt = now + RetryDelay(retry.attempts);
+                        m_retrying.emplace(retryAt, std::move(retry));
+                    }
+                    --m_batchesInFlight;
+                    m_signal.notify_all();
+                }
+
+                SQSQueue& m_queue;
+                SQSQueueProducerConfiguration m_config;
+
+                std::mutex m_lock;
+                std::condition_variable m_signal;
+                Aws::Deque<PendingMessage> m_pending;
+                // failed messages by the time their backoff ends, not counted in m_pendingBytes until they are pending again.
+                Aws::MultiMap<Clock::time_point, PendingMessage> m_retrying;
+                size_t m_pendingBytes;
+                size_t m_batchesInFlight;
+                bool m_stopping;
+
+                std::thread m_sender;
+            };
+        }
+    }
+}
+
 SQSQueue::SQSQueue(const std::shared_ptr<SQSClient>& client, const char* queueName, unsigned visibilityTimeout,
                    unsigned pollingFrequencyMs) :
    Queue(pollingFrequencyMs),
@@ -54,6 +673,60 @@ SQSQueue::SQSQueue(const std::shared_ptr<SQSClient>& client, const char* queueNa
 {
 }
 
+SQSQueue::~SQSQueue()
+{
+    StopConsuming();
+    StopBatchingPushes();
+}
+
+void SQSQueue::StartConsuming(const SQSQueueConsumerConfiguration& config)
+{
+    if (!IsInitialized())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Queue is not initialized, not consuming. Call EnsureQueueIsInitialized before calling this method.");
+        return;
+    }
+
+    if (m_consumer && m_consumer->IsStopping())
+    {
+        StopConsuming();
+    }
+
+    if (!m_consumer)
+    {
+        AWS_LOGSTREAM_INFO(CLASS_TAG, "Consuming " << m_queueUrl << " with " << config.workerCount << " workers.");
+        m_consumer = Aws::MakeUnique<SQSQueueConsumer>(CLASS_TAG, *this, config);
+        m_consumer->Start();
+    }
+}
+
+void SQSQueue::StopConsuming()
+{
+    // A handler can't wait for its own thread to finish, so the consumer is only told to stop, and joined later.
+    auto currentConsumer = SQSQueueConsumer::GetCurrent(*this);
+    if (currentConsumer)
+    {
+        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "StopConsuming called from a consumer thread, stopping without waiting.");
+        currentConsumer->Stop();
+        return;
+    }
+
+    m_consumer = nullptr;
+}
+
+void SQSQueue::StartBatchingPushes(const SQSQueueProducerConfiguration& config)
+{
+    if (!m_producer)
+    {
+        m_producer = Aws::MakeUnique<SQSQueueProducer>(CLASS_TAG, *this, config);
+    }
+}
+
+void SQSQueue::StopBatchingPushes()
+{
+    m_producer = nullptr;
+}
+
 Message SQSQueue::Top() const
 {
     if(IsInitialized())
@@ -113,6 +786,12 @@ void SQSQueue::Push(const Message& message)
 {
    if(IsInitialized())
    {
+       if (m_producer)
+       {
+           m_producer->Push(message);
+           return;
+       }
+
        AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending message to " << m_queueUrl);
        SendMessageRequest sendMessageRequest;
        sendMessageRequest.SetQueueUrl(m_queueUrl);
@@ -123,15 +123,29 @@ ExecuteSqlOutcome RDSDataServiceClient::ExecuteSql(const ExecuteSqlRequest& requ
 
 ExecuteSqlOutcomeCallable RDSDataServiceClient::ExecuteSqlCallable(const ExecuteSqlRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ExecuteSqlOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ExecuteSql(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  auto promise = Aws::MakeShared< std::promise< ExecuteSqlOutcome > >(ALLOCATION_TAG);
+  ExecuteSqlAsync(request, [promise](const RDSDataServiceClient*, const ExecuteSqlRequest&, const ExecuteSqlOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { promise->set_value(outcome); });
+  return promise->get_future();
 }
 
 void RDSDataServiceClient::ExecuteSqlAsync(const ExecuteSqlRequest& request, const ExecuteSqlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ExecuteSqlAsyncHelper( request, handler, context ); } );
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/ExecuteSql";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ExecuteSqlRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(uri, sharedRequest, [this, sharedRequest, handler, context](const JsonOutcome& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ExecuteSqlOutcome(ExecuteSqlResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ExecuteSqlOutcome(outcome.GetError()), context);
+    }
+  }, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
 }
 
 void RDSDataServiceClient::ExecuteSqlAsyncHelper(const ExecuteSqlRequest& request, const ExecuteSqlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
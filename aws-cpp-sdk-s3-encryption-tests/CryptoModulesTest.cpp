@@ -26,6 +26,7 @@
 #include <aws/core/utils/crypto/CryptoStream.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/Array.h>
+#include <aws/core/utils/threading/Executor.h>
 
 #include <aws/s3-encryption/modules/CryptoModule.h>
 #include <aws/s3-encryption/modules/CryptoModuleFactory.h>
@@ -39,11 +40,17 @@
 #include <aws/s3/model/CreateBucketRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 
 #include <aws/kms/KMSClient.h>
 #include <aws/kms/model/EncryptRequest.h>
 #include <aws/kms/model/DecryptRequest.h>
 
+#include <mutex>
+
 namespace
 {
     static const char* const ALLOCATION_TAG = "CryptoModuleTests";
@@ -52,6 +59,9 @@ namespace
     static const char* const BODY_STREAM_TEST = "This is a test message for encryption and decryption.";
     static const char* const TEST_CMK_ID = "ARN:SOME_COMBINATION_OF_LETTERS_AND_NUMBERS";
     static size_t const CBC_IV_SIZE_BYTES = 16u;
+    static const char* const UPLOAD_ID_TEST = "testUploadId";
+    static size_t const MULTIPART_PART_SIZE = 5 * 1024 * 1024;
+    static size_t const MULTIPART_BODY_SIZE = 2 * MULTIPART_PART_SIZE + 1234;
 
 #ifndef ENABLE_COMMONCRYPTO_ENCRYPTION
 #if !defined(NDEBUG) && defined(GTEST_HAS_DEATH_TEST)
@@ -136,7 +146,7 @@ namespace
     * populated into a get object result when a get operation is called. If a get request has a range specifying the
     * last 16 bytes of data, we know this is the crypto tag stored at the end of the body for GCM encryption, and we
     * return this. If the range is everything but the last 16 bytes then we only return that part of the body to the
-    * result.
+    * result. A multipart upload keeps its parts until it is completed, then stores them joined in order like a put.
     */
     class MockS3Client : public Aws::S3::S3Client
     {
@@ -151,7 +161,7 @@ namespace
             m_putObjectCalled++;
             if (request.GetKey().find(Aws::S3Encryption::Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX) != Aws::String::npos)
             {
-
+                m_partsWhenInstructionFilePut = m_parts.size();
                 Aws::S3::Model::PutObjectOutcome outcome;
                 Aws::S3::Model::PutObjectResult result(outcome.GetResultWithOwnership());
                 return result;
@@ -168,8 +178,68 @@ namespace
             return result;
         }
 
+        Aws::S3::Model::CreateMultipartUploadOutcome CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request) const override
+        {
+            m_metadata = request.GetMetadata();
+            m_parts.clear();
+            Aws::S3::Model::CreateMultipartUploadResult result;
+            result.SetUploadId(UPLOAD_ID_TEST);
+            return result;
+        }
+
+        Aws::S3::Model::UploadPartOutcome UploadPart(const Aws::S3::Model::UploadPartRequest& request) const override
+        {
+            std::shared_ptr<Aws::IOStream> body = request.GetBody();
+            Aws::String partString((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_uploadPartCalled++;
+            if (m_failUploadPart)
+            {
+                return Aws::S3::Model::UploadPartOutcome(Aws::Client::AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::INTERNAL_FAILURE, false));
+            }
+            m_parts[request.GetPartNumber()] = partString;
+            Aws::S3::Model::UploadPartResult result;
+            result.SetETag(Aws::Utils::StringUtils::to_string(request.GetPartNumber()));
+            return result;
+        }
+
+        // UploadPartCallable sends the request itself instead of calling UploadPart, so route it to the mocked one.
+        void UploadPartAsync(const Aws::S3::Model::UploadPartRequest& request, const Aws::S3::UploadPartResponseReceivedHandler& handler,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            m_uploadExecutor->Submit([this, request, handler, context]() { handler(this, request, UploadPart(request), context); });
+        }
+
+        Aws::S3::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const override
+        {
+            if (m_failComplete)
+            {
+                return Aws::S3::Model::CompleteMultipartUploadOutcome(Aws::Client::AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::INTERNAL_FAILURE, false));
+            }
+            bodyString.clear();
+            for (const auto& part : request.GetMultipartUpload().GetParts())
+            {
+                bodyString += m_parts[part.GetPartNumber()];
+            }
+            m_requestContentLength = bodyString.size();
+            return Aws::S3::Model::CompleteMultipartUploadResult();
+        }
+
+        Aws::S3::Model::AbortMultipartUploadOutcome AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest&) const override
+        {
+            m_abortCalled++;
+            return Aws::S3::Model::AbortMultipartUploadResult();
+        }
+
+        Aws::S3::Model::DeleteObjectOutcome DeleteObject(const Aws::S3::Model::DeleteObjectRequest& request) const override
+        {
+            m_deletedKeys.push_back(request.GetKey());
+            return Aws::S3::Model::DeleteObjectResult();
+        }
+
         Aws::S3::Model::GetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request) const override
         {
+            std::lock_guard<std::mutex> locker(m_mutex);
             m_getObjectCalled++;
             auto factory = request.GetResponseStreamFactory();
             Aws::Utils::Stream::ResponseStream responseStream(factory);
@@ -223,6 +293,15 @@ namespace
         mutable std::shared_ptr<Aws::IOStream> m_body;
         mutable std::shared_ptr<Aws::IOStream> m_instructionBody;
         mutable size_t m_requestContentLength;
+        mutable size_t m_uploadPartCalled = 0;
+        mutable Aws::Map<int, Aws::String> m_parts;
+        mutable size_t m_partsWhenInstructionFilePut = 0;
+        mutable size_t m_abortCalled = 0;
+        mutable Aws::Vector<Aws::String> m_deletedKeys;
+        bool m_failUploadPart = false;
+        bool m_failComplete = false;
+        mutable std::mutex m_mutex;
+        std::shared_ptr<Aws::Utils::Threading::PooledThreadExecutor> m_uploadExecutor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 2);
     };
 
     class CryptoModulesTest : public ::testing::Test
@@ -834,6 +913,176 @@ namespace
 #endif // !defined(NDEBUG) && defined(GTEST_HAS_DEATH_TEST)
 #endif
 
+    TEST_F(CryptoModulesTest, EncryptionOnlyMultipartOperationsTest)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::ENCRYPTION_ONLY);
+
+        MockS3Client s3Client;
+
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        Aws::String body(MULTIPART_BODY_SIZE, 'x');
+        for (size_t i = 0; i < body.size(); ++i)
+        {
+            body[i] = static_cast<char>('a' + i % 26);
+        }
+
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        putRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, body));
+        auto putOutcome = module->PutObjectSecurelyInParts(putRequest, s3Client, MULTIPART_PART_SIZE, 2);
+        ASSERT_TRUE(putOutcome.IsSuccess());
+        MetadataFilled(s3Client.GetMetadata());
+        ASSERT_EQ(3u, s3Client.m_uploadPartCalled);
+        //CBC pads the last part out to a whole block.
+        ASSERT_EQ(body.size() + 16 - body.size() % 16, s3Client.GetRequestContentLength());
+        ASSERT_EQ(0u, s3Client.m_putObjectCalled);
+
+        HeadObjectOutcome headOutcome = s3Client.HeadObject(HeadObjectRequest().WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME));
+        Aws::S3Encryption::Handlers::MetadataHandler handler;
+        ContentCryptoMaterial contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+
+        GetObjectRequest getRequest;
+        getRequest.SetBucket(BUCKET_TEST_NAME);
+        getRequest.SetKey(KEY_TEST_NAME);
+        auto decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        auto getOutcome = decryptionModule->GetObjectSecurelyInParts(getRequest, headOutcome.GetResult(), contentCryptoMaterial, s3Client, 1024 * 1024, 4);
+        ASSERT_TRUE(getOutcome.IsSuccess());
+        Aws::OStringStream ss;
+        ss << getOutcome.GetResult().GetBody().rdbuf();
+        ASSERT_TRUE(body == ss.str());
+        ASSERT_EQ(static_cast<long long>(body.size()), getOutcome.GetResult().GetContentLength());
+        ASSERT_EQ(s3Client.GetMetadata(), getOutcome.GetResult().GetMetadata());
+        ASSERT_EQ(11u, s3Client.m_getObjectCalled);
+    }
+
+#ifndef ENABLE_COMMONCRYPTO_ENCRYPTION
+    TEST_F(CryptoModulesTest, AuthenticatedEncryptionMultipartOperationsTest)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::AUTHENTICATED_ENCRYPTION);
+
+        MockS3Client s3Client;
+
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        Aws::String body(MULTIPART_BODY_SIZE, 'x');
+        for (size_t i = 0; i < body.size(); ++i)
+        {
+            body[i] = static_cast<char>('a' + i % 26);
+        }
+
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        putRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, body));
+        auto putOutcome = module->PutObjectSecurelyInParts(putRequest, s3Client, MULTIPART_PART_SIZE, 2);
+        ASSERT_TRUE(putOutcome.IsSuccess());
+        MetadataFilled(s3Client.GetMetadata());
+        ASSERT_EQ(3u, s3Client.m_uploadPartCalled);
+        ASSERT_EQ(body.size() + GCM_TAG_LENGTH / 8, s3Client.GetRequestContentLength());
+
+        HeadObjectOutcome headOutcome = s3Client.HeadObject(HeadObjectRequest().WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME));
+        Aws::S3Encryption::Handlers::MetadataHandler handler;
+        ContentCryptoMaterial contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+
+        GetObjectRequest getRequest;
+        getRequest.SetBucket(BUCKET_TEST_NAME);
+        getRequest.SetKey(KEY_TEST_NAME);
+        auto decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        auto getOutcome = decryptionModule->GetObjectSecurelyInParts(getRequest, headOutcome.GetResult(), contentCryptoMaterial, s3Client, 1024 * 1024, 4);
+        ASSERT_TRUE(getOutcome.IsSuccess());
+        Aws::OStringStream ss;
+        ss << getOutcome.GetResult().GetBody().rdbuf();
+        ASSERT_TRUE(body == ss.str());
+
+        //a changed byte in the middle of the body has to fail the tag check once the last part is decrypted.
+        s3Client.bodyString[body.size() / 2] ^= 1;
+        decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        getOutcome = decryptionModule->GetObjectSecurelyInParts(getRequest, headOutcome.GetResult(), contentCryptoMaterial, s3Client, 1024 * 1024, 4);
+        ASSERT_FALSE(getOutcome.IsSuccess());
+        ASSERT_EQ(CryptoErrors::DECRYPT_CONTENT_FAILED, getOutcome.GetError().GetErrorType().cryptoError);
+    }
+#endif
+
+    TEST_F(CryptoModulesTest, InstructionFileMultipartOperationsTest)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::INSTRUCTION_FILE, CryptoMode::ENCRYPTION_ONLY);
+        CryptoModuleFactory factory;
+        Aws::String body(MULTIPART_BODY_SIZE, 'x');
+
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+
+        //the instruction file is only put once every part was uploaded.
+        MockS3Client s3Client;
+        putRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, body));
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        auto putOutcome = module->PutObjectSecurelyInParts(putRequest, s3Client, MULTIPART_PART_SIZE, 2);
+        ASSERT_TRUE(putOutcome.IsSuccess());
+        ASSERT_EQ(1u, s3Client.m_putObjectCalled);
+        ASSERT_EQ(3u, s3Client.m_partsWhenInstructionFilePut);
+        ASSERT_EQ(0u, s3Client.m_abortCalled);
+
+        //an upload failing part way leaves no instruction file behind.
+        MockS3Client failingPartClient;
+        failingPartClient.m_failUploadPart = true;
+        putRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, body));
+        module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        putOutcome = module->PutObjectSecurelyInParts(putRequest, failingPartClient, MULTIPART_PART_SIZE, 2);
+        ASSERT_FALSE(putOutcome.IsSuccess());
+        ASSERT_EQ(0u, failingPartClient.m_putObjectCalled);
+        ASSERT_EQ(1u, failingPartClient.m_abortCalled);
+
+        //neither does one whose completion fails, the instruction file already put is deleted again.
+        MockS3Client failingCompleteClient;
+        failingCompleteClient.m_failComplete = true;
+        putRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, body));
+        module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        putOutcome = module->PutObjectSecurelyInParts(putRequest, failingCompleteClient, MULTIPART_PART_SIZE, 2);
+        ASSERT_FALSE(putOutcome.IsSuccess());
+        ASSERT_EQ(1u, failingCompleteClient.m_putObjectCalled);
+        ASSERT_EQ(1u, failingCompleteClient.m_abortCalled);
+        ASSERT_EQ(1u, failingCompleteClient.m_deletedKeys.size());
+        ASSERT_STREQ((Aws::String(KEY_TEST_NAME) + Aws::S3Encryption::Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX).c_str(), failingCompleteClient.m_deletedKeys[0].c_str());
+    }
+
+    TEST_F(CryptoModulesTest, RangedGetInPartsFails)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::ENCRYPTION_ONLY);
+        MockS3Client s3Client;
+
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        putRequest.SetBody(Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, Aws::String(MULTIPART_BODY_SIZE, 'x')));
+        ASSERT_TRUE(module->PutObjectSecurelyInParts(putRequest, s3Client, MULTIPART_PART_SIZE, 2).IsSuccess());
+
+        HeadObjectOutcome headOutcome = s3Client.HeadObject(HeadObjectRequest().WithBucket(BUCKET_TEST_NAME).WithKey(KEY_TEST_NAME));
+        Aws::S3Encryption::Handlers::MetadataHandler handler;
+        ContentCryptoMaterial contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+
+        GetObjectRequest getRequest;
+        getRequest.SetBucket(BUCKET_TEST_NAME);
+        getRequest.SetKey(KEY_TEST_NAME);
+        getRequest.SetRange("bytes=0-99");
+        auto decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        auto getOutcome = decryptionModule->GetObjectSecurelyInParts(getRequest, headOutcome.GetResult(), contentCryptoMaterial, s3Client, 1024 * 1024, 4);
+        ASSERT_FALSE(getOutcome.IsSuccess());
+        ASSERT_TRUE(getOutcome.GetError().GetErrorType().IsS3Error());
+        ASSERT_EQ(Aws::S3::S3Errors::INVALID_PARAMETER_COMBINATION, getOutcome.GetError().GetErrorType().s3Error);
+        ASSERT_EQ(0u, s3Client.m_getObjectCalled);
+    }
+
     TEST_F(CryptoModulesTest, RangeParserSuccess)
     {
         SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
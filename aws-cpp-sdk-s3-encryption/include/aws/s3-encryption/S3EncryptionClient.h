@@ -56,6 +56,7 @@ namespace Aws
 
         typedef Aws::Utils::Outcome<Aws::S3::Model::PutObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionPutObjectOutcome;
         typedef Aws::Utils::Outcome<Aws::S3::Model::GetObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionGetObjectOutcome;
+        typedef Aws::Utils::Outcome<Aws::S3::Model::CompleteMultipartUploadResult, AWSError<S3EncryptionErrors>> S3EncryptionMultipartUploadOutcome;
 
         class AWS_S3ENCRYPTION_API S3EncryptionClient
         {
@@ -94,9 +95,31 @@ namespace Aws
             */
             S3EncryptionGetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request) const;
 
-            inline bool MultipartUploadSupported() const { return false; }
+            /*
+            * Function to put an object encrypted to S3 with a multipart upload. The body is encrypted in order as a single cipher stream, so the object
+            * decrypts like one put with PutObject, while up to maxConcurrentParts parts of partSize bytes are uploaded at a time.
+            */
+            S3EncryptionMultipartUploadOutcome PutObjectInParts(const Aws::S3::Model::PutObjectRequest& request, size_t partSize = DEFAULT_PART_SIZE,
+                size_t maxConcurrentParts = DEFAULT_CONCURRENT_PARTS) const;
+
+            /*
+            * Function to get an object decrypted from S3 with ranged gets of partSize bytes, up to maxConcurrentParts at a time. Parts are decrypted in order
+            * as they arrive, so the tag of authenticated encryption objects is still checked. Requests for a range are served by GetObject.
+            */
+            S3EncryptionGetObjectOutcome GetObjectInParts(const Aws::S3::Model::GetObjectRequest& request, size_t partSize = DEFAULT_PART_SIZE,
+                size_t maxConcurrentParts = DEFAULT_CONCURRENT_PARTS) const;
+
+            inline bool MultipartUploadSupported() const { return true; }
+
+            static const size_t DEFAULT_PART_SIZE = 8 * 1024 * 1024;
+            static const size_t DEFAULT_CONCURRENT_PARTS = 8;
 
         private:
+            /*
+            * Function to read the crypto material of an object and get it decrypted, in parts of partSize bytes unless partSize is 0.
+            */
+            S3EncryptionGetObjectOutcome GetObjectDecrypted(const Aws::S3::Model::GetObjectRequest& request, size_t partSize, size_t maxConcurrentParts) const;
+
             /*
             * Function to get the instruction file object of a encrypted object from S3. This instruction file object will be used to assist decryption.
             */
@@ -70,7 +70,32 @@ namespace Aws
                 */
                 static std::pair<int64_t, int64_t> ParseGetObjectRequestRange(const Aws::String& range, int64_t contentLength);
 
+                /*
+                * Function to put an encrypted object to S3 with a multipart upload. The body is read and encrypted in order, partSize bytes at a time
+                * (rounded up to whole cipher blocks), and up to maxConcurrentParts parts are uploaded at a time on the client's executor.
+                */
+                S3EncryptionMultipartUploadOutcome PutObjectSecurelyInParts(const Aws::S3::Model::PutObjectRequest& request, const Aws::S3::S3Client& s3Client,
+                    size_t partSize, size_t maxConcurrentParts);
+
+                /*
+                * Function to get an encrypted object from S3 with ranged gets of partSize bytes, up to maxConcurrentParts at a time. Each part is decrypted
+                * once the parts before it have been, so the GCM tag is checked over the whole body. A request with a range fails with INVALID_PARAMETER_COMBINATION.
+                */
+                S3EncryptionGetObjectOutcome GetObjectSecurelyInParts(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headObjectResult,
+                    const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial, const Aws::S3::S3Client& s3Client, size_t partSize, size_t maxConcurrentParts);
+
             private:
+                /*
+                * This function generates the content encryption key and initializes the cipher, then stores the encrypted key in the request metadata
+                * unless it goes to an instruction file.
+                */
+                S3EncryptionPutObjectOutcome InitEncryption(Aws::S3::Model::PutObjectRequest& request);
+
+                /*
+                * This function puts the instruction file holding the encrypted key of the request's object, if the key is stored in one.
+                */
+                S3EncryptionPutObjectOutcome PutInstructionFile(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction);
+
                 /*
                 * This function is used to encrypt the given S3 PutObjectRequest.
                 */
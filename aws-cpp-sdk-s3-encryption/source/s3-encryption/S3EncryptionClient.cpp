@@ -52,7 +52,23 @@ namespace Aws
             return module->PutObjectSecurely(request, putObjectFunction);
         }
 
+        S3EncryptionMultipartUploadOutcome S3EncryptionClient::PutObjectInParts(const Aws::S3::Model::PutObjectRequest& request, size_t partSize, size_t maxConcurrentParts) const
+        {
+            auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, m_cryptoConfig);
+            return module->PutObjectSecurelyInParts(request, *m_s3Client, partSize, maxConcurrentParts);
+        }
+
         S3EncryptionGetObjectOutcome S3EncryptionClient::GetObject(const Aws::S3::Model::GetObjectRequest & request) const
+        {
+            return GetObjectDecrypted(request, 0, 0);
+        }
+
+        S3EncryptionGetObjectOutcome S3EncryptionClient::GetObjectInParts(const Aws::S3::Model::GetObjectRequest& request, size_t partSize, size_t maxConcurrentParts) const
+        {
+            return GetObjectDecrypted(request, partSize, maxConcurrentParts);
+        }
+
+        S3EncryptionGetObjectOutcome S3EncryptionClient::GetObjectDecrypted(const Aws::S3::Model::GetObjectRequest& request, size_t partSize, size_t maxConcurrentParts) const
         {
             Aws::S3::Model::HeadObjectRequest headRequest;
             headRequest.WithBucket(request.GetBucket());
@@ -106,6 +122,10 @@ namespace Aws
             }
 
             auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, decryptionCryptoConfig);
+            if (partSize > 0 && request.GetRange().empty())
+            {
+                return module->GetObjectSecurelyInParts(request, headOutcome.GetResult(), contentCryptoMaterial, *m_s3Client, partSize, maxConcurrentParts);
+            }
             auto getObjectFunction = [this](const Aws::S3::Model::GetObjectRequest& getRequest) { return m_s3Client->GetObject(getRequest); };
             return module->GetObjectSecurely(request, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction);
         }
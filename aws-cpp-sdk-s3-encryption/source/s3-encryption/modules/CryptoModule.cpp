@@ -16,9 +16,17 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/CryptoStream.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
@@ -38,6 +46,43 @@ namespace Aws
             static const size_t TAG_SIZE_BYTES = 16u;
             static const size_t AES_BLOCK_SIZE = 16u;
             static const size_t BITS_IN_BYTE = 8u;
+            static const size_t MIN_PART_SIZE = 5 * 1024 * 1024;
+
+            static void AbortMultipartUpload(const Aws::S3::S3Client& s3Client, const PutObjectRequest& request, const Aws::String& uploadId)
+            {
+                AbortMultipartUploadRequest abortRequest;
+                abortRequest.WithBucket(request.GetBucket()).WithKey(request.GetKey()).WithUploadId(uploadId);
+                if (request.RequestPayerHasBeenSet())
+                {
+                    abortRequest.SetRequestPayer(request.GetRequestPayer());
+                }
+
+                AbortMultipartUploadOutcome abortOutcome = s3Client.AbortMultipartUpload(abortRequest);
+                if (!abortOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Abort multipart upload operation not successful: "
+                        << abortOutcome.GetError().GetExceptionName() << " : "
+                        << abortOutcome.GetError().GetMessage());
+                }
+            }
+
+            static void DeleteInstructionFile(const Aws::S3::S3Client& s3Client, const PutObjectRequest& request)
+            {
+                DeleteObjectRequest deleteRequest;
+                deleteRequest.WithBucket(request.GetBucket()).WithKey(request.GetKey() + Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX);
+                if (request.RequestPayerHasBeenSet())
+                {
+                    deleteRequest.SetRequestPayer(request.GetRequestPayer());
+                }
+
+                DeleteObjectOutcome deleteOutcome = s3Client.DeleteObject(deleteRequest);
+                if (!deleteOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file delete operation not successful: "
+                        << deleteOutcome.GetError().GetExceptionName() << " : "
+                        << deleteOutcome.GetError().GetMessage());
+                }
+            }
 
             CryptoModule::CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration & cryptoConfig) :
                 m_encryptionMaterials(encryptionMaterials), m_contentCryptoMaterial(ContentCryptoMaterial()), m_cryptoConfig(cryptoConfig), m_cipher(nullptr)
@@ -47,37 +92,222 @@ namespace Aws
             S3EncryptionPutObjectOutcome CryptoModule::PutObjectSecurely(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction)
             {
                 PutObjectRequest copyRequest(request);
+                auto initOutcome = InitEncryption(copyRequest);
+                if (!initOutcome.IsSuccess())
+                {
+                    return initOutcome;
+                }
+                auto instructionOutcome = PutInstructionFile(copyRequest, putObjectFunction);
+                if (!instructionOutcome.IsSuccess())
+                {
+                    return instructionOutcome;
+                }
+                SetContentLength(copyRequest);
+                return WrapAndMakeRequestWithCipher(copyRequest, putObjectFunction);
+            }
+
+            S3EncryptionPutObjectOutcome CryptoModule::InitEncryption(Aws::S3::Model::PutObjectRequest& request)
+            {
                 PopulateCryptoContentMaterial();
                 InitEncryptionCipher();
-                SetContentLength(copyRequest);
                 auto encryptOutcome = m_encryptionMaterials->EncryptCEK(m_contentCryptoMaterial);
                 if (!encryptOutcome.IsSuccess())
                 {
                     return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(encryptOutcome.GetError()));
                 }
-                
-                if (m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
+
+                if (m_cryptoConfig.GetStorageMethod() == StorageMethod::METADATA)
+                {
+                    Handlers::MetadataHandler handler;
+                    handler.PopulateRequest(request, m_contentCryptoMaterial);
+                }
+                return S3EncryptionPutObjectOutcome(PutObjectResult());
+            }
+
+            S3EncryptionPutObjectOutcome CryptoModule::PutInstructionFile(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction)
+            {
+                if (m_cryptoConfig.GetStorageMethod() != StorageMethod::INSTRUCTION_FILE)
+                {
+                    return S3EncryptionPutObjectOutcome(PutObjectResult());
+                }
+
+                Handlers::InstructionFileHandler handler;
+                PutObjectRequest instructionFileRequest;
+                instructionFileRequest.WithBucket(request.GetBucket());
+                instructionFileRequest.WithKey(request.GetKey());
+                handler.PopulateRequest(instructionFileRequest, m_contentCryptoMaterial);
+                PutObjectOutcome instructionOutcome = putObjectFunction(instructionFileRequest);
+                if (!instructionOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file put operation not successful: "
+                        << instructionOutcome.GetError().GetExceptionName() << " : "
+                        << instructionOutcome.GetError().GetMessage());
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
+                }
+                return S3EncryptionPutObjectOutcome(PutObjectResult());
+            }
+
+            S3EncryptionMultipartUploadOutcome CryptoModule::PutObjectSecurelyInParts(const Aws::S3::Model::PutObjectRequest& request, const Aws::S3::S3Client& s3Client,
+                size_t partSize, size_t maxConcurrentParts)
+            {
+                PutObjectRequest copyRequest(request);
+                auto initOutcome = InitEncryption(copyRequest);
+                if (!initOutcome.IsSuccess())
+                {
+                    return S3EncryptionMultipartUploadOutcome(initOutcome.GetError());
+                }
+
+                CreateMultipartUploadRequest createRequest;
+                createRequest.WithBucket(copyRequest.GetBucket()).WithKey(copyRequest.GetKey()).WithMetadata(copyRequest.GetMetadata());
+                createRequest.SetContentType(copyRequest.GetContentType());
+                if (copyRequest.ACLHasBeenSet()) createRequest.SetACL(copyRequest.GetACL());
+                if (copyRequest.CacheControlHasBeenSet()) createRequest.SetCacheControl(copyRequest.GetCacheControl());
+                if (copyRequest.ContentDispositionHasBeenSet()) createRequest.SetContentDisposition(copyRequest.GetContentDisposition());
+                if (copyRequest.ContentEncodingHasBeenSet()) createRequest.SetContentEncoding(copyRequest.GetContentEncoding());
+                if (copyRequest.ContentLanguageHasBeenSet()) createRequest.SetContentLanguage(copyRequest.GetContentLanguage());
+                if (copyRequest.ExpiresHasBeenSet()) createRequest.SetExpires(copyRequest.GetExpires());
+                if (copyRequest.ServerSideEncryptionHasBeenSet()) createRequest.SetServerSideEncryption(copyRequest.GetServerSideEncryption());
+                if (copyRequest.SSEKMSKeyIdHasBeenSet()) createRequest.SetSSEKMSKeyId(copyRequest.GetSSEKMSKeyId());
+                if (copyRequest.SSECustomerAlgorithmHasBeenSet()) createRequest.SetSSECustomerAlgorithm(copyRequest.GetSSECustomerAlgorithm());
+                if (copyRequest.SSECustomerKeyHasBeenSet()) createRequest.SetSSECustomerKey(copyRequest.GetSSECustomerKey());
+                if (copyRequest.SSECustomerKeyMD5HasBeenSet()) createRequest.SetSSECustomerKeyMD5(copyRequest.GetSSECustomerKeyMD5());
+                if (copyRequest.StorageClassHasBeenSet()) createRequest.SetStorageClass(copyRequest.GetStorageClass());
+                if (copyRequest.TaggingHasBeenSet()) createRequest.SetTagging(copyRequest.GetTagging());
+                if (copyRequest.RequestPayerHasBeenSet()) createRequest.SetRequestPayer(copyRequest.GetRequestPayer());
+
+                CreateMultipartUploadOutcome createOutcome = s3Client.CreateMultipartUpload(createRequest);
+                if (!createOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Create multipart upload operation not successful: "
+                        << createOutcome.GetError().GetExceptionName() << " : "
+                        << createOutcome.GetError().GetMessage());
+                    return S3EncryptionMultipartUploadOutcome(BuildS3EncryptionError(createOutcome.GetError()));
+                }
+                const Aws::String& uploadId = createOutcome.GetResult().GetUploadId();
+
+                //every part but the last has to be at least 5MB, and whole blocks keep the ciphertext of a part exactly as long as its plaintext.
+                partSize = (std::max)(partSize, MIN_PART_SIZE);
+                partSize += (AES_BLOCK_SIZE - partSize % AES_BLOCK_SIZE) % AES_BLOCK_SIZE;
+                maxConcurrentParts = (std::max)(maxConcurrentParts, static_cast<size_t>(1));
+
+                struct UploadingPart
                 {
-                    Handlers::InstructionFileHandler handler;
-                    PutObjectRequest instructionFileRequest;
-                    instructionFileRequest.WithBucket(copyRequest.GetBucket());
-                    instructionFileRequest.WithKey(copyRequest.GetKey());
-                    handler.PopulateRequest(instructionFileRequest, m_contentCryptoMaterial);
-                    PutObjectOutcome instructionOutcome = putObjectFunction(instructionFileRequest);
-                    if (!instructionOutcome.IsSuccess())
+                    int partNumber;
+                    std::shared_ptr<CryptoBuffer> ciphertext;
+                    UploadPartOutcomeCallable outcome;
+                };
+                Aws::Deque<UploadingPart> uploadingParts;
+                CompletedMultipartUpload completedUpload;
+                S3EncryptionMultipartUploadOutcome failure;
+                bool failed = false;
+
+                Aws::IOStream& body = *copyRequest.GetBody();
+                body.clear();
+                body.seekg(0, std::ios_base::beg);
+                CryptoBuffer plaintext(partSize);
+                bool lastPart = false;
+                for (int partNumber = 1; !lastPart || !uploadingParts.empty(); ++partNumber)
+                {
+                    if (!lastPart && !failed)
+                    {
+                        body.read(reinterpret_cast<char*>(plaintext.GetUnderlyingData()), partSize);
+                        size_t bytesRead = static_cast<size_t>(body.gcount());
+                        lastPart = bytesRead < partSize || body.peek() == Aws::IOStream::traits_type::eof();
+
+                        CryptoBuffer encrypted = bytesRead == partSize ? m_cipher->EncryptBuffer(plaintext) : m_cipher->EncryptBuffer(CryptoBuffer(plaintext.GetUnderlyingData(), bytesRead));
+                        if (lastPart)
+                        {
+                            CryptoBuffer finalBlock = m_cipher->FinalizeEncryption();
+                            encrypted = CryptoBuffer({ (ByteBuffer*)&encrypted, (ByteBuffer*)&finalBlock });
+                        }
+
+                        if (!*m_cipher)
+                        {
+                            AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Encryption of part " << partNumber << " failed.");
+                            failure = S3EncryptionMultipartUploadOutcome(AWSError<S3EncryptionErrors>(CryptoErrors::ENCRYPT_CONTENT_FAILED, "EncryptContentFailed",
+                                "Content encryption failed", false));
+                            failed = lastPart = true;
+                        }
+                        else
+                        {
+                            auto ciphertext = Aws::MakeShared<CryptoBuffer>(ALLOCATION_TAG, std::move(encrypted));
+                            UploadPartRequest uploadPartRequest;
+                            uploadPartRequest.WithBucket(copyRequest.GetBucket()).WithKey(copyRequest.GetKey()).WithUploadId(uploadId).WithPartNumber(partNumber)
+                                .WithContentLength(static_cast<long long>(ciphertext->GetLength()));
+                            if (copyRequest.SSECustomerAlgorithmHasBeenSet()) uploadPartRequest.SetSSECustomerAlgorithm(copyRequest.GetSSECustomerAlgorithm());
+                            if (copyRequest.SSECustomerKeyHasBeenSet()) uploadPartRequest.SetSSECustomerKey(copyRequest.GetSSECustomerKey());
+                            if (copyRequest.SSECustomerKeyMD5HasBeenSet()) uploadPartRequest.SetSSECustomerKeyMD5(copyRequest.GetSSECustomerKeyMD5());
+                            if (copyRequest.RequestPayerHasBeenSet()) uploadPartRequest.SetRequestPayer(copyRequest.GetRequestPayer());
+                            uploadPartRequest.SetBody(Aws::MakeShared<Aws::Utils::Stream::DefaultUnderlyingStream>(ALLOCATION_TAG,
+                                Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(ALLOCATION_TAG, ciphertext->GetUnderlyingData(), ciphertext->GetLength())));
+
+                            UploadingPart uploadingPart;
+                            uploadingPart.partNumber = partNumber;
+                            uploadingPart.ciphertext = ciphertext;
+                            uploadingPart.outcome = s3Client.UploadPartCallable(uploadPartRequest);
+                            uploadingParts.push_back(std::move(uploadingPart));
+                        }
+                    }
+
+                    //the part buffers have to outlive their uploads, so even after a failure every part in flight is waited for.
+                    while (!uploadingParts.empty() && (uploadingParts.size() >= maxConcurrentParts || lastPart))
                     {
-                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file put operation not successful: "
-                            << instructionOutcome.GetError().GetExceptionName() << " : "
-                            << instructionOutcome.GetError().GetMessage());
-                        return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
+                        UploadingPart& uploadingPart = uploadingParts.front();
+                        UploadPartOutcome uploadOutcome = uploadingPart.outcome.get();
+                        if (!uploadOutcome.IsSuccess())
+                        {
+                            AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Upload part operation not successful for part " << uploadingPart.partNumber << ": "
+                                << uploadOutcome.GetError().GetExceptionName() << " : "
+                                << uploadOutcome.GetError().GetMessage());
+                            if (!failed)
+                            {
+                                failure = S3EncryptionMultipartUploadOutcome(BuildS3EncryptionError(uploadOutcome.GetError()));
+                                failed = lastPart = true;
+                            }
+                        }
+                        else
+                        {
+                            completedUpload.AddParts(CompletedPart().WithPartNumber(uploadingPart.partNumber).WithETag(uploadOutcome.GetResult().GetETag()));
+                        }
+                        uploadingParts.pop_front();
                     }
                 }
-                else
+
+                if (failed)
                 {
-                    Handlers::MetadataHandler handler;
-                    handler.PopulateRequest(copyRequest, m_contentCryptoMaterial);
+                    AbortMultipartUpload(s3Client, copyRequest, uploadId);
+                    return failure;
                 }
-                return WrapAndMakeRequestWithCipher(copyRequest, putObjectFunction);
+
+                //the instruction file is only written once all parts made it, so a failed upload leaves none behind.
+                auto instructionOutcome = PutInstructionFile(copyRequest, [&s3Client](const PutObjectRequest& putRequest) { return s3Client.PutObject(putRequest); });
+                if (!instructionOutcome.IsSuccess())
+                {
+                    AbortMultipartUpload(s3Client, copyRequest, uploadId);
+                    return S3EncryptionMultipartUploadOutcome(instructionOutcome.GetError());
+                }
+
+                CompleteMultipartUploadRequest completeRequest;
+                completeRequest.WithBucket(copyRequest.GetBucket()).WithKey(copyRequest.GetKey()).WithUploadId(uploadId).WithMultipartUpload(completedUpload);
+                if (copyRequest.RequestPayerHasBeenSet())
+                {
+                    completeRequest.SetRequestPayer(copyRequest.GetRequestPayer());
+                }
+
+                CompleteMultipartUploadOutcome completeOutcome = s3Client.CompleteMultipartUpload(completeRequest);
+                if (!completeOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Complete multipart upload operation not successful: "
+                        << completeOutcome.GetError().GetExceptionName() << " : "
+                        << completeOutcome.GetError().GetMessage());
+                    if (m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
+                    {
+                        DeleteInstructionFile(s3Client, copyRequest);
+                    }
+                    AbortMultipartUpload(s3Client, copyRequest, uploadId);
+                    return S3EncryptionMultipartUploadOutcome(BuildS3EncryptionError(completeOutcome.GetError()));
+                }
+                return S3EncryptionMultipartUploadOutcome(completeOutcome.GetResultWithOwnership());
             }
 
             S3EncryptionGetObjectOutcome CryptoModule::GetObjectSecurely(const Aws::S3::Model::GetObjectRequest& request,
@@ -117,6 +347,124 @@ namespace Aws
                 return UnwrapAndMakeRequestWithCipher(copyRequest, getObjectFunction, firstBlockAdjustment);
             }
 
+            S3EncryptionGetObjectOutcome CryptoModule::GetObjectSecurelyInParts(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headObjectResult,
+                const ContentCryptoMaterial& contentCryptoMaterial, const Aws::S3::S3Client& s3Client, size_t partSize, size_t maxConcurrentParts)
+            {
+                if (!request.GetRange().empty())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "A ranged get can't be split into parts, range: " << request.GetRange());
+                    return S3EncryptionGetObjectOutcome(AWSError<S3EncryptionErrors>(S3Errors::INVALID_PARAMETER_COMBINATION, "InvalidParameterCombination",
+                        "GetObjectSecurelyInParts does not take a request with a range", false));
+                }
+                auto getObjectFunction = [&s3Client](const GetObjectRequest& getRequest) { return s3Client.GetObject(getRequest); };
+                int64_t bodyLength = headObjectResult.GetContentLength() - static_cast<int64_t>(contentCryptoMaterial.GetCryptoTagLength() / BITS_IN_BYTE);
+                partSize = (std::max)(partSize, AES_BLOCK_SIZE);
+                if (bodyLength <= static_cast<int64_t>(partSize))
+                {
+                    return GetObjectSecurely(request, headObjectResult, contentCryptoMaterial, getObjectFunction);
+                }
+
+                m_contentCryptoMaterial = contentCryptoMaterial;
+                DecryptionConditionCheck(request.GetRange());
+                auto decryptOutcome = m_encryptionMaterials->DecryptCEK(m_contentCryptoMaterial);
+                if (!decryptOutcome.IsSuccess())
+                {
+                    return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(decryptOutcome.GetError()));
+                }
+                InitDecryptionCipher(0, 0, GetTag(request, getObjectFunction));
+
+                maxConcurrentParts = (std::max)(maxConcurrentParts, static_cast<size_t>(1));
+                Aws::Deque<std::pair<int64_t, GetObjectOutcomeCallable>> downloadingParts;
+                int64_t nextPartStart = 0;
+                auto requestParts = [&]()
+                {
+                    while (downloadingParts.size() < maxConcurrentParts && nextPartStart < bodyLength)
+                    {
+                        int64_t partEnd = (std::min)(nextPartStart + static_cast<int64_t>(partSize), bodyLength) - 1;
+                        GetObjectRequest partRequest(request);
+                        partRequest.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+                        partRequest.SetRange("bytes=" + StringUtils::to_string(nextPartStart) + "-" + StringUtils::to_string(partEnd));
+                        downloadingParts.emplace_back(partEnd - nextPartStart + 1, s3Client.GetObjectCallable(partRequest));
+                        nextPartStart = partEnd + 1;
+                    }
+                };
+
+                Aws::IOStream* userSuppliedStream = request.GetResponseStreamFactory()();
+                GetObjectResult result;
+                S3EncryptionGetObjectOutcome failure;
+                bool failed = false;
+                bool firstPart = true;
+                requestParts();
+                while (!downloadingParts.empty())
+                {
+                    int64_t partLength = downloadingParts.front().first;
+                    GetObjectOutcome partOutcome = downloadingParts.front().second.get();
+                    downloadingParts.pop_front();
+                    if (failed)
+                    {
+                        continue;
+                    }
+                    requestParts();
+
+                    if (!partOutcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 get operation not successful: "
+                            << partOutcome.GetError().GetExceptionName() << " : "
+                            << partOutcome.GetError().GetMessage());
+                        failure = S3EncryptionGetObjectOutcome(BuildS3EncryptionError(partOutcome.GetError()));
+                        failed = true;
+                        continue;
+                    }
+
+                    CryptoBuffer ciphertext(static_cast<size_t>(partLength));
+                    Aws::IOStream& partBody = partOutcome.GetResult().GetBody();
+                    partBody.read(reinterpret_cast<char*>(ciphertext.GetUnderlyingData()), partLength);
+                    CryptoBuffer plaintext = partBody.gcount() == partLength ? m_cipher->DecryptBuffer(ciphertext) : CryptoBuffer();
+                    if (partBody.gcount() != partLength || !*m_cipher)
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Decryption of object part failed.");
+                        failure = S3EncryptionGetObjectOutcome(AWSError<S3EncryptionErrors>(CryptoErrors::DECRYPT_CONTENT_FAILED, "DecryptContentFailed",
+                            "Content decryption failed", false));
+                        failed = true;
+                        continue;
+                    }
+                    userSuppliedStream->write(reinterpret_cast<const char*>(plaintext.GetUnderlyingData()), plaintext.GetLength());
+
+                    if (firstPart)
+                    {
+                        result = partOutcome.GetResultWithOwnership();
+                        firstPart = false;
+                    }
+                }
+
+                if (!failed)
+                {
+                    CryptoBuffer plaintext = m_cipher->FinalizeDecryption();
+                    if (!*m_cipher)
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Decryption of object failed, the content could not be authenticated.");
+                        failure = S3EncryptionGetObjectOutcome(AWSError<S3EncryptionErrors>(CryptoErrors::DECRYPT_CONTENT_FAILED, "DecryptContentFailed",
+                            "Content decryption failed", false));
+                        failed = true;
+                    }
+                    userSuppliedStream->write(reinterpret_cast<const char*>(plaintext.GetUnderlyingData()), plaintext.GetLength());
+                }
+
+                if (failed)
+                {
+                    Aws::Delete(userSuppliedStream);
+                    return failure;
+                }
+
+                userSuppliedStream->clear();
+                userSuppliedStream->seekg(0, std::ios_base::end);
+                result.SetContentLength(static_cast<long long>(userSuppliedStream->tellg()));
+                result.SetContentRange("");
+                userSuppliedStream->seekg(0, std::ios_base::beg);
+                result.ReplaceBody(userSuppliedStream);
+                return S3EncryptionGetObjectOutcome(std::move(result));
+            }
+
             S3EncryptionPutObjectOutcome CryptoModule::WrapAndMakeRequestWithCipher(Aws::S3::Model::PutObjectRequest & request, const PutObjectFunction& putObjectFunction)
             {
                 std::shared_ptr<Aws::IOStream> iostream = request.GetBody();
@@ -25,6 +25,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -45,6 +46,7 @@ namespace Model
     CommonPrefix& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
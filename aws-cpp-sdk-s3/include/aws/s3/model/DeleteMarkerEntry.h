@@ -27,6 +27,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -47,6 +48,7 @@ namespace Model
     DeleteMarkerEntry& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
@@ -33,6 +33,7 @@ namespace Utils
 namespace Xml
 {
   class XmlDocument;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -45,6 +46,10 @@ namespace Model
     ListObjectVersionsResult();
     ListObjectVersionsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     ListObjectVersionsResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /**
+     * Reads the response payload in a single pass, without building an XmlDocument.
+     */
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
@@ -28,6 +28,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace S3
@@ -48,6 +49,7 @@ namespace Model
     Object& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
 
     void AddToNode(Aws::Utils::Xml::XmlNode& parentNode) const;
+    bool ReadXml(Aws::Utils::Xml::XmlReader& reader);
 
 
     /**
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -58,6 +59,20 @@ CommonPrefix& CommonPrefix::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool CommonPrefix::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "Prefix")
+    {
+      m_prefixHasBeenSet = true;
+      return ReadXmlValue(reader, m_prefix);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void CommonPrefix::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
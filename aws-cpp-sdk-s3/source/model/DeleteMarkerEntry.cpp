@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -92,6 +93,44 @@ DeleteMarkerEntry& DeleteMarkerEntry::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool DeleteMarkerEntry::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "Owner")
+    {
+      m_ownerHasBeenSet = true;
+      return ReadXmlValue(reader, m_owner);
+    }
+
+    if(name == "Key")
+    {
+      m_keyHasBeenSet = true;
+      return ReadXmlValue(reader, m_key);
+    }
+
+    if(name == "VersionId")
+    {
+      m_versionIdHasBeenSet = true;
+      return ReadXmlValue(reader, m_versionId);
+    }
+
+    if(name == "IsLatest")
+    {
+      m_isLatestHasBeenSet = true;
+      return ReadXmlValue(reader, m_isLatest);
+    }
+
+    if(name == "LastModified")
+    {
+      m_lastModifiedHasBeenSet = true;
+      return ReadXmlValue(reader, m_lastModified);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void DeleteMarkerEntry::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -134,3 +135,79 @@ ListObjectVersionsResult& ListObjectVersionsResult::operator =(const Aws::Amazon
 
   return *this;
 }
+
+bool ListObjectVersionsResult::ReadXml(XmlReader& reader)
+{
+  return reader.ReadDocument([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "IsTruncated")
+    {
+      return ReadXmlValue(reader, m_isTruncated);
+    }
+
+    if(name == "KeyMarker")
+    {
+      return ReadXmlValue(reader, m_keyMarker);
+    }
+
+    if(name == "VersionIdMarker")
+    {
+      return ReadXmlValue(reader, m_versionIdMarker);
+    }
+
+    if(name == "NextKeyMarker")
+    {
+      return ReadXmlValue(reader, m_nextKeyMarker);
+    }
+
+    if(name == "NextVersionIdMarker")
+    {
+      return ReadXmlValue(reader, m_nextVersionIdMarker);
+    }
+
+    if(name == "Version")
+    {
+      m_versions.emplace_back();
+      return ReadXmlValue(reader, m_versions.back());
+    }
+
+    if(name == "DeleteMarker")
+    {
+      m_deleteMarkers.emplace_back();
+      return ReadXmlValue(reader, m_deleteMarkers.back());
+    }
+
+    if(name == "Name")
+    {
+      return ReadXmlValue(reader, m_name);
+    }
+
+    if(name == "Prefix")
+    {
+      return ReadXmlValue(reader, m_prefix);
+    }
+
+    if(name == "Delimiter")
+    {
+      return ReadXmlValue(reader, m_delimiter);
+    }
+
+    if(name == "MaxKeys")
+    {
+      return ReadXmlValue(reader, m_maxKeys);
+    }
+
+    if(name == "CommonPrefixes")
+    {
+      m_commonPrefixes.emplace_back();
+      return ReadXmlValue(reader, m_commonPrefixes.back());
+    }
+
+    if(name == "EncodingType")
+    {
+      return ReadXmlValue(reader, m_encodingType, EncodingTypeMapper::GetEncodingTypeForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
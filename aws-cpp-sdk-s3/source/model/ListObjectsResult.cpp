@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -113,3 +114,63 @@ ListObjectsResult& ListObjectsResult::operator =(const Aws::AmazonWebServiceResu
 
   return *this;
 }
+
+bool ListObjectsResult::ReadXml(XmlReader& reader)
+{
+  return reader.ReadDocument([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "IsTruncated")
+    {
+      return ReadXmlValue(reader, m_isTruncated);
+    }
+
+    if(name == "Marker")
+    {
+      return ReadXmlValue(reader, m_marker);
+    }
+
+    if(name == "NextMarker")
+    {
+      return ReadXmlValue(reader, m_nextMarker);
+    }
+
+    if(name == "Contents")
+    {
+      m_contents.emplace_back();
+      return ReadXmlValue(reader, m_contents.back());
+    }
+
+    if(name == "Name")
+    {
+      return ReadXmlValue(reader, m_name);
+    }
+
+    if(name == "Prefix")
+    {
+      return ReadXmlValue(reader, m_prefix);
+    }
+
+    if(name == "Delimiter")
+    {
+      return ReadXmlValue(reader, m_delimiter);
+    }
+
+    if(name == "MaxKeys")
+    {
+      return ReadXmlValue(reader, m_maxKeys);
+    }
+
+    if(name == "CommonPrefixes")
+    {
+      m_commonPrefixes.emplace_back();
+      return ReadXmlValue(reader, m_commonPrefixes.back());
+    }
+
+    if(name == "EncodingType")
+    {
+      return ReadXmlValue(reader, m_encodingType, EncodingTypeMapper::GetEncodingTypeForName);
+    }
+
+    return reader.SkipElement();
+  });
+}
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -125,3 +126,73 @@ ListObjectsV2Result& ListObjectsV2Result::operator =(const Aws::AmazonWebService
 
   return *this;
 }
+
+bool ListObjectsV2Result::ReadXml(XmlReader& reader)
+{
+  return reader.ReadDocument([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "IsTruncated")
+    {
+      return ReadXmlValue(reader, m_isTruncated);
+    }
+
+    if(name == "Contents")
+    {
+      m_contents.emplace_back();
+      return ReadXmlValue(reader, m_contents.back());
+    }
+
+    if(name == "Name")
+    {
+      return ReadXmlValue(reader, m_name);
+    }
+
+    if(name == "Prefix")
+    {
+      return ReadXmlValue(reader, m_prefix);
+    }
+
+    if(name == "Delimiter")
+    {
+      return ReadXmlValue(reader, m_delimiter);
+    }
+
+    if(name == "MaxKeys")
+    {
+      return ReadXmlValue(reader, m_maxKeys);
+    }
+
+    if(name == "CommonPrefixes")
+    {
+      m_commonPrefixes.emplace_back();
+      return ReadXmlValue(reader, m_commonPrefixes.back());
+    }
+
+    if(name == "EncodingType")
+    {
+      return ReadXmlValue(reader, m_encodingType, EncodingTypeMapper::GetEncodingTypeForName);
+    }
+
+    if(name == "KeyCount")
+    {
+      return ReadXmlValue(reader, m_keyCount);
+    }
+
+    if(name == "ContinuationToken")
+    {
+      return ReadXmlValue(reader, m_continuationToken);
+    }
+
+    if(name == "NextContinuationToken")
+    {
+      return ReadXmlValue(reader, m_nextContinuationToken);
+    }
+
+    if(name == "StartAfter")
+    {
+      return ReadXmlValue(reader, m_startAfter);
+    }
+
+    return reader.SkipElement();
+  });
+}
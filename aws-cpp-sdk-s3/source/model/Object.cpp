@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -102,6 +103,50 @@ Object& Object::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Object::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "Key")
+    {
+      m_keyHasBeenSet = true;
+      return ReadXmlValue(reader, m_key);
+    }
+
+    if(name == "LastModified")
+    {
+      m_lastModifiedHasBeenSet = true;
+      return ReadXmlValue(reader, m_lastModified);
+    }
+
+    if(name == "ETag")
+    {
+      m_eTagHasBeenSet = true;
+      return ReadXmlValue(reader, m_eTag);
+    }
+
+    if(name == "Size")
+    {
+      m_sizeHasBeenSet = true;
+      return ReadXmlValue(reader, m_size);
+    }
+
+    if(name == "StorageClass")
+    {
+      m_storageClassHasBeenSet = true;
+      return ReadXmlValue(reader, m_storageClass, ObjectStorageClassMapper::GetObjectStorageClassForName);
+    }
+
+    if(name == "Owner")
+    {
+      m_ownerHasBeenSet = true;
+      return ReadXmlValue(reader, m_owner);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Object::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -17,6 +17,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/xml/XmlReader.h>
 
 #include <utility>
 
@@ -66,6 +67,26 @@ Owner& Owner::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+bool Owner::ReadXml(XmlReader& reader)
+{
+  return reader.ReadChildren([this](XmlReader& reader, const XmlStringView& name) -> bool
+  {
+    if(name == "DisplayName")
+    {
+      m_displayNameHasBeenSet = true;
+      return ReadXmlValue(reader, m_displayName);
+    }
+
+    if(name == "ID")
+    {
+      m_iDHasBeenSet = true;
+      return ReadXmlValue(reader, m_iD);
+    }
+
+    return reader.SkipElement();
+  });
+}
+
 void Owner::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -0,0 +1,501 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/queues/sqs/SQSQueue.h>
+#include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/ChangeMessageVisibilityBatchRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/GetQueueUrlRequest.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Queues::Sqs;
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+
+namespace
+{
+    const char* ALLOCATION_TAG = "SQSQueueTest";
+    const char* QUEUE_URL = "https://sqs.us-east-1.amazonaws.com/123456789012/SQSQueueTest";
+
+    /**
+     * Serves the queue calls from memory, and records what the queue asked for.
+     */
+    class MockSQSClient : public SQSClient
+    {
+    public:
+        MockSQSClient() : SQSClient(Aws::Auth::AWSCredentials("access", "secret"), Aws::Client::ClientConfiguration()), m_receiveCalls(0)
+        {
+        }
+
+        void AddMessages(size_t count)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Message message;
+                message.SetBody(Aws::Utils::StringUtils::to_string(m_available.size() + m_received.size()));
+                message.SetReceiptHandle("handle-" + message.GetBody());
+                m_available.push_back(message);
+            }
+        }
+
+        GetQueueUrlOutcome GetQueueUrl(const GetQueueUrlRequest&) const override
+        {
+            GetQueueUrlResult result;
+            result.SetQueueUrl(QUEUE_URL);
+            return result;
+        }
+
+        ReceiveMessageOutcome ReceiveMessage(const ReceiveMessageRequest& request) const override
+        {
+            ++m_receiveCalls;
+            ReceiveMessageResult result;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                while (!m_available.empty() && result.GetMessages().size() < static_cast<size_t>(request.GetMaxNumberOfMessages()))
+                {
+                    m_received.insert(m_available.front().GetReceiptHandle());
+                    result.AddMessages(m_available.front());
+                    m_available.pop_front();
+                }
+            }
+
+            if (result.GetMessages().empty())
+            {
+                // stands in for the long poll on an empty queue.
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+            return result;
+        }
+
+        DeleteMessageBatchOutcome DeleteMessageBatch(const DeleteMessageBatchRequest& request) const override
+        {
+            DeleteMessageBatchResult result;
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_deleteBatchSizes.push_back(request.GetEntries().size());
+            for (const auto& entry : request.GetEntries())
+            {
+                m_deleted.insert(entry.GetReceiptHandle());
+                DeleteMessageBatchResultEntry successful;
+                successful.SetId(entry.GetId());
+                result.AddSuccessful(successful);
+            }
+            return result;
+        }
+
+        ChangeMessageVisibilityBatchOutcome ChangeMessageVisibilityBatch(const ChangeMessageVisibilityBatchRequest& request) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            for (const auto& entry : request.GetEntries())
+            {
+                m_visibilityTimeouts[entry.GetReceiptHandle()].push_back(entry.GetVisibilityTimeout());
+            }
+            return ChangeMessageVisibilityBatchResult();
+        }
+
+        /**
+         * Entries whose body starts with "flaky" fail on their first attempt, "never" always fails, and "invalid" fails as the
+         * sender's fault.
+         */
+        SendMessageBatchOutcome SendMessageBatch(const SendMessageBatchRequest& request) const override
+        {
+            SendMessageBatchResult result;
+            std::lock_guard<std::mutex> locker(m_lock);
+            size_t payloadBytes = 0;
+            for (const auto& entry : request.GetEntries())
+            {
+                const auto& body = entry.GetMessageBody();
+                payloadBytes += body.size();
+                auto& attempts = m_sendAttempts[body];
+                attempts.push_back(std::chrono::steady_clock::now());
+
+                bool senderFault = body == "invalid";
+                if (senderFault || body == "never" || (body.find("flaky") == 0 && attempts.size() == 1))
+                {
+                    BatchResultErrorEntry failed;
+                    failed.SetId(entry.GetId());
+                    failed.SetCode(senderFault ? "InvalidMessageContents" : "InternalError");
+                    failed.SetSenderFault(senderFault);
+                    result.AddFailed(failed);
+                    continue;
+                }
+
+                SendMessageBatchResultEntry successful;
+                successful.SetId(entry.GetId());
+                result.AddSuccessful(successful);
+            }
+            m_sendBatches.push_back(std::make_pair(request.GetEntries().size(), payloadBytes));
+            return result;
+        }
+
+        size_t GetReceiveCalls() const { return m_receiveCalls; }
+        size_t GetAvailableCount() const { std::lock_guard<std::mutex> locker(m_lock); return m_available.size(); }
+        Aws::Set<Aws::String> GetDeleted() const { std::lock_guard<std::mutex> locker(m_lock); return m_deleted; }
+        Aws::Vector<size_t> GetDeleteBatchSizes() const { std::lock_guard<std::mutex> locker(m_lock); return m_deleteBatchSizes; }
+        Aws::Map<Aws::String, Aws::Vector<int>> GetVisibilityTimeouts() const { std::lock_guard<std::mutex> locker(m_lock); return m_visibilityTimeouts; }
+        // the entry count and payload size of each SendMessageBatch call.
+        Aws::Vector<std::pair<size_t, size_t>> GetSendBatches() const { std::lock_guard<std::mutex> locker(m_lock); return m_sendBatches; }
+        Aws::Vector<std::chrono::steady_clock::time_point> GetSendAttempts(const Aws::String& body) const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto attempts = m_sendAttempts.find(body);
+            return attempts == m_sendAttempts.end() ? Aws::Vector<std::chrono::steady_clock::time_point>() : attempts->second;
+        }
+
+    private:
+        mutable std::mutex m_lock;
+        mutable std::atomic<size_t> m_receiveCalls;
+        mutable Aws::Deque<Message> m_available;
+        mutable Aws::Set<Aws::String> m_received;
+        mutable Aws::Set<Aws::String> m_deleted;
+        mutable Aws::Vector<size_t> m_deleteBatchSizes;
+        mutable Aws::Map<Aws::String, Aws::Vector<int>> m_visibilityTimeouts;
+        mutable Aws::Vector<std::pair<size_t, size_t>> m_sendBatches;
+        mutable Aws::Map<Aws::String, Aws::Vector<std::chrono::steady_clock::time_point>> m_sendAttempts;
+    };
+
+    Message MessageWithBody(const Aws::String& body)
+    {
+        Message message;
+        message.SetBody(body);
+        return message;
+    }
+
+    template<typename Predicate>
+    bool WaitFor(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::milliseconds(10000))
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return true;
+    }
+
+    class SQSQueueTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_client = Aws::MakeShared<MockSQSClient>(ALLOCATION_TAG);
+            m_queue = Aws::MakeUnique<SQSQueue>(ALLOCATION_TAG, m_client, "SQSQueueTest", 2);
+            m_queue->EnsureQueueIsInitialized();
+            ASSERT_EQ(QUEUE_URL, m_queue->GetQueueUrl());
+        }
+
+        void TearDown() override
+        {
+            m_queue = nullptr;
+            m_client = nullptr;
+        }
+
+        void CountSends()
+        {
+            m_queue->SetMessageSendSuccessEventHandler([this](const Aws::Queues::Queue<Message>*, const Message& message)
+            {
+                std::lock_guard<std::mutex> locker(m_sendsLock);
+                m_sent.push_back(message.GetBody());
+            });
+            m_queue->SetMessageSendFailedEventHandler([this](const Aws::Queues::Queue<Message>*, const Message& message)
+            {
+                std::lock_guard<std::mutex> locker(m_sendsLock);
+                m_sendFailed.push_back(message.GetBody());
+            });
+        }
+
+        size_t GetSentCount()
+        {
+            std::lock_guard<std::mutex> locker(m_sendsLock);
+            return m_sent.size();
+        }
+
+        std::shared_ptr<MockSQSClient> m_client;
+        Aws::UniquePtr<SQSQueue> m_queue;
+        std::mutex m_sendsLock;
+        Aws::Vector<Aws::String> m_sent;
+        Aws::Vector<Aws::String> m_sendFailed;
+    };
+}
+
+TEST_F(SQSQueueTest, TestConsumerDispatchesEachMessageOnceAndDeletesInBatches)
+{
+    const size_t messageCount = 25;
+    m_client->AddMessages(messageCount);
+
+    std::mutex handledLock;
+    Aws::Map<Aws::String, size_t> handled;
+    std::atomic<size_t> deleteSuccesses(0);
+    m_queue->SetMessageReceivedEventHandler([&](const Aws::Queues::Queue<Message>*, const Message& message, bool& deleteMessage)
+    {
+        std::lock_guard<std::mutex> locker(handledLock);
+        ++handled[message.GetBody()];
+        // the odd ones are left on the queue.
+        deleteMessage = Aws::Utils::StringUtils::ConvertToInt32(message.GetBody().c_str()) % 2 == 0;
+    });
+    m_queue->SetMessageDeleteSuccessEventHandler([&](const Aws::Queues::Queue<Message>*, const Message&) { ++deleteSuccesses; });
+
+    SQSQueueConsumerConfiguration config;
+    config.workerCount = 3;
+    config.prefetchCount = 7;
+    m_queue->StartConsuming(config);
+    ASSERT_TRUE(WaitFor([&] { std::lock_guard<std::mutex> locker(handledLock); return handled.size() == messageCount; }));
+    m_queue->StopConsuming();
+
+    for (const auto& message : handled)
+    {
+        ASSERT_EQ(1u, message.second);
+    }
+
+    auto deleted = m_client->GetDeleted();
+    ASSERT_EQ(13u, deleted.size());
+    ASSERT_EQ(13u, deleteSuccesses.load());
+    for (size_t i = 0; i < messageCount; ++i)
+    {
+        ASSERT_EQ(i % 2 == 0, deleted.count("handle-" + Aws::Utils::StringUtils::to_string(i)) == 1);
+    }
+    for (auto batchSize : m_client->GetDeleteBatchSizes())
+    {
+        ASSERT_LE(batchSize, 10u);
+    }
+}
+
+TEST_F(SQSQueueTest, TestConsumerExtendsVisibilityOfMessagesBeingHandled)
+{
+    m_client->AddMessages(1);
+    std::atomic<bool> done(false);
+    m_queue->SetMessageReceivedEventHandler([&](const Aws::Queues::Queue<Message>*, const Message&, bool&)
+    {
+        // longer than half of the 2 second visibility timeout, and than the maintenance interval.
+        std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+        done = true;
+    });
+
+    m_queue->StartConsuming();
+    ASSERT_TRUE(WaitFor([&] { return done.load(); }));
+    m_queue->StopConsuming();
+
+    auto visibilityTimeouts = m_client->GetVisibilityTimeouts();
+    ASSERT_EQ(1u, visibilityTimeouts.size());
+    ASSERT_FALSE(visibilityTimeouts["handle-0"].empty());
+    for (auto timeout : visibilityTimeouts["handle-0"])
+    {
+        ASSERT_EQ(2, timeout);
+    }
+}
+
+TEST_F(SQSQueueTest, TestConsumerDoesNotExtendVisibilityWhenDisabled)
+{
+    m_client->AddMessages(1);
+    std::atomic<bool> done(false);
+    m_queue->SetMessageReceivedEventHandler([&](const Aws::Queues::Queue<Message>*, const Message&, bool&)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+        done = true;
+    });
+
+    SQSQueueConsumerConfiguration config;
+    config.extendVisibilityTimeout = false;
+    m_queue->StartConsuming(config);
+    ASSERT_TRUE(WaitFor([&] { return done.load(); }));
+    m_queue->StopConsuming();
+
+    ASSERT_TRUE(m_client->GetVisibilityTimeouts().empty());
+}
+
+TEST_F(SQSQueueTest, TestStopConsumingHandlesReceivedMessagesAndSendsPendingDeletes)
+{
+    m_client->AddMessages(10);
+    std::atomic<size_t> started(0);
+    std::atomic<size_t> handled(0);
+    m_queue->SetMessageReceivedEventHandler([&](const Aws::Queues::Queue<Message>*, const Message&, bool& deleteMessage)
+    {
+        ++started;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ++handled;
+        deleteMessage = true;
+    });
+
+    SQSQueueConsumerConfiguration config;
+    config.workerCount = 1;
+    config.prefetchCount = 10;
+    // longer than the test, so only the shutdown sends the deletes.
+    config.deleteFlushDelayMs = 60000;
+    m_queue->StartConsuming(config);
+    ASSERT_TRUE(WaitFor([&] { return started > 0 && m_client->GetAvailableCount() == 0; }));
+    m_queue->StopConsuming();
+
+    ASSERT_EQ(10u, handled.load());
+    ASSERT_EQ(10u, m_client->GetDeleted().size());
+}
+
+TEST_F(SQSQueueTest, TestStopConsumingFromHandlerDoesNotDeadlock)
+{
+    m_client->AddMessages(5);
+    SQSQueue* queue = m_queue.get();
+    std::atomic<bool> stopFromHandler(true);
+    std::atomic<size_t> handled(0);
+    m_queue->SetMessageReceivedEventHandler([&, queue](const Aws::Queues::Queue<Message>*, const Message&, bool& deleteMessage)
+    {
+        ++handled;
+        deleteMessage = true;
+        if (stopFromHandler)
+        {
+            queue->StopConsuming();
+        }
+    });
+
+    SQSQueueConsumerConfiguration config;
+    config.workerCount = 2;
+    config.prefetchCount = 5;
+    m_queue->StartConsuming(config);
+    ASSERT_TRUE(WaitFor([&] { return handled.load() == 5; }));
+
+    // receiving stops once a handler asks for it, without anyone joining the consumer.
+    auto receiveCalls = m_client->GetReceiveCalls();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_EQ(receiveCalls, m_client->GetReceiveCalls());
+
+    // StartConsuming() from another thread joins the stopped consumer, which has sent its deletes, and starts a new one.
+    stopFromHandler = false;
+    m_client->AddMessages(1);
+    m_queue->StartConsuming(config);
+    ASSERT_EQ(5u, m_client->GetDeleted().size());
+    ASSERT_TRUE(WaitFor([&] { return handled.load() == 6; }));
+    m_queue->StopConsuming();
+    ASSERT_EQ(6u, m_client->GetDeleted().size());
+}
+
+TEST_F(SQSQueueTest, TestProducerSendsAtMostTenMessagesPerBatch)
+{
+    CountSends();
+    SQSQueueProducerConfiguration config;
+    // longer than the test, so only full batches and the shutdown send anything.
+    config.lingerMs = 60000;
+    m_queue->StartBatchingPushes(config);
+    for (size_t i = 0; i < 25; ++i)
+    {
+        m_queue->Push(MessageWithBody(Aws::Utils::StringUtils::to_string(i)));
+    }
+
+    ASSERT_TRUE(WaitFor([&] { return GetSentCount() == 20; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(20u, GetSentCount());
+
+    m_queue->StopBatchingPushes();
+    ASSERT_EQ(25u, GetSentCount());
+    auto batches = m_client->GetSendBatches();
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(10u, batches[0].first);
+    ASSERT_EQ(10u, batches[1].first);
+    ASSERT_EQ(5u, batches[2].first);
+}
+
+TEST_F(SQSQueueTest, TestProducerKeepsBatchesUnder256KB)
+{
+    CountSends();
+    SQSQueueProducerConfiguration config;
+    config.lingerMs = 60000;
+    m_queue->StartBatchingPushes(config);
+    for (char body = 'a'; body < 'e'; ++body)
+    {
+        m_queue->Push(MessageWithBody(Aws::String(100 * 1024, body)));
+    }
+
+    // 300 KB are queued after the third push, so a batch of the two that fit goes out without lingering.
+    ASSERT_TRUE(WaitFor([&] { return GetSentCount() >= 2; }));
+    m_queue->StopBatchingPushes();
+
+    ASSERT_EQ(4u, GetSentCount());
+    auto batches = m_client->GetSendBatches();
+    ASSERT_EQ(2u, batches.size());
+    for (const auto& batch : batches)
+    {
+        ASSERT_EQ(2u, batch.first);
+        ASSERT_LE(batch.second, 256u * 1024u);
+    }
+}
+
+TEST_F(SQSQueueTest, TestProducerRetriesFailedEntriesWithBackoff)
+{
+    CountSends();
+    SQSQueueProducerConfiguration config;
+    config.lingerMs = 10;
+    config.maxAttempts = 3;
+    config.retryDelayMs = 200;
+    m_queue->StartBatchingPushes(config);
+    m_queue->Push(MessageWithBody("ok"));
+    m_queue->Push(MessageWithBody("flaky"));
+    m_queue->Push(MessageWithBody("never"));
+    m_queue->Push(MessageWithBody("invalid"));
+    m_queue->StopBatchingPushes();
+
+    std::sort(m_sent.begin(), m_sent.end());
+    std::sort(m_sendFailed.begin(), m_sendFailed.end());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"flaky", "ok"}), m_sent);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"invalid", "never"}), m_sendFailed);
+
+    // the sender's fault isn't retried.
+    ASSERT_EQ(1u, m_client->GetSendAttempts("ok").size());
+    ASSERT_EQ(1u, m_client->GetSendAttempts("invalid").size());
+
+    auto flaky = m_client->GetSendAttempts("flaky");
+    ASSERT_EQ(2u, flaky.size());
+    ASSERT_GE(flaky[1] - flaky[0], std::chrono::milliseconds(200));
+
+    // each attempt waits twice as long as the one before, up to maxAttempts.
+    auto never = m_client->GetSendAttempts("never");
+    ASSERT_EQ(3u, never.size());
+    ASSERT_GE(never[1] - never[0], std::chrono::milliseconds(200));
+    ASSERT_GE(never[2] - never[1], std::chrono::milliseconds(400));
+}
+
+TEST_F(SQSQueueTest, TestStopBatchingPushesFlushesQueuedMessages)
+{
+    CountSends();
+    SQSQueueProducerConfiguration config;
+    config.lingerMs = 60000;
+    m_queue->StartBatchingPushes(config);
+    m_queue->Push(MessageWithBody("first"));
+    m_queue->Push(MessageWithBody("second"));
+    m_queue->Push(MessageWithBody("third"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_TRUE(m_client->GetSendBatches().empty());
+
+    m_queue->StopBatchingPushes();
+    ASSERT_EQ(3u, GetSentCount());
+    auto batches = m_client->GetSendBatches();
+    ASSERT_EQ(1u, batches.size());
+    ASSERT_EQ(3u, batches[0].first);
+}
@@ -0,0 +1,299 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/transfer/DirectorySync.h>
+
+#include "TransferTestFiles.h"
+
+using namespace Aws::Testing;
+using namespace Aws::Transfer;
+
+namespace
+{
+    const char CONTENTS[] = "hello";
+    const uint64_t CONTENTS_SIZE = sizeof(CONTENTS) - 1;
+
+    Aws::String ContentsETag()
+    {
+        return "\"" + Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateMD5(CONTENTS)) + "\"";
+    }
+
+    Aws::Utils::DateTime AnHourFromNow()
+    {
+        return Aws::Utils::DateTime(Aws::Utils::DateTime::Now().Millis() + 3600 * 1000);
+    }
+
+    Aws::Utils::DateTime LongAgo()
+    {
+        return Aws::Utils::DateTime(static_cast<int64_t>(0));
+    }
+
+    DirectorySyncEntry MakeObject(const Aws::String& relativeKey, uint64_t size, const Aws::Utils::DateTime& lastModified, const Aws::String& eTag)
+    {
+        DirectorySyncEntry object;
+        object.relativeKey = relativeKey;
+        object.key = "pre/" + relativeKey;
+        object.size = size;
+        object.lastModified = lastModified;
+        object.eTag = eTag;
+        return object;
+    }
+
+    void AddListedObject(DirectorySyncSource& source, const DirectorySyncEntry& object, bool listingDone = true)
+    {
+        Aws::Deque<DirectorySyncEntry> objects;
+        objects.push_back(object);
+        source.AddListedObjects(objects, listingDone);
+    }
+
+    class DirectorySyncTest : public TempFilesTest
+    {
+    protected:
+        void SetUp() override
+        {
+            m_directory = MakeTempDirectoryPath();
+            ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(m_directory.c_str()));
+        }
+
+        Aws::String MakePath(const Aws::String& relativePath)
+        {
+            return Aws::FileSystem::Join(m_directory, relativePath);
+        }
+
+        // An upload of m_directory that skips unchanged files, with one file whose object is given.
+        DirectorySyncStep UploadStepFor(const DirectorySyncEntry& object, uint64_t maxHashedFileSize)
+        {
+            WriteFile(MakePath("file"), CONTENTS);
+            DirectorySyncSource source(TransferDirection::UPLOAD, m_directory, "pre/", true, maxHashedFileSize);
+            AddListedObject(source, object);
+            DirectorySyncEntry file;
+            return source.Next(file);
+        }
+
+        // A download to m_directory that skips unchanged files, of one object whose counterpart is the local file.
+        DirectorySyncStep DownloadStepFor(DirectorySyncEntry object, uint64_t maxHashedFileSize)
+        {
+            WriteFile(MakePath("file"), CONTENTS);
+            object.filePath = MakePath("file");
+            DirectorySyncSource source(TransferDirection::DOWNLOAD, m_directory, "pre/", true, maxHashedFileSize);
+            AddListedObject(source, object);
+            DirectorySyncEntry file;
+            return source.Next(file);
+        }
+
+        Aws::String m_directory;
+    };
+}
+
+TEST_F(DirectorySyncTest, TestWalkerReturnsFilesInKeyOrder)
+{
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(MakePath("a").c_str()));
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(MakePath(Aws::FileSystem::Join("a", "b")).c_str()));
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(MakePath("empty").c_str()));
+    WriteFile(MakePath("a0"), CONTENTS);
+    WriteFile(MakePath("a-b"), CONTENTS);
+    WriteFile(MakePath("B"), CONTENTS);
+    WriteFile(MakePath(Aws::FileSystem::Join("a", "z")), CONTENTS);
+    WriteFile(MakePath(Aws::FileSystem::Join(Aws::FileSystem::Join("a", "b"), "c")), "hello world");
+
+    // '-' < '/' < '0', so the files of directory "a" go between "a-b" and "a0", and upper case before lower case.
+    SortedDirectoryWalker walker(m_directory);
+    Aws::Vector<Aws::String> relativeKeys;
+    DirectorySyncEntry file;
+    while (walker.Next(file))
+    {
+        relativeKeys.push_back(file.relativeKey);
+        if (file.relativeKey == "a/b/c")
+        {
+            ASSERT_EQ(MakePath(Aws::FileSystem::Join(Aws::FileSystem::Join("a", "b"), "c")), file.filePath);
+            ASSERT_EQ(11u, file.size);
+        }
+    }
+
+    Aws::Vector<Aws::String> expected = { "B", "a-b", "a/b/c", "a/z", "a0" };
+    ASSERT_EQ(expected, relativeKeys);
+}
+
+TEST_F(DirectorySyncTest, TestWalkerOfMissingDirectoryFindsNothing)
+{
+    SortedDirectoryWalker walker(MakePath("missing"));
+    DirectorySyncEntry file;
+    ASSERT_FALSE(walker.Next(file));
+}
+
+TEST_F(DirectorySyncTest, TestUploadSkipsObjectsAtLeastAsNew)
+{
+    ASSERT_EQ(DirectorySyncStep::SKIP, UploadStepFor(MakeObject("file", CONTENTS_SIZE, AnHourFromNow(), "\"multipart-2\""), 0));
+    // a newer object of another size is still a different file.
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, UploadStepFor(MakeObject("file", CONTENTS_SIZE + 1, AnHourFromNow(), ContentsETag()), 1024));
+}
+
+TEST_F(DirectorySyncTest, TestUploadSkipsOlderObjectsWithTheSameMD5)
+{
+    ASSERT_EQ(DirectorySyncStep::SKIP, UploadStepFor(MakeObject("file", CONTENTS_SIZE, LongAgo(), ContentsETag()), CONTENTS_SIZE));
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, UploadStepFor(MakeObject("file", CONTENTS_SIZE, LongAgo(), "\"00000000000000000000000000000000\""), 1024));
+    // the ETag of a multi-part upload is not an MD5.
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, UploadStepFor(MakeObject("file", CONTENTS_SIZE, LongAgo(), "\"multipart-2\""), 1024));
+}
+
+TEST_F(DirectorySyncTest, TestUploadOnlyHashesUpToMaxHashedFileSize)
+{
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, UploadStepFor(MakeObject("file", CONTENTS_SIZE, LongAgo(), ContentsETag()), CONTENTS_SIZE - 1));
+}
+
+TEST_F(DirectorySyncTest, TestUploadMatchesFilesWithListedObjects)
+{
+    WriteFile(MakePath("b"), CONTENTS);
+    WriteFile(MakePath("d"), CONTENTS);
+    DirectorySyncSource source(TransferDirection::UPLOAD, m_directory, "pre/", true, 1024);
+
+    DirectorySyncEntry file;
+    ASSERT_EQ(DirectorySyncStep::WAIT_FOR_LISTING, source.Next(file));
+    ASSERT_TRUE(source.NeedsListing(1));
+
+    // "a" has no local file, and "b" is up to date.
+    Aws::Deque<DirectorySyncEntry> objects;
+    objects.push_back(MakeObject("a", CONTENTS_SIZE, AnHourFromNow(), ""));
+    objects.push_back(MakeObject("b", CONTENTS_SIZE, AnHourFromNow(), ""));
+    source.AddListedObjects(objects, false);
+    ASSERT_EQ(DirectorySyncStep::SKIP, source.Next(file));
+    ASSERT_EQ("b", file.relativeKey);
+    ASSERT_EQ("pre/b", file.key);
+    ASSERT_EQ(MakePath("b"), file.filePath);
+
+    // "d" could still be on the next page of the listing.
+    ASSERT_EQ(DirectorySyncStep::WAIT_FOR_LISTING, source.Next(file));
+    AddListedObject(source, MakeObject("c", CONTENTS_SIZE, AnHourFromNow(), ""));
+    ASSERT_FALSE(source.NeedsListing(1));
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, source.Next(file));
+    ASSERT_EQ("d", file.relativeKey);
+    ASSERT_EQ(DirectorySyncStep::DONE, source.Next(file));
+}
+
+TEST_F(DirectorySyncTest, TestUploadWithoutSkippingNeverWaitsForListing)
+{
+    WriteFile(MakePath("file"), CONTENTS);
+    DirectorySyncSource source(TransferDirection::UPLOAD, m_directory, "pre/", false, 1024);
+    ASSERT_FALSE(source.NeedsListing(1));
+
+    DirectorySyncEntry file;
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, source.Next(file));
+    ASSERT_EQ("pre/file", file.key);
+    ASSERT_EQ(DirectorySyncStep::DONE, source.Next(file));
+}
+
+TEST_F(DirectorySyncTest, TestDownloadSkipsLocalFilesAtLeastAsNew)
+{
+    ASSERT_EQ(DirectorySyncStep::SKIP, DownloadStepFor(MakeObject("file", CONTENTS_SIZE, LongAgo(), "\"multipart-2\""), 0));
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, DownloadStepFor(MakeObject("file", CONTENTS_SIZE + 1, LongAgo(), ContentsETag()), 1024));
+}
+
+TEST_F(DirectorySyncTest, TestDownloadSkipsOlderLocalFilesWithTheSameMD5)
+{
+    ASSERT_EQ(DirectorySyncStep::SKIP, DownloadStepFor(MakeObject("file", CONTENTS_SIZE, AnHourFromNow(), ContentsETag()), CONTENTS_SIZE));
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, DownloadStepFor(MakeObject("file", CONTENTS_SIZE, AnHourFromNow(), ContentsETag()), CONTENTS_SIZE - 1));
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, DownloadStepFor(MakeObject("file", CONTENTS_SIZE, AnHourFromNow(), "\"00000000000000000000000000000000\""), 1024));
+}
+
+TEST_F(DirectorySyncTest, TestDownloadTransfersObjectsWithoutLocalFiles)
+{
+    WriteFile(MakePath("b"), CONTENTS);
+    DirectorySyncSource source(TransferDirection::DOWNLOAD, m_directory, "pre/", true, 1024);
+
+    DirectorySyncEntry file;
+    ASSERT_EQ(DirectorySyncStep::WAIT_FOR_LISTING, source.Next(file));
+
+    Aws::Deque<DirectorySyncEntry> objects;
+    objects.push_back(MakeObject("a", CONTENTS_SIZE, LongAgo(), ""));
+    objects.push_back(MakeObject("b", CONTENTS_SIZE, LongAgo(), ""));
+    objects.push_back(MakeObject("c", CONTENTS_SIZE, LongAgo(), ""));
+    source.AddListedObjects(objects, true);
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, source.Next(file));
+    ASSERT_EQ("pre/a", file.key);
+    ASSERT_EQ(DirectorySyncStep::SKIP, source.Next(file));
+    ASSERT_EQ("pre/b", file.key);
+    ASSERT_EQ(DirectorySyncStep::TRANSFER, source.Next(file));
+    ASSERT_EQ("pre/c", file.key);
+    ASSERT_EQ(DirectorySyncStep::DONE, source.Next(file));
+}
+
+TEST_F(DirectorySyncTest, TestWindowStartsSmallestFirst)
+{
+    DirectorySyncWindow window(4);
+    ASSERT_TRUE(window.IsEmpty());
+    uint64_t sizes[] = { 30, 10, 20, 10 };
+    for (auto size : sizes)
+    {
+        ASSERT_FALSE(window.IsFull());
+        DirectorySyncEntry file;
+        file.size = size;
+        file.relativeKey = Aws::Utils::StringUtils::to_string(window.GetSize());
+        window.Add(std::move(file));
+    }
+    ASSERT_TRUE(window.IsFull());
+
+    // files of the same size start in the order they were added.
+    ASSERT_EQ("1", window.PeekNext().relativeKey);
+    ASSERT_EQ("1", window.TakeNext().relativeKey);
+    ASSERT_EQ("3", window.TakeNext().relativeKey);
+    ASSERT_EQ(20u, window.TakeNext().size);
+    ASSERT_EQ(30u, window.TakeNext().size);
+    ASSERT_TRUE(window.IsEmpty());
+}
+
+TEST_F(DirectorySyncTest, TestWindowDoesNotStarveLargeFiles)
+{
+    DirectorySyncWindow window(4);
+    uint64_t sizes[] = { 100, 1, 2, 3 };
+    for (auto size : sizes)
+    {
+        DirectorySyncEntry file;
+        file.size = size;
+        window.Add(std::move(file));
+    }
+
+    // smaller files keep coming, but once the large one has been passed over for four starts it goes next.
+    Aws::Vector<uint64_t> started;
+    for (uint64_t size = 10; size < 13; ++size)
+    {
+        started.push_back(window.TakeNext().size);
+        DirectorySyncEntry file;
+        file.size = size;
+        window.Add(std::move(file));
+    }
+    started.push_back(window.TakeNext().size);
+    ASSERT_EQ(100u, window.PeekNext().size);
+    started.push_back(window.TakeNext().size);
+    started.push_back(window.TakeNext().size);
+
+    Aws::Vector<uint64_t> expected = { 1, 2, 3, 10, 100, 11 };
+    ASSERT_EQ(expected, started);
+}
+
+TEST_F(DirectorySyncTest, TestWindowClear)
+{
+    DirectorySyncWindow window(1);
+    window.Add(DirectorySyncEntry());
+    ASSERT_TRUE(window.IsFull());
+    window.Clear();
+    ASSERT_TRUE(window.IsEmpty());
+    ASSERT_FALSE(window.IsFull());
+}
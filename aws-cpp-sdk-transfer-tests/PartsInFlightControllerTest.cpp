@@ -0,0 +1,216 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/transfer/PartsInFlightController.h>
+
+using namespace Aws::Transfer;
+
+namespace
+{
+    const uint64_t MB = 1024 * 1024;
+    const uint64_t PART_SIZE = 8 * MB;
+    const std::chrono::steady_clock::duration FAST_PART = std::chrono::milliseconds(100);
+
+    // Sends count full-size parts, one after another, each taking elapsed.
+    void FinishParts(PartsInFlightController& controller, size_t count, std::chrono::steady_clock::duration elapsed, bool succeeded = true)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            controller.WaitForSlot();
+            controller.OnPartFinished(PART_SIZE, elapsed, succeeded);
+        }
+    }
+
+    uint64_t PartCount(uint64_t totalSize, uint64_t partSize)
+    {
+        return (totalSize + partSize - 1) / partSize;
+    }
+}
+
+TEST(PartsInFlightControllerTest, TestStartsAtFourWithinLimits)
+{
+    ASSERT_EQ(4u, PartsInFlightController(PART_SIZE, 32).GetLimit());
+    ASSERT_EQ(2u, PartsInFlightController(PART_SIZE, 2).GetLimit());
+    ASSERT_EQ(1u, PartsInFlightController(PART_SIZE, 0).GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestDoublesEveryRoundInSlowStart)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    FinishParts(controller, 4, FAST_PART);
+    ASSERT_EQ(8u, controller.GetLimit());
+    FinishParts(controller, 8, FAST_PART);
+    ASSERT_EQ(16u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestGrowsByOnePerRoundAfterCongestion)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    FinishParts(controller, 4, FAST_PART);
+    ASSERT_EQ(8u, controller.GetLimit());
+
+    FinishParts(controller, 1, FAST_PART, false);
+    ASSERT_EQ(4u, controller.GetLimit());
+
+    // each part adds one part over the current limit, so it takes a little over a round of parts to add a whole one.
+    FinishParts(controller, 4, FAST_PART);
+    ASSERT_EQ(4u, controller.GetLimit());
+    FinishParts(controller, 1, FAST_PART);
+    ASSERT_EQ(5u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestStopsGrowingAtMaxLimit)
+{
+    PartsInFlightController controller(PART_SIZE, 10);
+    FinishParts(controller, 50, FAST_PART);
+    ASSERT_EQ(10u, controller.GetLimit());
+
+    FinishParts(controller, 1, FAST_PART, false);
+    ASSERT_EQ(5u, controller.GetLimit());
+    FinishParts(controller, 200, FAST_PART);
+    ASSERT_EQ(10u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestHalvesOncePerRound)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    FinishParts(controller, 4, FAST_PART);
+    ASSERT_EQ(8u, controller.GetLimit());
+
+    // a full round of parts is in flight when the first one fails.
+    for (size_t i = 0; i < 8; ++i)
+    {
+        controller.WaitForSlot();
+    }
+    controller.OnPartFinished(PART_SIZE, FAST_PART, false);
+    ASSERT_EQ(4u, controller.GetLimit());
+
+    // the other parts of that round fail as well, and report nothing new.
+    for (size_t i = 0; i < 7; ++i)
+    {
+        controller.OnPartFinished(PART_SIZE, FAST_PART, false);
+        ASSERT_EQ(4u, controller.GetLimit());
+    }
+
+    // a part sent after the cut fails, so it is congested still.
+    FinishParts(controller, 1, FAST_PART, false);
+    ASSERT_EQ(2u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestRetriesHalveTheLimit)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    controller.OnPartRetried();
+    ASSERT_EQ(2u, controller.GetLimit());
+
+    FinishParts(controller, 1, FAST_PART);
+    controller.OnPartRetried();
+    ASSERT_EQ(1u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestNeverDropsBelowOne)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        FinishParts(controller, 1, FAST_PART, false);
+        ASSERT_LE(1u, controller.GetLimit());
+    }
+    ASSERT_EQ(1u, controller.GetLimit());
+
+    // the one slot left can still be used.
+    controller.WaitForSlot();
+    controller.ReleaseSlot();
+}
+
+TEST(PartsInFlightControllerTest, TestSlowPartsAreCongestion)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    FinishParts(controller, 4, FAST_PART);
+    ASSERT_EQ(8u, controller.GetLimit());
+
+    // parts that take three times as long per byte as the fastest pull the average past twice the fastest on the third one.
+    FinishParts(controller, 2, 3 * FAST_PART);
+    ASSERT_EQ(10u, controller.GetLimit());
+    FinishParts(controller, 1, 3 * FAST_PART);
+    ASSERT_EQ(5u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestShortPartsAreNotMeasured)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    FinishParts(controller, 4, FAST_PART);
+    ASSERT_EQ(8u, controller.GetLimit());
+
+    // the last part of a transfer is short, and its request latency says nothing about bandwidth.
+    for (size_t i = 0; i < 8; ++i)
+    {
+        controller.WaitForSlot();
+        controller.OnPartFinished(PART_SIZE / 4, 10 * FAST_PART, true);
+    }
+    ASSERT_EQ(16u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestReleasedSlotsDoNotMoveTheLimit)
+{
+    PartsInFlightController controller(PART_SIZE, 100);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        controller.WaitForSlot();
+    }
+    for (size_t i = 0; i < 4; ++i)
+    {
+        controller.ReleaseSlot();
+    }
+    ASSERT_EQ(4u, controller.GetLimit());
+}
+
+TEST(PartsInFlightControllerTest, TestPartSizeHasFiveMBMinimum)
+{
+    ASSERT_EQ(5 * MB, ComputeAutoTunedPartSize(0, 0));
+    ASSERT_EQ(5 * MB, ComputeAutoTunedPartSize(1, 1 * MB));
+    ASSERT_EQ(5 * MB, ComputeAutoTunedPartSize(100 * MB, 1 * MB));
+    ASSERT_EQ(5 * MB, ComputeAutoTunedPartSize(5000 * MB, 5 * MB));
+    ASSERT_EQ(8 * MB, ComputeAutoTunedPartSize(100 * MB, 8 * MB));
+}
+
+TEST(PartsInFlightControllerTest, TestPartSizeAimsForAThousandParts)
+{
+    ASSERT_EQ(10 * MB, ComputeAutoTunedPartSize(10000 * MB, 5 * MB));
+    // rounded up to a whole MB.
+    ASSERT_EQ(11 * MB, ComputeAutoTunedPartSize(10000 * MB + 1000 * 1024, 5 * MB));
+    // up to 64MB, past which parts stop getting larger until the part limit forces them to.
+    ASSERT_EQ(64 * MB, ComputeAutoTunedPartSize(64000 * MB, 5 * MB));
+    ASSERT_EQ(64 * MB, ComputeAutoTunedPartSize(500000 * MB, 5 * MB));
+}
+
+TEST(PartsInFlightControllerTest, TestPartSizeStaysWithinPartLimit)
+{
+    const uint64_t atLimit = MAX_PARTS_PER_UPLOAD * 64 * MB;
+    ASSERT_EQ(64 * MB, ComputeAutoTunedPartSize(atLimit, 5 * MB));
+    ASSERT_EQ(MAX_PARTS_PER_UPLOAD, PartCount(atLimit, ComputeAutoTunedPartSize(atLimit, 5 * MB)));
+
+    ASSERT_EQ(65 * MB, ComputeAutoTunedPartSize(atLimit + 1, 5 * MB));
+    ASSERT_GE(MAX_PARTS_PER_UPLOAD, PartCount(atLimit + 1, ComputeAutoTunedPartSize(atLimit + 1, 5 * MB)));
+
+    // S3's largest object.
+    const uint64_t fiveTB = 5ull * 1024 * 1024 * MB;
+    ASSERT_GE(MAX_PARTS_PER_UPLOAD, PartCount(fiveTB, ComputeAutoTunedPartSize(fiveTB, 5 * MB)));
+    for (uint64_t totalSize = atLimit - 3; totalSize <= atLimit + 3; ++totalSize)
+    {
+        ASSERT_GE(MAX_PARTS_PER_UPLOAD, PartCount(totalSize, ComputeAutoTunedPartSize(totalSize, 5 * MB)));
+    }
+}
@@ -0,0 +1,306 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/transfer/TransferJournal.h>
+
+#include "TransferTestFiles.h"
+
+using namespace Aws::Testing;
+using namespace Aws::Transfer;
+
+namespace
+{
+    const uint64_t MB = 1024 * 1024;
+
+    // A record laid out the way the journal writes them: tab terminated fields followed by their CRC32.
+    Aws::String FormatRecord(const Aws::Vector<Aws::String>& fields)
+    {
+        Aws::String record;
+        for (const auto& field : fields)
+        {
+            record += field + "\t";
+        }
+        return record + Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateCRC32(record)) + "\n";
+    }
+
+    // An upload of 25MB in 10MB parts, so parts 1 and 2 are 10MB and part 3 is 5MB.
+    TransferJournalState MakeUploadState()
+    {
+        TransferJournalState state;
+        state.direction = TransferDirection::UPLOAD;
+        state.bucketName = "bucket";
+        state.keyName = "dir/key with\ttabs\nand newlines%";
+        state.filePath = "/tmp/some file.bin";
+        state.contentType = "application/octet-stream";
+        state.totalSize = 25 * MB;
+        state.partSize = 10 * MB;
+        state.multipartId = "upload-id";
+        state.metadata["name"] = "value&with=separators";
+        state.metadata["other"] = "";
+        state.fileLastModified = Aws::Utils::DateTime(static_cast<int64_t>(1500000000) * 1000);
+        return state;
+    }
+
+    class TransferJournalTest : public TempFilesTest
+    {
+    };
+}
+
+TEST_F(TransferJournalTest, TestCreateAndReopen)
+{
+    auto path = MakeTempFilePath();
+    auto state = MakeUploadState();
+    auto journal = TransferJournal::Create(path, state, 1);
+    ASSERT_NE(nullptr, journal);
+    ASSERT_EQ(path, journal->GetPath());
+    journal->RecordCompletedPart(1, "\"etag1\"");
+    journal->RecordCompletedPart(3, "\"etag3\"");
+    journal = nullptr;
+
+    TransferJournalState reopened;
+    journal = TransferJournal::Open(path, reopened, 1);
+    ASSERT_NE(nullptr, journal);
+    ASSERT_EQ(TransferDirection::UPLOAD, reopened.direction);
+    ASSERT_EQ(state.bucketName, reopened.bucketName);
+    ASSERT_EQ(state.keyName, reopened.keyName);
+    ASSERT_EQ(state.filePath, reopened.filePath);
+    ASSERT_EQ(state.contentType, reopened.contentType);
+    ASSERT_EQ(state.totalSize, reopened.totalSize);
+    ASSERT_EQ(state.partSize, reopened.partSize);
+    ASSERT_EQ(state.multipartId, reopened.multipartId);
+    ASSERT_EQ(state.metadata, reopened.metadata);
+    ASSERT_EQ(state.fileLastModified, reopened.fileLastModified);
+    ASSERT_EQ(2u, reopened.completedParts.size());
+    ASSERT_EQ("\"etag1\"", reopened.completedParts[1]);
+    ASSERT_EQ("\"etag3\"", reopened.completedParts[3]);
+
+    // a reopened journal appends after what is already there.
+    journal->RecordCompletedPart(2, "\"etag2\"");
+    journal = nullptr;
+    journal = TransferJournal::Open(path, reopened, 1);
+    ASSERT_NE(nullptr, journal);
+    ASSERT_EQ(3u, reopened.completedParts.size());
+    ASSERT_EQ("\"etag2\"", reopened.completedParts[2]);
+}
+
+TEST_F(TransferJournalTest, TestDownloadStateRoundTrips)
+{
+    auto path = MakeTempFilePath();
+    TransferJournalState state;
+    state.direction = TransferDirection::DOWNLOAD;
+    state.bucketName = "bucket";
+    state.keyName = "key";
+    state.filePath = "/tmp/target.bin";
+    state.totalSize = 12 * MB + 3;
+    state.partSize = 5 * MB;
+    state.versionId = "version";
+    state.objectETag = "\"object-etag\"";
+    ASSERT_NE(nullptr, TransferJournal::Create(path, state, 1));
+
+    TransferJournalState reopened;
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_EQ(TransferDirection::DOWNLOAD, reopened.direction);
+    ASSERT_EQ(state.versionId, reopened.versionId);
+    ASSERT_EQ(state.objectETag, reopened.objectETag);
+    ASSERT_TRUE(reopened.multipartId.empty());
+    ASSERT_TRUE(reopened.metadata.empty());
+    ASSERT_TRUE(reopened.completedParts.empty());
+}
+
+TEST_F(TransferJournalTest, TestPartsAreCommittedInBatches)
+{
+    auto path = MakeTempFilePath();
+    auto journal = TransferJournal::Create(path, MakeUploadState(), 2);
+    ASSERT_NE(nullptr, journal);
+    size_t beforeSyncCalls = 0;
+    journal->SetBeforeSyncCallback([&beforeSyncCalls]() { ++beforeSyncCalls; return true; });
+
+    TransferJournalState reopened;
+    journal->RecordCompletedPart(1, "\"etag1\"");
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 2));
+    ASSERT_TRUE(reopened.completedParts.empty());
+    ASSERT_EQ(0u, beforeSyncCalls);
+
+    journal->RecordCompletedPart(2, "\"etag2\"");
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 2));
+    ASSERT_EQ(2u, reopened.completedParts.size());
+    ASSERT_EQ(1u, beforeSyncCalls);
+
+    journal->RecordCompletedPart(3, "\"etag3\"");
+    ASSERT_TRUE(journal->Sync());
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 2));
+    ASSERT_EQ(3u, reopened.completedParts.size());
+    ASSERT_EQ(2u, beforeSyncCalls);
+}
+
+TEST_F(TransferJournalTest, TestFailedBeforeSyncCommitsNothing)
+{
+    auto path = MakeTempFilePath();
+    auto journal = TransferJournal::Create(path, MakeUploadState(), 2);
+    ASSERT_NE(nullptr, journal);
+    journal->SetBeforeSyncCallback([]() { return false; });
+    journal->RecordCompletedPart(1, "\"etag1\"");
+    ASSERT_FALSE(journal->Sync());
+
+    TransferJournalState reopened;
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_TRUE(reopened.completedParts.empty());
+}
+
+TEST_F(TransferJournalTest, TestTornTailIsTruncated)
+{
+    auto path = MakeTempFilePath();
+    auto journal = TransferJournal::Create(path, MakeUploadState(), 1);
+    ASSERT_NE(nullptr, journal);
+    journal->RecordCompletedPart(1, "\"etag1\"");
+    journal = nullptr;
+    auto valid = ReadFile(path);
+
+    // a crash in the middle of writing the next record leaves part of it behind.
+    auto torn = FormatRecord({"PART", "2", Aws::Utils::StringUtils::to_string(10 * MB), Aws::Utils::StringUtils::to_string(10 * MB), "%22etag2%22"});
+    WriteFile(path, valid + torn.substr(0, torn.size() / 2));
+
+    TransferJournalState reopened;
+    journal = TransferJournal::Open(path, reopened, 1);
+    ASSERT_NE(nullptr, journal);
+    ASSERT_EQ(1u, reopened.completedParts.size());
+    ASSERT_EQ(valid, ReadFile(path));
+
+    // records appended after the torn one was dropped are read back.
+    journal->RecordCompletedPart(2, "\"etag2\"");
+    journal = nullptr;
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_EQ(2u, reopened.completedParts.size());
+    ASSERT_EQ("\"etag2\"", reopened.completedParts[2]);
+}
+
+TEST_F(TransferJournalTest, TestChecksumMismatchDropsTheRest)
+{
+    auto path = MakeTempFilePath();
+    auto journal = TransferJournal::Create(path, MakeUploadState(), 1);
+    ASSERT_NE(nullptr, journal);
+    journal->RecordCompletedPart(1, "\"etag1\"");
+    journal->RecordCompletedPart(2, "\"etag2\"");
+    journal->RecordCompletedPart(3, "\"etag3\"");
+    journal = nullptr;
+
+    auto contents = ReadFile(path);
+    auto corrupted = contents.find("etag2");
+    ASSERT_NE(Aws::String::npos, corrupted);
+    contents[corrupted] = 'E';
+    WriteFile(path, contents);
+
+    TransferJournalState reopened;
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_EQ(1u, reopened.completedParts.size());
+    ASSERT_EQ("\"etag1\"", reopened.completedParts[1]);
+}
+
+TEST_F(TransferJournalTest, TestPartsWithAnotherLayoutAreIgnored)
+{
+    auto path = MakeTempFilePath();
+    ASSERT_NE(nullptr, TransferJournal::Create(path, MakeUploadState(), 1));
+
+    auto ten = Aws::Utils::StringUtils::to_string(10 * MB);
+    auto twenty = Aws::Utils::StringUtils::to_string(20 * MB);
+    auto five = Aws::Utils::StringUtils::to_string(5 * MB);
+    Aws::String records;
+    records += FormatRecord({"PART", "0", "0", ten, "part-zero"});
+    records += FormatRecord({"PART", "4", "31457280", ten, "past-the-end"});
+    records += FormatRecord({"PART", "2", "0", ten, "wrong-offset"});
+    records += FormatRecord({"PART", "3", twenty, ten, "wrong-size"});
+    records += FormatRecord({"PART", "1", "0", ten});
+    records += FormatRecord({"UNKNOWN", "1", "0", ten, "unknown-record"});
+    // well formed records around the bad ones are still used.
+    records += FormatRecord({"PART", "1", "0", ten, "%22etag1%22"});
+    records += FormatRecord({"PART", "3", twenty, five, "%22etag3%22"});
+    WriteFile(path, ReadFile(path) + records);
+
+    TransferJournalState reopened;
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_EQ(2u, reopened.completedParts.size());
+    ASSERT_EQ("\"etag1\"", reopened.completedParts[1]);
+    ASSERT_EQ("\"etag3\"", reopened.completedParts[3]);
+}
+
+TEST_F(TransferJournalTest, TestOpenRequiresAValidHeader)
+{
+    TransferJournalState reopened;
+    ASSERT_EQ(nullptr, TransferJournal::Open(MakeTempFilePath(), reopened, 1));
+
+    auto path = MakeTempFilePath();
+    WriteFile(path, "");
+    ASSERT_EQ(nullptr, TransferJournal::Open(path, reopened, 1));
+
+    auto header = FormatRecord({"TRANSFER", "3", "UPLOAD", "bucket", "key", "file", "", "10", "5", "id", "", "", "", "0"});
+    WriteFile(path, header);
+    ASSERT_EQ(nullptr, TransferJournal::Open(path, reopened, 1));
+
+    header = FormatRecord({"TRANSFER", "2", "UPLOAD", "bucket", "key", "file", "", "10", "0", "id", "", "", "", "0"});
+    WriteFile(path, header);
+    ASSERT_EQ(nullptr, TransferJournal::Open(path, reopened, 1));
+
+    header = FormatRecord({"TRANSFER", "2", "UPLOAD", "bucket", "key", "file", "", "10", "5", "id", "", "", ""});
+    WriteFile(path, header);
+    ASSERT_EQ(nullptr, TransferJournal::Open(path, reopened, 1));
+
+    header = FormatRecord({"TRANSFER", "2", "UPLOAD", "bucket", "key", "file", "", "10", "5", "id", "", "", "", "1500000000000"});
+    WriteFile(path, header);
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_EQ(10u, reopened.totalSize);
+    ASSERT_EQ(5u, reopened.partSize);
+    ASSERT_EQ(static_cast<int64_t>(1500000000000), reopened.fileLastModified.Millis());
+}
+
+TEST_F(TransferJournalTest, TestRestartDropsCompletedParts)
+{
+    auto path = MakeTempFilePath();
+    auto journal = TransferJournal::Create(path, MakeUploadState(), 1);
+    ASSERT_NE(nullptr, journal);
+    journal->RecordCompletedPart(1, "\"etag1\"");
+
+    auto state = MakeUploadState();
+    state.multipartId = "another-upload-id";
+    state.partSize = 5 * MB;
+    ASSERT_TRUE(journal->Restart(state));
+    journal->RecordCompletedPart(5, "\"etag5\"");
+    journal = nullptr;
+
+    TransferJournalState reopened;
+    ASSERT_NE(nullptr, TransferJournal::Open(path, reopened, 1));
+    ASSERT_EQ("another-upload-id", reopened.multipartId);
+    ASSERT_EQ(5 * MB, reopened.partSize);
+    ASSERT_EQ(1u, reopened.completedParts.size());
+    ASSERT_EQ("\"etag5\"", reopened.completedParts[5]);
+}
+
+TEST_F(TransferJournalTest, TestRemoveDeletesTheJournal)
+{
+    auto path = MakeTempFilePath();
+    auto journal = TransferJournal::Create(path, MakeUploadState(), 4);
+    ASSERT_NE(nullptr, journal);
+    bool beforeSyncCalled = false;
+    journal->SetBeforeSyncCallback([&beforeSyncCalled]() { beforeSyncCalled = true; return true; });
+    journal->RecordCompletedPart(1, "\"etag1\"");
+    journal->Remove();
+    ASSERT_TRUE(beforeSyncCalled);
+
+    TransferJournalState reopened;
+    ASSERT_EQ(nullptr, TransferJournal::Open(path, reopened, 1));
+}
@@ -0,0 +1,520 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/stream/FileRangeStreamBuf.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/s3/S3Client.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
+#include <aws/s3/model/ListPartsRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/transfer/TransferJournal.h>
+#include <aws/transfer/TransferManager.h>
+
+#include "TransferTestFiles.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+
+using namespace Aws::Testing;
+using namespace Aws::S3;
+using namespace Aws::S3::Model;
+using namespace Aws::Transfer;
+
+namespace
+{
+    const char* ALLOCATION_TAG = "TransferManagerMockS3Tests";
+    const char* TEST_BUCKET = "bucket";
+    const char* TEST_KEY = "key";
+    const uint64_t MB = 1024 * 1024;
+
+    /**
+     * Serves a single object from memory, uploaded to it in parts, and counts the calls made for it. Async part uploads run on uploadExecutor,
+     * which has to be drained before the client is released.
+     */
+    class MockS3Client : public S3Client
+    {
+    public:
+        MockS3Client(Aws::Utils::Threading::Executor* uploadExecutor) : S3Client(Aws::Auth::AWSCredentials("access", "secret"), Aws::Client::ClientConfiguration()), m_getObjectCalls(0),
+            m_failGetObjectFrom(static_cast<size_t>(-1)), m_abortExpected(false), m_abortCalls(0), m_uploadExecutor(uploadExecutor)
+        {
+        }
+
+        void SetObject(const Aws::String& data)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_object = data;
+        }
+
+        HeadObjectOutcome HeadObject(const HeadObjectRequest&) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            HeadObjectResult result;
+            result.SetContentLength(static_cast<long long>(m_object.size()));
+            result.SetETag("\"etag\"");
+            return result;
+        }
+
+        /**
+         * Makes ranged gets starting at or past offset fail.
+         */
+        void FailGetObjectFrom(size_t offset)
+        {
+            m_failGetObjectFrom = offset;
+        }
+
+        /**
+         * Adds a part to the multi-part upload, as if it had been uploaded before.
+         */
+        void SetUploadedPart(int partNumber, const Aws::String& data)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_uploadedParts[partNumber] = data;
+        }
+
+        Aws::String GetObjectData() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_object;
+        }
+
+        Aws::Map<int, size_t> GetUploadPartSizes() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_uploadPartSizes;
+        }
+
+        UploadPartOutcome UploadPart(const UploadPartRequest& request) const override
+        {
+            Aws::String data((Aws::IStreamBufIterator(*request.GetBody())), Aws::IStreamBufIterator());
+            EXPECT_EQ(request.GetContentLength(), static_cast<long long>(data.size()));
+            if (request.GetDataSentEventHandler())
+            {
+                request.GetDataSentEventHandler()(nullptr, static_cast<long long>(data.size()));
+            }
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_uploadPartSizes[request.GetPartNumber()] = data.size();
+            m_uploadedParts[request.GetPartNumber()] = data;
+            UploadPartResult result;
+            result.SetETag(PartETag(request.GetPartNumber()));
+            return result;
+        }
+
+        // the generated operation sends the request itself instead of calling UploadPart, so route it to the mocked one.
+        void UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            m_uploadExecutor->Submit([this, request, handler, context]() { handler(this, request, UploadPart(request), context); });
+        }
+
+        ListPartsOutcome ListParts(const ListPartsRequest&) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            ListPartsResult result;
+            for (const auto& uploadedPart : m_uploadedParts)
+            {
+                Part part;
+                part.SetPartNumber(uploadedPart.first);
+                part.SetETag(PartETag(uploadedPart.first));
+                part.SetSize(static_cast<long long>(uploadedPart.second.size()));
+                result.AddParts(part);
+            }
+            return result;
+        }
+
+        CompleteMultipartUploadOutcome CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_object.clear();
+            for (const auto& part : request.GetMultipartUpload().GetParts())
+            {
+                EXPECT_EQ(PartETag(part.GetPartNumber()), part.GetETag());
+                m_object += m_uploadedParts[part.GetPartNumber()];
+            }
+            return CompleteMultipartUploadResult();
+        }
+
+        CreateMultipartUploadOutcome CreateMultipartUpload(const CreateMultipartUploadRequest&) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_uploadedParts.clear();
+            CreateMultipartUploadResult result;
+            result.SetUploadId("new-upload-id");
+            return result;
+        }
+
+        /**
+         * Allows the multi-part upload to be aborted, which fails the test otherwise.
+         */
+        void ExpectAbort()
+        {
+            m_abortExpected = true;
+        }
+
+        AbortMultipartUploadOutcome AbortMultipartUpload(const AbortMultipartUploadRequest&) const override
+        {
+            EXPECT_TRUE(m_abortExpected) << "The multi-part upload was not expected to be aborted.";
+            ++m_abortCalls;
+            return AbortMultipartUploadResult();
+        }
+
+        size_t GetAbortCalls() const { return m_abortCalls; }
+
+        static Aws::String PartETag(int partNumber)
+        {
+            return "\"etag" + Aws::Utils::StringUtils::to_string(partNumber) + "\"";
+        }
+
+        GetObjectOutcome GetObject(const GetObjectRequest& request) const override
+        {
+            ++m_getObjectCalls;
+            Aws::String data;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                data = m_object;
+            }
+
+            size_t rangeBegin = 0;
+            size_t rangeEnd = data.size() - 1;
+            if (!request.GetRange().empty())
+            {
+                unsigned long long begin = 0;
+                unsigned long long end = 0;
+                EXPECT_EQ(2, sscanf(request.GetRange().c_str(), "bytes=%llu-%llu", &begin, &end));
+                rangeBegin = static_cast<size_t>(begin);
+                rangeEnd = static_cast<size_t>(end);
+            }
+            if (rangeBegin >= m_failGetObjectFrom)
+            {
+                return GetObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::INTERNAL_FAILURE, "InternalError", "Injected failure.", false));
+            }
+
+            Aws::Utils::Stream::ResponseStream responseStream(request.GetResponseStreamFactory());
+            responseStream.GetUnderlyingStream().write(data.c_str() + rangeBegin, rangeEnd - rangeBegin + 1);
+            if (request.GetDataReceivedEventHandler())
+            {
+                request.GetDataReceivedEventHandler()(nullptr, nullptr, static_cast<long long>(rangeEnd - rangeBegin + 1));
+            }
+
+            Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream> awsStream(std::move(responseStream), Aws::Http::HeaderValueCollection());
+            GetObjectResult result(std::move(awsStream));
+            result.SetContentLength(static_cast<long long>(rangeEnd - rangeBegin + 1));
+            result.SetETag("\"etag\"");
+            return GetObjectOutcome(std::move(result));
+        }
+
+        size_t GetGetObjectCalls() const { return m_getObjectCalls; }
+
+    private:
+        mutable std::mutex m_lock;
+        mutable std::atomic<size_t> m_getObjectCalls;
+        std::atomic<size_t> m_failGetObjectFrom;
+        std::atomic<bool> m_abortExpected;
+        mutable std::atomic<size_t> m_abortCalls;
+        mutable Aws::String m_object;
+        mutable Aws::Map<int, Aws::String> m_uploadedParts;
+        mutable Aws::Map<int, size_t> m_uploadPartSizes;
+        Aws::Utils::Threading::Executor* m_uploadExecutor;
+    };
+
+    Aws::String MakeContent(size_t size)
+    {
+        Aws::String content(size, 'a');
+        for (size_t i = 0; i < size; ++i)
+        {
+            content[i] = static_cast<char>('a' + (i * 7 + i / 13) % 26);
+        }
+        return content;
+    }
+
+    bool FileExists(const Aws::String& path)
+    {
+        Aws::IFStream file(path.c_str(), std::ios_base::in | std::ios_base::binary);
+        return file.good();
+    }
+
+    class TransferManagerMockS3Tests : public TempFilesTest
+    {
+    protected:
+        void SetUp() override
+        {
+            m_s3Executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 4);
+            m_s3Client = Aws::MakeShared<MockS3Client>(ALLOCATION_TAG, m_s3Executor.get());
+            m_executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, 4);
+        }
+
+        void TearDown() override
+        {
+            TempFilesTest::TearDown();
+            // a response handler still running may release the last reference to the transfer manager, and with it the client.
+            m_s3Executor = nullptr;
+            m_executor = nullptr;
+            m_s3Client = nullptr;
+        }
+
+        TransferManagerConfiguration MakeConfiguration()
+        {
+            TransferManagerConfiguration config(m_executor.get());
+            config.s3Client = m_s3Client;
+            return config;
+        }
+
+        std::shared_ptr<MockS3Client> m_s3Client;
+        std::shared_ptr<Aws::Utils::Threading::PooledThreadExecutor> m_executor;
+        std::shared_ptr<Aws::Utils::Threading::PooledThreadExecutor> m_s3Executor;
+    };
+}
+
+TEST_F(TransferManagerMockS3Tests, FileBackedDownloadWritesToTargetFile)
+{
+    auto content = MakeContent(static_cast<size_t>(12 * MB + 3));
+    m_s3Client->SetObject(content);
+    auto config = MakeConfiguration();
+    config.fileBackedDownloads = true;
+    auto transferManager = TransferManager::Create(config);
+
+    auto targetPath = MakeTempFilePath();
+    auto handle = transferManager->DownloadFile(TEST_BUCKET, TEST_KEY, targetPath);
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_TRUE(handle->IsMultipart());
+    ASSERT_TRUE(handle->IsDownloadingToTargetFile());
+    ASSERT_EQ(3u, m_s3Client->GetGetObjectCalls());
+    ASSERT_TRUE(ReadFile(targetPath) == content);
+}
+
+TEST_F(TransferManagerMockS3Tests, FileBackedDownloadKeepsCustomStream)
+{
+    auto content = MakeContent(static_cast<size_t>(12 * MB + 3));
+    m_s3Client->SetObject(content);
+    auto config = MakeConfiguration();
+    config.fileBackedDownloads = true;
+    auto transferManager = TransferManager::Create(config);
+
+    // the caller's stream writes somewhere else than the target file path it also passed.
+    auto targetPath = MakeTempFilePath();
+    auto streamPath = MakeTempFilePath();
+    CreateDownloadStreamCallback createStream = [streamPath]()
+    {
+        return Aws::New<Aws::FStream>(ALLOCATION_TAG, streamPath.c_str(), std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);
+    };
+    auto handle = transferManager->DownloadFile(TEST_BUCKET, TEST_KEY, createStream, DownloadConfiguration(), targetPath);
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_TRUE(handle->IsMultipart());
+    ASSERT_FALSE(handle->IsDownloadingToTargetFile());
+    ASSERT_TRUE(ReadFile(targetPath).empty());
+    handle = nullptr;
+    ASSERT_TRUE(ReadFile(streamPath) == content);
+}
+
+TEST_F(TransferManagerMockS3Tests, FileBackedUploadSendsEachPartsRangeOfTheFile)
+{
+    auto content = MakeContent(static_cast<size_t>(12 * MB + 3));
+    auto filePath = MakeTempFilePath();
+    WriteFile(filePath, content);
+    auto config = MakeConfiguration();
+    config.fileBackedUploads = true;
+    auto transferManager = TransferManager::Create(config);
+
+    auto handle = transferManager->UploadFile(filePath, TEST_BUCKET, TEST_KEY, "text/plain", Aws::Map<Aws::String, Aws::String>());
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_TRUE(handle->IsMultipart());
+    auto partSizes = m_s3Client->GetUploadPartSizes();
+    ASSERT_EQ(3u, partSizes.size());
+    ASSERT_EQ(static_cast<size_t>(5 * MB), partSizes[1]);
+    ASSERT_EQ(static_cast<size_t>(5 * MB), partSizes[2]);
+    ASSERT_EQ(static_cast<size_t>(2 * MB + 3), partSizes[3]);
+    // the parts are put together in order on completion, so each part must have read its own range of the file.
+    ASSERT_TRUE(m_s3Client->GetObjectData() == content);
+}
+
+TEST_F(TransferManagerMockS3Tests, ResumeBufferedUploadWithPartsLargerThanBuffers)
+{
+    auto content = MakeContent(static_cast<size_t>(25 * MB));
+    auto filePath = MakeTempFilePath();
+    WriteFile(filePath, content);
+
+    // the upload was journaled with 10MB parts, twice the 5MB transfer buffers of the transfer manager resuming it.
+    TransferJournalState state;
+    state.direction = TransferDirection::UPLOAD;
+    state.bucketName = TEST_BUCKET;
+    state.keyName = TEST_KEY;
+    state.filePath = filePath;
+    state.totalSize = content.size();
+    state.partSize = 10 * MB;
+    state.multipartId = "upload-id";
+    ASSERT_TRUE(Aws::Utils::Stream::ReadOnlyFile(filePath).GetLastModified(state.fileLastModified));
+    auto journalPath = MakeTempFilePath();
+    auto journal = TransferJournal::Create(journalPath, state, 1);
+    ASSERT_NE(nullptr, journal);
+    journal->RecordCompletedPart(1, MockS3Client::PartETag(1));
+    journal = nullptr;
+    m_s3Client->SetUploadedPart(1, content.substr(0, static_cast<size_t>(10 * MB)));
+
+    auto config = MakeConfiguration();
+    ASSERT_FALSE(config.fileBackedUploads);
+    ASSERT_EQ(5 * MB, config.bufferSize);
+    auto transferManager = TransferManager::Create(config);
+    auto handle = transferManager->ResumeTransfer(journalPath);
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(10 * MB, handle->GetPartSize());
+    auto uploadPartSizes = m_s3Client->GetUploadPartSizes();
+    ASSERT_EQ(2u, uploadPartSizes.size());
+    ASSERT_EQ(10 * MB, uploadPartSizes[2]);
+    ASSERT_EQ(5 * MB, uploadPartSizes[3]);
+    ASSERT_TRUE(m_s3Client->GetObjectData() == content);
+    ASSERT_FALSE(FileExists(journalPath));
+}
+
+TEST_F(TransferManagerMockS3Tests, ResumeUploadStartsOverIfFileWasRewritten)
+{
+    auto content = MakeContent(static_cast<size_t>(12 * MB));
+    auto filePath = MakeTempFilePath();
+    WriteFile(filePath, content);
+
+    // the file kept its size, but was written after the upload was journaled with the old content of its first part.
+    TransferJournalState state;
+    state.direction = TransferDirection::UPLOAD;
+    state.bucketName = TEST_BUCKET;
+    state.keyName = TEST_KEY;
+    state.filePath = filePath;
+    state.totalSize = content.size();
+    state.partSize = 5 * MB;
+    state.multipartId = "upload-id";
+    Aws::Utils::DateTime lastModified;
+    ASSERT_TRUE(Aws::Utils::Stream::ReadOnlyFile(filePath).GetLastModified(lastModified));
+    state.fileLastModified = lastModified - std::chrono::seconds(10);
+    auto journalPath = MakeTempFilePath();
+    auto journal = TransferJournal::Create(journalPath, state, 1);
+    ASSERT_NE(nullptr, journal);
+    journal->RecordCompletedPart(1, MockS3Client::PartETag(1));
+    journal = nullptr;
+    m_s3Client->SetUploadedPart(1, Aws::String(static_cast<size_t>(5 * MB), 'x'));
+    m_s3Client->ExpectAbort();
+
+    auto transferManager = TransferManager::Create(MakeConfiguration());
+    auto handle = transferManager->ResumeTransfer(journalPath);
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(1u, m_s3Client->GetAbortCalls());
+    ASSERT_EQ(3u, m_s3Client->GetUploadPartSizes().size());
+    ASSERT_TRUE(m_s3Client->GetObjectData() == content);
+}
+
+TEST_F(TransferManagerMockS3Tests, ResumeDownloadKeepsJournaledParts)
+{
+    auto content = MakeContent(static_cast<size_t>(12 * MB + 3));
+    m_s3Client->SetObject(content);
+
+    // part 1 made it to the file before the process stopped, the rest of the file was allocated but never written.
+    auto targetPath = MakeTempFilePath();
+    WriteFile(targetPath, content.substr(0, static_cast<size_t>(5 * MB)) + Aws::String(content.size() - static_cast<size_t>(5 * MB), '\0'));
+
+    TransferJournalState state;
+    state.direction = TransferDirection::DOWNLOAD;
+    state.bucketName = TEST_BUCKET;
+    state.keyName = TEST_KEY;
+    state.filePath = targetPath;
+    state.totalSize = content.size();
+    state.partSize = 5 * MB;
+    state.objectETag = "\"etag\"";
+    auto journalPath = MakeTempFilePath();
+    auto journal = TransferJournal::Create(journalPath, state, 1);
+    ASSERT_NE(nullptr, journal);
+    journal->RecordCompletedPart(1, "\"etag\"");
+    journal = nullptr;
+
+    auto transferManager = TransferManager::Create(MakeConfiguration());
+    auto handle = transferManager->ResumeTransfer(journalPath);
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(2u, m_s3Client->GetGetObjectCalls());
+    ASSERT_TRUE(ReadFile(targetPath) == content);
+    ASSERT_FALSE(FileExists(journalPath));
+}
+
+TEST_F(TransferManagerMockS3Tests, DownloadThatCannotOpenTargetFileRemovesJournal)
+{
+    m_s3Client->SetObject(MakeContent(static_cast<size_t>(12 * MB + 3)));
+    auto config = MakeConfiguration();
+    config.fileBackedDownloads = true;
+    config.journalDirectory = MakeTempDirectoryPath();
+    auto transferManager = TransferManager::Create(config);
+
+    // a directory can't be opened for writing.
+    auto targetPath = MakeTempDirectoryPath();
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(targetPath.c_str()));
+    auto handle = transferManager->DownloadFile(TEST_BUCKET, TEST_KEY, targetPath);
+    handle->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::FAILED, handle->GetStatus());
+    ASSERT_EQ(0u, m_s3Client->GetGetObjectCalls());
+    ASSERT_EQ(nullptr, handle->GetJournal());
+    auto journalDirectory = Aws::FileSystem::OpenDirectory(config.journalDirectory);
+    ASSERT_TRUE(journalDirectory && *journalDirectory);
+    ASSERT_FALSE(journalDirectory->Next());
+}
+
+TEST_F(TransferManagerMockS3Tests, OnlyFileBackedDownloadsAreJournaled)
+{
+    auto content = MakeContent(static_cast<size_t>(12 * MB + 3));
+    m_s3Client->SetObject(content);
+    m_s3Client->FailGetObjectFrom(static_cast<size_t>(10 * MB));
+    auto config = MakeConfiguration();
+    config.journalDirectory = MakeTempDirectoryPath();
+
+    auto transferManager = TransferManager::Create(config);
+    auto handle = transferManager->DownloadFile(TEST_BUCKET, TEST_KEY, MakeTempFilePath());
+    handle->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::FAILED, handle->GetStatus());
+    ASSERT_EQ(nullptr, handle->GetJournal());
+
+    config.fileBackedDownloads = true;
+    transferManager = TransferManager::Create(config);
+    handle = transferManager->DownloadFile(TEST_BUCKET, TEST_KEY, MakeTempFilePath());
+    handle->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::FAILED, handle->GetStatus());
+    ASSERT_NE(nullptr, handle->GetJournal());
+    ASSERT_TRUE(FileExists(handle->GetJournalPath()));
+
+    // the journal picks the download up where it failed.
+    m_s3Client->FailGetObjectFrom(static_cast<size_t>(-1));
+    auto resumed = transferManager->ResumeTransfer(handle->GetJournalPath());
+    resumed->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, resumed->GetStatus());
+    ASSERT_TRUE(ReadFile(handle->GetTargetFilePath()) == content);
+}
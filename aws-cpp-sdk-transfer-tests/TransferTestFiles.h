@@ -0,0 +1,78 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/external/gtest.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/UUID.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <fstream>
+
+namespace Aws
+{
+namespace Testing
+{
+    inline Aws::String ReadFile(const Aws::String& path)
+    {
+        Aws::IFStream file(path.c_str(), std::ios_base::in | std::ios_base::binary);
+        return Aws::String((Aws::IStreamBufIterator(file)), Aws::IStreamBufIterator());
+    }
+
+    inline void WriteFile(const Aws::String& path, const Aws::String& contents)
+    {
+        Aws::OFStream file(path.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        file << contents;
+    }
+
+    /**
+     * Fixture handing out unique paths under the temp directory, whatever the test left at them is deleted on tear down.
+     */
+    class TempFilesTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            for (const auto& path : m_files)
+            {
+                Aws::FileSystem::RemoveFileIfExists(path.c_str());
+            }
+            for (const auto& path : m_directories)
+            {
+                Aws::FileSystem::DeepDeleteDirectory(path.c_str());
+            }
+        }
+
+        Aws::String MakeTempFilePath()
+        {
+            m_files.push_back(Aws::FileSystem::CreateTempFilePath() + Aws::String(Aws::Utils::UUID::RandomUUID()));
+            return m_files.back();
+        }
+
+        Aws::String MakeTempDirectoryPath()
+        {
+            m_directories.push_back(Aws::FileSystem::CreateTempFilePath() + Aws::String(Aws::Utils::UUID::RandomUUID()));
+            return m_directories.back();
+        }
+
+    private:
+        Aws::Vector<Aws::String> m_files;
+        Aws::Vector<Aws::String> m_directories;
+    };
+} // namespace Testing
+} // namespace Aws
@@ -759,6 +759,62 @@ TEST_F(TransferTests, TransferManager_DirectoryUploadAndDownloadTest)
     ASSERT_EQ(1u, m_s3Client->listObjectsV2RequestCount);
 }
 
+TEST_F(TransferTests, TransferManager_DirectoryTransferStatusTest)
+{
+    const Aws::String RandomFileName = Aws::Utils::UUID::RandomUUID();
+    auto uploadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), RandomFileName + "dirUpload");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(uploadDir.c_str()));
+    auto smallTestFileName = Aws::FileSystem::Join(uploadDir, RandomFileName + "SmallTransferTestFile.txt");
+    auto emptyTestFileName = Aws::FileSystem::Join(uploadDir, RandomFileName + "EmptyTransferTestFile.txt");
+    auto nestedDirectory = Aws::FileSystem::Join(uploadDir, RandomFileName + "nested");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(nestedDirectory.c_str()));
+    auto nestedFileName = Aws::FileSystem::Join(nestedDirectory, RandomFileName + "nestedFile");
+
+    ScopedTestFile smallFile(smallTestFileName, SMALL_TEST_SIZE, testString);
+    ScopedTestFile emptyFile(emptyTestFileName, 0, testString);
+    ScopedTestFile nestedFile(nestedFileName, CONTENT_TEST_FILE_TEXT);
+
+    Aws::Vector<Aws::String> uploadedKeys;
+    std::mutex keysLock;
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    transferManagerConfig.transferInitiatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            std::lock_guard<std::mutex> locker(keysLock);
+            if (handle->GetTransferDirection() == TransferDirection::UPLOAD)
+            {
+                uploadedKeys.push_back(handle->GetKey());
+            }
+        };
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    auto directoryUpload = transferManager->StartUploadDirectory(uploadDir, GetTestBucketName(), "statusTest", Aws::Map<Aws::String, Aws::String>());
+    ASSERT_EQ(TransferDirection::UPLOAD, directoryUpload->GetTransferDirection());
+    directoryUpload->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryUpload->GetStatus());
+    ASSERT_EQ(3u, directoryUpload->GetFilesCompleted());
+    ASSERT_EQ(0u, directoryUpload->GetFilesInFlight());
+
+    ASSERT_EQ(3u, uploadedKeys.size());
+    for (const auto& key : uploadedKeys)
+    {
+        ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), key.c_str()));
+    }
+
+    auto downloadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), RandomFileName + "dirDownload");
+    auto directoryDownload = transferManager->StartDownloadToDirectory(downloadDir, GetTestBucketName(), "statusTest");
+    ASSERT_EQ(TransferDirection::DOWNLOAD, directoryDownload->GetTransferDirection());
+    directoryDownload->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryDownload->GetStatus());
+    ASSERT_EQ(3u, directoryDownload->GetFilesCompleted());
+    ASSERT_EQ(0u, directoryDownload->GetFilesInFlight());
+    ASSERT_EQ(directoryDownload->GetBytesQueued(), directoryDownload->GetBytesTransferred());
+
+    Aws::FileSystem::DirectoryTree uploadTree(uploadDir);
+    Aws::FileSystem::DirectoryTree downloadTree(downloadDir);
+    ASSERT_EQ(uploadTree, downloadTree);
+}
+
 // Test of a basic multi part upload - 7.5 megs
 TEST_F(TransferTests, TransferManager_MediumTest)
 {
@@ -0,0 +1,184 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+#include <aws/transfer/TransferHandle.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <mutex>
+#include <utility>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        /**
+         * A regular file under the local directory or an object under the prefix, keyed by its path relative to the directory with '/' delimiters so
+         * that the two sides of a directory transfer can be matched up.
+         */
+        struct DirectorySyncEntry
+        {
+            DirectorySyncEntry() : size(0) {}
+
+            Aws::String relativeKey;
+            Aws::String filePath;
+            Aws::String key;
+            uint64_t size;
+            Aws::Utils::DateTime lastModified;
+            Aws::String eTag;
+        };
+
+        /**
+         * Walks the regular files under a directory in the order ListObjectsV2 returns their keys, i.e. by relative path compared byte-wise. The
+         * entries of a directory are read and sorted when the walk enters it, a sub directory sorting as if its name ended with '/', so only the
+         * directories on the current path are held in memory.
+         */
+        class AWS_TRANSFER_API SortedDirectoryWalker
+        {
+        public:
+            SortedDirectoryWalker(const Aws::String& directory);
+
+            /**
+             * Fills in relativeKey, filePath, size and lastModified of the next file. Returns false once all files were walked.
+             */
+            bool Next(DirectorySyncEntry& file);
+
+        private:
+            struct Child
+            {
+                Aws::String name;
+                Aws::String sortName;
+                bool isDirectory;
+                uint64_t size;
+                Aws::Utils::DateTime lastModified;
+            };
+
+            struct Level
+            {
+                Aws::String path;
+                Aws::String relativeKey;
+                Aws::Vector<Child> children;
+                size_t next;
+            };
+
+            void EnterDirectory(const Aws::String& path, const Aws::String& relativeKey);
+
+            Aws::Vector<Level> m_levels;
+        };
+
+        enum class DirectorySyncStep
+        {
+            TRANSFER,
+            SKIP,
+            WAIT_FOR_LISTING,
+            DONE
+        };
+
+        /**
+         * The source side of an UploadDirectory or DownloadToDirectory operation, the local directory for uploads and the listing for downloads.
+         * If unchanged files are skipped, each file is matched with its counterpart on the destination side, which is up to date if it has the
+         * same size and either is at least as new as the source, or its ETag is the MD5 of the local file (only hashed up to maxHashedFileSize).
+         * Uploads that don't skip unchanged files never need the listing.
+         */
+        class AWS_TRANSFER_API DirectorySyncSource
+        {
+        public:
+            /**
+             * listPrefix is prepended to the relative keys of the files uploaded.
+             */
+            DirectorySyncSource(TransferDirection direction, const Aws::String& directory, const Aws::String& listPrefix, bool skipUnchanged, uint64_t maxHashedFileSize);
+
+            /**
+             * Takes the next file of the source side. WAIT_FOR_LISTING means it can't tell until more of the listing arrives. Only one thread at a
+             * time may call it, and it may hash a local file before it returns.
+             */
+            DirectorySyncStep Next(DirectorySyncEntry& file);
+
+            /**
+             * Appends the next page of the listing, objects sorted by relativeKey. listingDone is set once that was the last page, or listing failed.
+             */
+            void AddListedObjects(Aws::Deque<DirectorySyncEntry>& objects, bool listingDone);
+
+            /**
+             * Whether the listing isn't done and fewer than prefetchKeys of the listed objects are still waiting to be taken.
+             */
+            bool NeedsListing(size_t prefetchKeys) const;
+
+        private:
+            bool IsUpToDate(const DirectorySyncEntry& localFile, const DirectorySyncEntry& object) const;
+
+            const TransferDirection m_direction;
+            const Aws::String m_listPrefix;
+            const bool m_skipUnchanged;
+            const uint64_t m_maxHashedFileSize;
+
+            Aws::UniquePtr<SortedDirectoryWalker> m_walker;
+            DirectorySyncEntry m_localFile;
+            bool m_hasLocalFile;
+
+            mutable std::mutex m_lock;
+            Aws::Deque<DirectorySyncEntry> m_listedObjects;
+            bool m_listingDone;
+        };
+
+        /**
+         * The bounded window of files of a directory transfer that are waiting to start. Files start smallest first, so that many small files
+         * don't queue up behind a large one, unless the oldest file has been passed over for a whole window's worth of starts. Not thread safe.
+         */
+        class AWS_TRANSFER_API DirectorySyncWindow
+        {
+        public:
+            DirectorySyncWindow(size_t capacity);
+
+            inline bool IsFull() const { return m_files.size() >= m_capacity; }
+            inline bool IsEmpty() const { return m_files.empty(); }
+            inline size_t GetSize() const { return m_files.size(); }
+
+            void Add(DirectorySyncEntry&& file);
+            /**
+             * The file to start next. The window must not be empty.
+             */
+            const DirectorySyncEntry& PeekNext() const;
+            /**
+             * Removes the file PeekNext() returns, counting it as started.
+             */
+            DirectorySyncEntry TakeNext();
+            void Clear();
+
+        private:
+            struct WindowedFile
+            {
+                DirectorySyncEntry file;
+                uint64_t queuedAt;
+            };
+
+            Aws::Map<uint64_t, WindowedFile>::const_iterator FindNext() const;
+
+            const size_t m_capacity;
+            // by the order the files were added, and by size.
+            Aws::Map<uint64_t, WindowedFile> m_files;
+            Aws::Set<std::pair<uint64_t, uint64_t>> m_filesBySize;
+            uint64_t m_nextSequence;
+            uint64_t m_filesStarted;
+        };
+    }
+}
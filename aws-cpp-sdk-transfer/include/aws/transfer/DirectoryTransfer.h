@@ -0,0 +1,193 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+#include <aws/transfer/TransferHandle.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        /**
+         * Tracks an UploadDirectory or DownloadToDirectory operation as a whole. TransferManager feeds the files it finds to per-file transfers a
+         * bounded number at a time; this object keeps the aggregate counts, the files currently in flight and the overall status, and computes the
+         * throughput of the operation so far. Each file still gets its own TransferHandle, passed to the transferInitiatedCallback.
+         */
+        class AWS_TRANSFER_API DirectoryTransfer
+        {
+        public:
+            DirectoryTransfer(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix);
+
+            /**
+             * Whether this is an UploadDirectory or a DownloadToDirectory operation.
+             */
+            inline TransferDirection GetTransferDirection() const { return m_direction; }
+            /**
+             * Local directory being uploaded or downloaded to.
+             */
+            inline const Aws::String& GetDirectory() const { return m_directory; }
+            /**
+             * Bucket being uploaded or downloaded from.
+             */
+            inline const Aws::String& GetBucketName() const { return m_bucketName; }
+            /**
+             * Key prefix of the objects in the bucket.
+             */
+            inline const Aws::String& GetPrefix() const { return m_prefix; }
+
+            /**
+             * IN_PROGRESS until every file found has been transferred or skipped. Then COMPLETED if all of them succeeded, CANCELED if Cancel() was
+             * called, and FAILED if a file transfer failed or the bucket couldn't be listed.
+             */
+            TransferStatus GetStatus() const;
+            /**
+             * Sets the status of the operation. Waiters are released once it is a finished status. Mostly for internal use.
+             */
+            void UpdateStatus(TransferStatus value);
+            /**
+             * Blocks until the operation is finished.
+             */
+            void WaitUntilFinished() const;
+
+            /**
+             * Stops starting new file transfers and cancels the ones in flight.
+             */
+            void Cancel();
+            /**
+             * False once Cancel() was called.
+             */
+            inline bool ShouldContinue() const { return !m_cancel.load(); }
+
+            /**
+             * Number of files found so far that need to be transferred, including those already started.
+             */
+            inline uint64_t GetFilesQueued() const { return m_filesQueued.load(); }
+            /**
+             * Total size of the files found so far that need to be transferred.
+             */
+            inline uint64_t GetBytesQueued() const { return m_bytesQueued.load(); }
+            /**
+             * Records a file that needs to be transferred.
+             */
+            void AddQueuedFile(uint64_t size);
+
+            /**
+             * Number of files left alone because their destination was already up to date.
+             */
+            inline uint64_t GetFilesSkipped() const { return m_filesSkipped.load(); }
+            /**
+             * Total size of the files left alone because their destination was already up to date.
+             */
+            inline uint64_t GetBytesSkipped() const { return m_bytesSkipped.load(); }
+            /**
+             * Records a file whose destination was already up to date.
+             */
+            void AddSkippedFile(uint64_t size);
+
+            /**
+             * Number of file transfers that finished with COMPLETED.
+             */
+            inline uint64_t GetFilesCompleted() const { return m_filesCompleted.load(); }
+            /**
+             * Number of file transfers that finished with any other status.
+             */
+            inline uint64_t GetFilesFailed() const { return m_filesFailed.load(); }
+
+            /**
+             * Number of file transfers started and not finished yet.
+             */
+            size_t GetFilesInFlight() const;
+            /**
+             * Total size of the file transfers started and not finished yet.
+             */
+            uint64_t GetBytesInFlight() const;
+            /**
+             * Tracks a started file transfer of size bytes until it finishes. Returns false if it had already finished, in which case it is counted
+             * right away.
+             */
+            bool AddInFlightFile(const std::shared_ptr<TransferHandle>& handle, uint64_t size);
+            /**
+             * Counts a tracked file transfer once it reached a finished status. Returns false if the transfer isn't finished or isn't tracked
+             * (any more).
+             */
+            bool RemoveInFlightFile(const TransferHandle& handle);
+
+            /**
+             * Called after RemoveInFlightFile() counted a finished file transfer, to start the next files. Mostly for internal use.
+             */
+            std::function<void()> GetFileFinishedCallback() const;
+            /**
+             * Sets the function called after a file transfer finished. Mostly for internal use.
+             */
+            void SetFileFinishedCallback(const std::function<void()>& value);
+
+            /**
+             * Bytes moved so far by the file transfers, including the progress of the ones in flight.
+             */
+            uint64_t GetBytesTransferred() const;
+            /**
+             * Time since the operation started, up to when it finished.
+             */
+            std::chrono::milliseconds GetElapsedTime() const;
+            /**
+             * Average bytes per second moved so far (GetBytesTransferred() over GetElapsedTime()).
+             */
+            double GetThroughput() const;
+
+        private:
+            struct InFlightFile
+            {
+                std::shared_ptr<TransferHandle> handle;
+                uint64_t size;
+            };
+
+            void CountFinishedFile(const TransferHandle& handle);
+
+            TransferDirection m_direction;
+            Aws::String m_directory;
+            Aws::String m_bucketName;
+            Aws::String m_prefix;
+
+            std::atomic<bool> m_cancel;
+            std::atomic<uint64_t> m_filesQueued;
+            std::atomic<uint64_t> m_bytesQueued;
+            std::atomic<uint64_t> m_filesSkipped;
+            std::atomic<uint64_t> m_bytesSkipped;
+            std::atomic<uint64_t> m_filesCompleted;
+            std::atomic<uint64_t> m_filesFailed;
+            // bytes moved by the files that finished
+            uint64_t m_bytesFinished;
+
+            Aws::Map<Aws::String, InFlightFile> m_inFlightFiles;
+            uint64_t m_bytesInFlight;
+            std::chrono::steady_clock::time_point m_startTime;
+            std::chrono::steady_clock::time_point m_finishTime;
+            TransferStatus m_status;
+            std::function<void()> m_fileFinishedCallback;
+            mutable std::mutex m_lock;
+            mutable std::condition_variable m_waitUntilFinishedSignal;
+        };
+    }
+}
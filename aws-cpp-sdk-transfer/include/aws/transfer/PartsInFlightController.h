@@ -0,0 +1,87 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        /**
+         * S3 rejects multi-part uploads with more parts than this.
+         */
+        const uint64_t MAX_PARTS_PER_UPLOAD = 10000;
+
+        /**
+         * The part size TransferManager uses for a file backed, auto-tuned transfer of totalSize bytes: about 1,000 parts of at most 64MB each,
+         * larger if that is what it takes to stay within MAX_PARTS_PER_UPLOAD, rounded up to a whole MB, and never smaller than minPartSize
+         * or S3's 5MB minimum.
+         */
+        AWS_TRANSFER_API uint64_t ComputeAutoTunedPartSize(uint64_t totalSize, uint64_t minPartSize);
+
+        /**
+         * Limits the parts of one auto-tuned transfer in flight. The limit doubles every round of parts until the first sign of congestion,
+         * then grows by one part per round. It is halved, at most once a round, when a part fails, when a part request is retried, or when
+         * parts take more than twice as long per byte as the fastest full-size parts seen, which is where more parallel parts stop adding throughput.
+         * The limit starts at 4 parts, and stays between 1 and maxLimit.
+         */
+        class AWS_TRANSFER_API PartsInFlightController
+        {
+        public:
+            PartsInFlightController(uint64_t partSize, size_t maxLimit);
+
+            size_t GetLimit() const;
+
+            /**
+             * Blocks until another part of the transfer may be sent.
+             */
+            void WaitForSlot();
+
+            /**
+             * Gives back a slot without a measurement, e.g. for a part that was never sent or was canceled.
+             */
+            void ReleaseSlot();
+
+            /**
+             * Gives back the slot of a part that was sent, and adjusts the limit from how the part went.
+             */
+            void OnPartFinished(uint64_t bytes, std::chrono::steady_clock::duration elapsed, bool succeeded);
+
+            void OnPartRetried();
+
+        private:
+            void Decrease();
+
+            const uint64_t m_partSize;
+            const double m_maxLimit;
+            double m_limit;
+            size_t m_inFlight;
+            double m_fastestSecondsPerByte;
+            double m_averageSecondsPerByte;
+            size_t m_partsSinceDecrease;
+            size_t m_partsInFlightAtDecrease;
+            bool m_slowStart;
+            mutable std::mutex m_lock;
+            std::condition_variable m_slotFreed;
+        };
+    }
+}
@@ -38,6 +38,8 @@ namespace Aws
     namespace Transfer
     {
         class TransferHandle;
+        class TransferJournal;
+        class DirectoryTransfer;
 
         typedef std::function<Aws::IOStream*(void)> CreateDownloadStreamCallback;
 
@@ -263,6 +265,55 @@ namespace Aws
              */
             inline void SetBytesTotalSize(uint64_t value) { m_bytesTotalSize.store(value); }
 
+            /**
+             * Size of the parts of a multi-part transfer, set when its parts are created. With auto-tuning this is chosen from the object's size.
+             */
+            inline uint64_t GetPartSize() const { return m_partSize.load(); }
+            /**
+             * Size of the parts of a multi-part transfer, set when its parts are created.
+             */
+            inline void SetPartSize(uint64_t value) { m_partSize.store(value); }
+            /**
+             * If TransferManager auto-tunes this transfer, the current limit on its parts in flight at once, which follows measured part throughput.
+             * 0 if the transfer isn't auto-tuned.
+             */
+            inline size_t GetMaxPartsInFlight() const { return m_maxPartsInFlight.load(); }
+            /**
+             * If TransferManager auto-tunes this transfer, the current limit on its parts in flight at once.
+             */
+            inline void SetMaxPartsInFlight(size_t value) { m_maxPartsInFlight.store(value); }
+
+            /**
+             * The journal this transfer's progress is checkpointed to, if TransferManager journals it. Mostly for internal use.
+             */
+            inline std::shared_ptr<TransferJournal> GetJournal() const { std::lock_guard<std::mutex> locker(m_getterSetterLock); return m_journal; }
+            /**
+             * The journal this transfer's progress is checkpointed to. Mostly for internal use.
+             */
+            inline void SetJournal(const std::shared_ptr<TransferJournal>& journal) { std::lock_guard<std::mutex> locker(m_getterSetterLock); m_journal = journal; }
+            /**
+             * Location of the journal this transfer is checkpointed to, which can be passed to TransferManager::ResumeTransfer to pick the
+             * transfer up again after a restart. Empty if the transfer isn't journaled, or once it completed.
+             */
+            Aws::String GetJournalPath() const;
+            /**
+             * (Download only) Whether the download stream is the file at GetTargetFilePath(), opened by TransferManager, rather than a stream
+             * from a CreateDownloadStreamCallback that was passed in. Only then can parts be written straight into the file. Mostly for internal use.
+             */
+            inline bool IsDownloadingToTargetFile() const { return m_downloadingToTargetFile.load(); }
+            /**
+             * (Download only) Whether the download stream is the file at GetTargetFilePath(), opened by TransferManager. Mostly for internal use.
+             */
+            inline void SetDownloadingToTargetFile(bool value) { m_downloadingToTargetFile.store(value); }
+            /**
+             * The UploadDirectory or DownloadToDirectory operation this file transfer is part of, if any.
+             */
+            inline std::shared_ptr<DirectoryTransfer> GetDirectoryTransfer() const { std::lock_guard<std::mutex> locker(m_getterSetterLock); return m_directoryTransfer; }
+            /**
+             * The UploadDirectory or DownloadToDirectory operation this file transfer is part of. Mostly for internal use.
+             */
+            inline void SetDirectoryTransfer(const std::shared_ptr<DirectoryTransfer>& value) { std::lock_guard<std::mutex> locker(m_getterSetterLock); m_directoryTransfer = value; }
+
             /**
              * Bucket portion of the object location in Amazon S3.
              */
@@ -376,6 +427,9 @@ namespace Aws
             std::atomic<uint64_t> m_bytesTransferred;
             std::atomic<bool> m_lastPart;
             std::atomic<uint64_t> m_bytesTotalSize;
+            std::atomic<uint64_t> m_partSize;
+            std::atomic<size_t> m_maxPartsInFlight;
+            std::atomic<bool> m_downloadingToTargetFile;
             Aws::String m_bucket;
             Aws::String m_key;
             Aws::String m_fileName;
@@ -386,6 +440,8 @@ namespace Aws
             Aws::Client::AWSError<Aws::S3::S3Errors> m_lastError;
             std::atomic<bool> m_cancel;
             std::shared_ptr<const Aws::Client::AsyncCallerContext> m_context;
+            std::shared_ptr<TransferJournal> m_journal;
+            std::shared_ptr<DirectoryTransfer> m_directoryTransfer;
             const Utils::UUID m_handleId;
 
             CreateDownloadStreamCallback m_createDownloadStreamFn;
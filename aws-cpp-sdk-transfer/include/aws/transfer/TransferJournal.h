@@ -0,0 +1,151 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+#include <aws/transfer/TransferHandle.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            class WritableFile;
+        }
+    }
+
+    namespace Transfer
+    {
+        /**
+         * What a journal records about a multi-part transfer: enough to find the object, the local file and the multi-part upload again after
+         * a restart, how the transfer was split into parts, and the parts that were durably done.
+         */
+        struct AWS_TRANSFER_API TransferJournalState
+        {
+            TransferJournalState() : direction(TransferDirection::UPLOAD), totalSize(0), partSize(0) {}
+
+            TransferDirection direction;
+            Aws::String bucketName;
+            Aws::String keyName;
+            Aws::String filePath;
+            Aws::String contentType;
+            uint64_t totalSize;
+            uint64_t partSize;
+            /**
+             * (Upload only) the id of the multi-part upload.
+             */
+            Aws::String multipartId;
+            /**
+             * (Upload only) the metadata given to the object, to upload it again if the upload has to start over.
+             */
+            Aws::Map<Aws::String, Aws::String> metadata;
+            /**
+             * (Upload only) when the file was last written as the upload started, to detect that it changed before a resume.
+             */
+            Aws::Utils::DateTime fileLastModified;
+            /**
+             * (Download only) the version id and ETag of the object being downloaded, to detect that it changed before a resume.
+             */
+            Aws::String versionId;
+            Aws::String objectETag;
+            /**
+             * Parts that were completed, by part number, with their ETags. Part n covers [(n - 1) * partSize, min(n * partSize, totalSize)).
+             */
+            Aws::Map<int, Aws::String> completedParts;
+        };
+
+        /**
+         * An append only, on disk journal of one multi-part transfer, which lets TransferManager resume the transfer from another process.
+         *
+         * The journal starts with a header record describing the transfer, followed by one record per completed part. Each record is a line of
+         * tab separated, url encoded fields ending with the CRC32 of the record, so a record torn by a crash is detected and dropped when the
+         * journal is read back. Part records are group committed: they are held in memory and written and synced every syncBatchSize records
+         * or when Sync() is called, so a crash loses at most the last batch, whose parts are simply transferred again. The before sync callback
+         * runs before each commit, e.g. to sync a download's file first, so the journal never claims data that isn't on disk.
+         */
+        class AWS_TRANSFER_API TransferJournal
+        {
+        public:
+            ~TransferJournal();
+
+            TransferJournal(const TransferJournal&) = delete;
+            TransferJournal& operator=(const TransferJournal&) = delete;
+
+            /**
+             * Creates the journal at path, replacing any file there, and durably writes the header for state. Returns nullptr on failure.
+             */
+            static std::shared_ptr<TransferJournal> Create(const Aws::String& path, const TransferJournalState& state, size_t syncBatchSize);
+
+            /**
+             * Reads the journal at path into state and opens it to append further records, dropping a torn or corrupt tail. Returns nullptr if
+             * the file can't be read or has no valid header.
+             */
+            static std::shared_ptr<TransferJournal> Open(const Aws::String& path, TransferJournalState& state, size_t syncBatchSize);
+
+            const Aws::String& GetPath() const { return m_path; }
+
+            /**
+             * Replaces the journal's contents with a header for state, for a transfer that has to start over.
+             */
+            bool Restart(const TransferJournalState& state);
+
+            /**
+             * Records that a part completed with eTag. The record is committed with the next batch.
+             */
+            void RecordCompletedPart(int partId, const Aws::String& eTag);
+
+            /**
+             * Commits the records not yet on disk. Returns false if they couldn't be written.
+             */
+            bool Sync();
+
+            /**
+             * Closes and deletes the journal, once the transfer it describes is finished. The before sync callback runs first, so what the
+             * journal covered is on disk before the journal is gone.
+             */
+            void Remove();
+
+            void SetBeforeSyncCallback(const std::function<bool()>& callback);
+
+        private:
+            TransferJournal(const Aws::String& path, const std::shared_ptr<Aws::Utils::Stream::WritableFile>& file, uint64_t endOffset,
+                            const TransferJournalState& state, size_t syncBatchSize);
+            static std::shared_ptr<TransferJournal> MakeJournal(const Aws::String& path, const std::shared_ptr<Aws::Utils::Stream::WritableFile>& file,
+                                                               uint64_t endOffset, const TransferJournalState& state, size_t syncBatchSize);
+
+            bool Append(const Aws::String& records);
+            bool CommitLocked();
+
+            const Aws::String m_path;
+            std::shared_ptr<Aws::Utils::Stream::WritableFile> m_file;
+            uint64_t m_endOffset;
+            uint64_t m_totalSize;
+            uint64_t m_partSize;
+            const size_t m_syncBatchSize;
+            Aws::String m_pendingRecords;
+            size_t m_pendingRecordCount;
+            std::function<bool()> m_beforeSync;
+            std::mutex m_lock;
+        };
+    }
+}
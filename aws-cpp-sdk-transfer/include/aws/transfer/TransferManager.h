@@ -16,11 +16,14 @@
 #pragma once
 
 #include <aws/transfer/TransferHandle.h>
+#include <aws/transfer/TransferJournal.h>
+#include <aws/transfer/DirectoryTransfer.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/UploadPartRequest.h>
 #include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/ResourceManager.h>
 #include <aws/core/client/AsyncCallerContext.h>
@@ -32,12 +35,16 @@ namespace Aws
     namespace Transfer
     {
         class TransferManager;
+        class PartsInFlightController;
+        struct DirectorySyncContext;
+        struct DirectorySyncEntry;
 
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&)> UploadProgressCallback;
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&)> DownloadProgressCallback;
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&)> TransferStatusUpdatedCallback;
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&, const Aws::Client::AWSError<Aws::S3::S3Errors>&)> ErrorCallback;
         typedef std::function<void(const TransferManager*, const std::shared_ptr<const TransferHandle>&)> TransferInitiatedCallback;
+        typedef std::function<void(const TransferManager*, const std::shared_ptr<const DirectoryTransfer>&)> DirectoryTransferUpdatedCallback;
 
         const uint64_t MB5 = 5 * 1024 * 1024;
 
@@ -46,7 +53,9 @@ namespace Aws
          */
         struct TransferManagerConfiguration
         {
-            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5)
+            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5),
+                fileBackedUploads(false), fileBackedDownloads(false), maxFileBackedPartsInFlight(32), autoTune(false), journalSyncBatchSize(16),
+                maxDirectoryFilesInFlight(64), maxDirectoryBytesInFlight(1024 * 1024 * 1024), skipUnchangedFiles(false)
             {
             }
 
@@ -86,6 +95,62 @@ namespace Aws
              * to increase your max heap size if this is something you plan on increasing.
              */
             uint64_t bufferSize;
+            /**
+             * If true, multi-part uploads of files given by name don't copy their parts into transfer buffers. Each part is sent from a stream
+             * over its own byte range of the file instead, which the http client reads with positional reads straight into its own buffer,
+             * so parts are read in parallel and no transfer buffer is held while they are in flight. Defaults to false.
+             */
+            bool fileBackedUploads;
+            /**
+             * If true, multi-part downloads to a file path don't land their parts in transfer buffers. The file is sized up front and each
+             * ranged get writes its body straight into the file at the part's offset as it is received, so parts complete in any order
+             * without holding a buffer and without a second copy. Downloads given a CreateDownloadStreamCallback always write to its stream,
+             * even when a file path is given as well. Defaults to false.
+             */
+            bool fileBackedDownloads;
+            /**
+             * Maximum number of parts of file backed uploads and downloads in flight at once, across all transfers. This takes the place of
+             * transferBufferMaxHeapSize / bufferSize for those transfers. Defaults to 32.
+             */
+            size_t maxFileBackedPartsInFlight;
+            /**
+             * If true, multi-part transfers are tuned as they run instead of using fixed settings:
+             * the part size is picked from the object's size, growing past bufferSize as needed to stay within S3's 10,000 part limit, and each
+             * transfer's parts in flight start small, double every round until the first sign of congestion, then grow additively while parts
+             * keep completing as fast per byte as the fastest seen, and are halved when parts fail, are retried or slow down, up to
+             * transferBufferMaxHeapSize / bufferSize parts for buffered transfers or maxFileBackedPartsInFlight for file backed ones. Part sizes
+             * above bufferSize are only used for file backed transfers, as buffered parts must fit in a transfer buffer. The chosen part size and
+             * the current limit are reported on the TransferHandle. Defaults to false.
+             */
+            bool autoTune;
+            /**
+             * If set, multi-part transfers of files are journaled to a file in this directory as their parts complete (see TransferJournal),
+             * so TransferManager::ResumeTransfer can pick them up again after the process restarts. Downloads are only journaled when they are
+             * file backed (see fileBackedDownloads), as only those keep the parts already written in the file. A transfer's journal is deleted
+             * once it completes. Empty by default, which turns journaling off.
+             */
+            Aws::String journalDirectory;
+            /**
+             * Number of completed parts whose journal records are written and synced to disk together. A crash loses at most this many parts of
+             * progress. Defaults to 16.
+             */
+            size_t journalSyncBatchSize;
+            /**
+             * Maximum number of file transfers UploadDirectory and DownloadToDirectory have in flight at once. Among the files found but not started
+             * yet, the smallest go first, so that many small transfers keep the connections busy while the large ones split into parts. Defaults to 64.
+             */
+            size_t maxDirectoryFilesInFlight;
+            /**
+             * Maximum total size of the files UploadDirectory and DownloadToDirectory have in flight at once. A file larger than this is still
+             * transferred, on its own. Defaults to 1GB.
+             */
+            uint64_t maxDirectoryBytesInFlight;
+            /**
+             * If true, UploadDirectory and DownloadToDirectory leave alone the files whose destination is already up to date: the bucket is listed
+             * alongside the walk of the directory and a file is skipped if its counterpart has the same size and was modified no earlier. If only the
+             * modification time differs, a single-part file is still skipped when its MD5 matches the object's ETag. Defaults to false.
+             */
+            bool skipUnchangedFiles;
 
             /**
              * Callback to receive progress updates for uploads.
@@ -103,6 +168,10 @@ namespace Aws
              * Callback to receive initiated transfers for the directory operations.
              */
             TransferInitiatedCallback transferInitiatedCallback;
+            /**
+             * Callback to receive updates on the progress of the directory operations, as their files finish or are skipped, and once they're done.
+             */
+            DirectoryTransferUpdatedCallback directoryTransferUpdatedCallback;
             /**
              * Callback to receive all errors that are thrown over the course of a transfer.
              */
@@ -196,7 +265,8 @@ namespace Aws
             /**
              * Uploads entire contents of directory to Amazon S3 bucket and stores them in a directory starting at prefix. This is an asynchronous method. You will receive notifications
              * that an upload has started via the transferInitiatedCallback callback function in your configuration. If you do not set this callback, then you will not be able to handle
-             * the file transfers.
+             * the file transfers. The directory is walked as the uploads proceed, keeping at most maxDirectoryFilesInFlight files and
+             * maxDirectoryBytesInFlight bytes in flight.
              *
              * directory: the absolute directory on disk to upload
              * bucketName: the name of the S3 bucket to upload to
@@ -204,10 +274,17 @@ namespace Aws
              */
             void UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
 
+            /**
+             * Same as UploadDirectory, but returns a DirectoryTransfer that reports the progress of the whole operation and can cancel it.
+             */
+            std::shared_ptr<DirectoryTransfer> StartUploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix,
+                                                                    const Aws::Map<Aws::String, Aws::String>& metadata);
+
             /**
             * Downloads entire contents of an Amazon S3 bucket starting at prefix stores them in a directory (not including the prefix). This is an asynchronous method. You will receive notifications
             * that a download has started via the transferInitiatedCallback callback function in your configuration. If you do not set this callback, then you will not be able to handle
             * the file transfers. If an error occurs prior to the transfer being initiated (e.g. list objects fails, then an error will be passed through the errorCallback).
+            * The bucket is listed as the downloads proceed, keeping at most maxDirectoryFilesInFlight files and maxDirectoryBytesInFlight bytes in flight.
             *
             * directory: the absolute directory on disk to download to
             * bucketName: the name of the S3 bucket to upload to
@@ -215,6 +292,23 @@ namespace Aws
             */
             void DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
 
+            /**
+            * Same as DownloadToDirectory, but returns a DirectoryTransfer that reports the progress of the whole operation and can cancel it. If listing
+            * the objects fails, the DirectoryTransfer fails as well.
+            */
+            std::shared_ptr<DirectoryTransfer> StartDownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
+
+            /**
+             * Resumes the multi-part upload or download journaled at journalPath (see TransferHandle::GetJournalPath()), typically one left
+             * unfinished by a process that stopped. The returned handle keeps being journaled at journalPath.
+             *
+             * For an upload, the parts in the journal are checked against ListParts for its upload id and only the parts that are missing or
+             * don't match are sent again. If the upload no longer exists or the file's size changed, the file is uploaded again from the start.
+             * For a download, the object's ETag and size are checked against the journal and only the parts not in the journal are fetched. If
+             * the object or the local file changed, the download starts over.
+             */
+            std::shared_ptr<TransferHandle> ResumeTransfer(const Aws::String& journalPath, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
         private:
             /**
              * To ensure TransferManager is always created as a shared_ptr, since it inherits enable_shared_from_this.
@@ -263,15 +357,30 @@ namespace Aws
                                                          const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
 
             bool MultipartUploadSupported(uint64_t length) const;
+            uint64_t ComputePartSize(uint64_t totalSize, bool fileBacked) const;
+            bool InitializePartsForUpload(const std::shared_ptr<TransferHandle>& handle, bool fileBacked);
             bool InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle);
 
             void DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
+            void DoFileBackedMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
+            void SubmitUploadPart(const std::shared_ptr<TransferHandle>& handle, const PartPointer& partState, const std::shared_ptr<Aws::IOStream>& body, bool fileBacked,
+                                  const std::shared_ptr<PartsInFlightController>& partsInFlight);
+            std::shared_ptr<PartsInFlightController> CreatePartsInFlightController(const std::shared_ptr<TransferHandle>& handle, bool fileBacked) const;
             void DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
 
             void DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
             void DoSinglePartUpload(const std::shared_ptr<TransferHandle>& handle);
 
+            std::shared_ptr<TransferHandle> SubmitDownload(const std::shared_ptr<TransferHandle>& handle, const DownloadConfiguration& downloadConfig,
+                                                           const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
             void DoDownload(const std::shared_ptr<TransferHandle>& handle);
+            bool IsFileBackedDownload(const TransferHandle& handle) const;
+            void FinishMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
+
+            void StartJournal(const std::shared_ptr<TransferHandle>& handle, const TransferJournalState& state);
+            void CloseJournal(const std::shared_ptr<TransferHandle>& handle, bool resumable);
+            void DoResumeUpload(const std::shared_ptr<TransferHandle>& handle, const TransferJournalState& state);
+            void DoResumeDownload(const std::shared_ptr<TransferHandle>& handle, const TransferJournalState& state);
             void DoSinglePartDownload(const std::shared_ptr<TransferHandle>& handle);
 
             void HandleGetObjectResponse(const Aws::S3::S3Client* client, 
@@ -283,18 +392,29 @@ namespace Aws
 
             void HandleUploadPartResponse(const Aws::S3::S3Client*, const Aws::S3::Model::UploadPartRequest&, const Aws::S3::Model::UploadPartOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
             void HandlePutObjectResponse(const Aws::S3::S3Client*, const Aws::S3::Model::PutObjectRequest&, const Aws::S3::Model::PutObjectOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
-            void HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request&, const Aws::S3::Model::ListObjectsV2Outcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+
+            std::shared_ptr<DirectoryTransfer> StartDirectoryTransfer(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName,
+                                                                      const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
+            void PumpDirectoryTransfer(const std::shared_ptr<DirectorySyncContext>& context);
+            void SubmitPumpDirectoryTransfer(const std::shared_ptr<DirectorySyncContext>& context);
+            void StartDirectoryFile(const std::shared_ptr<DirectorySyncContext>& context, const DirectorySyncEntry& file);
+            void ReportSkippedDirectoryFile(const DirectorySyncContext& context, const DirectorySyncEntry& file);
+            void RequestDirectoryListing(const std::shared_ptr<DirectorySyncContext>& context);
+            void HandleDirectoryListObjectsResponse(const std::shared_ptr<DirectorySyncContext>& context, const Aws::S3::Model::ListObjectsV2Outcome& outcome);
+            void FinishDirectoryTransfer(const std::shared_ptr<DirectorySyncContext>& context);
 
             TransferStatus DetermineIfFailedOrCanceled(const TransferHandle&) const;
             void TriggerUploadProgressCallback(const std::shared_ptr<const TransferHandle>&) const;
             void TriggerDownloadProgressCallback(const std::shared_ptr<const TransferHandle>&) const;
             void TriggerTransferStatusUpdatedCallback(const std::shared_ptr<const TransferHandle>&) const;
+            void TriggerDirectoryTransferUpdatedCallback(const std::shared_ptr<const DirectoryTransfer>&) const;
             void TriggerErrorCallback(const std::shared_ptr<const TransferHandle>&, const Aws::Client::AWSError<Aws::S3::S3Errors>& error)const;
 
             static Aws::String DetermineFilePath(const Aws::String& directory, const Aws::String& prefix, const Aws::String& keyName);
 
             Aws::Utils::ExclusiveOwnershipResourceManager<unsigned char*> m_bufferManager;
             TransferManagerConfiguration m_transferConfig;
+            Aws::Utils::Threading::Semaphore m_fileBackedPartSlots;
         };
 
         
@@ -0,0 +1,290 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/transfer/DirectorySync.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/platform/FileSystem.h>
+#include <fstream>
+#include <algorithm>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        static const char DIRECTORY_SYNC_TAG[] = "DirectorySync";
+
+        static bool LocalFileMatchesETag(const Aws::String& filePath, uint64_t size, const Aws::String& eTag, uint64_t maxHashedFileSize)
+        {
+            // only the ETag of an object uploaded in a single part (and not encrypted with KMS) is the MD5 of its content.
+            Aws::String md5 = Aws::Utils::StringUtils::ToLower(eTag.c_str());
+            md5.erase(std::remove(md5.begin(), md5.end(), '"'), md5.end());
+            if (md5.size() != 32 || size > maxHashedFileSize)
+            {
+                return false;
+            }
+
+#ifdef _MSC_VER
+            Aws::FStream fileStream(Aws::Utils::StringUtils::ToWString(filePath.c_str()).c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+            Aws::FStream fileStream(filePath.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+            if (!fileStream.good())
+            {
+                return false;
+            }
+
+            return Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateMD5(fileStream)) == md5;
+        }
+
+        SortedDirectoryWalker::SortedDirectoryWalker(const Aws::String& directory)
+        {
+            EnterDirectory(directory, Aws::String());
+        }
+
+        bool SortedDirectoryWalker::Next(DirectorySyncEntry& file)
+        {
+            while (!m_levels.empty())
+            {
+                auto& level = m_levels.back();
+                if (level.next == level.children.size())
+                {
+                    m_levels.pop_back();
+                    continue;
+                }
+
+                const auto& child = level.children[level.next++];
+                Aws::String path = Aws::FileSystem::Join(level.path, child.name);
+                Aws::String relativeKey = level.relativeKey + child.sortName;
+                if (child.isDirectory)
+                {
+                    EnterDirectory(path, relativeKey);
+                    continue;
+                }
+
+                file.relativeKey = std::move(relativeKey);
+                file.filePath = std::move(path);
+                file.size = child.size;
+                file.lastModified = child.lastModified;
+                file.eTag.clear();
+                return true;
+            }
+
+            return false;
+        }
+
+        void SortedDirectoryWalker::EnterDirectory(const Aws::String& path, const Aws::String& relativeKey)
+        {
+            Level level;
+            level.path = path;
+            level.relativeKey = relativeKey;
+            level.next = 0;
+
+            auto directory = Aws::FileSystem::OpenDirectory(path);
+            if (directory && *directory)
+            {
+                Aws::FileSystem::DirectoryEntry entry;
+                while ((entry = directory->Next()))
+                {
+                    if (entry.fileType != Aws::FileSystem::FileType::File && entry.fileType != Aws::FileSystem::FileType::Directory)
+                    {
+                        continue;
+                    }
+
+                    Child child;
+                    child.name = entry.path.substr(entry.path.find_last_of(Aws::FileSystem::PATH_DELIM) + 1);
+                    child.isDirectory = entry.fileType == Aws::FileSystem::FileType::Directory;
+                    child.sortName = child.isDirectory ? child.name + "/" : child.name;
+                    child.size = static_cast<uint64_t>(entry.fileSize);
+                    child.lastModified = entry.lastModified;
+                    level.children.push_back(std::move(child));
+                }
+            }
+            else
+            {
+                AWS_LOGSTREAM_ERROR(DIRECTORY_SYNC_TAG, "Could not open directory " << path << ". Its files will not be transferred.");
+            }
+
+            std::sort(level.children.begin(), level.children.end(), [](const Child& left, const Child& right) { return left.sortName < right.sortName; });
+            m_levels.push_back(std::move(level));
+        }
+
+        DirectorySyncSource::DirectorySyncSource(TransferDirection direction, const Aws::String& directory, const Aws::String& listPrefix, bool skipUnchanged,
+                                                 uint64_t maxHashedFileSize) :
+            m_direction(direction),
+            m_listPrefix(listPrefix),
+            m_skipUnchanged(skipUnchanged),
+            m_maxHashedFileSize(maxHashedFileSize),
+            m_hasLocalFile(false),
+            m_listingDone(direction == TransferDirection::UPLOAD && !skipUnchanged)
+        {
+            if (direction == TransferDirection::UPLOAD || skipUnchanged)
+            {
+                m_walker = Aws::MakeUnique<SortedDirectoryWalker>(DIRECTORY_SYNC_TAG, directory);
+            }
+        }
+
+        DirectorySyncStep DirectorySyncSource::Next(DirectorySyncEntry& file)
+        {
+            if (m_direction == TransferDirection::UPLOAD)
+            {
+                if (!m_hasLocalFile)
+                {
+                    if (!m_walker->Next(m_localFile))
+                    {
+                        return DirectorySyncStep::DONE;
+                    }
+                    m_hasLocalFile = true;
+                }
+
+                DirectorySyncEntry object;
+                bool matched = false;
+                if (m_skipUnchanged)
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    while (!m_listedObjects.empty() && m_listedObjects.front().relativeKey < m_localFile.relativeKey)
+                    {
+                        m_listedObjects.pop_front();
+                    }
+
+                    if (m_listedObjects.empty() && !m_listingDone)
+                    {
+                        return DirectorySyncStep::WAIT_FOR_LISTING;
+                    }
+
+                    if (!m_listedObjects.empty() && m_listedObjects.front().relativeKey == m_localFile.relativeKey)
+                    {
+                        object = std::move(m_listedObjects.front());
+                        m_listedObjects.pop_front();
+                        matched = true;
+                    }
+                }
+
+                file = std::move(m_localFile);
+                m_hasLocalFile = false;
+                file.key = m_listPrefix + file.relativeKey;
+                return matched && IsUpToDate(file, object) ? DirectorySyncStep::SKIP : DirectorySyncStep::TRANSFER;
+            }
+
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (m_listedObjects.empty())
+                {
+                    return m_listingDone ? DirectorySyncStep::DONE : DirectorySyncStep::WAIT_FOR_LISTING;
+                }
+
+                file = std::move(m_listedObjects.front());
+                m_listedObjects.pop_front();
+            }
+
+            if (!m_skipUnchanged || file.relativeKey.empty())
+            {
+                return DirectorySyncStep::TRANSFER;
+            }
+
+            while (!m_hasLocalFile || m_localFile.relativeKey < file.relativeKey)
+            {
+                m_hasLocalFile = m_walker->Next(m_localFile);
+                if (!m_hasLocalFile)
+                {
+                    break;
+                }
+            }
+
+            bool matched = m_hasLocalFile && m_localFile.relativeKey == file.relativeKey;
+            return matched && IsUpToDate(m_localFile, file) ? DirectorySyncStep::SKIP : DirectorySyncStep::TRANSFER;
+        }
+
+        void DirectorySyncSource::AddListedObjects(Aws::Deque<DirectorySyncEntry>& objects, bool listingDone)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            for (auto& object : objects)
+            {
+                m_listedObjects.push_back(std::move(object));
+            }
+            m_listingDone = m_listingDone || listingDone;
+        }
+
+        bool DirectorySyncSource::NeedsListing(size_t prefetchKeys) const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return !m_listingDone && m_listedObjects.size() < prefetchKeys;
+        }
+
+        bool DirectorySyncSource::IsUpToDate(const DirectorySyncEntry& localFile, const DirectorySyncEntry& object) const
+        {
+            if (localFile.size != object.size)
+            {
+                return false;
+            }
+
+            bool upload = m_direction == TransferDirection::UPLOAD;
+            const auto& source = upload ? localFile : object;
+            const auto& destination = upload ? object : localFile;
+            return destination.lastModified >= source.lastModified ||
+                LocalFileMatchesETag(localFile.filePath, localFile.size, object.eTag, m_maxHashedFileSize);
+        }
+
+        DirectorySyncWindow::DirectorySyncWindow(size_t capacity) :
+            m_capacity(capacity),
+            m_nextSequence(0),
+            m_filesStarted(0)
+        {
+        }
+
+        void DirectorySyncWindow::Add(DirectorySyncEntry&& file)
+        {
+            uint64_t sequence = m_nextSequence++;
+            m_filesBySize.insert(std::make_pair(file.size, sequence));
+            WindowedFile windowedFile;
+            windowedFile.file = std::move(file);
+            windowedFile.queuedAt = m_filesStarted;
+            m_files[sequence] = std::move(windowedFile);
+        }
+
+        Aws::Map<uint64_t, DirectorySyncWindow::WindowedFile>::const_iterator DirectorySyncWindow::FindNext() const
+        {
+            auto next = m_files.begin();
+            if (m_filesStarted - next->second.queuedAt < m_capacity)
+            {
+                next = m_files.find(m_filesBySize.begin()->second);
+            }
+            return next;
+        }
+
+        const DirectorySyncEntry& DirectorySyncWindow::PeekNext() const
+        {
+            return FindNext()->second.file;
+        }
+
+        DirectorySyncEntry DirectorySyncWindow::TakeNext()
+        {
+            auto next = FindNext();
+            DirectorySyncEntry file = std::move(m_files.at(next->first).file);
+            m_filesBySize.erase(std::make_pair(file.size, next->first));
+            m_files.erase(next);
+            m_filesStarted++;
+            return file;
+        }
+
+        void DirectorySyncWindow::Clear()
+        {
+            m_files.clear();
+            m_filesBySize.clear();
+        }
+    }
+}
@@ -0,0 +1,211 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/transfer/DirectoryTransfer.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        static const char DIRECTORY_TRANSFER_TAG[] = "DirectoryTransfer";
+
+        static bool IsFinishedStatus(TransferStatus status)
+        {
+            return status != TransferStatus::NOT_STARTED && status != TransferStatus::IN_PROGRESS;
+        }
+
+        DirectoryTransfer::DirectoryTransfer(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix) :
+            m_direction(direction),
+            m_directory(directory),
+            m_bucketName(bucketName),
+            m_prefix(prefix),
+            m_cancel(false),
+            m_filesQueued(0),
+            m_bytesQueued(0),
+            m_filesSkipped(0),
+            m_bytesSkipped(0),
+            m_filesCompleted(0),
+            m_filesFailed(0),
+            m_bytesFinished(0),
+            m_bytesInFlight(0),
+            m_startTime(std::chrono::steady_clock::now()),
+            m_finishTime(),
+            m_status(TransferStatus::IN_PROGRESS)
+        {}
+
+        TransferStatus DirectoryTransfer::GetStatus() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_status;
+        }
+
+        void DirectoryTransfer::UpdateStatus(TransferStatus value)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            if (IsFinishedStatus(m_status))
+            {
+                return;
+            }
+
+            AWS_LOGSTREAM_INFO(DIRECTORY_TRANSFER_TAG, "Directory transfer of [" << m_directory << "] " << (m_direction == TransferDirection::UPLOAD ? "to" : "from")
+                    << " bucket [" << m_bucketName << "] with prefix [" << m_prefix << "] changed status to [" << value << "].");
+            m_status = value;
+            if (IsFinishedStatus(value))
+            {
+                m_finishTime = std::chrono::steady_clock::now();
+                locker.unlock();
+                m_waitUntilFinishedSignal.notify_all();
+            }
+        }
+
+        void DirectoryTransfer::WaitUntilFinished() const
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_waitUntilFinishedSignal.wait(locker, [this]() { return IsFinishedStatus(m_status); });
+        }
+
+        void DirectoryTransfer::Cancel()
+        {
+            m_cancel.store(true);
+
+            Aws::Vector<std::shared_ptr<TransferHandle>> inFlightHandles;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                inFlightHandles.reserve(m_inFlightFiles.size());
+                for (const auto& file : m_inFlightFiles)
+                {
+                    inFlightHandles.push_back(file.second.handle);
+                }
+            }
+
+            for (const auto& handle : inFlightHandles)
+            {
+                handle->Cancel();
+            }
+        }
+
+        void DirectoryTransfer::AddQueuedFile(uint64_t size)
+        {
+            m_filesQueued++;
+            m_bytesQueued.fetch_add(size);
+        }
+
+        void DirectoryTransfer::AddSkippedFile(uint64_t size)
+        {
+            m_filesSkipped++;
+            m_bytesSkipped.fetch_add(size);
+        }
+
+        size_t DirectoryTransfer::GetFilesInFlight() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_inFlightFiles.size();
+        }
+
+        uint64_t DirectoryTransfer::GetBytesInFlight() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_bytesInFlight;
+        }
+
+        bool DirectoryTransfer::AddInFlightFile(const std::shared_ptr<TransferHandle>& handle, uint64_t size)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            // the transfer may have finished before it got here, in which case RemoveInFlightFile() already passed it by.
+            if (IsFinishedStatus(handle->GetStatus()))
+            {
+                CountFinishedFile(*handle);
+                return false;
+            }
+
+            InFlightFile file;
+            file.handle = handle;
+            file.size = size;
+            m_inFlightFiles[handle->GetId()] = file;
+            m_bytesInFlight += size;
+            return true;
+        }
+
+        bool DirectoryTransfer::RemoveInFlightFile(const TransferHandle& handle)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto file = m_inFlightFiles.find(handle.GetId());
+            if (file == m_inFlightFiles.end() || !IsFinishedStatus(handle.GetStatus()))
+            {
+                return false;
+            }
+
+            m_bytesInFlight -= file->second.size;
+            m_inFlightFiles.erase(file);
+            CountFinishedFile(handle);
+            return true;
+        }
+
+        std::function<void()> DirectoryTransfer::GetFileFinishedCallback() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_fileFinishedCallback;
+        }
+
+        void DirectoryTransfer::SetFileFinishedCallback(const std::function<void()>& value)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_fileFinishedCallback = value;
+        }
+
+        void DirectoryTransfer::CountFinishedFile(const TransferHandle& handle)
+        {
+            if (handle.GetStatus() == TransferStatus::COMPLETED)
+            {
+                m_filesCompleted++;
+            }
+            else
+            {
+                m_filesFailed++;
+            }
+            m_bytesFinished += handle.GetBytesTransferred();
+        }
+
+        uint64_t DirectoryTransfer::GetBytesTransferred() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            uint64_t bytesTransferred = m_bytesFinished;
+            for (const auto& file : m_inFlightFiles)
+            {
+                bytesTransferred += file.second.handle->GetBytesTransferred();
+            }
+            return bytesTransferred;
+        }
+
+        std::chrono::milliseconds DirectoryTransfer::GetElapsedTime() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto endTime = IsFinishedStatus(m_status) ? m_finishTime : std::chrono::steady_clock::now();
+            return std::chrono::duration_cast<std::chrono::milliseconds>(endTime - m_startTime);
+        }
+
+        double DirectoryTransfer::GetThroughput() const
+        {
+            auto elapsed = GetElapsedTime();
+            if (elapsed.count() <= 0)
+            {
+                return 0.0;
+            }
+            return static_cast<double>(GetBytesTransferred()) * 1000.0 / static_cast<double>(elapsed.count());
+        }
+    }
+}
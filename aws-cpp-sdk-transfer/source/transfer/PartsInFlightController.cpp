@@ -0,0 +1,125 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/transfer/PartsInFlightController.h>
+#include <algorithm>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        static const uint64_t MIN_PART_SIZE = 5 * 1024 * 1024;
+        static const uint64_t AUTO_TUNE_TARGET_PART_COUNT = 1000;
+        static const uint64_t AUTO_TUNE_MAX_PREFERRED_PART_SIZE = 64 * 1024 * 1024;
+        static const size_t AUTO_TUNE_INITIAL_PARTS_IN_FLIGHT = 4;
+
+        uint64_t ComputeAutoTunedPartSize(uint64_t totalSize, uint64_t minPartSize)
+        {
+            // fewer, larger parts cut per request overhead on large objects, but never so large that small objects lose their parallelism,
+            // unless that is what it takes to stay within the part limit.
+            const uint64_t MB = 1024 * 1024;
+            uint64_t partSize = (std::min)(totalSize / AUTO_TUNE_TARGET_PART_COUNT, AUTO_TUNE_MAX_PREFERRED_PART_SIZE);
+            partSize = (std::max)(partSize, (totalSize + MAX_PARTS_PER_UPLOAD - 1) / MAX_PARTS_PER_UPLOAD);
+            partSize = (partSize + MB - 1) / MB * MB;
+            return (std::max)(partSize, (std::max)(minPartSize, MIN_PART_SIZE));
+        }
+
+        PartsInFlightController::PartsInFlightController(uint64_t partSize, size_t maxLimit) :
+            m_partSize(partSize),
+            m_maxLimit(static_cast<double>((std::max)(maxLimit, static_cast<size_t>(1)))),
+            m_limit((std::min)(static_cast<double>(AUTO_TUNE_INITIAL_PARTS_IN_FLIGHT), m_maxLimit)),
+            m_inFlight(0),
+            m_fastestSecondsPerByte(0.0),
+            m_averageSecondsPerByte(0.0),
+            m_partsSinceDecrease(0),
+            m_partsInFlightAtDecrease(0),
+            m_slowStart(true)
+        {
+        }
+
+        size_t PartsInFlightController::GetLimit() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return static_cast<size_t>(m_limit);
+        }
+
+        void PartsInFlightController::WaitForSlot()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_slotFreed.wait(locker, [this] { return m_inFlight < static_cast<size_t>(m_limit); });
+            ++m_inFlight;
+        }
+
+        void PartsInFlightController::ReleaseSlot()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            --m_inFlight;
+            m_slotFreed.notify_all();
+        }
+
+        void PartsInFlightController::OnPartFinished(uint64_t bytes, std::chrono::steady_clock::duration elapsed, bool succeeded)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            --m_inFlight;
+            // parts that were already in flight when the limit was cut report the same congestion, so wait for them before cutting again.
+            bool sentBeforeDecrease = m_partsSinceDecrease < m_partsInFlightAtDecrease;
+            ++m_partsSinceDecrease;
+
+            bool congested = !succeeded;
+            double seconds = std::chrono::duration<double>(elapsed).count();
+            // short parts are dominated by request latency rather than bandwidth, they say nothing about congestion.
+            if (succeeded && bytes > 0 && bytes * 2 >= m_partSize && seconds > 0)
+            {
+                double secondsPerByte = seconds / static_cast<double>(bytes);
+                m_averageSecondsPerByte = m_averageSecondsPerByte == 0.0 ? secondsPerByte : 0.75 * m_averageSecondsPerByte + 0.25 * secondsPerByte;
+                if (m_fastestSecondsPerByte == 0.0 || secondsPerByte < m_fastestSecondsPerByte)
+                {
+                    m_fastestSecondsPerByte = secondsPerByte;
+                }
+                congested = m_averageSecondsPerByte > 2 * m_fastestSecondsPerByte;
+            }
+
+            if (congested)
+            {
+                if (!sentBeforeDecrease)
+                {
+                    Decrease();
+                }
+            }
+            else
+            {
+                m_limit = (std::min)(m_limit + (m_slowStart ? 1.0 : 1.0 / m_limit), m_maxLimit);
+            }
+            m_slotFreed.notify_all();
+        }
+
+        void PartsInFlightController::OnPartRetried()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (m_partsSinceDecrease >= m_partsInFlightAtDecrease)
+            {
+                Decrease();
+            }
+        }
+
+        void PartsInFlightController::Decrease()
+        {
+            m_limit = (std::max)(m_limit / 2, 1.0);
+            m_slowStart = false;
+            m_partsSinceDecrease = 0;
+            m_partsInFlightAtDecrease = m_inFlight;
+        }
+    }
+}
@@ -14,6 +14,7 @@
 */
 
 #include <aws/transfer/TransferHandle.h>
+#include <aws/transfer/TransferJournal.h>
 #include <aws/core/utils/logging/LogMacros.h>
 
 #include <cassert>
@@ -77,6 +78,9 @@ namespace Aws
             m_bytesTransferred(0), 
             m_lastPart(false),
             m_bytesTotalSize(totalSize),
+            m_partSize(0),
+            m_maxPartsInFlight(0),
+            m_downloadingToTargetFile(false),
             m_bucket(bucketName), 
             m_key(keyName), 
             m_fileName(targetFilePath),
@@ -94,6 +98,9 @@ namespace Aws
             m_bytesTransferred(0), 
             m_lastPart(false),
             m_bytesTotalSize(0),
+            m_partSize(0),
+            m_maxPartsInFlight(0),
+            m_downloadingToTargetFile(false),
             m_bucket(bucketName), 
             m_key(keyName), 
             m_fileName(targetFilePath),
@@ -111,6 +118,9 @@ namespace Aws
             m_bytesTransferred(0), 
             m_lastPart(false),
             m_bytesTotalSize(0),
+            m_partSize(0),
+            m_maxPartsInFlight(0),
+            m_downloadingToTargetFile(false),
             m_bucket(bucketName), 
             m_key(keyName), 
             m_fileName(targetFilePath),
@@ -127,6 +137,12 @@ namespace Aws
             CleanupDownloadStream();
         }
 
+        Aws::String TransferHandle::GetJournalPath() const
+        {
+            auto journal = GetJournal();
+            return journal ? journal->GetPath() : Aws::String();
+        }
+
         void TransferHandle::ChangePartToCompleted(const PartPointer& partState, const Aws::String &eTag)
         {
             std::lock_guard<std::mutex> locker(m_partsLock);
@@ -0,0 +1,371 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/transfer/TransferJournal.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/stream/FileRangeStreamBuf.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/platform/FileSystem.h>
+#include <fstream>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        static const char JOURNAL_TAG[] = "TransferJournal";
+        static const char HEADER_RECORD[] = "TRANSFER";
+        static const char PART_RECORD[] = "PART";
+        static const char JOURNAL_VERSION[] = "2";
+        static const char FIELD_DELIM = '\t';
+        static const char RECORD_DELIM = '\n';
+
+        static Aws::String ChecksumOf(const Aws::String& fields)
+        {
+            return Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateCRC32(fields));
+        }
+
+        static Aws::String FormatRecord(const Aws::Vector<Aws::String>& fields)
+        {
+            Aws::StringStream ss;
+            for (const auto& field : fields)
+            {
+                ss << field << FIELD_DELIM;
+            }
+            Aws::String record = ss.str();
+            return record + ChecksumOf(record) + RECORD_DELIM;
+        }
+
+        static Aws::String Encode(const Aws::String& value)
+        {
+            return Aws::Utils::StringUtils::URLEncode(value.c_str());
+        }
+
+        static Aws::String Decode(const Aws::String& value)
+        {
+            return Aws::Utils::StringUtils::URLDecode(value.c_str());
+        }
+
+        static uint64_t ToUInt64(const Aws::String& value)
+        {
+            return static_cast<uint64_t>(Aws::Utils::StringUtils::ConvertToInt64(value.c_str()));
+        }
+
+        static Aws::String EncodeMetadata(const Aws::Map<Aws::String, Aws::String>& metadata)
+        {
+            Aws::StringStream ss;
+            for (const auto& entry : metadata)
+            {
+                ss << (ss.tellp() > 0 ? "&" : "") << Encode(entry.first) << "=" << Encode(entry.second);
+            }
+            return ss.str();
+        }
+
+        static Aws::Map<Aws::String, Aws::String> DecodeMetadata(const Aws::String& value)
+        {
+            Aws::Map<Aws::String, Aws::String> metadata;
+            for (const auto& entry : Aws::Utils::StringUtils::Split(value, '&'))
+            {
+                auto separator = entry.find('=');
+                if (separator != Aws::String::npos)
+                {
+                    metadata[Decode(entry.substr(0, separator))] = Decode(entry.substr(separator + 1));
+                }
+            }
+            return metadata;
+        }
+
+        static Aws::String FormatHeader(const TransferJournalState& state)
+        {
+            Aws::Vector<Aws::String> fields;
+            fields.push_back(HEADER_RECORD);
+            fields.push_back(JOURNAL_VERSION);
+            fields.push_back(state.direction == TransferDirection::UPLOAD ? "UPLOAD" : "DOWNLOAD");
+            fields.push_back(Encode(state.bucketName));
+            fields.push_back(Encode(state.keyName));
+            fields.push_back(Encode(state.filePath));
+            fields.push_back(Encode(state.contentType));
+            fields.push_back(Aws::Utils::StringUtils::to_string(state.totalSize));
+            fields.push_back(Aws::Utils::StringUtils::to_string(state.partSize));
+            fields.push_back(Encode(state.multipartId));
+            fields.push_back(EncodeMetadata(state.metadata));
+            fields.push_back(Encode(state.versionId));
+            fields.push_back(Encode(state.objectETag));
+            fields.push_back(Aws::Utils::StringUtils::to_string(state.fileLastModified.Millis()));
+            return FormatRecord(fields);
+        }
+
+        /**
+         * Splits a record into its fields, keeping empty ones. Returns false if the record's checksum doesn't match.
+         */
+        static bool ParseRecord(const Aws::String& record, Aws::Vector<Aws::String>& fields)
+        {
+            auto checksumBegin = record.find_last_of(FIELD_DELIM);
+            if (checksumBegin == Aws::String::npos || ChecksumOf(record.substr(0, checksumBegin + 1)) != record.substr(checksumBegin + 1))
+            {
+                return false;
+            }
+
+            fields.clear();
+            size_t fieldBegin = 0;
+            for (size_t fieldEnd = record.find(FIELD_DELIM); fieldEnd <= checksumBegin; fieldEnd = record.find(FIELD_DELIM, fieldBegin))
+            {
+                fields.push_back(record.substr(fieldBegin, fieldEnd - fieldBegin));
+                fieldBegin = fieldEnd + 1;
+            }
+            return true;
+        }
+
+        static bool ParseHeader(const Aws::Vector<Aws::String>& fields, TransferJournalState& state)
+        {
+            if (fields.size() != 14 || fields[0] != HEADER_RECORD || fields[1] != JOURNAL_VERSION || (fields[2] != "UPLOAD" && fields[2] != "DOWNLOAD"))
+            {
+                return false;
+            }
+
+            state.direction = fields[2] == "UPLOAD" ? TransferDirection::UPLOAD : TransferDirection::DOWNLOAD;
+            state.bucketName = Decode(fields[3]);
+            state.keyName = Decode(fields[4]);
+            state.filePath = Decode(fields[5]);
+            state.contentType = Decode(fields[6]);
+            state.totalSize = ToUInt64(fields[7]);
+            state.partSize = ToUInt64(fields[8]);
+            state.multipartId = Decode(fields[9]);
+            state.metadata = DecodeMetadata(fields[10]);
+            state.versionId = Decode(fields[11]);
+            state.objectETag = Decode(fields[12]);
+            state.fileLastModified = Aws::Utils::DateTime(static_cast<int64_t>(Aws::Utils::StringUtils::ConvertToInt64(fields[13].c_str())));
+            state.completedParts.clear();
+            return state.partSize > 0;
+        }
+
+        static bool ParsePart(const Aws::Vector<Aws::String>& fields, TransferJournalState& state)
+        {
+            if (fields.size() != 5 || fields[0] != PART_RECORD)
+            {
+                return false;
+            }
+
+            int partId = static_cast<int>(Aws::Utils::StringUtils::ConvertToInt32(fields[1].c_str()));
+            uint64_t partCount = (state.totalSize + state.partSize - 1) / state.partSize;
+            if (partId < 1 || static_cast<uint64_t>(partId) > partCount)
+            {
+                return false;
+            }
+
+            // a part recorded with another layout than the header's isn't one this transfer can use.
+            uint64_t rangeBegin = (partId - 1) * state.partSize;
+            if (ToUInt64(fields[2]) != rangeBegin || ToUInt64(fields[3]) != (std::min)(state.partSize, state.totalSize - rangeBegin))
+            {
+                return false;
+            }
+
+            state.completedParts[partId] = Decode(fields[4]);
+            return true;
+        }
+
+        TransferJournal::TransferJournal(const Aws::String& path, const std::shared_ptr<Aws::Utils::Stream::WritableFile>& file, uint64_t endOffset,
+                                         const TransferJournalState& state, size_t syncBatchSize) :
+            m_path(path), m_file(file), m_endOffset(endOffset), m_totalSize(state.totalSize), m_partSize(state.partSize),
+            m_syncBatchSize((std::max)(syncBatchSize, static_cast<size_t>(1))), m_pendingRecordCount(0)
+        {
+        }
+
+        std::shared_ptr<TransferJournal> TransferJournal::MakeJournal(const Aws::String& path, const std::shared_ptr<Aws::Utils::Stream::WritableFile>& file,
+                                                                      uint64_t endOffset, const TransferJournalState& state, size_t syncBatchSize)
+        {
+            // the constructor is private so journals are only made through Create and Open.
+            struct MakeSharedEnabler : public TransferJournal {
+                MakeSharedEnabler(const Aws::String& path, const std::shared_ptr<Aws::Utils::Stream::WritableFile>& file, uint64_t endOffset,
+                                  const TransferJournalState& state, size_t syncBatchSize) : TransferJournal(path, file, endOffset, state, syncBatchSize) {}
+            };
+
+            return Aws::MakeShared<MakeSharedEnabler>(JOURNAL_TAG, path, file, endOffset, state, syncBatchSize);
+        }
+
+        TransferJournal::~TransferJournal()
+        {
+            Sync();
+        }
+
+        std::shared_ptr<TransferJournal> TransferJournal::Create(const Aws::String& path, const TransferJournalState& state, size_t syncBatchSize)
+        {
+            auto file = Aws::MakeShared<Aws::Utils::Stream::WritableFile>(JOURNAL_TAG, path);
+            if (!file->IsOpen())
+            {
+                AWS_LOGSTREAM_ERROR(JOURNAL_TAG, "Failed to create transfer journal: " << path);
+                return nullptr;
+            }
+
+            auto journal = MakeJournal(path, file, 0, state, syncBatchSize);
+            return journal->Restart(state) ? journal : nullptr;
+        }
+
+        std::shared_ptr<TransferJournal> TransferJournal::Open(const Aws::String& path, TransferJournalState& state, size_t syncBatchSize)
+        {
+#ifdef _MSC_VER
+            Aws::IFStream journalStream(Aws::Utils::StringUtils::ToWString(path.c_str()).c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+            Aws::IFStream journalStream(path.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+            if (!journalStream.good())
+            {
+                AWS_LOGSTREAM_ERROR(JOURNAL_TAG, "Failed to open transfer journal: " << path);
+                return nullptr;
+            }
+            Aws::String contents((std::istreambuf_iterator<char>(journalStream)), std::istreambuf_iterator<char>());
+            journalStream.close();
+
+            // everything up to the first record that is torn or fails its checksum is valid.
+            uint64_t validLength = 0;
+            bool hasHeader = false;
+            Aws::Vector<Aws::String> fields;
+            for (size_t recordEnd = contents.find(RECORD_DELIM); recordEnd != Aws::String::npos; recordEnd = contents.find(RECORD_DELIM, validLength))
+            {
+                Aws::String record = contents.substr(static_cast<size_t>(validLength), recordEnd - static_cast<size_t>(validLength));
+                if (!ParseRecord(record, fields))
+                {
+                    AWS_LOGSTREAM_WARN(JOURNAL_TAG, "Dropping corrupt records at offset " << validLength << " of transfer journal: " << path);
+                    break;
+                }
+                if (!hasHeader)
+                {
+                    if (!ParseHeader(fields, state))
+                    {
+                        break;
+                    }
+                    hasHeader = true;
+                }
+                else if (!ParsePart(fields, state))
+                {
+                    AWS_LOGSTREAM_WARN(JOURNAL_TAG, "Ignoring unexpected record at offset " << validLength << " of transfer journal: " << path);
+                }
+                validLength = recordEnd + 1;
+            }
+
+            if (!hasHeader)
+            {
+                AWS_LOGSTREAM_ERROR(JOURNAL_TAG, "No valid header in transfer journal: " << path);
+                return nullptr;
+            }
+
+            auto file = Aws::MakeShared<Aws::Utils::Stream::WritableFile>(JOURNAL_TAG, path);
+            if (!file->IsOpen() || (validLength < contents.size() && !file->Allocate(validLength)))
+            {
+                AWS_LOGSTREAM_ERROR(JOURNAL_TAG, "Failed to open transfer journal for writing: " << path);
+                return nullptr;
+            }
+
+            return MakeJournal(path, file, validLength, state, syncBatchSize);
+        }
+
+        bool TransferJournal::Restart(const TransferJournalState& state)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_pendingRecords.clear();
+            m_pendingRecordCount = 0;
+            m_endOffset = 0;
+            m_totalSize = state.totalSize;
+            m_partSize = state.partSize;
+            if (!m_file || !m_file->Allocate(0) || !Append(FormatHeader(state)) || !m_file->Sync())
+            {
+                AWS_LOGSTREAM_ERROR(JOURNAL_TAG, "Failed to write the header of transfer journal: " << m_path);
+                return false;
+            }
+            return true;
+        }
+
+        void TransferJournal::RecordCompletedPart(int partId, const Aws::String& eTag)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            uint64_t rangeBegin = (partId - 1) * m_partSize;
+            Aws::Vector<Aws::String> fields;
+            fields.push_back(PART_RECORD);
+            fields.push_back(Aws::Utils::StringUtils::to_string(partId));
+            fields.push_back(Aws::Utils::StringUtils::to_string(rangeBegin));
+            fields.push_back(Aws::Utils::StringUtils::to_string((std::min)(m_partSize, m_totalSize - rangeBegin)));
+            fields.push_back(Encode(eTag));
+            m_pendingRecords += FormatRecord(fields);
+
+            if (++m_pendingRecordCount >= m_syncBatchSize)
+            {
+                CommitLocked();
+            }
+        }
+
+        bool TransferJournal::Sync()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return CommitLocked();
+        }
+
+        void TransferJournal::Remove()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (m_beforeSync)
+            {
+                m_beforeSync();
+            }
+            m_pendingRecords.clear();
+            m_pendingRecordCount = 0;
+            m_beforeSync = nullptr;
+            m_file = nullptr;
+            Aws::FileSystem::RemoveFileIfExists(m_path.c_str());
+        }
+
+        void TransferJournal::SetBeforeSyncCallback(const std::function<bool()>& callback)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_beforeSync = callback;
+        }
+
+        bool TransferJournal::Append(const Aws::String& records)
+        {
+            if (!m_file->WriteAt(m_endOffset, records.c_str(), records.size()))
+            {
+                return false;
+            }
+            m_endOffset += records.size();
+            return true;
+        }
+
+        bool TransferJournal::CommitLocked()
+        {
+            if (m_pendingRecords.empty() || !m_file)
+            {
+                return true;
+            }
+
+            // a torn append may leave the first records of the batch intact, Open keeps those and drops the rest from the first torn one on.
+            // Either way the parts whose records were lost are just transferred again when the transfer is resumed.
+            uint64_t committedOffset = m_endOffset;
+            if ((m_beforeSync && !m_beforeSync()) || !Append(m_pendingRecords) || !m_file->Sync())
+            {
+                AWS_LOGSTREAM_WARN(JOURNAL_TAG, "Failed to commit " << m_pendingRecordCount << " record(s) to transfer journal: " << m_path
+                        << ". Their parts will be transferred again if the transfer is resumed.");
+                m_endOffset = committedOffset;
+                m_pendingRecords.clear();
+                m_pendingRecordCount = 0;
+                return false;
+            }
+
+            m_pendingRecords.clear();
+            m_pendingRecordCount = 0;
+            return true;
+        }
+    }
+}
@@ -14,10 +14,16 @@
 */
 
 #include <aws/transfer/TransferManager.h>
+#include <aws/transfer/PartsInFlightController.h>
+#include <aws/transfer/DirectorySync.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/stream/FileRangeStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/FileSystemUtils.h>
 #include <aws/core/platform/FileSystem.h>
@@ -27,8 +33,11 @@
 #include <aws/s3/model/ListObjectsV2Request.h>
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/ListPartsRequest.h>
 #include <fstream>
 #include <algorithm>
+#include <chrono>
+#include <mutex>
 
 #include <aws/core/utils/logging/LogMacros.h>
 
@@ -41,18 +50,98 @@ namespace Aws
             return (path.find_last_of('/') == path.size() - 1 || path.find_last_of('\\') == path.size() - 1);
         }
 
+        static const size_t DIRECTORY_WINDOW_FILES_PER_FILE_IN_FLIGHT = 4;
+        static const size_t DIRECTORY_LISTING_PREFETCH_KEYS = 1000;
+
         struct TransferHandleAsyncContext : public Aws::Client::AsyncCallerContext
         {
+            TransferHandleAsyncContext() : fileBackedPart(false) {}
+
             std::shared_ptr<TransferHandle> handle;
             PartPointer partState;
+            bool fileBackedPart;
+            std::shared_ptr<PartsInFlightController> partsInFlight;
+            std::chrono::steady_clock::time_point partStartTime;
         };
 
-        struct DownloadDirectoryContext : public Aws::Client::AsyncCallerContext
+        static void ReleasePartInFlight(const TransferHandleAsyncContext& context, bool succeeded)
+        {
+            if (!context.partsInFlight)
+            {
+                return;
+            }
+
+            if (context.handle->ShouldContinue())
+            {
+                context.partsInFlight->OnPartFinished(context.partState->GetSizeInBytes(), std::chrono::steady_clock::now() - context.partStartTime, succeeded);
+                context.handle->SetMaxPartsInFlight(context.partsInFlight->GetLimit());
+            }
+            else
+            {
+                context.partsInFlight->ReleaseSlot();
+            }
+        }
+
+        /**
+         * State of one UploadDirectory or DownloadToDirectory operation. The source side is merged with the destination side, if unchanged files
+         * are skipped, into a bounded window of files to transfer. The source and the window are only pulled from by the thread pumping the
+         * transfer (see TransferManager::PumpDirectoryTransfer), the listing state and the pump flags are under lock.
+         */
+        struct DirectorySyncContext
         {
-            Aws::String rootDirectory;
-            Aws::String prefix;
+            DirectorySyncContext(TransferDirection direction, const Aws::String& directory, const Aws::String& prefix, bool skipUnchanged, uint64_t maxHashedFileSize,
+                                 size_t windowCapacity) :
+                listPrefix(direction == TransferDirection::UPLOAD ? prefix + "/" : prefix),
+                source(direction, directory, listPrefix, skipUnchanged, maxHashedFileSize),
+                window(windowCapacity),
+                sourceDone(false),
+                listingInFlight(false), listingFailed(false), pumping(false), pumpRequested(false), finished(false)
+            {}
+
+            std::shared_ptr<TransferManager> manager;
+            std::shared_ptr<DirectoryTransfer> directoryTransfer;
+            Aws::Map<Aws::String, Aws::String> metadata;
+            Aws::String listPrefix;
+            DirectorySyncSource source;
+            DirectorySyncWindow window;
+            bool sourceDone;
+
+            std::mutex lock;
+            Aws::String continuationToken;
+            bool listingInFlight;
+            bool listingFailed;
+            bool pumping;
+            bool pumpRequested;
+            bool finished;
         };
 
+        static CreateDownloadStreamCallback CreateFileStreamFunction(const Aws::String& writeToFile)
+        {
+#ifdef _MSC_VER
+            return [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, Aws::Utils::StringUtils::ToWString(writeToFile.c_str()).c_str(),
+                                                         std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
+#else
+            return [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, writeToFile.c_str(),
+                                                         std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
+#endif
+        }
+
+        static uint64_t GetFileSize(const Aws::String& fileName, bool& exists)
+        {
+#ifdef _MSC_VER
+            Aws::IFStream fileStream(Aws::Utils::StringUtils::ToWString(fileName.c_str()).c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+            Aws::IFStream fileStream(fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+            exists = fileStream.good();
+            if (!exists)
+            {
+                return 0;
+            }
+            fileStream.seekg(0, std::ios_base::end);
+            return static_cast<uint64_t>(fileStream.tellg());
+        }
+
         std::shared_ptr<TransferManager> TransferManager::Create(const TransferManagerConfiguration& config)
         {
             // Because TransferManager's ctor is private (to ensure it's always constructed as a shared_ptr)
@@ -65,7 +154,8 @@ namespace Aws
             return Aws::MakeShared<MakeSharedEnabler>(CLASS_TAG, config);
         }
 
-        TransferManager::TransferManager(const TransferManagerConfiguration& configuration) : m_transferConfig(configuration)
+        TransferManager::TransferManager(const TransferManagerConfiguration& configuration) : m_transferConfig(configuration),
+            m_fileBackedPartSlots((std::max)(configuration.maxFileBackedPartsInFlight, static_cast<size_t>(1)), (std::max)(configuration.maxFileBackedPartsInFlight, static_cast<size_t>(1)))
         {
             assert(m_transferConfig.s3Client);
             assert(m_transferConfig.transferExecutor);
@@ -110,12 +200,7 @@ namespace Aws
                                                                       const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
             auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, bucketName, keyName, writeToStreamfn, writeToFile);
-            handle->ApplyDownloadConfiguration(downloadConfig);
-            handle->SetContext(context);
-
-            auto self = shared_from_this();
-            m_transferConfig.transferExecutor->Submit([self, handle] { self->DoDownload(handle); });
-            return handle;
+            return SubmitDownload(handle, downloadConfig, context);
         }
 
         std::shared_ptr<TransferHandle> TransferManager::DownloadFile(const Aws::String& bucketName, 
@@ -124,15 +209,21 @@ namespace Aws
                                                                       const DownloadConfiguration& downloadConfig,
                                                                       const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
-#ifdef _MSC_VER
-            auto createFileFn = [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, Aws::Utils::StringUtils::ToWString(writeToFile.c_str()).c_str(),
-                                                                     std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
-#else
-            auto createFileFn = [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, writeToFile.c_str(),
-                                                                     std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
-#endif
+            auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, bucketName, keyName, CreateFileStreamFunction(writeToFile), writeToFile);
+            handle->SetDownloadingToTargetFile(true);
+            return SubmitDownload(handle, downloadConfig, context);
+        }
+
+        std::shared_ptr<TransferHandle> TransferManager::SubmitDownload(const std::shared_ptr<TransferHandle>& handle,
+                                                                        const DownloadConfiguration& downloadConfig,
+                                                                        const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+        {
+            handle->ApplyDownloadConfiguration(downloadConfig);
+            handle->SetContext(context);
 
-            return DownloadFile(bucketName, keyName, createFileFn, downloadConfig, writeToFile, context);
+            auto self = shared_from_this();
+            m_transferConfig.transferExecutor->Submit([self, handle] { self->DoDownload(handle); });
+            return handle;
         }
 
         std::shared_ptr<TransferHandle> TransferManager::RetryUpload(const Aws::String& fileName, const std::shared_ptr<TransferHandle>& retryHandle)
@@ -202,56 +293,354 @@ namespace Aws
 
         void TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
         {
-            assert(m_transferConfig.transferInitiatedCallback);
+            StartUploadDirectory(directory, bucketName, prefix, metadata);
+        }
+
+        std::shared_ptr<DirectoryTransfer> TransferManager::StartUploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix,
+                                                                                 const Aws::Map<Aws::String, Aws::String>& metadata)
+        {
+            return StartDirectoryTransfer(TransferDirection::UPLOAD, directory, bucketName, prefix, metadata);
+        }
+
+        void TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
+        {
+            StartDownloadToDirectory(directory, bucketName, prefix);
+        }
+
+        std::shared_ptr<DirectoryTransfer> TransferManager::StartDownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
+        {
+            Aws::FileSystem::CreateDirectoryIfNotExists(directory.c_str());
+            return StartDirectoryTransfer(TransferDirection::DOWNLOAD, directory, bucketName, prefix, Aws::Map<Aws::String, Aws::String>());
+        }
+
+        std::shared_ptr<TransferHandle> TransferManager::ResumeTransfer(const Aws::String& journalPath, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+        {
+            TransferJournalState state;
+            auto journal = TransferJournal::Open(journalPath, state, m_transferConfig.journalSyncBatchSize);
+            if (!journal)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Failed to read transfer journal: " << journalPath << " to resume the transfer.");
+                auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, "", "", 0);
+                handle->SetContext(context);
+                Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::INTERNAL_FAILURE, "InvalidJournal", "The transfer journal could not be read.", false);
+                handle->SetError(error);
+                handle->UpdateStatus(TransferStatus::FAILED);
+                TriggerErrorCallback(handle, error);
+                TriggerTransferStatusUpdatedCallback(handle);
+                return handle;
+            }
+
+            std::shared_ptr<TransferHandle> handle;
+            if (state.direction == TransferDirection::UPLOAD)
+            {
+                handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, state.bucketName, state.keyName, state.totalSize, state.filePath);
+                handle->SetMultipartId(state.multipartId);
+                handle->SetMetadata(state.metadata);
+            }
+            else
+            {
+                handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, state.bucketName, state.keyName, CreateFileStreamFunction(state.filePath), state.filePath);
+                handle->SetDownloadingToTargetFile(true);
+                handle->SetBytesTotalSize(state.totalSize);
+                handle->SetVersionId(state.versionId);
+            }
+            handle->SetContentType(state.contentType);
+            handle->SetPartSize(state.partSize);
+            handle->SetContext(context);
+            handle->SetJournal(journal);
+
+            AWS_LOGSTREAM_INFO(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Resuming transfer journaled at: " << journalPath
+                    << " for Bucket: [" << state.bucketName << "] with Key: [" << state.keyName << "]. " << state.completedParts.size()
+                    << " part(s) were journaled as completed.");
 
             auto self = shared_from_this();
-            auto visitor = [self, bucketName, prefix, metadata](const Aws::FileSystem::DirectoryTree*, const Aws::FileSystem::DirectoryEntry& entry)
+            m_transferConfig.transferExecutor->Submit([self, handle, state]
+                {
+                    if (state.direction == TransferDirection::UPLOAD)
+                    {
+                        self->DoResumeUpload(handle, state);
+                    }
+                    else
+                    {
+                        self->DoResumeDownload(handle, state);
+                    }
+                });
+            return handle;
+        }
+
+        /**
+         * Adds the parts of a resumed transfer to its handle, as completed for those in completedParts and as failed for the rest, so the
+         * handle looks like one whose failed parts are about to be retried.
+         */
+        static void RestoreParts(const std::shared_ptr<TransferHandle>& handle, uint64_t totalSize, uint64_t partSize, const Aws::Map<int, Aws::String>& completedParts)
+        {
+            uint64_t partCount = (totalSize + partSize - 1) / partSize;
+            handle->SetIsMultipart(true);
+            for (uint64_t i = 0; i < partCount; ++i)
             {
-                if (entry && entry.fileType == Aws::FileSystem::FileType::File)
+                uint64_t sizeOfPart = (std::min)(totalSize - i * partSize, partSize);
+                auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, static_cast<size_t>(sizeOfPart), i == partCount - 1);
+                partState->SetRangeBegin(static_cast<size_t>(i * partSize));
+                handle->AddPendingPart(partState);
+
+                auto completedPart = completedParts.find(partState->GetPartId());
+                if (completedPart != completedParts.end())
                 {
-                    Aws::StringStream ssKey;
-                    Aws::String relativePath = entry.relativePath;
-                    char delimiter[] = { Aws::FileSystem::PATH_DELIM, 0 };
-                    Aws::Utils::StringUtils::Replace(relativePath, delimiter, "/");
-
-                    ssKey << prefix << "/" << relativePath;
-                    Aws::String keyName = ssKey.str();
-                    AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Uploading file: " << entry.path
-                            << " as part of directory upload to S3 Bucket: [" << bucketName << "] and Key: ["
-                            << keyName << "].");
-                    self->m_transferConfig.transferInitiatedCallback(self.get(), self->UploadFile(entry.path, bucketName, keyName, DEFAULT_CONTENT_TYPE, metadata));
+                    partState->OnDataTransferred(static_cast<long long>(sizeOfPart), handle);
+                    handle->ChangePartToCompleted(partState, completedPart->second);
+                }
+                else
+                {
+                    handle->ChangePartToFailed(partState);
                 }
+            }
+        }
 
-                return true;
-            };
+        void TransferManager::DoResumeUpload(const std::shared_ptr<TransferHandle>& handle, const TransferJournalState& state)
+        {
+            bool fileExists = false;
+            uint64_t fileSize = GetFileSize(handle->GetTargetFilePath(), fileExists);
+            if (!fileExists)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to open file: "
+                        << handle->GetTargetFilePath() << " to resume its upload to bucket: " << handle->GetBucketName() << " with key: " << handle->GetKey());
+                Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::Client::AWSError<Aws::Client::CoreErrors>(static_cast<Aws::Client::CoreErrors>(Aws::S3::S3Errors::NO_SUCH_UPLOAD),
+                        "NoSuchUpload", "The requested file could not be opened.", false));
+                handle->SetError(error);
+                handle->UpdateStatus(TransferStatus::FAILED);
+                TriggerErrorCallback(handle, error);
+                TriggerTransferStatusUpdatedCallback(handle);
+                return;
+            }
 
-            m_transferConfig.transferExecutor->Submit([directory, visitor]() { Aws::FileSystem::DirectoryTree dir(directory); dir.TraverseDepthFirst(visitor); });
+            bool startOver = false;
+            Aws::Map<int, Aws::S3::Model::Part> uploadedParts;
+            // a file rewritten in place keeps its size, so the parts already uploaded are only reused if it wasn't written since either.
+            Aws::Utils::DateTime lastModified;
+            if (fileSize != state.totalSize || !Aws::Utils::Stream::ReadOnlyFile(handle->GetTargetFilePath()).GetLastModified(lastModified) ||
+                lastModified != state.fileLastModified)
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] File: " << handle->GetTargetFilePath()
+                        << " changed since its upload was journaled. Aborting Upload ID: [" << state.multipartId << "] and uploading it again.");
+                Aws::S3::Model::AbortMultipartUploadRequest abortMultipartUploadRequest;
+                abortMultipartUploadRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+                abortMultipartUploadRequest.WithBucket(handle->GetBucketName())
+                    .WithKey(handle->GetKey())
+                    .WithUploadId(state.multipartId);
+                m_transferConfig.s3Client->AbortMultipartUpload(abortMultipartUploadRequest);
+                startOver = true;
+            }
+            else
+            {
+                Aws::S3::Model::ListPartsRequest listPartsRequest;
+                listPartsRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+                listPartsRequest.WithBucket(handle->GetBucketName())
+                    .WithKey(handle->GetKey())
+                    .WithUploadId(state.multipartId);
+
+                for (;;)
+                {
+                    auto listPartsOutcome = m_transferConfig.s3Client->ListParts(listPartsRequest);
+                    if (!listPartsOutcome.IsSuccess())
+                    {
+                        if (listPartsOutcome.GetError().GetErrorType() == Aws::S3::S3Errors::NO_SUCH_UPLOAD)
+                        {
+                            AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Upload ID: [" << state.multipartId
+                                    << "] no longer exists. Uploading file: " << handle->GetTargetFilePath() << " again.");
+                            startOver = true;
+                            break;
+                        }
+
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to list the parts of Upload ID: ["
+                                << state.multipartId << "] to resume it. " << listPartsOutcome.GetError());
+                        handle->SetError(listPartsOutcome.GetError());
+                        handle->UpdateStatus(TransferStatus::FAILED);
+                        TriggerErrorCallback(handle, listPartsOutcome.GetError());
+                        TriggerTransferStatusUpdatedCallback(handle);
+                        return;
+                    }
+
+                    for (const auto& part : listPartsOutcome.GetResult().GetParts())
+                    {
+                        uploadedParts[part.GetPartNumber()] = part;
+                    }
+                    if (!listPartsOutcome.GetResult().GetIsTruncated())
+                    {
+                        break;
+                    }
+                    listPartsRequest.SetPartNumberMarker(listPartsOutcome.GetResult().GetNextPartNumberMarker());
+                }
+            }
+
+            if (startOver)
+            {
+                handle->SetMultipartId("");
+                handle->SetBytesTotalSize(fileSize);
+                if (!MultipartUploadSupported(fileSize))
+                {
+                    CloseJournal(handle, false);
+                }
+                SubmitUpload(handle);
+                return;
+            }
+
+            // a part counts as done only if S3 has it exactly as it was journaled.
+            Aws::Map<int, Aws::String> verifiedParts;
+            uint64_t partCount = (state.totalSize + state.partSize - 1) / state.partSize;
+            for (const auto& journaledPart : state.completedParts)
+            {
+                auto uploadedPart = uploadedParts.find(journaledPart.first);
+                uint64_t partSize = (std::min)(state.totalSize - (journaledPart.first - 1) * state.partSize, state.partSize);
+                if (uploadedPart != uploadedParts.end() && uploadedPart->second.GetETag() == journaledPart.second &&
+                    static_cast<uint64_t>(uploadedPart->second.GetSize()) == partSize)
+                {
+                    verifiedParts.insert(journaledPart);
+                }
+            }
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] " << verifiedParts.size() << " of "
+                    << partCount << " part(s) of Upload ID: [" << state.multipartId << "] verified against ListParts.");
+
+            RestoreParts(handle, state.totalSize, state.partSize, verifiedParts);
+            if (handle->HasFailedParts())
+            {
+                DoMultiPartUpload(handle);
+            }
+            else
+            {
+                handle->UpdateStatus(TransferStatus::IN_PROGRESS);
+                TriggerTransferStatusUpdatedCallback(handle);
+                FinishMultiPartUpload(handle);
+            }
         }
 
-        void TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
+        void TransferManager::DoResumeDownload(const std::shared_ptr<TransferHandle>& handle, const TransferJournalState& state)
         {
-            assert(m_transferConfig.transferInitiatedCallback);
-            Aws::FileSystem::CreateDirectoryIfNotExists(directory.c_str());
-         
-            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
-            auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request,
-                const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
+            Aws::S3::Model::HeadObjectRequest headObjectRequest;
+            headObjectRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+            headObjectRequest.WithBucket(handle->GetBucketName())
+                             .WithKey(handle->GetKey());
+            if (!state.versionId.empty())
+            {
+                headObjectRequest.SetVersionId(state.versionId);
+            }
 
-            Aws::S3::Model::ListObjectsV2Request request;
-            request.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
-            request.WithBucket(bucketName)
-                .WithPrefix(prefix);
+            auto headObjectOutcome = m_transferConfig.s3Client->HeadObject(headObjectRequest);
+            if (!headObjectOutcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId()
+                        << "] Failed to get the object to resume its download from Bucket: ["
+                        << handle->GetBucketName() << "] with Key: [" << handle->GetKey()
+                        << "] " << headObjectOutcome.GetError());
+                handle->SetError(headObjectOutcome.GetError());
+                handle->UpdateStatus(TransferStatus::FAILED);
+                TriggerErrorCallback(handle, headObjectOutcome.GetError());
+                TriggerTransferStatusUpdatedCallback(handle);
+                return;
+            }
 
-            auto context = Aws::MakeShared<DownloadDirectoryContext>(CLASS_TAG);
-            context->rootDirectory = directory;
-            context->prefix = prefix;
+            bool fileExists = false;
+            uint64_t fileSize = GetFileSize(handle->GetTargetFilePath(), fileExists);
+            const auto& headObject = headObjectOutcome.GetResult();
+            if (headObject.GetETag() != state.objectETag || static_cast<uint64_t>(headObject.GetContentLength()) != state.totalSize ||
+                !fileExists || fileSize != state.totalSize)
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] The object in Bucket: [" << handle->GetBucketName()
+                        << "] with Key: [" << handle->GetKey() << "] or the file: " << handle->GetTargetFilePath()
+                        << " changed since the download was journaled. Downloading it again.");
+                // without parts, the download is planned again from the object as it is now.
+                DoDownload(handle);
+                return;
+            }
 
-            m_transferConfig.s3Client->ListObjectsV2Async(request, handler, context);
+            handle->SetContentType(headObject.GetContentType());
+            handle->SetMetadata(headObject.GetMetadata());
+            RestoreParts(handle, state.totalSize, state.partSize, state.completedParts);
+            if (handle->HasFailedParts())
+            {
+                DoDownload(handle);
+            }
+            else
+            {
+                CloseJournal(handle, false);
+                handle->UpdateStatus(TransferStatus::COMPLETED);
+                TriggerTransferStatusUpdatedCallback(handle);
+            }
+        }
+
+        void TransferManager::StartJournal(const std::shared_ptr<TransferHandle>& handle, const TransferJournalState& state)
+        {
+            // a resumed transfer that has to start over keeps its journal.
+            auto journal = handle->GetJournal();
+            if (journal)
+            {
+                if (!journal->Restart(state))
+                {
+                    handle->SetJournal(nullptr);
+                }
+                return;
+            }
+
+            if (m_transferConfig.journalDirectory.empty())
+            {
+                return;
+            }
+
+            Aws::FileSystem::CreateDirectoryIfNotExists(m_transferConfig.journalDirectory.c_str(), true/*create parent dirs*/);
+            Aws::StringStream journalPath;
+            journalPath << m_transferConfig.journalDirectory;
+            if (m_transferConfig.journalDirectory.back() != Aws::FileSystem::PATH_DELIM)
+            {
+                journalPath << Aws::FileSystem::PATH_DELIM;
+            }
+            journalPath << handle->GetId() << ".journal";
+
+            journal = TransferJournal::Create(journalPath.str(), state, m_transferConfig.journalSyncBatchSize);
+            if (journal)
+            {
+                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Journaling transfer to: " << journal->GetPath());
+                handle->SetJournal(journal);
+            }
+            else
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to create a journal in: "
+                        << m_transferConfig.journalDirectory << ". The transfer will not be resumable.");
+            }
+        }
+
+        void TransferManager::CloseJournal(const std::shared_ptr<TransferHandle>& handle, bool resumable)
+        {
+            auto journal = handle->GetJournal();
+            if (!journal)
+            {
+                return;
+            }
+
+            if (resumable)
+            {
+                journal->Sync();
+            }
+            else
+            {
+                journal->Remove();
+                handle->SetJournal(nullptr);
+            }
         }
 
         void TransferManager::DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle)
         {
+            if (m_transferConfig.fileBackedUploads)
+            {
+                DoFileBackedMultiPartUpload(handle);
+                return;
+            }
+            // the parts of a resumed upload were sized by whoever journaled it, possibly larger than a transfer buffer.
+            if (!handle->GetMultiPartId().empty() && handle->GetPartSize() > m_transferConfig.bufferSize)
+            {
+                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Parts of " << handle->GetPartSize()
+                        << " bytes do not fit in a transfer buffer of " << m_transferConfig.bufferSize << " bytes. Uploading them from the file.");
+                DoFileBackedMultiPartUpload(handle);
+                return;
+            }
 #ifdef _MSC_VER
             auto wide = Aws::Utils::StringUtils::ToWString(handle->GetTargetFilePath().c_str());
             auto streamToPut = Aws::MakeShared<Aws::FStream>(CLASS_TAG, wide.c_str(), std::ios_base::in | std::ios_base::binary);
@@ -262,13 +651,38 @@ namespace Aws
 #endif
         }
 
-        void TransferManager::DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle)
+        uint64_t TransferManager::ComputePartSize(uint64_t totalSize, bool fileBacked) const
+        {
+            // buffered parts have to fit in a transfer buffer.
+            if (!m_transferConfig.autoTune || !fileBacked)
+            {
+                return m_transferConfig.bufferSize;
+            }
+
+            return ComputeAutoTunedPartSize(totalSize, m_transferConfig.bufferSize);
+        }
+
+        std::shared_ptr<PartsInFlightController> TransferManager::CreatePartsInFlightController(const std::shared_ptr<TransferHandle>& handle, bool fileBacked) const
+        {
+            if (!m_transferConfig.autoTune)
+            {
+                return nullptr;
+            }
+
+            size_t maxLimit = fileBacked ? m_transferConfig.maxFileBackedPartsInFlight
+                                         : static_cast<size_t>(m_transferConfig.transferBufferMaxHeapSize / m_transferConfig.bufferSize);
+            auto partsInFlight = Aws::MakeShared<PartsInFlightController>(CLASS_TAG, handle->GetPartSize(), maxLimit);
+            handle->SetMaxPartsInFlight(partsInFlight->GetLimit());
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Auto-tuning with part size " << handle->GetPartSize()
+                    << " bytes, starting at " << partsInFlight->GetLimit() << " part(s) in flight, up to " << maxLimit << ".");
+            return partsInFlight;
+        }
+
+        bool TransferManager::InitializePartsForUpload(const std::shared_ptr<TransferHandle>& handle, bool fileBacked)
         {
             handle->SetIsMultipart(true);
 
             bool isRetry = !handle->GetMultiPartId().empty();
-            uint64_t sentBytes = 0;
-
             if (!isRetry)
             {
                 Aws::S3::Model::CreateMultipartUploadRequest createMultipartRequest = m_transferConfig.createMultipartUploadTemplate;
@@ -283,7 +697,9 @@ namespace Aws
                 {
                     handle->SetMultipartId(createMultipartResponse.GetResult().GetUploadId());
                     uint64_t totalSize = handle->GetBytesTotalSize();
-                    uint64_t partCount = ( totalSize + m_transferConfig.bufferSize - 1 ) / m_transferConfig.bufferSize;
+                    uint64_t partSize = ComputePartSize(totalSize, fileBacked);
+                    uint64_t partCount = ( totalSize + partSize - 1 ) / partSize;
+                    handle->SetPartSize(partSize);
                     AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId()
                             << "] Successfully created a multi-part upload request. Upload ID: ["
                             << createMultipartResponse.GetResult().GetUploadId()
@@ -291,9 +707,35 @@ namespace Aws
 
                     for (uint64_t i = 0; i < partCount; ++i)
                     {
-                        uint64_t partSize = (std::min)(totalSize - i * m_transferConfig.bufferSize, m_transferConfig.bufferSize);
+                        uint64_t sizeOfPart = (std::min)(totalSize - i * partSize, partSize);
                         bool lastPart = (i == partCount - 1) ? true : false;
-                        handle->AddQueuedPart(Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, static_cast<size_t>(partSize), lastPart));
+                        auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, static_cast<size_t>(sizeOfPart), lastPart);
+                        partState->SetRangeBegin(static_cast<size_t>(i * partSize));
+                        handle->AddQueuedPart(partState);
+                    }
+
+                    // only uploads of files can be picked up again from another process.
+                    if (!handle->GetTargetFilePath().empty())
+                    {
+                        TransferJournalState journalState;
+                        journalState.direction = TransferDirection::UPLOAD;
+                        journalState.bucketName = handle->GetBucketName();
+                        journalState.keyName = handle->GetKey();
+                        journalState.filePath = handle->GetTargetFilePath();
+                        journalState.contentType = handle->GetContentType();
+                        journalState.totalSize = totalSize;
+                        journalState.partSize = partSize;
+                        journalState.multipartId = handle->GetMultiPartId();
+                        journalState.metadata = handle->GetMetadata();
+                        if (Aws::Utils::Stream::ReadOnlyFile(handle->GetTargetFilePath()).GetLastModified(journalState.fileLastModified))
+                        {
+                            StartJournal(handle, journalState);
+                        }
+                        else
+                        {
+                            AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Not journaling upload, as the time file: "
+                                    << handle->GetTargetFilePath() << " was last written could not be read.");
+                        }
                     }
                 }
                 else
@@ -306,7 +748,7 @@ namespace Aws
 
                     TriggerErrorCallback(handle, createMultipartResponse.GetError());
                     TriggerTransferStatusUpdatedCallback(handle);
-                    return;
+                    return false;
                 }
             }
             else
@@ -320,69 +762,55 @@ namespace Aws
                     handle->AddQueuedPart(failedParts.second);
                 }
 
-                sentBytes = handle->GetBytesTotalSize() - bytesLeft;
-
                 AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId()
                             << "] Retrying multi-part upload for " << failedPartsSize
                             << " failed parts of total size " << bytesLeft << " bytes. Upload ID ["
                             << handle->GetMultiPartId() << "].");
             }
 
-            //still consistent
-            PartStateMap queuedParts = handle->GetQueuedParts();
-            auto partsIter = queuedParts.begin();
-
             handle->UpdateStatus(TransferStatus::IN_PROGRESS);
             TriggerTransferStatusUpdatedCallback(handle);
+            return true;
+        }
+
+        void TransferManager::DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle)
+        {
+            if (!InitializePartsForUpload(handle, false))
+            {
+                return;
+            }
 
+            //still consistent
+            PartStateMap queuedParts = handle->GetQueuedParts();
+            auto partsIter = queuedParts.begin();
+            auto partsInFlight = CreatePartsInFlightController(handle, false);
 
-            while (sentBytes < handle->GetBytesTotalSize() && handle->ShouldContinue() && partsIter != queuedParts.end())
+            while (handle->ShouldContinue() && partsIter != queuedParts.end())
             {
+                if (partsInFlight)
+                {
+                    partsInFlight->WaitForSlot();
+                }
                 auto buffer = m_bufferManager.Acquire();
                 if(handle->ShouldContinue())
                 {
                     auto lengthToWrite = partsIter->second->GetSizeInBytes();
-                    streamToPut->seekg((partsIter->first - 1) * m_transferConfig.bufferSize);
+                    streamToPut->seekg(partsIter->second->GetRangeBegin());
                     streamToPut->read(reinterpret_cast<char*>(buffer), lengthToWrite);
 
                     auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
                     auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
 
-                    auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
-                    PartPointer partPtr = partsIter->second;
-                    Aws::S3::Model::UploadPartRequest uploadPartRequest = m_transferConfig.uploadPartTemplate;
-                    uploadPartRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
-                    uploadPartRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
-                    uploadPartRequest.SetDataSentEventHandler([self, handle, partPtr](const Aws::Http::HttpRequest*, long long amount){ partPtr->OnDataTransferred(amount, handle); self->TriggerUploadProgressCallback(handle); });
-                    uploadPartRequest.SetRequestRetryHandler([partPtr](const AmazonWebServiceRequest&){ partPtr->Reset(); });
-                    uploadPartRequest.WithBucket(handle->GetBucketName())
-                        .WithContentLength(static_cast<long long>(lengthToWrite))
-                        .WithKey(handle->GetKey())
-                        .WithPartNumber(partsIter->first)
-                        .WithUploadId(handle->GetMultiPartId());
-
-                    handle->AddPendingPart(partsIter->second);
-
-                    uploadPartRequest.SetBody(preallocatedStreamReader);
-                    uploadPartRequest.SetContentType(handle->GetContentType());
-                    auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
-                    asyncContext->handle = handle;
-                    asyncContext->partState = partsIter->second;
-
-                    auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::UploadPartRequest& request,
-                        const Aws::S3::Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
-                    {
-                        self->HandleUploadPartResponse(client, request, outcome, context);
-                    };
-
-                    m_transferConfig.s3Client->UploadPartAsync(uploadPartRequest, callback, asyncContext);
-                    sentBytes += lengthToWrite;
-
+                    SubmitUploadPart(handle, partsIter->second, preallocatedStreamReader, false, partsInFlight);
                     ++partsIter;
                 }
                 else
                 {
                     m_bufferManager.Release(buffer);
+                    if (partsInFlight)
+                    {
+                        partsInFlight->ReleaseSlot();
+                    }
                 }
             }
             //parts get moved from queued to pending on this thread.
@@ -399,6 +827,111 @@ namespace Aws
             }
         }
 
+        void TransferManager::DoFileBackedMultiPartUpload(const std::shared_ptr<TransferHandle>& handle)
+        {
+            auto fileToPut = Aws::MakeShared<Aws::Utils::Stream::ReadOnlyFile>(CLASS_TAG, handle->GetTargetFilePath());
+            if (!fileToPut->IsOpen())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to open file: "
+                        << handle->GetTargetFilePath() << " to upload to bucket: " << handle->GetBucketName() << " with key: " << handle->GetKey());
+                Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::Client::AWSError<Aws::Client::CoreErrors>(static_cast<Aws::Client::CoreErrors>(Aws::S3::S3Errors::NO_SUCH_UPLOAD),
+                        "NoSuchUpload", "The requested file could not be opened.", false));
+                handle->SetError(error);
+                handle->UpdateStatus(TransferStatus::FAILED);
+                TriggerErrorCallback(handle, error);
+                TriggerTransferStatusUpdatedCallback(handle);
+                return;
+            }
+
+            if (!InitializePartsForUpload(handle, true))
+            {
+                return;
+            }
+
+            PartStateMap queuedParts = handle->GetQueuedParts();
+            auto partsIter = queuedParts.begin();
+            auto partsInFlight = CreatePartsInFlightController(handle, true);
+
+            while (handle->ShouldContinue() && partsIter != queuedParts.end())
+            {
+                if (partsInFlight)
+                {
+                    partsInFlight->WaitForSlot();
+                }
+                // parts hold no buffer while in flight, so they are only bounded by the slots.
+                m_fileBackedPartSlots.WaitOne();
+                if (!handle->ShouldContinue())
+                {
+                    m_fileBackedPartSlots.Release();
+                    if (partsInFlight)
+                    {
+                        partsInFlight->ReleaseSlot();
+                    }
+                    break;
+                }
+
+                auto partStream = Aws::MakeShared<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
+                        Aws::MakeUnique<Aws::Utils::Stream::FileRangeStreamBuf>(CLASS_TAG, fileToPut, partsIter->second->GetRangeBegin(), partsIter->second->GetSizeInBytes()));
+
+                SubmitUploadPart(handle, partsIter->second, partStream, true, partsInFlight);
+                ++partsIter;
+            }
+
+            for (; partsIter != queuedParts.end(); ++partsIter)
+            {
+                handle->ChangePartToFailed(partsIter->second);
+            }
+
+            if (handle->HasFailedParts())
+            {
+                handle->UpdateStatus(DetermineIfFailedOrCanceled(*handle));
+                TriggerTransferStatusUpdatedCallback(handle);
+            }
+        }
+
+        void TransferManager::SubmitUploadPart(const std::shared_ptr<TransferHandle>& handle, const PartPointer& partState, const std::shared_ptr<Aws::IOStream>& body, bool fileBacked,
+                                               const std::shared_ptr<PartsInFlightController>& partsInFlight)
+        {
+            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+            PartPointer partPtr = partState;
+            Aws::S3::Model::UploadPartRequest uploadPartRequest = m_transferConfig.uploadPartTemplate;
+            uploadPartRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+            uploadPartRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
+            uploadPartRequest.SetDataSentEventHandler([self, handle, partPtr](const Aws::Http::HttpRequest*, long long amount){ partPtr->OnDataTransferred(amount, handle); self->TriggerUploadProgressCallback(handle); });
+            uploadPartRequest.SetRequestRetryHandler([partPtr, partsInFlight](const AmazonWebServiceRequest&)
+            {
+                partPtr->Reset();
+                if (partsInFlight)
+                {
+                    partsInFlight->OnPartRetried();
+                }
+            });
+            uploadPartRequest.WithBucket(handle->GetBucketName())
+                .WithContentLength(static_cast<long long>(partState->GetSizeInBytes()))
+                .WithKey(handle->GetKey())
+                .WithPartNumber(partState->GetPartId())
+                .WithUploadId(handle->GetMultiPartId());
+
+            handle->AddPendingPart(partState);
+
+            uploadPartRequest.SetBody(body);
+            uploadPartRequest.SetContentType(handle->GetContentType());
+            auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
+            asyncContext->handle = handle;
+            asyncContext->partState = partState;
+            asyncContext->fileBackedPart = fileBacked;
+            asyncContext->partsInFlight = partsInFlight;
+
+            auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::UploadPartRequest& request,
+                const Aws::S3::Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+            {
+                self->HandleUploadPartResponse(client, request, outcome, context);
+            };
+
+            asyncContext->partStartTime = std::chrono::steady_clock::now();
+            m_transferConfig.s3Client->UploadPartAsync(uploadPartRequest, callback, asyncContext);
+        }
+
         void TransferManager::DoSinglePartUpload(const std::shared_ptr<TransferHandle>& handle)
         {
 #ifdef _MSC_VER
@@ -474,10 +1007,20 @@ namespace Aws
             std::shared_ptr<TransferHandleAsyncContext> transferContext =
                 std::const_pointer_cast<TransferHandleAsyncContext>(std::static_pointer_cast<const TransferHandleAsyncContext>(context));
 
-            auto originalStreamBuffer = (Aws::Utils::Stream::PreallocatedStreamBuf*)request.GetBody()->rdbuf();
+            if (transferContext->fileBackedPart)
+            {
+                // the part's stream owns its stream buf, there is no buffer to return.
+                m_fileBackedPartSlots.Release();
+            }
+            else
+            {
+                auto originalStreamBuffer = (Aws::Utils::Stream::PreallocatedStreamBuf*)request.GetBody()->rdbuf();
+
+                m_bufferManager.Release(originalStreamBuffer->GetBuffer());
+                Aws::Delete(originalStreamBuffer);
+            }
+            ReleasePartInFlight(*transferContext, outcome.IsSuccess());
 
-            m_bufferManager.Release(originalStreamBuffer->GetBuffer());
-            Aws::Delete(originalStreamBuffer);
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
 
@@ -485,6 +1028,12 @@ namespace Aws
             {
                 if (handle->ShouldContinue())
                 {
+                    // recorded first, so the last part to finish commits this record when it closes the journal.
+                    auto journal = handle->GetJournal();
+                    if (journal)
+                    {
+                        journal->RecordCompletedPart(partState->GetPartId(), outcome.GetResult().GetETag());
+                    }
                     handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
                     AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId()
                             << " successfully uploaded Part: [" << partState->GetPartId() << "] to Bucket: ["
@@ -517,7 +1066,11 @@ namespace Aws
             }
 
             TriggerTransferStatusUpdatedCallback(handle);
+            FinishMultiPartUpload(handle);
+        }
 
+        void TransferManager::FinishMultiPartUpload(const std::shared_ptr<TransferHandle>& handle)
+        {
             PartStateMap pendingParts, queuedParts, failedParts, completedParts;
             handle->GetAllPartsTransactional(queuedParts, pendingParts, failedParts, completedParts);
 
@@ -551,6 +1104,7 @@ namespace Aws
                                 << "] Multi-part upload completed successfully to Bucket: ["
                                 << handle->GetBucketName() << "] with Key: [" << handle->GetKey()
                                 << "] with Upload ID: [" << handle->GetMultiPartId() << "].");
+                        CloseJournal(handle, false);
                         handle->UpdateStatus(TransferStatus::COMPLETED);
                     }
                     else
@@ -561,6 +1115,7 @@ namespace Aws
                                 << "] with Upload ID: [" << handle->GetMultiPartId()
                                 << "]. " << completeUploadOutcome.GetError());
 
+                        CloseJournal(handle, true);
                         handle->UpdateStatus(DetermineIfFailedOrCanceled(*handle));
                     }
                 }
@@ -569,6 +1124,7 @@ namespace Aws
                     AWS_LOGSTREAM_TRACE(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] " << failedParts.size()
                             << " Failed parts. " << handle->GetBytesTransferred() << " bytes transferred out of "
                             << handle->GetBytesTotalSize() << " total bytes.");
+                    CloseJournal(handle, true);
                     handle->UpdateStatus(DetermineIfFailedOrCanceled(*handle));
                 }
                 TriggerTransferStatusUpdatedCallback(handle);
@@ -622,7 +1178,10 @@ namespace Aws
             {
                 DownloadConfiguration retryDownloadConfig;
                 retryDownloadConfig.versionId = retryHandle->GetVersionId();
-                return DownloadFile(retryHandle->GetBucketName(), retryHandle->GetKey(), retryHandle->GetCreateDownloadStreamFunction(), retryDownloadConfig, retryHandle->GetTargetFilePath());
+                auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, retryHandle->GetBucketName(), retryHandle->GetKey(),
+                                                              retryHandle->GetCreateDownloadStreamFunction(), retryHandle->GetTargetFilePath());
+                handle->SetDownloadingToTargetFile(retryHandle->IsDownloadingToTargetFile());
+                return SubmitDownload(handle, retryDownloadConfig, nullptr);
             }
 
             retryHandle->UpdateStatus(TransferStatus::NOT_STARTED);
@@ -700,7 +1259,6 @@ namespace Aws
         bool TransferManager::InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle)
         {
             bool isRetry = handle->HasParts();
-            size_t bufferSize = static_cast<size_t>(m_transferConfig.bufferSize);
             if (!isRetry)
             {
                 Aws::S3::Model::HeadObjectRequest headObjectRequest;
@@ -737,18 +1295,40 @@ namespace Aws
                     handle->SetVersionId(headObjectOutcome.GetResult().GetVersionId());
                 }
 
+                std::size_t partSize = static_cast<size_t>(ComputePartSize(downloadSize, IsFileBackedDownload(*handle)));
                 // For empty file, we create 1 part here to make downloading behaviors consistent for files with different size.
-                std::size_t partCount = (std::max)((downloadSize + bufferSize - 1) / bufferSize, static_cast<std::size_t>(1));
+                std::size_t partCount = (std::max)((downloadSize + partSize - 1) / partSize, static_cast<std::size_t>(1));
                 handle->SetIsMultipart(partCount > 1);    // doesn't make a difference but let's be accurate
+                handle->SetPartSize(partSize);
 
                 for(std::size_t i = 0; i < partCount; ++i)
                 {
-                    std::size_t partSize = (i + 1 < partCount ) ? bufferSize : (downloadSize - bufferSize * (partCount - 1));
+                    std::size_t sizeOfPart = (i + 1 < partCount ) ? partSize : (downloadSize - partSize * (partCount - 1));
                     bool lastPart = (i == partCount - 1) ? true : false;
-                    auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, partSize, lastPart);
-                    partState->SetRangeBegin(i * bufferSize);
+                    auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, sizeOfPart, lastPart);
+                    partState->SetRangeBegin(i * partSize);
                     handle->AddQueuedPart(partState);
                 }
+
+                // only a download that writes its parts in place can pick up the parts already in the file again.
+                if (partCount > 1 && IsFileBackedDownload(*handle))
+                {
+                    TransferJournalState journalState;
+                    journalState.direction = TransferDirection::DOWNLOAD;
+                    journalState.bucketName = handle->GetBucketName();
+                    journalState.keyName = handle->GetKey();
+                    journalState.filePath = handle->GetTargetFilePath();
+                    journalState.contentType = handle->GetContentType();
+                    journalState.totalSize = downloadSize;
+                    journalState.partSize = partSize;
+                    journalState.versionId = handle->GetVersionId();
+                    journalState.objectETag = headObjectOutcome.GetResult().GetETag();
+                    StartJournal(handle, journalState);
+                }
+                else if (partCount > 1 && !m_transferConfig.journalDirectory.empty())
+                {
+                    AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Not journaling download, as it is not file backed.");
+                }
             }
             else
             {
@@ -763,6 +1343,7 @@ namespace Aws
 
         void TransferManager::DoDownload(const std::shared_ptr<TransferHandle>& handle)
         {
+            bool isRetry = handle->HasParts();
             if (!InitializePartsForDownload(handle))
             {
                 return;
@@ -771,7 +1352,6 @@ namespace Aws
             TriggerTransferStatusUpdatedCallback(handle);
 
             bool isMultipart = handle->IsMultipart();
-            size_t bufferSize = static_cast<size_t>(m_transferConfig.bufferSize);
 
             if(!isMultipart)
             {
@@ -780,23 +1360,79 @@ namespace Aws
                 return;
             }
 
+            std::shared_ptr<Aws::Utils::Stream::WritableFile> fileToWrite;
+            if (IsFileBackedDownload(*handle))
+            {
+                fileToWrite = Aws::MakeShared<Aws::Utils::Stream::WritableFile>(CLASS_TAG, handle->GetTargetFilePath());
+                // a retry keeps the parts already written, the file is only ever resized to the object's size.
+                if (!fileToWrite->IsOpen() || !fileToWrite->Allocate(handle->GetBytesTotalSize()))
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId()
+                            << "] Failed to open and size file: " << handle->GetTargetFilePath() << " to download object in Bucket: ["
+                            << handle->GetBucketName() << "] with Key: [" << handle->GetKey() << "].");
+                    Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::INTERNAL_FAILURE, "WriteFileFailed",
+                            "The download file could not be opened for writing.", false);
+                    for (auto& queuedPart : handle->GetQueuedParts())
+                    {
+                        handle->ChangePartToFailed(queuedPart.second);
+                    }
+                    // nothing was written yet if the journal was only just started, a retry keeps the parts journaled before.
+                    CloseJournal(handle, isRetry);
+                    handle->SetError(error);
+                    handle->UpdateStatus(TransferStatus::FAILED);
+                    TriggerErrorCallback(handle, error);
+                    TriggerTransferStatusUpdatedCallback(handle);
+                    return;
+                }
+
+                auto journal = handle->GetJournal();
+                if (journal)
+                {
+                    // parts are only journaled once their bytes are on disk.
+                    journal->SetBeforeSyncCallback([fileToWrite]() { return fileToWrite->Sync(); });
+                }
+            }
+
             auto queuedParts = handle->GetQueuedParts();
             auto queuedPartIter = queuedParts.begin();
+            auto partsInFlight = CreatePartsInFlightController(handle, fileToWrite != nullptr);
             while(queuedPartIter != queuedParts.end() && handle->ShouldContinue())
             {
                 const auto& partState = queuedPartIter->second;
-                std::size_t rangeStart = ( partState->GetPartId() - 1 ) * bufferSize;
+                std::size_t rangeStart = partState->GetRangeBegin();
                 std::size_t rangeEnd = rangeStart + partState->GetSizeInBytes() - 1;
-                auto buffer = m_bufferManager.Acquire();
-                partState->SetDownloadBuffer(buffer);
+                unsigned char* buffer = nullptr;
+                CreateDownloadStreamCallback responseStreamFunction;
 
-                CreateDownloadStreamCallback responseStreamFunction = [partState, buffer, rangeEnd, rangeStart]() 
+                if (partsInFlight)
+                {
+                    partsInFlight->WaitForSlot();
+                }
+                if (fileToWrite)
                 {
-                    auto bufferStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG, 
-                            Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, rangeEnd - rangeStart + 1));
-                    partState->SetDownloadPartStream(bufferStream);
-                    return bufferStream;
-                };
+                    // parts hold no buffer while in flight, so they are only bounded by the slots.
+                    m_fileBackedPartSlots.WaitOne();
+                    responseStreamFunction = [partState, fileToWrite, rangeEnd, rangeStart]()
+                    {
+                        auto fileStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
+                                Aws::MakeUnique<Aws::Utils::Stream::FileRangeWriteStreamBuf>(CLASS_TAG, fileToWrite, rangeStart, rangeEnd - rangeStart + 1));
+                        partState->SetDownloadPartStream(fileStream);
+                        return fileStream;
+                    };
+                }
+                else
+                {
+                    buffer = m_bufferManager.Acquire();
+                    partState->SetDownloadBuffer(buffer);
+
+                    responseStreamFunction = [partState, buffer, rangeEnd, rangeStart]()
+                    {
+                        auto bufferStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
+                                Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, rangeEnd - rangeStart + 1));
+                        partState->SetDownloadPartStream(bufferStream);
+                        return bufferStream;
+                    };
+                }
 
                 if(handle->ShouldContinue())
                 {
@@ -822,15 +1458,21 @@ namespace Aws
                         self->TriggerDownloadProgressCallback(handle);
                     });
 
-                    getObjectRangeRequest.SetRequestRetryHandler([self, partState, handle](const Aws::AmazonWebServiceRequest&)
+                    getObjectRangeRequest.SetRequestRetryHandler([self, partState, handle, partsInFlight](const Aws::AmazonWebServiceRequest&)
                     {
                         partState->Reset();
+                        if (partsInFlight)
+                        {
+                            partsInFlight->OnPartRetried();
+                        }
                         self->TriggerDownloadProgressCallback(handle);
                     });
 
                     auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
                     asyncContext->handle = handle;
                     asyncContext->partState = partState;
+                    asyncContext->fileBackedPart = fileToWrite != nullptr;
+                    asyncContext->partsInFlight = partsInFlight;
 
                     auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::GetObjectRequest& request,
                         const Aws::S3::Model::GetObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
@@ -840,12 +1482,24 @@ namespace Aws
 
                     handle->AddPendingPart(partState);
 
+                    asyncContext->partStartTime = std::chrono::steady_clock::now();
                     m_transferConfig.s3Client->GetObjectAsync(getObjectRangeRequest, callback, asyncContext);
                     ++queuedPartIter;
                 }
-                else if(buffer)
+                else
                 {
-                    m_bufferManager.Release(buffer);
+                    if(buffer)
+                    {
+                        m_bufferManager.Release(buffer);
+                    }
+                    else
+                    {
+                        m_fileBackedPartSlots.Release();
+                    }
+                    if (partsInFlight)
+                    {
+                        partsInFlight->ReleaseSlot();
+                    }
                     break;
                 }
             }
@@ -893,8 +1547,31 @@ namespace Aws
                 {
                     Aws::IOStream* bufferStream = partState->GetDownloadPartStream();
                     assert(bufferStream);
-                    handle->WritePartToDownloadStream(bufferStream, partState->GetRangeBegin());
-                    handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    if (!transferContext->fileBackedPart)
+                    {
+                        handle->WritePartToDownloadStream(bufferStream, partState->GetRangeBegin());
+                        handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    }
+                    else if (bufferStream->good())
+                    {
+                        // the body was written to the file at the part's offset as it arrived.
+                        auto journal = handle->GetJournal();
+                        if (journal)
+                        {
+                            journal->RecordCompletedPart(partState->GetPartId(), outcome.GetResult().GetETag());
+                        }
+                        handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    }
+                    else
+                    {
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId()
+                                << "] Failed to write part [" << partState->GetPartId() << "] to file: " << handle->GetTargetFilePath());
+                        Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::INTERNAL_FAILURE, "WriteFileFailed",
+                                "The downloaded part could not be written to the file.", true);
+                        handle->ChangePartToFailed(partState);
+                        handle->SetError(error);
+                        TriggerErrorCallback(handle, error);
+                    }
                 }
                 else
                 {
@@ -908,6 +1585,11 @@ namespace Aws
                 m_bufferManager.Release(partState->GetDownloadBuffer());
                 partState->SetDownloadBuffer(nullptr);
             }
+            else if (transferContext->fileBackedPart)
+            {
+                m_fileBackedPartSlots.Release();
+            }
+            ReleasePartInFlight(*transferContext, outcome.IsSuccess());
 
             TriggerTransferStatusUpdatedCallback(handle);
 
@@ -918,10 +1600,12 @@ namespace Aws
             {
                 if (failedParts.size() == 0 && handle->GetBytesTransferred() == handle->GetBytesTotalSize())
                 {
+                    CloseJournal(handle, false);
                     handle->UpdateStatus(TransferStatus::COMPLETED);
                 }
                 else
                 {
+                    CloseJournal(handle, true);
                     handle->UpdateStatus(DetermineIfFailedOrCanceled(*handle));
                 }
                 TriggerTransferStatusUpdatedCallback(handle);
@@ -956,6 +1640,7 @@ namespace Aws
                             "] Successfully aborted multi-part upload. In Bucket: ["
                             << canceledHandle->GetBucketName() << "] with Key: [" << canceledHandle->GetKey()
                             << "] with Upload ID: [" << canceledHandle->GetMultiPartId() << "].");
+                    CloseJournal(canceledHandle, false);
                     canceledHandle->UpdateStatus(TransferStatus::ABORTED);
                     TriggerTransferStatusUpdatedCallback(canceledHandle);
                 }
@@ -981,64 +1666,302 @@ namespace Aws
             }
         }
 
-        void TransferManager::HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+        std::shared_ptr<DirectoryTransfer> TransferManager::StartDirectoryTransfer(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName,
+                                                                                   const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
         {
-            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
-            auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
+            size_t windowCapacity = DIRECTORY_WINDOW_FILES_PER_FILE_IN_FLIGHT * (std::max)(m_transferConfig.maxDirectoryFilesInFlight, static_cast<size_t>(1));
+            auto context = Aws::MakeShared<DirectorySyncContext>(CLASS_TAG, direction, directory, prefix, m_transferConfig.skipUnchangedFiles,
+                                                                 m_transferConfig.bufferSize, windowCapacity);
+            context->manager = shared_from_this(); // keep transfer manager alive until the directory transfer is finished.
+            context->directoryTransfer = Aws::MakeShared<DirectoryTransfer>(CLASS_TAG, direction, directory, bucketName, prefix);
+            context->metadata = metadata;
+            // the file transfers find their way back to the directory transfer through their handles; cleared once it is finished.
+            context->directoryTransfer->SetFileFinishedCallback([context]() { context->manager->SubmitPumpDirectoryTransfer(context); });
+
+            SubmitPumpDirectoryTransfer(context);
+            return context->directoryTransfer;
+        }
 
-            auto downloadContext = std::static_pointer_cast<const DownloadDirectoryContext>(context);
-            const auto& directory = downloadContext->rootDirectory;
-            const auto& prefix = downloadContext->prefix;
+        /**
+         * Pumping may hash local files to tell whether they changed, so it never runs on the S3 client's callback threads, only on the transfer executor.
+         */
+        void TransferManager::SubmitPumpDirectoryTransfer(const std::shared_ptr<DirectorySyncContext>& context)
+        {
+            auto self = shared_from_this();
+            m_transferConfig.transferExecutor->Submit([self, context]() { self->PumpDirectoryTransfer(context); });
+        }
 
-            if (outcome.IsSuccess())
+        /**
+         * Moves a directory transfer along: takes files from the source side into the window of files to transfer, starts the smallest of them
+         * while the in-flight limits allow, and asks for more of the listing when it runs low. It is called whenever one of those can make
+         * progress (a file transfer finished, a listing page arrived); if another thread is already pumping, that thread does another round instead.
+         */
+        void TransferManager::PumpDirectoryTransfer(const std::shared_ptr<DirectorySyncContext>& context)
+        {
             {
-                Aws::S3::Model::ListObjectsV2Request requestCpy = request;
+                std::lock_guard<std::mutex> locker(context->lock);
+                if (context->pumping || context->finished)
+                {
+                    context->pumpRequested = true;
+                    return;
+                }
+                context->pumping = true;
+            }
 
-                auto& result = outcome.GetResult();
+            auto& directoryTransfer = context->directoryTransfer;
+            for (;;)
+            {
+                bool skippedFiles = false;
+                while (directoryTransfer->ShouldContinue() && !context->sourceDone && !context->window.IsFull())
+                {
+                    DirectorySyncEntry file;
+                    auto step = context->source.Next(file);
+                    if (step == DirectorySyncStep::WAIT_FOR_LISTING)
+                    {
+                        break;
+                    }
+                    if (step == DirectorySyncStep::DONE)
+                    {
+                        context->sourceDone = true;
+                        break;
+                    }
+                    if (step == DirectorySyncStep::SKIP)
+                    {
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Skipping unchanged file: " << file.relativeKey << " in bucket: [" << directoryTransfer->GetBucketName() << "]");
+                        directoryTransfer->AddSkippedFile(file.size);
+                        ReportSkippedDirectoryFile(*context, file);
+                        skippedFiles = true;
+                        continue;
+                    }
+
+                    directoryTransfer->AddQueuedFile(file.size);
+                    context->window.Add(std::move(file));
+                }
+
+                if (!directoryTransfer->ShouldContinue())
+                {
+                    context->window.Clear();
+                }
+
+                while (!context->window.IsEmpty())
+                {
+                    uint64_t size = context->window.PeekNext().size;
+                    size_t filesInFlight = directoryTransfer->GetFilesInFlight();
+                    if (filesInFlight >= m_transferConfig.maxDirectoryFilesInFlight ||
+                        (filesInFlight > 0 && directoryTransfer->GetBytesInFlight() + size > m_transferConfig.maxDirectoryBytesInFlight))
+                    {
+                        break;
+                    }
+
+                    StartDirectoryFile(context, context->window.TakeNext());
+                }
+
+                RequestDirectoryListing(context);
+
+                if (skippedFiles)
+                {
+                    TriggerDirectoryTransferUpdatedCallback(directoryTransfer);
+                }
+
+                bool done = (context->sourceDone || !directoryTransfer->ShouldContinue()) && context->window.IsEmpty() && directoryTransfer->GetFilesInFlight() == 0;
+                {
+                    std::lock_guard<std::mutex> locker(context->lock);
+                    if (!done && context->pumpRequested)
+                    {
+                        context->pumpRequested = false;
+                        continue;
+                    }
+
+                    context->pumping = false;
+                    context->finished = done;
+                }
+
+                if (done)
+                {
+                    FinishDirectoryTransfer(context);
+                }
+                return;
+            }
+        }
+
+        void TransferManager::StartDirectoryFile(const std::shared_ptr<DirectorySyncContext>& context, const DirectorySyncEntry& file)
+        {
+            const auto& bucketName = context->directoryTransfer->GetBucketName();
+            std::shared_ptr<TransferHandle> handle;
+            if (context->directoryTransfer->GetTransferDirection() == TransferDirection::UPLOAD)
+            {
+                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Uploading file: " << file.filePath
+                        << " as part of directory upload to S3 Bucket: [" << bucketName << "] and Key: ["
+                        << file.key << "].");
+                handle = UploadFile(file.filePath, bucketName, file.key, DEFAULT_CONTENT_TYPE, context->metadata);
+            }
+            else
+            {
+                auto lastDelimter = file.filePath.find_last_of(Aws::FileSystem::PATH_DELIM);
+                if (lastDelimter != std::string::npos)
+                {
+                    Aws::FileSystem::CreateDirectoryIfNotExists(file.filePath.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
+                }
+                AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << file.key <<
+                        "] in bucket: [" << bucketName << "] to destination file: [" << file.filePath << "]");
+                handle = DownloadFile(bucketName, file.key, file.filePath);
+            }
+
+            handle->SetDirectoryTransfer(context->directoryTransfer);
+            if (!context->directoryTransfer->AddInFlightFile(handle, file.size))
+            {
+                // it finished already; go around again for the slot it freed.
+                std::lock_guard<std::mutex> locker(context->lock);
+                context->pumpRequested = true;
+            }
+
+            if (m_transferConfig.transferInitiatedCallback)
+            {
+                m_transferConfig.transferInitiatedCallback(this, handle);
+            }
+        }
 
-                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects succeeded for bucket: " << directory <<
-                        " with prefix: " << prefix << ". Number of keys received: " << result.GetContents().size());
+        void TransferManager::ReportSkippedDirectoryFile(const DirectorySyncContext& context, const DirectorySyncEntry& file)
+        {
+            if (!m_transferConfig.transferStatusUpdatedCallback)
+            {
+                return;
+            }
+
+            const auto& bucketName = context.directoryTransfer->GetBucketName();
+            std::shared_ptr<TransferHandle> handle;
+            if (context.directoryTransfer->GetTransferDirection() == TransferDirection::UPLOAD)
+            {
+                handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, bucketName, file.key, file.size, file.filePath);
+            }
+            else
+            {
+                handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, bucketName, file.key, file.filePath);
+                handle->SetBytesTotalSize(file.size);
+            }
+            handle->UpdateStatus(TransferStatus::EXACT_OBJECT_ALREADY_EXISTS);
+            m_transferConfig.transferStatusUpdatedCallback(this, handle);
+        }
 
-                //if it was truncated, we don't care on this pass anyways. Just go ahead and kick off another list objects and will handle it when it finishes.
-                if (result.GetIsTruncated())
+        void TransferManager::RequestDirectoryListing(const std::shared_ptr<DirectorySyncContext>& context)
+        {
+            Aws::S3::Model::ListObjectsV2Request request;
+            {
+                std::lock_guard<std::mutex> locker(context->lock);
+                if (context->listingInFlight || !context->source.NeedsListing(DIRECTORY_LISTING_PREFETCH_KEYS) || !context->directoryTransfer->ShouldContinue())
+                {
+                    return;
+                }
+                context->listingInFlight = true;
+                if (!context->continuationToken.empty())
                 {
-                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects response has a continuation token for bucket: "
-                            << directory << " with prefix: " << prefix << ". Getting the next set of results.");
-                    requestCpy.SetContinuationToken(result.GetNextContinuationToken());
-                    m_transferConfig.s3Client->ListObjectsV2Async(requestCpy, handler, context);
+                    request.SetContinuationToken(context->continuationToken);
                 }
+            }
+
+            request.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+            request.WithBucket(context->directoryTransfer->GetBucketName())
+                .WithPrefix(context->listPrefix);
+
+            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+            auto handler = [self, context](const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request&, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { self->HandleDirectoryListObjectsResponse(context, outcome); };
+            m_transferConfig.s3Client->ListObjectsV2Async(request, handler);
+        }
 
-                //this can contain matching directories or actual objects to download. If it's a directory, go ahead and create a local directory then
-                // take the new prefix and call list again. if it's an object key, go ahead and initiate download.
+        void TransferManager::HandleDirectoryListObjectsResponse(const std::shared_ptr<DirectorySyncContext>& context, const Aws::S3::Model::ListObjectsV2Outcome& outcome)
+        {
+            const auto& directoryTransfer = context->directoryTransfer;
+            const auto& directory = directoryTransfer->GetDirectory();
+
+            if (outcome.IsSuccess())
+            {
+                auto& result = outcome.GetResult();
+                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects succeeded for bucket: " << directoryTransfer->GetBucketName() <<
+                        " with prefix: " << context->listPrefix << ". Number of keys received: " << result.GetContents().size());
+
+                Aws::Deque<DirectorySyncEntry> objects;
                 for (auto& content : result.GetContents())
                 {
-                    if (!IsS3KeyPrefix(content.GetKey()))
+                    // keys ending with a delimiter stand for directories.
+                    if (IsS3KeyPrefix(content.GetKey()))
                     {
-                        Aws::String fileName = DetermineFilePath(downloadContext->rootDirectory, downloadContext->prefix, content.GetKey());
-                        auto lastDelimter = fileName.find_last_of(Aws::FileSystem::PATH_DELIM);
-                        if (lastDelimter != std::string::npos)
+                        continue;
+                    }
+
+                    DirectorySyncEntry object;
+                    object.key = content.GetKey();
+                    object.size = static_cast<uint64_t>(content.GetSize());
+                    object.lastModified = content.GetLastModified();
+                    object.eTag = content.GetETag();
+                    if (directoryTransfer->GetTransferDirection() == TransferDirection::UPLOAD)
+                    {
+                        object.relativeKey = object.key.substr(context->listPrefix.size());
+                    }
+                    else
+                    {
+                        object.filePath = DetermineFilePath(directory, directoryTransfer->GetPrefix(), object.key);
+                        // the local counterpart, if the key maps to a file inside the directory. Otherwise it never matches one.
+                        if (object.filePath.compare(0, directory.size(), directory) == 0 &&
+                            (directory.empty() || directory.back() == Aws::FileSystem::PATH_DELIM || object.filePath[directory.size()] == Aws::FileSystem::PATH_DELIM))
                         {
-                            Aws::FileSystem::CreateDirectoryIfNotExists(fileName.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
+                            object.relativeKey = object.filePath.substr(directory.size());
+                            object.relativeKey.erase(0, object.relativeKey.find_first_not_of(Aws::FileSystem::PATH_DELIM));
+                            char delimiter[] = { Aws::FileSystem::PATH_DELIM, 0 };
+                            Aws::Utils::StringUtils::Replace(object.relativeKey, delimiter, "/");
                         }
-                        AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << content.GetKey() <<
-                                "] in bucket: [" << directory << "] to destination file: [" << fileName << "]");
-                        m_transferConfig.transferInitiatedCallback(this, DownloadFile(request.GetBucket(), content.GetKey(), fileName));
                     }
+                    objects.push_back(std::move(object));
                 }
+
+                context->source.AddListedObjects(objects, !result.GetIsTruncated());
+                std::lock_guard<std::mutex> locker(context->lock);
+                context->listingInFlight = false;
+                context->continuationToken = result.GetNextContinuationToken();
             }
             else
             {
-                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Listing objects failed for bucket: " << directory << " with prefix: "
-                        << prefix << ". Error message: " << outcome.GetError());
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Listing objects failed for bucket: " << directoryTransfer->GetBucketName() << " with prefix: "
+                        << context->listPrefix << ". Error message: " << outcome.GetError());
                 //notify user if list objects failed.
                 if (m_transferConfig.errorCallback)
                 {
-                    auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, request.GetBucket(), "");
+                    auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, directoryTransfer->GetBucketName(), "");
                     m_transferConfig.errorCallback(this, handle, outcome.GetError());
                 }
+
+                // an upload goes on without skipping anything; a download has nothing more to go on.
+                Aws::Deque<DirectorySyncEntry> noObjects;
+                context->source.AddListedObjects(noObjects, true);
+                std::lock_guard<std::mutex> locker(context->lock);
+                context->listingInFlight = false;
+                context->listingFailed = directoryTransfer->GetTransferDirection() == TransferDirection::DOWNLOAD;
             }
+
+            SubmitPumpDirectoryTransfer(context);
+        }
+
+        void TransferManager::FinishDirectoryTransfer(const std::shared_ptr<DirectorySyncContext>& context)
+        {
+            const auto& directoryTransfer = context->directoryTransfer;
+            if (!directoryTransfer->ShouldContinue())
+            {
+                directoryTransfer->UpdateStatus(TransferStatus::CANCELED);
+            }
+            else if (context->listingFailed || directoryTransfer->GetFilesFailed() > 0)
+            {
+                directoryTransfer->UpdateStatus(TransferStatus::FAILED);
+            }
+            else
+            {
+                directoryTransfer->UpdateStatus(TransferStatus::COMPLETED);
+            }
+
+            AWS_LOGSTREAM_INFO(CLASS_TAG, "Directory transfer of " << directoryTransfer->GetDirectory() << " finished with "
+                    << directoryTransfer->GetFilesCompleted() << " files transferred, " << directoryTransfer->GetFilesFailed() << " failed and "
+                    << directoryTransfer->GetFilesSkipped() << " skipped, at " << directoryTransfer->GetThroughput() << " bytes/second.");
+            TriggerDirectoryTransferUpdatedCallback(directoryTransfer);
+            directoryTransfer->SetFileFinishedCallback(nullptr);
         }
 
         Aws::String TransferManager::DetermineFilePath(const Aws::String& directory, const Aws::String& prefix, const Aws::String& keyName)
@@ -1086,6 +2009,25 @@ namespace Aws
             {
                 m_transferConfig.transferStatusUpdatedCallback(this, handle);
             }
+
+            auto directoryTransfer = handle->GetDirectoryTransfer();
+            if (directoryTransfer && directoryTransfer->RemoveInFlightFile(*handle))
+            {
+                TriggerDirectoryTransferUpdatedCallback(directoryTransfer);
+                auto fileFinishedCallback = directoryTransfer->GetFileFinishedCallback();
+                if (fileFinishedCallback)
+                {
+                    fileFinishedCallback();
+                }
+            }
+        }
+
+        void TransferManager::TriggerDirectoryTransferUpdatedCallback(const std::shared_ptr<const DirectoryTransfer>& directoryTransfer) const
+        {
+            if (m_transferConfig.directoryTransferUpdatedCallback)
+            {
+                m_transferConfig.directoryTransferUpdatedCallback(this, directoryTransfer);
+            }
         }
 
         void TransferManager::TriggerErrorCallback(const std::shared_ptr<const TransferHandle>& handle, const Aws::Client::AWSError<Aws::S3::S3Errors>& error) const
@@ -1096,6 +2038,13 @@ namespace Aws
             }
         }
 
+        bool TransferManager::IsFileBackedDownload(const TransferHandle& handle) const
+        {
+            // a resumed download was journaled as file backed, and keeps writing its parts where they belong in the file.
+            // a stream from the caller's CreateDownloadStreamCallback is always written through, even if a target file path was given too.
+            return (m_transferConfig.fileBackedDownloads || handle.GetJournal()) && handle.IsDownloadingToTargetFile();
+        }
+
         bool TransferManager::MultipartUploadSupported(uint64_t length) const
         {
             return length > m_transferConfig.bufferSize && 
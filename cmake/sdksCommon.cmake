@@ -129,7 +129,7 @@ list(APPEND HIGH_LEVEL_SDK_LIST "text-to-speech")
 
 set(SDK_TEST_PROJECT_LIST "")
 list(APPEND SDK_TEST_PROJECT_LIST "cognito-identity:aws-cpp-sdk-cognitoidentity-integration-tests")
-list(APPEND SDK_TEST_PROJECT_LIST "dynamodb:aws-cpp-sdk-dynamodb-integration-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "dynamodb:aws-cpp-sdk-dynamodb-tests,aws-cpp-sdk-dynamodb-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "identity-management:aws-cpp-sdk-identity-management-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "lambda:aws-cpp-sdk-lambda-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "s3:aws-cpp-sdk-s3-integration-tests")
@@ -155,7 +155,7 @@ set(TEST_DEPENDENCY_LIST "")
 list(APPEND TEST_DEPENDENCY_LIST "cognito-identity:access-management,iam,core")
 list(APPEND TEST_DEPENDENCY_LIST "identity-management:cognito-identity,sts,core")
 list(APPEND TEST_DEPENDENCY_LIST "lambda:access-management,cognito-identity,iam,kinesis,core")
-list(APPEND TEST_DEPENDENCY_LIST "sqs:access-management,cognito-identity,iam,core")
+list(APPEND TEST_DEPENDENCY_LIST "sqs:access-management,cognito-identity,iam,queues,core")
 list(APPEND TEST_DEPENDENCY_LIST "transfer:s3,core")
 list(APPEND TEST_DEPENDENCY_LIST "s3-encryption:s3,kms,core")
 list(APPEND TEST_DEPENDENCY_LIST "s3control:access-management,cognito-identity,iam,core")
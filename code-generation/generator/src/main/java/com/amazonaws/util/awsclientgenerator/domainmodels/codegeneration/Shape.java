@@ -53,6 +53,9 @@ public class Shape {
     private boolean event;
     private boolean exception;
     private boolean sensitive;
+    private boolean jsonReaderDeserializable;
+    private boolean jsonWriterSerializable;
+    private boolean xmlReaderDeserializable;
 
     public boolean isMap() {
         return "map".equals(type.toLowerCase());
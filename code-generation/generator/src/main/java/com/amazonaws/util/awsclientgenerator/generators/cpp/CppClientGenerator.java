@@ -396,4 +396,66 @@ public abstract class CppClientGenerator implements ClientGenerator {
     protected Set<String> getOperationsToRemove(){
         return new HashSet<String>();
     }
+
+    /**
+     * Operations whose results are parsed in a single pass by an XmlReader, through ReadXml() functions generated for
+     * the result and every structure reachable from it, instead of through an XmlDocument. Only rest-xml and ec2
+     * results are read this way; operations whose results can't be (see canReadWithXmlReader) keep using XmlDocument.
+     */
+    protected Set<String> getXmlReaderOperations() {
+        return new HashSet<>();
+    }
+
+    /**
+     * Marks the results of getXmlReaderOperations(), and the structures they reach, as xmlReaderDeserializable.
+     */
+    protected void markXmlReaderShapes(ServiceModel serviceModel) {
+        String protocol = serviceModel.getMetadata().getProtocol();
+        if (!"rest-xml".equals(protocol) && !"ec2".equals(protocol)) {
+            return;
+        }
+
+        for (String operationName : getXmlReaderOperations()) {
+            Operation operation = serviceModel.getOperations().get(operationName);
+            if (operation == null || operation.getResult() == null) {
+                continue;
+            }
+
+            Set<String> reachableShapes = new HashSet<>();
+            if (canReadWithXmlReader(operation.getResult().getShape(), reachableShapes)) {
+                reachableShapes.stream().map(shapeName -> serviceModel.getShapes().get(shapeName))
+                        .filter(shape -> shape != null && shape.isStructure())
+                        .forEach(shape -> shape.setXmlReaderDeserializable(true));
+            }
+        }
+    }
+
+    /**
+     * True if shape and everything reachable from it can be read by the ReadXmlValue() overloads in
+     * aws/core/utils/xml/XmlReader.h. Those don't expose attributes and can't read maps or lists of lists, and
+     * results must come entirely from the payload. Collects the names of the reachable shapes into visitedShapes.
+     */
+    private static boolean canReadWithXmlReader(Shape shape, Set<String> visitedShapes) {
+        if (!visitedShapes.add(shape.getName())) {
+            return true;
+        }
+
+        if (shape.isStructure()) {
+            if (shape.hasHeaderMembers() || shape.hasStatusCodeMembers() || shape.hasStreamMembers()
+                    || shape.hasEventStreamMembers() || shape.getPayload() != null) {
+                return false;
+            }
+            return shape.getMembers().entrySet().stream()
+                    .filter(memberEntry -> !"ResponseMetadata".equals(memberEntry.getKey()))
+                    .map(Map.Entry::getValue)
+                    .allMatch(member -> !member.isXmlAttribute()
+                            && (member.getShape().isEnum() || canReadWithXmlReader(member.getShape(), visitedShapes)));
+        }
+        if (shape.isList()) {
+            Shape valueShape = shape.getListMember().getShape();
+            return !valueShape.isList() && !valueShape.isMap()
+                    && (valueShape.isEnum() || canReadWithXmlReader(valueShape, visitedShapes));
+        }
+        return !shape.isMap();
+    }
 }
@@ -27,7 +27,9 @@ import org.apache.velocity.VelocityContext;
 
 import java.nio.charset.StandardCharsets;
 import java.util.HashMap;
-import java.util.Map;;
+import java.util.HashSet;
+import java.util.Map;
+import java.util.Set;
 
 public class JsonCppClientGenerator extends CppClientGenerator {
 
@@ -35,6 +37,98 @@ public class JsonCppClientGenerator extends CppClientGenerator {
         super();
     }
 
+    @Override
+    public SdkFileEntry[] generateSourceFiles(ServiceModel serviceModel) throws Exception {
+
+        for (String operationName : getJsonReaderOperations()) {
+            Operation operation = serviceModel.getOperations().get(operationName);
+            if (operation == null || operation.getResult() == null) {
+                continue;
+            }
+
+            Set<String> reachableShapes = new HashSet<>();
+            if (canStreamJson(operation.getResult().getShape(), reachableShapes, false)) {
+                reachableShapes.stream().map(shapeName -> serviceModel.getShapes().get(shapeName))
+                        .filter(shape -> shape != null && shape.isStructure())
+                        .forEach(shape -> shape.setJsonReaderDeserializable(true));
+            }
+        }
+
+        for (String operationName : getJsonWriterOperations()) {
+            Operation operation = serviceModel.getOperations().get(operationName);
+            if (operation == null || operation.getRequest() == null) {
+                continue;
+            }
+
+            Set<String> reachableShapes = new HashSet<>();
+            if (canStreamJson(operation.getRequest().getShape(), reachableShapes, true)) {
+                reachableShapes.stream().map(shapeName -> serviceModel.getShapes().get(shapeName))
+                        .filter(shape -> shape != null && shape.isStructure())
+                        .forEach(shape -> shape.setJsonWriterSerializable(true));
+            }
+        }
+
+        return super.generateSourceFiles(serviceModel);
+    }
+
+    /**
+     * Operations whose results are parsed straight from the response stream by a JsonReader, through ReadJson()
+     * functions generated for the result and every structure reachable from it, instead of through a JsonValue.
+     * Operations whose results can't be read this way (see canStreamJson) keep using JsonValue.
+     */
+    protected Set<String> getJsonReaderOperations() {
+        return new HashSet<>();
+    }
+
+    /**
+     * Operations whose request payloads are written by a JsonWriter, through WriteJson() functions generated for
+     * every structure reachable from the request, instead of by building a JsonValue first.
+     * Operations whose requests can't be written this way (see canStreamJson) keep using JsonValue.
+     */
+    protected Set<String> getJsonWriterOperations() {
+        return new HashSet<>();
+    }
+
+    /**
+     * True if the payload of shape and everything reachable from it can be read by the ReadJsonValue() overloads in
+     * aws/core/utils/json/JsonReader.h, or written by the WriteJsonValue() overloads in aws/core/utils/json/JsonWriter.h.
+     * Neither handles enums inside lists and maps, results must come entirely from the payload, and timestamps are
+     * only written as epoch seconds. Collects the names of the reachable shapes into visitedShapes.
+     */
+    private static boolean canStreamJson(Shape shape, Set<String> visitedShapes, boolean forWriting) {
+        if (!visitedShapes.add(shape.getName())) {
+            return true;
+        }
+
+        if (shape.isStructure()) {
+            if (shape.hasStreamMembers() || shape.hasEventStreamMembers() || shape.getPayload() != null) {
+                return false;
+            }
+            if (!forWriting && (shape.hasHeaderMembers() || shape.hasStatusCodeMembers())) {
+                return false;
+            }
+            return shape.getMembers().values().stream().filter(ShapeMember::isUsedForPayload).map(ShapeMember::getShape)
+                    .allMatch(memberShape -> memberShape.isEnum() || canStreamJson(memberShape, visitedShapes, forWriting));
+        }
+        if (shape.isList()) {
+            Shape valueShape = shape.getListMember().getShape();
+            return !valueShape.isEnum() && canStreamJson(valueShape, visitedShapes, forWriting);
+        }
+        if (shape.isMap()) {
+            Shape valueShape = shape.getMapValue().getShape();
+            return shape.getMapKey().getShape().isString() && !valueShape.isEnum()
+                    && canStreamJson(valueShape, visitedShapes, forWriting);
+        }
+        if (shape.isBlob()) {
+            return !shape.isSensitive();
+        }
+        if (shape.isTimeStamp()) {
+            String format = shape.getTimestampFormat();
+            return forWriting ? format == null || "unixTimestamp".equalsIgnoreCase(format) : !"rfc822".equalsIgnoreCase(format);
+        }
+        return true;
+    }
+
     @Override
     protected SdkFileEntry generateErrorMarshallerHeaderFile(ServiceModel serviceModel) throws Exception {
         Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/json/JsonErrorMarshallerHeader.vm", StandardCharsets.UTF_8.name());
@@ -86,6 +86,8 @@ public class QueryCppClientGenerator extends CppClientGenerator {
             operation.getRequest().getShape().setSupportsPresigning(true);
         });
 
+        markXmlReaderShapes(serviceModel);
+
         return super.generateSourceFiles(serviceModel);
     }
 
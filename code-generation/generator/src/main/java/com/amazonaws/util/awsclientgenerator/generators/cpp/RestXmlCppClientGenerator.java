@@ -33,6 +33,11 @@ public class RestXmlCppClientGenerator  extends CppClientGenerator {
         super();
     }
 
+    @Override
+    public SdkFileEntry[] generateSourceFiles(ServiceModel serviceModel) throws Exception {
+        markXmlReaderShapes(serviceModel);
+        return super.generateSourceFiles(serviceModel);
+    }
 
     @Override
     protected SdkFileEntry generateErrorMarshallerHeaderFile(ServiceModel serviceModel) throws Exception {
@@ -36,7 +36,7 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
     @Override
     public SdkFileEntry[] generateSourceFiles(ServiceModel serviceModel) throws Exception {
 
-        // add a helper class that is used for AttributeValue values.
+        // AttributeValueValue.h only forwards to AttributeValue.h now, it is kept so that code including it still builds.
         Shape attributeValueShape = new Shape();
         attributeValueShape.setName("AttributeValueValue");
         attributeValueShape.setType("structure");
@@ -68,15 +68,23 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
                 Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/dynamodb/AttributeValueSource.vm");
                 return makeFile(template, createContext(serviceModel), "source/model/AttributeValue.cpp", true);
             }
-            case "AttributeValueValue": {
-                Template template = velocityEngine.getTemplate("/com/amazonaws/util/awsclientgenerator/velocity/cpp/dynamodb/AttributeValueValueSource.vm");
-                return makeFile(template, createContext(serviceModel), "source/model/AttributeValueValue.cpp", true);
-            }
+            case "AttributeValueValue":
+                return null;
             default:
                 return super.generateModelSourceFile(serviceModel, shapeEntry);
         }
     }
 
+    @Override
+    protected Set<String> getJsonReaderOperations() {
+        return new HashSet<>(Arrays.asList(new String[]{"BatchGetItem", "GetItem", "PutItem", "Query", "Scan"}));
+    }
+
+    @Override
+    protected Set<String> getJsonWriterOperations() {
+        return new HashSet<>(Arrays.asList(new String[]{"BatchWriteItem", "PutItem"}));
+    }
+
     @Override
     protected Set<String> getRetryableErrors() {
         return new HashSet<>(Arrays.asList(new String[]{"LimitExceededException", "ProvisionedThroughputExceededException", "ResourceInUseException", "TransactionInProgressException"}));
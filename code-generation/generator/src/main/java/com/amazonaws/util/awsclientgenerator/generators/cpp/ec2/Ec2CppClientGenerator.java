@@ -20,10 +20,13 @@ import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.*;
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.Error;
 import com.amazonaws.util.awsclientgenerator.generators.cpp.QueryCppClientGenerator;
 
+import java.util.Arrays;
 import java.util.Collection;
+import java.util.HashSet;
 import java.util.LinkedList;
 import java.util.List;
 import java.util.Map;
+import java.util.Set;
 
 public class Ec2CppClientGenerator extends QueryCppClientGenerator{
 
@@ -752,4 +755,12 @@ public class Ec2CppClientGenerator extends QueryCppClientGenerator{
         return super.generateSourceFiles(serviceModel);
     }
 
+    /**
+     * The Describe* calls whose responses grow with the size of an account.
+     */
+    @Override
+    protected Set<String> getXmlReaderOperations() {
+        return new HashSet<>(Arrays.asList(new String[]{"DescribeImages", "DescribeInstances", "DescribeSnapshots", "DescribeVolumes"}));
+    }
+
 }
@@ -0,0 +1,34 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+package com.amazonaws.util.awsclientgenerator.generators.cpp.logs;
+
+import com.amazonaws.util.awsclientgenerator.generators.cpp.JsonCppClientGenerator;
+
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.Set;
+
+public class CloudWatchLogsJsonCppClientGenerator extends JsonCppClientGenerator {
+
+    public CloudWatchLogsJsonCppClientGenerator() throws Exception {
+        super();
+    }
+
+    @Override
+    protected Set<String> getJsonReaderOperations() {
+        return new HashSet<>(Arrays.asList(new String[]{"GetLogEvents"}));
+    }
+}
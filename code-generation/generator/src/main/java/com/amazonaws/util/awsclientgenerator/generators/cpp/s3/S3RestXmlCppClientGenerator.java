@@ -26,6 +26,7 @@ import org.apache.velocity.Template;
 import org.apache.velocity.VelocityContext;
 
 import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
 import java.util.HashSet;
 import java.util.LinkedHashMap;
 import java.util.Map;
@@ -164,6 +165,11 @@ public class S3RestXmlCppClientGenerator  extends RestXmlCppClientGenerator {
         return super.generateSourceFiles(serviceModel);
     }
 
+    @Override
+    protected Set<String> getXmlReaderOperations() {
+        return new HashSet<>(Arrays.asList(new String[]{"ListObjects", "ListObjectsV2", "ListObjectVersions"}));
+    }
+
     protected void hackGetObjectOutputResponse(ServiceModel serviceModel) {
         Shape getObjectResult  = serviceModel.getShapes().get("GetObjectResult");
         if (getObjectResult == null) return;
@@ -86,6 +86,8 @@ public:
                     GetMockSecretAccessKey()), "service", config.region.empty() ? Aws::Region::US_EAST_1 : config.region), nullptr) ,
         m_countedRetryStrategy(std::static_pointer_cast<CountedRetryStrategy>(config.retryStrategy)) { }
 
+    ~MockAWSClient() { StopAsyncRequests(); }
+
     Aws::Client::HttpResponseOutcome MakeRequest(const AmazonWebServiceRequest& request)
     {
         m_countedRetryStrategy->ResetAttemptedRetriesCount();
@@ -95,6 +97,14 @@ public:
         return httpOutcome;
     }
 
+    void MakeRequestAsync(const std::shared_ptr<const AmazonWebServiceRequest>& request, const HttpResponseOutcomeReceivedHandler& handler)
+    {
+        m_countedRetryStrategy->ResetAttemptedRetriesCount();
+        const URI uri("domain.com/something");
+        const auto method = HttpMethod::HTTP_GET;
+        AWSClient::AttemptExhaustivelyAsync(uri, request, method, Aws::Auth::SIGV4_SIGNER, handler);
+    }
+
     inline static const char* GetMockAccessKey() { return "AKIDEXAMPLE"; }
     inline static const char* GetMockSecretAccessKey() { return "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"; }
 
@@ -0,0 +1,125 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#ifndef _WIN32
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+
+/**
+ * Minimal keep-alive http server on a loopback port, counting connections and requests. Each request is answered with what the responder
+ * returns for its request line, an empty 200 by default. Request bodies are not read, so it only serves requests without one.
+ */
+class LoopbackHttpServer
+{
+public:
+    typedef std::function<std::string(const std::string& requestLine)> Responder;
+
+    LoopbackHttpServer(const Responder& responder = RespondEmptyOk) :
+        m_responder(responder), m_listenSocket(socket(AF_INET, SOCK_STREAM, 0)), m_port(0), m_connections(0), m_requests(0)
+    {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addressLength = sizeof(address);
+        if (bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), addressLength) == 0 && listen(m_listenSocket, 8) == 0 &&
+            getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0)
+        {
+            m_port = ntohs(address.sin_port);
+            m_acceptThread = std::thread(&LoopbackHttpServer::Accept, this);
+        }
+    }
+
+    ~LoopbackHttpServer()
+    {
+        shutdown(m_listenSocket, SHUT_RDWR);
+        close(m_listenSocket);
+        if (m_acceptThread.joinable())
+        {
+            m_acceptThread.join();
+        }
+        for (auto& connection : m_connectionThreads)
+        {
+            connection.join();
+        }
+    }
+
+    Aws::String GetEndpoint() const { return "http://127.0.0.1:" + Aws::Utils::StringUtils::to_string(m_port); }
+    unsigned short GetPort() const { return m_port; }
+    int GetConnectionCount() const { return m_connections.load(); }
+    int GetRequestCount() const { return m_requests.load(); }
+
+    static std::string RespondEmptyOk(const std::string&)
+    {
+        return "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+    }
+
+private:
+    void Accept()
+    {
+        for (;;)
+        {
+            int connectionSocket = accept(m_listenSocket, nullptr, nullptr);
+            if (connectionSocket < 0)
+            {
+                return;
+            }
+            ++m_connections;
+            m_connectionThreads.emplace_back(&LoopbackHttpServer::Serve, this, connectionSocket);
+        }
+    }
+
+    void Serve(int connectionSocket)
+    {
+        std::string received;
+        char buffer[1024];
+        ssize_t bytesRead = 0;
+        while ((bytesRead = recv(connectionSocket, buffer, sizeof(buffer), 0)) > 0)
+        {
+            received.append(buffer, static_cast<size_t>(bytesRead));
+            for (size_t headerEnd = received.find("\r\n\r\n"); headerEnd != std::string::npos; headerEnd = received.find("\r\n\r\n"))
+            {
+                std::string response = m_responder(received.substr(0, received.find("\r\n")));
+                received.erase(0, headerEnd + 4);
+                ++m_requests;
+                if (send(connectionSocket, response.c_str(), response.size(), 0) < 0)
+                {
+                    break;
+                }
+            }
+        }
+        close(connectionSocket);
+    }
+
+    Responder m_responder;
+    int m_listenSocket;
+    unsigned short m_port;
+    std::atomic<int> m_connections;
+    std::atomic<int> m_requests;
+    std::thread m_acceptThread;
+    // only touched by the accept thread until it has been joined.
+    Aws::Vector<std::thread> m_connectionThreads;
+};
+#endif
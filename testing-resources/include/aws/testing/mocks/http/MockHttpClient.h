@@ -29,6 +29,8 @@ static const char* MockHttpAllocationTag = "MockHttp";
 class MockHttpClient : public Aws::Http::HttpClient
 {
 public:
+    MockHttpClient() : m_supportsAsyncRequests(false) {}
+
     std::shared_ptr<Aws::Http::HttpResponse> MakeRequest(Aws::Http::HttpRequest& request,
                                                          Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr, 
                                                          Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
@@ -63,6 +65,10 @@ public:
         return nullptr;
     }
 
+    bool SupportsAsyncRequests() const override { return m_supportsAsyncRequests; }
+    //lets tests drive the non-blocking request path of AWSClient, responses are still handed back on the calling thread.
+    void SetSupportsAsyncRequests(bool value) { m_supportsAsyncRequests = value; }
+
     const Aws::Http::Standard::StandardHttpRequest& GetMostRecentHttpRequest() const { return m_requestsMade.back(); }
     const Aws::Vector<Aws::Http::Standard::StandardHttpRequest>& GetAllRequestsMade() const { return m_requestsMade; }
 
@@ -80,6 +86,7 @@ public:
 private:
     mutable Aws::Vector<Aws::Http::Standard::StandardHttpRequest> m_requestsMade;
     mutable Aws::Queue< std::shared_ptr<Aws::Http::HttpResponse> > m_responsesToUse;
+    bool m_supportsAsyncRequests;
 };
 
 class MockHttpClientFactory : public Aws::Http::HttpClientFactory